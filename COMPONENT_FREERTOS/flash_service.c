@@ -0,0 +1,896 @@
+/******************************************************************************
+* File Name:   flash_service.c
+*
+* Description: Flash service task of the FreeRTOS variant. Tasks queue read,
+*              write and erase requests; the service merges adjacent reads,
+*              serves each priority class in address order and signals
+*              completion with task notifications.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+
+#include "flash_service.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "flash_suspend.h"
+#include "queue.h"
+#include "smif_mmio.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Demo: a table of FLASH_SERVICE_DEMO_TABLE_SIZE bytes read by
+ * FLASH_SERVICE_DEMO_READERS tasks in FLASH_SERVICE_DEMO_RECORD_SIZE records,
+ * a control task reading it every FLASH_SERVICE_DEMO_CTRL_PERIOD_MS and a
+ * logger writing FLASH_SERVICE_DEMO_LOG_RECORD_SIZE records into the next
+ * sector every FLASH_SERVICE_DEMO_LOG_PERIOD_MS.
+ */
+#define FLASH_SERVICE_DEMO_TABLE_SIZE       (16u * 1024u)
+#define FLASH_SERVICE_DEMO_RECORD_SIZE      (64u)
+#define FLASH_SERVICE_DEMO_READERS          (4u)
+#define FLASH_SERVICE_DEMO_CTRL_PERIOD_MS   (10u)
+#define FLASH_SERVICE_DEMO_CTRL_SIZE        (16u)
+#define FLASH_SERVICE_DEMO_LOG_SIZE         (32u * 1024u)
+#define FLASH_SERVICE_DEMO_LOG_RECORD_SIZE  (256u)
+#define FLASH_SERVICE_DEMO_LOG_PERIOD_MS    (20u)
+#define FLASH_SERVICE_DEMO_REPORT_MS        (2000u)
+
+#define FLASH_SERVICE_DEMO_TASK_PRIORITY    (FLASH_SERVICE_TASK_PRIORITY)
+#define FLASH_SERVICE_DEMO_CTRL_PRIORITY    (FLASH_SERVICE_TASK_PRIORITY + 1u)
+#define FLASH_SERVICE_DEMO_STACK_SIZE       (configMINIMAL_STACK_SIZE * 2u)
+#define FLASH_SERVICE_DEMO_MONITOR_STACK    (configMINIMAL_STACK_SIZE * 4u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static QueueHandle_t service_queue;
+
+/* Requests taken from the queue, one list per class sorted by address. Only
+ * accessed by the service task.
+ */
+static flash_service_req_t *service_pending[FLASH_SERVICE_PRIO_COUNT];
+static uint32_t service_pending_count;
+
+/* Write or erase in progress and how far it got */
+static flash_service_req_t *service_active;
+static uint32_t service_active_offset;
+
+/* End of the last range served; each class is scanned upwards from here */
+static uint32_t service_head_addr;
+
+static flash_service_stats_t service_stats;
+
+CY_ALIGN(4) static uint8_t service_bounce[FLASH_SERVICE_MERGE_SIZE];
+
+static uint32_t demo_table_addr;
+static uint32_t demo_log_addr;
+static volatile uint32_t demo_errors;
+static volatile uint32_t demo_ctrl_max_cycles;
+
+/*******************************************************************************
+* Function Name: service_complete
+****************************************************************************//**
+* Summary:
+*  Hands a request back to its task. The request may be reused as soon as done
+*  is set, so it is not accessed afterwards.
+*
+*******************************************************************************/
+static void service_complete(flash_service_req_t *req, cy_rslt_t result)
+{
+    TaskHandle_t task = req->task;
+
+    req->result = result;
+    req->done = true;
+    (void)xTaskNotify(task, FLASH_SERVICE_NOTIFY_BIT, eSetBits);
+}
+
+/*******************************************************************************
+* Function Name: service_insert
+****************************************************************************//**
+* Summary:
+*  Adds a request to the list of its class, after the requests at the same or
+*  lower addresses.
+*
+*******************************************************************************/
+static void service_insert(flash_service_req_t *req)
+{
+    flash_service_req_t **link = &service_pending[req->prio];
+
+    while((NULL != *link) && ((*link)->addr <= req->addr))
+    {
+        link = &(*link)->next;
+    }
+
+    req->next = *link;
+    *link = req;
+
+    service_pending_count++;
+    service_stats.requests[req->prio]++;
+
+    if(service_pending_count > service_stats.max_pending)
+    {
+        service_stats.max_pending = service_pending_count;
+    }
+}
+
+/*******************************************************************************
+* Function Name: service_is_eligible
+****************************************************************************//**
+* Summary:
+*  Returns true if a request can be served now. While a write or erase is in
+*  progress, only reads outside its range can, by suspending it.
+*
+*******************************************************************************/
+static bool service_is_eligible(const flash_service_req_t *req)
+{
+    if(NULL == service_active)
+    {
+        return true;
+    }
+
+    /* The last sector erased may extend past the end of the range */
+    uint32_t active_end = service_active->addr +
+                          ((service_active_offset > service_active->length) ? service_active_offset :
+                           service_active->length);
+
+    return (FLASH_SERVICE_OP_READ == req->op) &&
+           (((req->addr + req->length) <= service_active->addr) || (req->addr >= active_end));
+}
+
+/*******************************************************************************
+* Function Name: service_select
+****************************************************************************//**
+* Summary:
+*  Returns the link to the next request to serve: the eligible request of the
+*  highest non-empty class at or above service_head_addr, or the lowest one of
+*  that class if there is none above (circular scan). Returns NULL if nothing
+*  can be served now.
+*
+*******************************************************************************/
+static flash_service_req_t **service_select(void)
+{
+    for(uint32_t prio = 0u; prio < (uint32_t)FLASH_SERVICE_PRIO_COUNT; prio++)
+    {
+        flash_service_req_t **wrap = NULL;
+
+        for(flash_service_req_t **link = &service_pending[prio]; NULL != *link; link = &(*link)->next)
+        {
+            if(!service_is_eligible(*link))
+            {
+                continue;
+            }
+
+            if((*link)->addr >= service_head_addr)
+            {
+                return link;
+            }
+
+            if(NULL == wrap)
+            {
+                wrap = link;
+            }
+        }
+
+        if(NULL != wrap)
+        {
+            return wrap;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: service_read
+****************************************************************************//**
+* Summary:
+*  Serves the read request at link together with the reads following it in
+*  its class that start within FLASH_SERVICE_MERGE_GAP bytes of the span so
+*  far, as long as the span fits in the bounce buffer. A single request is
+*  read directly into its buffer.
+*
+*******************************************************************************/
+static void service_read(flash_service_req_t **link)
+{
+    flash_service_req_t *first = *link;
+    flash_service_req_t *last = first;
+    uint32_t span_end = first->addr + first->length;
+    cy_rslt_t result;
+
+    while(NULL != last->next)
+    {
+        const flash_service_req_t *cand = last->next;
+        uint32_t cand_end = cand->addr + cand->length;
+
+        if(cand_end < span_end)
+        {
+            cand_end = span_end;
+        }
+
+        if((FLASH_SERVICE_OP_READ != cand->op) || (cand->addr > (span_end + FLASH_SERVICE_MERGE_GAP)) ||
+           ((cand_end - first->addr) > FLASH_SERVICE_MERGE_SIZE) || !service_is_eligible(cand))
+        {
+            break;
+        }
+
+        last = last->next;
+        span_end = cand_end;
+    }
+
+    *link = last->next;
+    last->next = NULL;
+
+    if(first == last)
+    {
+        result = flash_suspend_read(first->addr, first->length, first->buf);
+    }
+    else
+    {
+        result = flash_suspend_read(first->addr, span_end - first->addr, service_bounce);
+    }
+
+    service_stats.read_transfers++;
+    if(NULL != service_active)
+    {
+        service_stats.reads_during_op++;
+    }
+    service_head_addr = span_end;
+
+    for(flash_service_req_t *req = first; NULL != req; )
+    {
+        flash_service_req_t *next = req->next;
+
+        if((first != last) && (CY_RSLT_SUCCESS == result))
+        {
+            (void)memcpy(req->buf, &service_bounce[req->addr - first->addr], req->length);
+        }
+
+        if(req != first)
+        {
+            service_stats.merged_reads++;
+        }
+
+        service_pending_count--;
+        service_complete(req, result);
+        req = next;
+    }
+}
+
+/*******************************************************************************
+* Function Name: service_advance
+****************************************************************************//**
+* Summary:
+*  Once the page program or sector erase started last has finished, starts the
+*  next one of the active request, or completes it.
+*
+*******************************************************************************/
+static void service_advance(void)
+{
+    flash_service_req_t *req = service_active;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if(flash_suspend_is_busy())
+    {
+        return;
+    }
+
+    if(service_active_offset < req->length)
+    {
+        uint32_t addr = req->addr + service_active_offset;
+
+        if(FLASH_SERVICE_OP_ERASE == req->op)
+        {
+            uint32_t erase_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(addr);
+
+            result = flash_suspend_erase_start(addr);
+            service_active_offset += erase_size - (addr % erase_size);
+        }
+        else
+        {
+            uint32_t page_size = smif_mmio_get_page_size();
+            uint32_t chunk = page_size - (addr % page_size);
+
+            if(chunk > (req->length - service_active_offset))
+            {
+                chunk = req->length - service_active_offset;
+            }
+
+            result = flash_suspend_program_start(addr, &req->buf[service_active_offset], chunk);
+            service_active_offset += chunk;
+        }
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            return;
+        }
+    }
+
+    service_active = NULL;
+    service_head_addr = req->addr + req->length;
+    service_complete(req, result);
+}
+
+/*******************************************************************************
+* Function Name: service_dispatch
+****************************************************************************//**
+* Summary:
+*  Serves the request at link: reads complete before returning, writes and
+*  erases are started and then advanced by service_advance().
+*
+*******************************************************************************/
+static void service_dispatch(flash_service_req_t **link)
+{
+    flash_service_req_t *req = *link;
+
+    if(FLASH_SERVICE_OP_READ == req->op)
+    {
+        service_read(link);
+        return;
+    }
+
+    *link = req->next;
+    req->next = NULL;
+    service_pending_count--;
+
+    if(FLASH_SERVICE_OP_WRITE == req->op)
+    {
+        service_stats.writes++;
+    }
+    else
+    {
+        service_stats.erases++;
+    }
+
+    service_active = req;
+    service_active_offset = 0u;
+    service_advance();
+}
+
+/*******************************************************************************
+* Function Name: service_task
+****************************************************************************//**
+* Summary:
+*  Takes every request queued so far, so that they are ordered and merged
+*  together, then serves one. Blocks on the queue when there is nothing to
+*  serve, for FLASH_SERVICE_POLL_MS at most while a write or erase is in
+*  progress.
+*
+*******************************************************************************/
+static void service_task(void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    for(;;)
+    {
+        flash_service_req_t *req;
+        TickType_t wait = portMAX_DELAY;
+
+        if(NULL != service_select())
+        {
+            wait = 0u;
+        }
+        else if(NULL != service_active)
+        {
+            wait = pdMS_TO_TICKS(FLASH_SERVICE_POLL_MS);
+        }
+
+        if(pdTRUE == xQueueReceive(service_queue, &req, wait))
+        {
+            do
+            {
+                service_insert(req);
+            } while(pdTRUE == xQueueReceive(service_queue, &req, 0u));
+        }
+
+        if(NULL != service_active)
+        {
+            service_advance();
+        }
+
+        flash_service_req_t **link = service_select();
+
+        if(NULL != link)
+        {
+            service_dispatch(link);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: flash_service_init
+****************************************************************************//**
+* Summary:
+*  Creates the queue and the service task. Call in MMIO mode after
+*  cy_serial_flash_qspi_init(), before or after the scheduler is started. From
+*  then on, the external memory must only be accessed through the service.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t flash_service_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    if(NULL != service_queue)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    cy_rslt_t result = flash_suspend_init(mem_config);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    service_queue = xQueueCreate(FLASH_SERVICE_QUEUE_LENGTH, sizeof(flash_service_req_t *));
+
+    if(NULL == service_queue)
+    {
+        return FLASH_SERVICE_RSLT_ERR_RTOS;
+    }
+
+    if(pdPASS != xTaskCreate(service_task, "flash service", FLASH_SERVICE_TASK_STACK_SIZE, NULL,
+                             FLASH_SERVICE_TASK_PRIORITY, NULL))
+    {
+        return FLASH_SERVICE_RSLT_ERR_RTOS;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: flash_service_submit
+****************************************************************************//**
+* Summary:
+*  Queues a request from the calling task and returns without waiting for it
+*  to be served. The request and its buffer belong to the service until
+*  req->done is set; the task is then notified with FLASH_SERVICE_NOTIFY_BIT.
+*  Requests of different classes, and of one class at different addresses,
+*  may complete in any order, so a task must wait for a write or erase before
+*  submitting a request overlapping it. Writes and erases are not suspended
+*  by later ones, whatever their class; reads outside their range are served
+*  while they are in progress.
+*
+* Parameters:
+*  req - request with op, prio, addr, length and buf set. Erases must start on
+*        a sector boundary.
+*  timeout - ticks to wait for room in the queue.
+*
+*******************************************************************************/
+cy_rslt_t flash_service_submit(flash_service_req_t *req, TickType_t timeout)
+{
+    if(NULL == service_queue)
+    {
+        return FLASH_SERVICE_RSLT_ERR_NOT_INIT;
+    }
+
+    if((NULL == req) || (req->prio >= FLASH_SERVICE_PRIO_COUNT) || (req->op > FLASH_SERVICE_OP_ERASE) ||
+       (0u == req->length) || ((req->addr + req->length) < req->addr) ||
+       ((FLASH_SERVICE_OP_ERASE != req->op) && (NULL == req->buf)))
+    {
+        return FLASH_SERVICE_RSLT_ERR_BAD_PARAM;
+    }
+
+    if((FLASH_SERVICE_OP_ERASE == req->op) &&
+       (0u != (req->addr % (uint32_t)cy_serial_flash_qspi_get_erase_size(req->addr))))
+    {
+        return FLASH_SERVICE_RSLT_ERR_BAD_PARAM;
+    }
+
+    req->task = xTaskGetCurrentTaskHandle();
+    req->done = false;
+    req->result = CY_RSLT_SUCCESS;
+    req->next = NULL;
+
+    if(pdTRUE != xQueueSend(service_queue, &req, timeout))
+    {
+        return FLASH_SERVICE_RSLT_ERR_QUEUE_FULL;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: flash_service_wait
+****************************************************************************//**
+* Summary:
+*  Blocks until a request submitted by the calling task has been served.
+*  After a timeout the request still belongs to the service; wait again
+*  before reusing it.
+*
+* Parameters:
+*  req - request passed to flash_service_submit().
+*  timeout - ticks to wait.
+*
+* Return:
+*  The result of the request, or FLASH_SERVICE_RSLT_ERR_TIMEOUT.
+*
+*******************************************************************************/
+cy_rslt_t flash_service_wait(flash_service_req_t *req, TickType_t timeout)
+{
+    TimeOut_t start;
+
+    vTaskSetTimeOutState(&start);
+
+    /* The bit may also be left over from an earlier request of the task */
+    while(!req->done)
+    {
+        if((pdFALSE != xTaskCheckForTimeOut(&start, &timeout)) ||
+           (pdTRUE != xTaskNotifyWait(0u, FLASH_SERVICE_NOTIFY_BIT, NULL, timeout)))
+        {
+            return req->done ? req->result : FLASH_SERVICE_RSLT_ERR_TIMEOUT;
+        }
+    }
+
+    return req->result;
+}
+
+/*******************************************************************************
+* Function Name: flash_service_transfer
+****************************************************************************//**
+* Summary:
+*  Submits a request and waits for it.
+*
+* Parameters:
+*  op - operation.
+*  prio - class of the request.
+*  addr - external memory address.
+*  buf - data to write or buffer to read into; unused for erases.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t flash_service_transfer(flash_service_op_t op, flash_service_prio_t prio, uint32_t addr, uint8_t *buf,
+                                 uint32_t length)
+{
+    flash_service_req_t req =
+    {
+        .op = op,
+        .prio = prio,
+        .addr = addr,
+        .length = length,
+        .buf = buf,
+    };
+
+    cy_rslt_t result = flash_service_submit(&req, portMAX_DELAY);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    return flash_service_wait(&req, portMAX_DELAY);
+}
+
+/*******************************************************************************
+* Function Name: flash_service_get_stats
+****************************************************************************//**
+* Summary:
+*  Copies the counters since flash_service_init().
+*
+*******************************************************************************/
+void flash_service_get_stats(flash_service_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = service_stats;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: demo_pattern
+****************************************************************************//**
+* Summary:
+*  Returns the byte the demo table holds at an offset.
+*
+*******************************************************************************/
+static uint8_t demo_pattern(uint32_t offset)
+{
+    return (uint8_t)((offset * 7u) ^ (offset >> 8u));
+}
+
+/*******************************************************************************
+* Function Name: demo_check
+****************************************************************************//**
+* Summary:
+*  Counts an error if a transfer failed or read data that is not the table.
+*
+*******************************************************************************/
+static void demo_check(cy_rslt_t result, uint32_t offset, const uint8_t *data, uint32_t length)
+{
+    bool ok = (CY_RSLT_SUCCESS == result);
+
+    for(uint32_t index = 0u; ok && (index < length); index++)
+    {
+        ok = (data[index] == demo_pattern(offset + index));
+    }
+
+    if(!ok)
+    {
+        demo_errors++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: demo_program_table
+****************************************************************************//**
+* Summary:
+*  Erases the table sector and programs the pattern. Runs before the
+*  scheduler is started.
+*
+*******************************************************************************/
+static cy_rslt_t demo_program_table(void)
+{
+    uint8_t page[FLASH_SERVICE_DEMO_LOG_RECORD_SIZE];
+    cy_rslt_t result = cy_serial_flash_qspi_erase(demo_table_addr,
+                                                  cy_serial_flash_qspi_get_erase_size(demo_table_addr));
+
+    for(uint32_t offset = 0u; (CY_RSLT_SUCCESS == result) && (offset < FLASH_SERVICE_DEMO_TABLE_SIZE);
+        offset += sizeof(page))
+    {
+        for(uint32_t index = 0u; index < sizeof(page); index++)
+        {
+            page[index] = demo_pattern(offset + index);
+        }
+
+        result = cy_serial_flash_qspi_write(demo_table_addr + offset, sizeof(page), page);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: demo_reader_task
+****************************************************************************//**
+* Summary:
+*  Reads the table in records, interleaved with the other readers so that
+*  their requests are adjacent.
+*
+*******************************************************************************/
+static void demo_reader_task(void *arg)
+{
+    uint8_t record[FLASH_SERVICE_DEMO_RECORD_SIZE];
+    uint32_t offset = (uint32_t)(uintptr_t)arg * FLASH_SERVICE_DEMO_RECORD_SIZE;
+
+    for(;;)
+    {
+        cy_rslt_t result = flash_service_transfer(FLASH_SERVICE_OP_READ, FLASH_SERVICE_PRIO_NORMAL,
+                                                  demo_table_addr + offset, record, sizeof(record));
+
+        demo_check(result, offset, record, sizeof(record));
+        offset = (offset + (FLASH_SERVICE_DEMO_READERS * FLASH_SERVICE_DEMO_RECORD_SIZE)) %
+                 FLASH_SERVICE_DEMO_TABLE_SIZE;
+    }
+}
+
+/*******************************************************************************
+* Function Name: demo_ctrl_task
+****************************************************************************//**
+* Summary:
+*  Reads the end of the table every FLASH_SERVICE_DEMO_CTRL_PERIOD_MS in the
+*  high class and records the worst latency.
+*
+*******************************************************************************/
+static void demo_ctrl_task(void *arg)
+{
+    uint8_t data[FLASH_SERVICE_DEMO_CTRL_SIZE];
+    uint32_t offset = FLASH_SERVICE_DEMO_TABLE_SIZE - sizeof(data);
+    TickType_t wake = xTaskGetTickCount();
+
+    CY_UNUSED_PARAMETER(arg);
+
+    for(;;)
+    {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(FLASH_SERVICE_DEMO_CTRL_PERIOD_MS));
+
+        uint32_t start = cycle_counter_get();
+        cy_rslt_t result = flash_service_transfer(FLASH_SERVICE_OP_READ, FLASH_SERVICE_PRIO_HIGH,
+                                                  demo_table_addr + offset, data, sizeof(data));
+        uint32_t cycles = cycle_counter_get() - start;
+
+        demo_check(result, offset, data, sizeof(data));
+        if(cycles > demo_ctrl_max_cycles)
+        {
+            demo_ctrl_max_cycles = cycles;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: demo_logger_task
+****************************************************************************//**
+* Summary:
+*  Appends a record to the log every FLASH_SERVICE_DEMO_LOG_PERIOD_MS in the
+*  low class and reads it back, erasing the log sector before each pass.
+*
+*******************************************************************************/
+static void demo_logger_task(void *arg)
+{
+    uint8_t record[FLASH_SERVICE_DEMO_LOG_RECORD_SIZE];
+    uint8_t check[FLASH_SERVICE_DEMO_LOG_RECORD_SIZE];
+    uint32_t offset = 0u;
+    uint32_t sequence = 0u;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    for(;;)
+    {
+        cy_rslt_t result = CY_RSLT_SUCCESS;
+
+        if(0u == offset)
+        {
+            result = flash_service_transfer(FLASH_SERVICE_OP_ERASE, FLASH_SERVICE_PRIO_LOW, demo_log_addr, NULL,
+                                            FLASH_SERVICE_DEMO_LOG_SIZE);
+        }
+
+        (void)memset(record, (int)(sequence & 0xFFu), sizeof(record));
+        (void)memcpy(record, &sequence, sizeof(sequence));
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = flash_service_transfer(FLASH_SERVICE_OP_WRITE, FLASH_SERVICE_PRIO_LOW, demo_log_addr + offset,
+                                            record, sizeof(record));
+        }
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = flash_service_transfer(FLASH_SERVICE_OP_READ, FLASH_SERVICE_PRIO_LOW, demo_log_addr + offset,
+                                            check, sizeof(check));
+        }
+
+        if((CY_RSLT_SUCCESS != result) || (0 != memcmp(record, check, sizeof(record))))
+        {
+            demo_errors++;
+        }
+
+        sequence++;
+        offset = (offset + sizeof(record)) % FLASH_SERVICE_DEMO_LOG_SIZE;
+        vTaskDelay(pdMS_TO_TICKS(FLASH_SERVICE_DEMO_LOG_PERIOD_MS));
+    }
+}
+
+/*******************************************************************************
+* Function Name: demo_monitor_task
+****************************************************************************//**
+* Summary:
+*  Prints the service counters every FLASH_SERVICE_DEMO_REPORT_MS.
+*
+*******************************************************************************/
+static void demo_monitor_task(void *arg)
+{
+    flash_service_stats_t stats;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    for(;;)
+    {
+        vTaskDelay(pdMS_TO_TICKS(FLASH_SERVICE_DEMO_REPORT_MS));
+
+        uint32_t ctrl_us = cycle_counter_to_us(demo_ctrl_max_cycles);
+
+        demo_ctrl_max_cycles = 0u;
+        flash_service_get_stats(&stats);
+
+        printf("Requests high/normal/low %"PRIu32"/%"PRIu32"/%"PRIu32", read transfers %"PRIu32
+               " (%"PRIu32" merged reads, %"PRIu32" during program/erase)\n", stats.requests[FLASH_SERVICE_PRIO_HIGH],
+               stats.requests[FLASH_SERVICE_PRIO_NORMAL], stats.requests[FLASH_SERVICE_PRIO_LOW],
+               stats.read_transfers, stats.merged_reads, stats.reads_during_op);
+        printf("Writes %"PRIu32", erases %"PRIu32", max pending %"PRIu32", control read max %"PRIu32" us, "
+               "errors %"PRIu32"\n", stats.writes, stats.erases, stats.max_pending, ctrl_us, demo_errors);
+    }
+}
+
+/*******************************************************************************
+* Function Name: flash_service_demo_start
+****************************************************************************//**
+* Summary:
+*  Programs the demo table in the sector at ext_addr, starts the service and
+*  the demo tasks, and starts the scheduler. The log is kept in the next
+*  sector. Both sectors are overwritten. Must be called in MMIO mode after
+*  cy_serial_flash_qspi_init().
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*  ext_addr - start of a sector followed by another one.
+*
+* Return:
+*  Does not return unless an error occurred.
+*
+*******************************************************************************/
+cy_rslt_t flash_service_demo_start(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr)
+{
+    uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(ext_addr);
+    bool created = true;
+
+    if((0u != (ext_addr % sector_size)) || (FLASH_SERVICE_DEMO_TABLE_SIZE > sector_size) ||
+       (FLASH_SERVICE_DEMO_LOG_SIZE > (uint32_t)cy_serial_flash_qspi_get_erase_size(ext_addr + sector_size)))
+    {
+        return FLASH_SERVICE_RSLT_ERR_BAD_PARAM;
+    }
+
+    demo_table_addr = ext_addr;
+    demo_log_addr = ext_addr + sector_size;
+
+    cy_rslt_t result = demo_program_table();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = flash_service_init(mem_config);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    cycle_counter_init();
+
+    for(uint32_t index = 0u; created && (index < FLASH_SERVICE_DEMO_READERS); index++)
+    {
+        char name[configMAX_TASK_NAME_LEN];
+
+        (void)snprintf(name, sizeof(name), "reader %"PRIu32, index);
+        created = (pdPASS == xTaskCreate(demo_reader_task, name, FLASH_SERVICE_DEMO_STACK_SIZE,
+                                         (void *)(uintptr_t)index, FLASH_SERVICE_DEMO_TASK_PRIORITY, NULL));
+    }
+
+    created = created && (pdPASS == xTaskCreate(demo_ctrl_task, "control", FLASH_SERVICE_DEMO_STACK_SIZE, NULL,
+                                                FLASH_SERVICE_DEMO_CTRL_PRIORITY, NULL));
+    created = created && (pdPASS == xTaskCreate(demo_logger_task, "logger", FLASH_SERVICE_DEMO_STACK_SIZE, NULL,
+                                                FLASH_SERVICE_DEMO_TASK_PRIORITY, NULL));
+    created = created && (pdPASS == xTaskCreate(demo_monitor_task, "monitor", FLASH_SERVICE_DEMO_MONITOR_STACK,
+                                                NULL, FLASH_SERVICE_DEMO_CTRL_PRIORITY, NULL));
+
+    if(!created)
+    {
+        return FLASH_SERVICE_RSLT_ERR_RTOS;
+    }
+
+    printf("%"PRIu32" readers (normal), control read every %"PRIu32" ms (high), logger every %"PRIu32
+           " ms (low)\n", (uint32_t)FLASH_SERVICE_DEMO_READERS, (uint32_t)FLASH_SERVICE_DEMO_CTRL_PERIOD_MS,
+           (uint32_t)FLASH_SERVICE_DEMO_LOG_PERIOD_MS);
+
+    vTaskStartScheduler();
+
+    /* Only reached if the idle or timer task could not be created */
+    return FLASH_SERVICE_RSLT_ERR_RTOS;
+}
+
+/* [] END OF FILE */
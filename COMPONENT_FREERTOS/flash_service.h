@@ -0,0 +1,157 @@
+/******************************************************************************
+* File Name:   flash_service.h
+*
+* Description: Flash service task of the FreeRTOS variant. Tasks queue read,
+*              write and erase requests; the service merges adjacent reads,
+*              serves each priority class in address order and signals
+*              completion with task notifications.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef FLASH_SERVICE_H
+#define FLASH_SERVICE_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* FreeRTOS priority and stack size (words) of the service task. Requests are
+ * only ordered and merged if they queue up while the tasks submitting them
+ * run, so it should not be above those tasks: it would then take every
+ * request alone as soon as it is sent.
+ */
+#define FLASH_SERVICE_TASK_PRIORITY     (tskIDLE_PRIORITY + 2u)
+#define FLASH_SERVICE_TASK_STACK_SIZE   (configMINIMAL_STACK_SIZE * 2u)
+
+/* Requests that can be submitted before the service picks them up */
+#define FLASH_SERVICE_QUEUE_LENGTH      (16u)
+
+/* Largest span read in one transfer when adjacent reads are merged, and the
+ * largest gap between two reads that is read along to merge them.
+ */
+#define FLASH_SERVICE_MERGE_SIZE        (1024u)
+#define FLASH_SERVICE_MERGE_GAP         (32u)
+
+/* Interval at which a program or erase in progress is polled */
+#define FLASH_SERVICE_POLL_MS           (1u)
+
+/* Notification bit the service sets in the submitting task on completion */
+#define FLASH_SERVICE_NOTIFY_BIT        (1uL << 31u)
+
+#define FLASH_SERVICE_RSLT_ERR_BAD_PARAM    APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SERVICE, 1u)
+#define FLASH_SERVICE_RSLT_ERR_NOT_INIT     APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SERVICE, 2u)
+#define FLASH_SERVICE_RSLT_ERR_QUEUE_FULL   APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SERVICE, 3u)
+#define FLASH_SERVICE_RSLT_ERR_TIMEOUT      APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SERVICE, 4u)
+#define FLASH_SERVICE_RSLT_ERR_RTOS         APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SERVICE, 5u)
+#define FLASH_SERVICE_RSLT_ERR_VERIFY       APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SERVICE, 6u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Classes are served strictly in this order; within a class, requests are
+ * served in ascending address order starting from the last address served.
+ */
+typedef enum
+{
+    FLASH_SERVICE_PRIO_HIGH,
+    FLASH_SERVICE_PRIO_NORMAL,
+    FLASH_SERVICE_PRIO_LOW,
+    FLASH_SERVICE_PRIO_COUNT
+} flash_service_prio_t;
+
+typedef enum
+{
+    FLASH_SERVICE_OP_READ,
+    FLASH_SERVICE_OP_WRITE,
+    FLASH_SERVICE_OP_ERASE      /* Every sector overlapping the range */
+} flash_service_op_t;
+
+/* Owned by the service from flash_service_submit() until done is set. The
+ * caller keeps it (and buf) valid until then, typically on its stack.
+ */
+typedef struct flash_service_req
+{
+    flash_service_op_t op;
+    flash_service_prio_t prio;
+    uint32_t addr;
+    uint32_t length;
+    uint8_t *buf;                       /* Unused for erases */
+    TaskHandle_t task;                  /* Set by flash_service_submit() */
+    volatile bool done;
+    volatile cy_rslt_t result;
+    struct flash_service_req *next;     /* Used by the service */
+} flash_service_req_t;
+
+typedef struct
+{
+    uint32_t requests[FLASH_SERVICE_PRIO_COUNT];
+    uint32_t read_transfers;    /* Transfers issued for read requests */
+    uint32_t merged_reads;      /* Read requests served by another one's transfer */
+    uint32_t reads_during_op;   /* Read transfers while a program or erase was in progress */
+    uint32_t writes;
+    uint32_t erases;
+    uint32_t max_pending;       /* Most requests waiting in the service at once */
+} flash_service_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t flash_service_init(const cy_stc_smif_mem_config_t *mem_config);
+cy_rslt_t flash_service_submit(flash_service_req_t *req, TickType_t timeout);
+cy_rslt_t flash_service_wait(flash_service_req_t *req, TickType_t timeout);
+cy_rslt_t flash_service_transfer(flash_service_op_t op, flash_service_prio_t prio, uint32_t addr, uint8_t *buf,
+                                 uint32_t length);
+void flash_service_get_stats(flash_service_stats_t *stats);
+cy_rslt_t flash_service_demo_start(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_SERVICE_H */
+
+/* [] END OF FILE */
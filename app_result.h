@@ -0,0 +1,98 @@
+/******************************************************************************
+* File Name:   app_result.h
+*
+* Description: This file defines the result codes returned by the application
+*              modules of this example.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef APP_RESULT_H
+#define APP_RESULT_H
+
+#include "cy_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Module identifier shared by all application modules */
+#define APP_RSLT_MODULE                 (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF0u)
+
+/* Each application module owns a 256-entry range of error codes */
+#define APP_RSLT_ERR(range, code)       CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, APP_RSLT_MODULE, \
+                                                       ((uint16_t)(range) << 8u) | (uint16_t)(code))
+
+/* Error code ranges */
+#define APP_RSLT_RANGE_XIP_BENCHMARK    (0x01u)
+#define APP_RSLT_RANGE_SMIF_MMIO        (0x02u)
+#define APP_RSLT_RANGE_QSPI_ASYNC       (0x03u)
+#define APP_RSLT_RANGE_QSPI_TUNING      (0x04u)
+#define APP_RSLT_RANGE_FLASH_BENCHMARK  (0x05u)
+#define APP_RSLT_RANGE_WRITE_COALESCE   (0x06u)
+#define APP_RSLT_RANGE_SMART_WRITE      (0x07u)
+#define APP_RSLT_RANGE_ERASE_PLANNER    (0x08u)
+#define APP_RSLT_RANGE_XIP_ASSET        (0x09u)
+#define APP_RSLT_RANGE_XIP_SWITCH       (0x0Au)
+#define APP_RSLT_RANGE_FLASH_SUSPEND    (0x0Bu)
+#define APP_RSLT_RANGE_QSPI_BUS         (0x0Cu)
+#define APP_RSLT_RANGE_XIP_READ_MODE    (0x0Du)
+#define APP_RSLT_RANGE_SMIF_CACHE       (0x0Eu)
+#define APP_RSLT_RANGE_MEM_SLOTS        (0x0Fu)
+#define APP_RSLT_RANGE_KV_STORE         (0x10u)
+#define APP_RSLT_RANGE_FLASH_LOG        (0x11u)
+#define APP_RSLT_RANGE_FAST_BOOT        (0x12u)
+#define APP_RSLT_RANGE_XIP_ZASSET       (0x13u)
+#define APP_RSLT_RANGE_FLASH_VERIFY     (0x14u)
+#define APP_RSLT_RANGE_SMIF_ARB         (0x15u)
+#define APP_RSLT_RANGE_XIP_CRYPTO       (0x16u)
+#define APP_RSLT_RANGE_FLASH_LOADER     (0x17u)
+#define APP_RSLT_RANGE_LOW_POWER        (0x18u)
+#define APP_RSLT_RANGE_QSPI_STREAM      (0x19u)
+#define APP_RSLT_RANGE_FLASH_SERVICE    (0x1Au)
+#define APP_RSLT_RANGE_WEAR_ALLOC       (0x1Bu)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* APP_RESULT_H */
+
+/* [] END OF FILE */
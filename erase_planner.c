@@ -0,0 +1,365 @@
+/******************************************************************************
+* File Name:   erase_planner.c
+*
+* Description: This file contains the erase planner. A range is rounded out
+*              to sector boundaries and split into one step per hybrid region
+*              it crosses, or replaced by a single chip erase when it covers
+*              the whole memory. Plans are executed through the direct SMIF
+*              command interface.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "erase_planner.h"
+#include "smart_write.h"
+#include "smif_mmio.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define ERASE_PLANNER_DEMO_OFFSET       (100u)
+#define ERASE_PLANNER_DEMO_SECTORS      (2u)
+
+/*******************************************************************************
+* Function Name: planner_locate
+****************************************************************************//**
+* Summary:
+*  Finds the sector map region that contains an address. Memories without
+*  hybrid regions are treated as one region of uniform sectors.
+*
+* Parameters:
+*  device - device configuration.
+*  addr - address to locate.
+*  step - receives the region start, sector size and erase time; the number
+*         of sectors up to the end of the region is returned in count.
+*
+* Return:
+*  true if the address is covered by the sector map.
+*
+*******************************************************************************/
+static bool planner_locate(const cy_stc_smif_mem_device_cfg_t *device, uint32_t addr, erase_plan_step_t *step)
+{
+    if(0u == device->hybridRegionCount)
+    {
+        step->addr = 0u;
+        step->sector_size = device->eraseSize;
+        step->count = device->memSize / device->eraseSize;
+        step->max_time_ms = device->eraseTime;
+
+        return (addr < device->memSize);
+    }
+
+    for(uint32_t index = 0; index < device->hybridRegionCount; index++)
+    {
+        const cy_stc_smif_hybrid_region_info_t *region = device->hybridRegionInfo[index];
+        uint32_t region_end = region->regionAddress + (region->sectorsCount * region->eraseSize);
+
+        if((addr >= region->regionAddress) && (addr < region_end))
+        {
+            step->addr = region->regionAddress;
+            step->sector_size = region->eraseSize;
+            step->count = region->sectorsCount;
+            step->max_time_ms = region->eraseTime;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: planner_wait_ready
+****************************************************************************//**
+* Summary:
+*  Polls the memory until the erase in progress completes or the timeout
+*  expires.
+*
+*******************************************************************************/
+static cy_rslt_t planner_wait_ready(uint32_t timeout_ms)
+{
+    uint32_t polls = ((timeout_ms * 1000u) / ERASE_PLANNER_POLL_US) + 1u;
+
+    while(smif_mmio_is_busy())
+    {
+        if(0u == polls--)
+        {
+            return ERASE_PLANNER_RSLT_ERR_TIMEOUT;
+        }
+
+        Cy_SysLib_DelayUs(ERASE_PLANNER_POLL_US);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: erase_planner_plan
+****************************************************************************//**
+* Summary:
+*  Computes the erase commands needed to erase [addr, addr + length). The
+*  range is rounded out to the boundaries of the sectors that contain its
+*  first and last bytes, so data outside the range in those sectors is lost.
+*  The range is split into one step per sector map region it crosses. When the
+*  rounded range covers the whole memory, the plan is a single chip erase.
+*
+* Parameters:
+*  mem_config - memory configuration, with the SFDP data already populated.
+*  addr - start of the range.
+*  length - length of the range.
+*  plan - receives the plan.
+*
+*******************************************************************************/
+cy_rslt_t erase_planner_plan(const cy_stc_smif_mem_config_t *mem_config, uint32_t addr, uint32_t length,
+                             erase_plan_t *plan)
+{
+    erase_plan_step_t region;
+
+    if((NULL == mem_config) || (NULL == mem_config->deviceCfg) || (NULL == plan) || (0u == length))
+    {
+        return ERASE_PLANNER_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_device_cfg_t *device = mem_config->deviceCfg;
+
+    if((addr >= device->memSize) || (length > (device->memSize - addr)))
+    {
+        return ERASE_PLANNER_RSLT_ERR_BAD_PARAM;
+    }
+
+    memset(plan, 0, sizeof(*plan));
+
+    /* Round the end up to the end of the sector holding the last byte */
+    uint32_t last = addr + length - 1u;
+
+    if(!planner_locate(device, last, &region))
+    {
+        return ERASE_PLANNER_RSLT_ERR_SECTOR_MAP;
+    }
+
+    plan->end = last - ((last - region.addr) % region.sector_size) + region.sector_size;
+
+    if(!planner_locate(device, addr, &region))
+    {
+        return ERASE_PLANNER_RSLT_ERR_SECTOR_MAP;
+    }
+
+    plan->start = addr - ((addr - region.addr) % region.sector_size);
+
+    if((0u == plan->start) && (device->memSize == plan->end))
+    {
+        plan->steps[0].op = ERASE_PLAN_OP_CHIP;
+        plan->steps[0].addr = 0u;
+        plan->steps[0].sector_size = device->memSize;
+        plan->steps[0].count = 1u;
+        plan->steps[0].max_time_ms = device->chipEraseTime;
+        plan->num_steps = 1u;
+        plan->num_commands = 1u;
+        plan->max_time_ms = device->chipEraseTime;
+
+        return CY_RSLT_SUCCESS;
+    }
+
+    uint32_t current = plan->start;
+
+    while(current < plan->end)
+    {
+        if(!planner_locate(device, current, &region))
+        {
+            return ERASE_PLANNER_RSLT_ERR_SECTOR_MAP;
+        }
+
+        if(ERASE_PLANNER_MAX_STEPS == plan->num_steps)
+        {
+            return ERASE_PLANNER_RSLT_ERR_SECTOR_MAP;
+        }
+
+        uint32_t region_end = region.addr + (region.count * region.sector_size);
+        uint32_t step_end = (plan->end < region_end) ? plan->end : region_end;
+        erase_plan_step_t *step = &plan->steps[plan->num_steps++];
+
+        step->op = ERASE_PLAN_OP_SECTORS;
+        step->addr = current;
+        step->sector_size = region.sector_size;
+        step->count = (step_end - current) / region.sector_size;
+        step->max_time_ms = region.max_time_ms;
+
+        plan->num_commands += step->count;
+        plan->max_time_ms += step->count * step->max_time_ms;
+
+        current = step_end;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: erase_planner_execute
+****************************************************************************//**
+* Summary:
+*  Issues the erase commands of a plan back to back, waiting for each one to
+*  complete. smif_mmio_init() must have been called with the configuration
+*  used to build the plan, and the SMIF must be in MMIO mode.
+*
+* Parameters:
+*  plan - plan returned by erase_planner_plan().
+*
+*******************************************************************************/
+cy_rslt_t erase_planner_execute(const erase_plan_t *plan)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if(NULL == plan)
+    {
+        return ERASE_PLANNER_RSLT_ERR_BAD_PARAM;
+    }
+
+    for(uint32_t index = 0; (index < plan->num_steps) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        const erase_plan_step_t *step = &plan->steps[index];
+
+        for(uint32_t sector = 0; (sector < step->count) && (CY_RSLT_SUCCESS == result); sector++)
+        {
+            result = (ERASE_PLAN_OP_CHIP == step->op) ? smif_mmio_chip_erase_start() :
+                     smif_mmio_sector_erase_start(step->addr + (sector * step->sector_size));
+
+            if(CY_RSLT_SUCCESS == result)
+            {
+                result = planner_wait_ready(step->max_time_ms);
+            }
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: erase_planner_print
+****************************************************************************//**
+* Summary:
+*  Prints the steps of a plan.
+*
+*******************************************************************************/
+void erase_planner_print(const erase_plan_t *plan)
+{
+    printf("  0x%08"PRIx32" - 0x%08"PRIx32": %"PRIu32" command(s), up to %"PRIu32" ms\n",
+           plan->start, plan->end, plan->num_commands, plan->max_time_ms);
+
+    for(uint32_t index = 0; index < plan->num_steps; index++)
+    {
+        const erase_plan_step_t *step = &plan->steps[index];
+
+        if(ERASE_PLAN_OP_CHIP == step->op)
+        {
+            printf("    chip erase\n");
+        }
+        else
+        {
+            printf("    0x%08"PRIx32": %"PRIu32" x %"PRIu32" KB sector erase\n", step->addr, step->count,
+                   step->sector_size / 1024u);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: erase_planner_demo
+****************************************************************************//**
+* Summary:
+*  Prints the plans for an unaligned range and for the whole memory, then
+*  executes the first one and checks that the rounded range is blank. Must be
+*  called in MMIO mode.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*  ext_addr - start of three sectors that may be erased.
+*
+*******************************************************************************/
+cy_rslt_t erase_planner_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr)
+{
+    erase_plan_t plan;
+    bool blank = false;
+    uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(ext_addr);
+
+    cy_rslt_t result = smif_mmio_init(mem_config);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = erase_planner_plan(mem_config, 0u, mem_config->deviceCfg->memSize, &plan);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("Whole memory:\n");
+        erase_planner_print(&plan);
+
+        result = erase_planner_plan(mem_config, ext_addr + ERASE_PLANNER_DEMO_OFFSET,
+                                    ERASE_PLANNER_DEMO_SECTORS * sector_size, &plan);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("%u bytes at offset %u of a sector:\n", (unsigned int)(ERASE_PLANNER_DEMO_SECTORS * sector_size),
+               (unsigned int)ERASE_PLANNER_DEMO_OFFSET);
+        erase_planner_print(&plan);
+
+        cycle_counter_init();
+        uint32_t start = cycle_counter_get();
+        result = erase_planner_execute(&plan);
+        uint32_t cycles = cycle_counter_get() - start;
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            printf("  executed in %"PRIu32" us\n", cycle_counter_to_us(cycles));
+            result = smart_write_is_blank(plan.start, plan.end - plan.start, &blank);
+        }
+    }
+
+    if((CY_RSLT_SUCCESS == result) && !blank)
+    {
+        result = ERASE_PLANNER_RSLT_ERR_VERIFY;
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name:   erase_planner.h
+*
+* Description: This file contains the declarations of the erase planner,
+*              which turns an arbitrary address range into the shortest
+*              sequence of erase commands allowed by the sector map of the
+*              memory.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef ERASE_PLANNER_H
+#define ERASE_PLANNER_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the erase planner demo before entering XIP mode */
+#ifndef ERASE_PLANNER_DEMO_ENABLE
+#define ERASE_PLANNER_DEMO_ENABLE           (0u)
+#endif
+
+/* Maximum number of steps in a plan: one per hybrid region crossed */
+#define ERASE_PLANNER_MAX_STEPS             (8u)
+
+/* Interval between status register polls while an erase is in progress */
+#define ERASE_PLANNER_POLL_US               (100u)
+
+#define ERASE_PLANNER_RSLT_ERR_BAD_PARAM    APP_RSLT_ERR(APP_RSLT_RANGE_ERASE_PLANNER, 1u)
+#define ERASE_PLANNER_RSLT_ERR_SECTOR_MAP   APP_RSLT_ERR(APP_RSLT_RANGE_ERASE_PLANNER, 2u)
+#define ERASE_PLANNER_RSLT_ERR_TIMEOUT      APP_RSLT_ERR(APP_RSLT_RANGE_ERASE_PLANNER, 3u)
+#define ERASE_PLANNER_RSLT_ERR_VERIFY       APP_RSLT_ERR(APP_RSLT_RANGE_ERASE_PLANNER, 4u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef enum
+{
+    ERASE_PLAN_OP_SECTORS,  /* Erase count consecutive sectors of one size */
+    ERASE_PLAN_OP_CHIP      /* Erase the whole memory with one command */
+} erase_plan_op_t;
+
+typedef struct
+{
+    erase_plan_op_t op;
+    uint32_t addr;              /* Address of the first sector */
+    uint32_t sector_size;       /* Size of each sector, or the memory size */
+    uint32_t count;             /* Number of erase commands in the step */
+    uint32_t max_time_ms;       /* Maximum time of one erase command */
+} erase_plan_step_t;
+
+typedef struct
+{
+    uint32_t start;             /* Range actually erased, rounded out to */
+    uint32_t end;               /* sector boundaries */
+    uint32_t num_steps;
+    uint32_t num_commands;      /* Total erase commands of the plan */
+    uint32_t max_time_ms;       /* Worst-case erase time of the plan */
+    erase_plan_step_t steps[ERASE_PLANNER_MAX_STEPS];
+} erase_plan_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t erase_planner_plan(const cy_stc_smif_mem_config_t *mem_config, uint32_t addr, uint32_t length,
+                             erase_plan_t *plan);
+cy_rslt_t erase_planner_execute(const erase_plan_t *plan);
+void erase_planner_print(const erase_plan_t *plan);
+cy_rslt_t erase_planner_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* ERASE_PLANNER_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,644 @@
+/******************************************************************************
+* File Name:   fast_boot.c
+*
+* Description: This file implements the fast-boot path. The SFDP parameters
+*              discovered on the first boot are cached in internal flash so
+*              that later boots initialize the QSPI memory without probing
+*              it, and the boot sequence is time-stamped up to the first
+*              instruction executed from XIP.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "fast_boot.h"
+#include "qspi_bus.h"
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define FB_MAGIC                        (0x31434246u)   /* "FBC1" */
+
+/* Command structures of cy_stc_smif_mem_device_cfg_t filled in by SFDP */
+#define FB_CMD_COUNT                    (10u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Followed by the device configuration, FB_CMD_COUNT commands (zero for a
+ * command the configuration does not have), the addresses of the hybrid
+ * region structures and the structures themselves.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t crc;               /* CRC-32 of the rest of the header and the payload */
+    uint32_t build_key;         /* Identifies the firmware that wrote the cache */
+    uint32_t device_cfg;        /* Address of the device configuration */
+    uint16_t cfg_size;
+    uint8_t cmd_size;
+    uint8_t region_size;
+    uint16_t region_count;
+    uint16_t length;            /* Payload bytes */
+} fb_header_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+CY_SECTION(".cy_xip_code") __attribute__((used, noinline)) static void fb_xip_entry(void);
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Programmed as zeros with the application, so flashing a new build always
+ * starts without a cache. Read through a volatile pointer because the flash
+ * driver rewrites it behind the compiler's back.
+ */
+#if (FAST_BOOT_CACHE_IN_WORK_FLASH)
+CY_SECTION(".cy_em_eeprom")
+#endif
+CY_ALIGN(CY_FLASH_SIZEOF_ROW) static const volatile uint8_t fb_cache[FAST_BOOT_CACHE_SIZE] = {0u};
+
+/* Rows being written or the cache being checked */
+static uint32_t fb_buf[FAST_BOOT_CACHE_SIZE / sizeof(uint32_t)];
+
+/* Copy of the memory configuration without CY_SMIF_FLAG_DETECT_SFDP, used
+ * when the parameters come from the cache. The serial-flash library keeps a
+ * pointer to it.
+ */
+static cy_stc_smif_mem_config_t fb_mem_config;
+static const cy_stc_smif_mem_config_t *fb_source = NULL;
+
+static fast_boot_cache_t fb_state = FAST_BOOT_CACHE_UNUSED;
+
+static uint32_t fb_cycles[FAST_BOOT_MARK_COUNT];
+static uint32_t fb_clock_hz[FAST_BOOT_MARK_COUNT];
+
+#if (FAST_BOOT_ENABLE)
+/*******************************************************************************
+* Function Name: Cy_OnResetUser
+****************************************************************************//**
+* Summary:
+*  Overrides the weak hook called by the startup code at the start of the
+*  reset handler, so that the cycle counter counts from the CM4 reset. Runs
+*  before the C runtime is initialized: only registers may be touched here.
+*
+*******************************************************************************/
+void Cy_OnResetUser(void)
+{
+    cycle_counter_init();
+}
+#endif
+
+/*******************************************************************************
+* Function Name: fb_crc32
+****************************************************************************//**
+* Summary:
+*  Updates a CRC-32 (IEEE 802.3) with a buffer. Start with 0.
+*
+*******************************************************************************/
+static uint32_t fb_crc32(uint32_t crc, const uint8_t *buf, size_t length)
+{
+    crc = ~crc;
+
+    for(size_t index = 0; index < length; index++)
+    {
+        crc ^= buf[index];
+
+        for(uint32_t bit = 0; bit < 8u; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+
+    return ~crc;
+}
+
+/*******************************************************************************
+* Function Name: fb_build_key
+****************************************************************************//**
+* Summary:
+*  Returns a value that changes with the build: the cache holds addresses of
+*  SMIF driver structures, which are only meaningful to the firmware that
+*  wrote them.
+*
+*******************************************************************************/
+static uint32_t fb_build_key(void)
+{
+    static const char build[] = __DATE__ " " __TIME__;
+    uint32_t code[2] = { (uint32_t)&Cy_SMIF_MemInit, (uint32_t)&cy_serial_flash_qspi_init };
+
+    return fb_crc32(fb_crc32(0u, (const uint8_t *)build, sizeof(build)), (const uint8_t *)code, sizeof(code));
+}
+
+/*******************************************************************************
+* Function Name: fb_get_cmds
+****************************************************************************//**
+* Summary:
+*  Lists the command structures of a device configuration.
+*
+*******************************************************************************/
+static void fb_get_cmds(const cy_stc_smif_mem_device_cfg_t *cfg, cy_stc_smif_mem_cmd_t *cmds[FB_CMD_COUNT])
+{
+    cmds[0] = cfg->readCmd;
+    cmds[1] = cfg->writeEnCmd;
+    cmds[2] = cfg->writeDisCmd;
+    cmds[3] = cfg->eraseCmd;
+    cmds[4] = cfg->chipEraseCmd;
+    cmds[5] = cfg->programCmd;
+    cmds[6] = cfg->readStsRegWipCmd;
+    cmds[7] = cfg->readStsRegQeCmd;
+    cmds[8] = cfg->writeStsRegQeCmd;
+    cmds[9] = cfg->readSfdpCmd;
+}
+
+/*******************************************************************************
+* Function Name: fb_payload_size
+****************************************************************************//**
+* Summary:
+*  Returns the size of the payload for a number of hybrid regions.
+*
+*******************************************************************************/
+static uint32_t fb_payload_size(uint32_t region_count)
+{
+    return sizeof(cy_stc_smif_mem_device_cfg_t) + (FB_CMD_COUNT * sizeof(cy_stc_smif_mem_cmd_t)) +
+           (region_count * (sizeof(uint32_t) + sizeof(cy_stc_smif_hybrid_region_info_t)));
+}
+
+/*******************************************************************************
+* Function Name: fb_is_sram
+****************************************************************************//**
+* Summary:
+*  Checks that a cached pointer refers to a word-aligned object in SRAM.
+*
+*******************************************************************************/
+static bool fb_is_sram(const void *ptr, uint32_t size)
+{
+    uint32_t addr = (uint32_t)ptr;
+
+    return (0u == (addr & 3u)) && (addr >= CY_SRAM_BASE) && (addr <= (CY_SRAM_BASE + CY_SRAM_SIZE - size));
+}
+
+/*******************************************************************************
+* Function Name: fb_serialize
+****************************************************************************//**
+* Summary:
+*  Fills fb_buf with the cache contents for the parameters that SFDP has
+*  written into the device configuration.
+*
+* Return:
+*  FAST_BOOT_RSLT_ERR_TOO_LARGE if the parameters do not fit in the cache.
+*
+*******************************************************************************/
+static cy_rslt_t fb_serialize(const cy_stc_smif_mem_config_t *mem_config)
+{
+    const cy_stc_smif_mem_device_cfg_t *cfg = mem_config->deviceCfg;
+    uint32_t region_count = (NULL == cfg->hybridRegionInfo) ? 0u : cfg->hybridRegionCount;
+    uint8_t *buf = (uint8_t *)fb_buf;
+
+    if((region_count > FAST_BOOT_MAX_REGIONS) ||
+       ((sizeof(fb_header_t) + fb_payload_size(region_count)) > FAST_BOOT_CACHE_SIZE))
+    {
+        return FAST_BOOT_RSLT_ERR_TOO_LARGE;
+    }
+
+    memset(fb_buf, 0, sizeof(fb_buf));
+
+    fb_header_t hdr =
+    {
+        .magic = FB_MAGIC,
+        .crc = 0u,
+        .build_key = fb_build_key(),
+        .device_cfg = (uint32_t)cfg,
+        .cfg_size = (uint16_t)sizeof(cy_stc_smif_mem_device_cfg_t),
+        .cmd_size = (uint8_t)sizeof(cy_stc_smif_mem_cmd_t),
+        .region_size = (uint8_t)sizeof(cy_stc_smif_hybrid_region_info_t),
+        .region_count = (uint16_t)region_count,
+        .length = (uint16_t)fb_payload_size(region_count)
+    };
+
+    uint8_t *payload = &buf[sizeof(hdr)];
+    memcpy(payload, cfg, sizeof(*cfg));
+    payload += sizeof(*cfg);
+
+    cy_stc_smif_mem_cmd_t *cmds[FB_CMD_COUNT];
+    fb_get_cmds(cfg, cmds);
+    for(uint32_t index = 0; index < FB_CMD_COUNT; index++)
+    {
+        if(NULL != cmds[index])
+        {
+            memcpy(payload, cmds[index], sizeof(cy_stc_smif_mem_cmd_t));
+        }
+        payload += sizeof(cy_stc_smif_mem_cmd_t);
+    }
+
+    for(uint32_t index = 0; index < region_count; index++)
+    {
+        uint32_t region = (uint32_t)cfg->hybridRegionInfo[index];
+        memcpy(payload, &region, sizeof(region));
+        payload += sizeof(region);
+    }
+
+    for(uint32_t index = 0; index < region_count; index++)
+    {
+        memcpy(payload, cfg->hybridRegionInfo[index], sizeof(cy_stc_smif_hybrid_region_info_t));
+        payload += sizeof(cy_stc_smif_hybrid_region_info_t);
+    }
+
+    memcpy(buf, &hdr, sizeof(hdr));
+    hdr.crc = fb_crc32(0u, &buf[offsetof(fb_header_t, build_key)],
+                       sizeof(hdr) - offsetof(fb_header_t, build_key) + hdr.length);
+    memcpy(buf, &hdr, sizeof(hdr));
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: fb_load
+****************************************************************************//**
+* Summary:
+*  Copies the cache into fb_buf and checks that it was written by this build
+*  for this memory configuration, and that every pointer it holds matches the
+*  current device configuration or refers to SRAM.
+*
+*******************************************************************************/
+static bool fb_load(const cy_stc_smif_mem_config_t *mem_config)
+{
+    uint8_t *buf = (uint8_t *)fb_buf;
+    fb_header_t hdr;
+
+    for(uint32_t index = 0; index < FAST_BOOT_CACHE_SIZE; index++)
+    {
+        buf[index] = fb_cache[index];
+    }
+    memcpy(&hdr, buf, sizeof(hdr));
+
+    if((FB_MAGIC != hdr.magic) || (fb_build_key() != hdr.build_key) ||
+       ((uint32_t)mem_config->deviceCfg != hdr.device_cfg) ||
+       (sizeof(cy_stc_smif_mem_device_cfg_t) != hdr.cfg_size) ||
+       (sizeof(cy_stc_smif_mem_cmd_t) != hdr.cmd_size) ||
+       (sizeof(cy_stc_smif_hybrid_region_info_t) != hdr.region_size) ||
+       (hdr.region_count > FAST_BOOT_MAX_REGIONS) || (fb_payload_size(hdr.region_count) != hdr.length) ||
+       ((sizeof(hdr) + hdr.length) > FAST_BOOT_CACHE_SIZE))
+    {
+        return false;
+    }
+
+    if(hdr.crc != fb_crc32(0u, &buf[offsetof(fb_header_t, build_key)],
+                           sizeof(hdr) - offsetof(fb_header_t, build_key) + hdr.length))
+    {
+        return false;
+    }
+
+    /* The commands are restored through the pointers of the device
+     * configuration, so they must be the ones the configuration has now.
+     */
+    cy_stc_smif_mem_device_cfg_t cached;
+    memcpy(&cached, &buf[sizeof(hdr)], sizeof(cached));
+
+    cy_stc_smif_mem_cmd_t *cached_cmds[FB_CMD_COUNT];
+    cy_stc_smif_mem_cmd_t *current_cmds[FB_CMD_COUNT];
+    fb_get_cmds(&cached, cached_cmds);
+    fb_get_cmds(mem_config->deviceCfg, current_cmds);
+    if(0 != memcmp(cached_cmds, current_cmds, sizeof(cached_cmds)))
+    {
+        return false;
+    }
+
+    if(hdr.region_count != ((NULL == cached.hybridRegionInfo) ? 0u : cached.hybridRegionCount))
+    {
+        return false;
+    }
+
+    /* SFDP points the hybrid regions at driver-owned SRAM */
+    if(0u != hdr.region_count)
+    {
+        const uint8_t *regions = &buf[sizeof(hdr) + fb_payload_size(0u)];
+
+        if(!fb_is_sram(cached.hybridRegionInfo, hdr.region_count * sizeof(uint32_t)))
+        {
+            return false;
+        }
+
+        for(uint32_t index = 0; index < hdr.region_count; index++)
+        {
+            uint32_t region;
+            memcpy(&region, &regions[index * sizeof(region)], sizeof(region));
+            if(!fb_is_sram((const void *)region, sizeof(cy_stc_smif_hybrid_region_info_t)))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: fb_restore
+****************************************************************************//**
+* Summary:
+*  Writes the parameters loaded by fb_load() back into the device
+*  configuration, as SFDP detection would have.
+*
+*******************************************************************************/
+static void fb_restore(const cy_stc_smif_mem_config_t *mem_config)
+{
+    cy_stc_smif_mem_device_cfg_t *cfg = mem_config->deviceCfg;
+    const uint8_t *payload = &((const uint8_t *)fb_buf)[sizeof(fb_header_t)];
+    uint32_t region_count = ((const fb_header_t *)fb_buf)->region_count;
+
+    memcpy(cfg, payload, sizeof(*cfg));
+    payload += sizeof(*cfg);
+
+    cy_stc_smif_mem_cmd_t *cmds[FB_CMD_COUNT];
+    fb_get_cmds(cfg, cmds);
+    for(uint32_t index = 0; index < FB_CMD_COUNT; index++)
+    {
+        if(NULL != cmds[index])
+        {
+            memcpy(cmds[index], payload, sizeof(cy_stc_smif_mem_cmd_t));
+        }
+        payload += sizeof(cy_stc_smif_mem_cmd_t);
+    }
+
+    const uint8_t *structs = payload + (region_count * sizeof(uint32_t));
+    for(uint32_t index = 0; index < region_count; index++)
+    {
+        uint32_t region;
+        memcpy(&region, &payload[index * sizeof(region)], sizeof(region));
+        cfg->hybridRegionInfo[index] = (cy_stc_smif_hybrid_region_info_t *)region;
+        memcpy(cfg->hybridRegionInfo[index], &structs[index * sizeof(cy_stc_smif_hybrid_region_info_t)],
+               sizeof(cy_stc_smif_hybrid_region_info_t));
+    }
+}
+
+/*******************************************************************************
+* Function Name: fb_write
+****************************************************************************//**
+* Summary:
+*  Programs fb_buf into the cache rows that differ from it.
+*
+*******************************************************************************/
+static cy_rslt_t fb_write(void)
+{
+    const uint8_t *buf = (const uint8_t *)fb_buf;
+
+    for(uint32_t row = 0; row < FAST_BOOT_CACHE_ROWS; row++)
+    {
+        uint32_t offset = row * CY_FLASH_SIZEOF_ROW;
+        bool same = true;
+
+        for(uint32_t index = 0; same && (index < CY_FLASH_SIZEOF_ROW); index++)
+        {
+            same = (fb_cache[offset + index] == buf[offset + index]);
+        }
+
+        if(!same && (CY_FLASH_DRV_SUCCESS != Cy_Flash_WriteRow((uint32_t)&fb_cache[offset],
+                                                               &fb_buf[offset / sizeof(uint32_t)])))
+        {
+            return FAST_BOOT_RSLT_ERR_FLASH_WRITE;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: fast_boot_mark
+****************************************************************************//**
+* Summary:
+*  Records the cycle counter and the CPU clock at a point of the boot
+*  sequence.
+*
+*******************************************************************************/
+void fast_boot_mark(fast_boot_mark_t mark)
+{
+    fb_cycles[mark] = cycle_counter_get();
+    fb_clock_hz[mark] = SystemCoreClock;
+}
+
+/*******************************************************************************
+* Function Name: fast_boot_qspi_init
+****************************************************************************//**
+* Summary:
+*  Initializes the QSPI memory like qspi_bus_init(). When the memory
+*  configuration relies on SFDP and the cache holds the parameters found by an
+*  earlier boot of this build, they are written into the device configuration
+*  and the memory is initialized without probing it. If that fails, the
+*  memory is probed as usual.
+*
+*  In dual-quad mode, qspi_bus_init() probes both memories through
+*  smifBlockConfig anyway, so the cache is not used.
+*
+* Parameters:
+*  mem_config - memory configuration of the device.
+*  hz - QSPI bus frequency.
+*
+* Return:
+*  Result of qspi_bus_init().
+*
+*******************************************************************************/
+cy_rslt_t fast_boot_qspi_init(const cy_stc_smif_mem_config_t *mem_config, uint32_t hz)
+{
+    fb_source = mem_config;
+    fb_state = FAST_BOOT_CACHE_UNUSED;
+
+#if (QSPI_BUS_MODE != QSPI_BUS_MODE_DUAL_QUAD)
+    if(0u != (mem_config->flags & CY_SMIF_FLAG_DETECT_SFDP))
+    {
+        fb_state = FAST_BOOT_CACHE_MISS;
+
+        if(fb_load(mem_config))
+        {
+            fb_restore(mem_config);
+
+            fb_mem_config = *mem_config;
+            fb_mem_config.flags &= ~CY_SMIF_FLAG_DETECT_SFDP;
+
+            if(CY_RSLT_SUCCESS == qspi_bus_init(&fb_mem_config, hz))
+            {
+                fb_state = FAST_BOOT_CACHE_HIT;
+                return CY_RSLT_SUCCESS;
+            }
+
+            fb_state = FAST_BOOT_CACHE_REJECTED;
+        }
+    }
+#endif
+
+    return qspi_bus_init(mem_config, hz);
+}
+
+/*******************************************************************************
+* Function Name: fb_xip_entry
+****************************************************************************//**
+* Summary:
+*  Stamps FAST_BOOT_MARK_XIP. Executes from external memory.
+*
+*******************************************************************************/
+static void fb_xip_entry(void)
+{
+    fb_cycles[FAST_BOOT_MARK_XIP] = cycle_counter_get();
+    fb_clock_hz[FAST_BOOT_MARK_XIP] = SystemCoreClock;
+}
+
+/*******************************************************************************
+* Function Name: fast_boot_first_xip
+****************************************************************************//**
+* Summary:
+*  Enables XIP mode, calls a function placed in external memory that stamps
+*  FAST_BOOT_MARK_XIP, and returns to MMIO mode for the rest of the example.
+*
+* Return:
+*  Result of cy_serial_flash_qspi_enable_xip().
+*
+*******************************************************************************/
+cy_rslt_t fast_boot_first_xip(void)
+{
+    cy_rslt_t result = cy_serial_flash_qspi_enable_xip(true);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        fb_xip_entry();
+        result = cy_serial_flash_qspi_enable_xip(false);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: fast_boot_cache_update
+****************************************************************************//**
+* Summary:
+*  Stores the parameters found by SFDP in the last fast_boot_qspi_init() for
+*  the next boots. Meant to be called once the boot-time critical work is
+*  done; does nothing if the parameters came from the cache or SFDP is not
+*  used. The CPU is stalled while the internal flash is programmed.
+*
+* Return:
+*  FAST_BOOT_RSLT_ERR_TOO_LARGE if the parameters do not fit in the cache,
+*  FAST_BOOT_RSLT_ERR_FLASH_WRITE if the flash driver fails.
+*
+*******************************************************************************/
+cy_rslt_t fast_boot_cache_update(void)
+{
+    if((FAST_BOOT_CACHE_MISS != fb_state) && (FAST_BOOT_CACHE_REJECTED != fb_state))
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    cy_rslt_t result = fb_serialize(fb_source);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = fb_write();
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: fast_boot_cache_invalidate
+****************************************************************************//**
+* Summary:
+*  Clears the cache, so that the next boot probes the memory again. Needed
+*  when the memory part changes without the application being reprogrammed.
+*
+*******************************************************************************/
+cy_rslt_t fast_boot_cache_invalidate(void)
+{
+    memset(fb_buf, 0, sizeof(fb_buf));
+    return fb_write();
+}
+
+/*******************************************************************************
+* Function Name: fast_boot_get_cache_state
+****************************************************************************//**
+* Summary:
+*  Returns how the last fast_boot_qspi_init() obtained the memory parameters.
+*
+*******************************************************************************/
+fast_boot_cache_t fast_boot_get_cache_state(void)
+{
+    return fb_state;
+}
+
+/*******************************************************************************
+* Function Name: fast_boot_report
+****************************************************************************//**
+* Summary:
+*  Prints the duration of each boot stage up to the first XIP instruction.
+*  Each stage is converted at the clock in use when it ended, so the cybsp_init()
+*  stage, which configures the clocks, is approximate. Time spent by the CM0+
+*  before it releases the CM4 from reset is not included.
+*
+*******************************************************************************/
+void fast_boot_report(void)
+{
+    static const char *const stage_names[FAST_BOOT_MARK_COUNT] =
+    {
+        "Reset to main()", "cybsp_init()", "QSPI bring-up", "XIP entry"
+    };
+    static const char *const cache_names[] = { "not used", "hit", "miss", "rejected" };
+
+    uint32_t previous = 0u;
+    uint32_t total_us = 0u;
+
+    printf("\nFast boot, SFDP cache %s:\n", cache_names[fb_state]);
+    for(uint32_t mark = 0; mark < FAST_BOOT_MARK_COUNT; mark++)
+    {
+        uint32_t cycles = fb_cycles[mark] - previous;
+        uint32_t us = (0u == fb_clock_hz[mark]) ? 0u :
+                      (uint32_t)(((uint64_t)cycles * 1000000u) / fb_clock_hz[mark]);
+
+        printf("  %-16s %10"PRIu32" cycles %8"PRIu32" us%s\n", stage_names[mark], cycles, us,
+               (FAST_BOOT_MARK_BSP == mark) ? " (approx.)" : "");
+        previous = fb_cycles[mark];
+        total_us += us;
+    }
+    printf("Time to first XIP instruction: %"PRIu32" us after the CM4 reset\n", total_us);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,123 @@
+/******************************************************************************
+* File Name:   fast_boot.h
+*
+* Description: This file contains the declarations of the fast-boot path that
+*              brings up the QSPI memory with cached SFDP parameters and
+*              measures the time to the first XIP instruction.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef FAST_BOOT_H
+#define FAST_BOOT_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to bring up the QSPI memory right after cybsp_init(), ahead of the
+ * console, with the SFDP parameters cached in internal flash by an earlier
+ * boot, and to report the time from reset to the first XIP instruction.
+ */
+#ifndef FAST_BOOT_ENABLE
+#define FAST_BOOT_ENABLE                (0u)
+#endif
+
+/* Set to 1 to keep the cache in the auxiliary (work) flash through the
+ * .cy_em_eeprom section; the linker script must place that section. By
+ * default the cache is a row-aligned array in the main flash.
+ */
+#ifndef FAST_BOOT_CACHE_IN_WORK_FLASH
+#define FAST_BOOT_CACHE_IN_WORK_FLASH   (0u)
+#endif
+
+/* Internal flash rows reserved for the cache */
+#define FAST_BOOT_CACHE_ROWS            (2u)
+#define FAST_BOOT_CACHE_SIZE            (FAST_BOOT_CACHE_ROWS * CY_FLASH_SIZEOF_ROW)
+
+/* Largest number of hybrid sector regions that can be cached */
+#define FAST_BOOT_MAX_REGIONS           (8u)
+
+#define FAST_BOOT_RSLT_ERR_TOO_LARGE    APP_RSLT_ERR(APP_RSLT_RANGE_FAST_BOOT, 1u)
+#define FAST_BOOT_RSLT_ERR_FLASH_WRITE  APP_RSLT_ERR(APP_RSLT_RANGE_FAST_BOOT, 2u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Points of the boot sequence stamped with fast_boot_mark() */
+typedef enum
+{
+    FAST_BOOT_MARK_MAIN,        /* Entry of main() */
+    FAST_BOOT_MARK_BSP,         /* cybsp_init() done, clocks configured */
+    FAST_BOOT_MARK_QSPI,        /* QSPI memory initialized */
+    FAST_BOOT_MARK_XIP,         /* First instruction executed from XIP */
+    FAST_BOOT_MARK_COUNT
+} fast_boot_mark_t;
+
+typedef enum
+{
+    FAST_BOOT_CACHE_UNUSED,     /* The memory configuration does not use SFDP */
+    FAST_BOOT_CACHE_HIT,        /* Parameters restored from the cache */
+    FAST_BOOT_CACHE_MISS,       /* No valid cache, the memory was probed */
+    FAST_BOOT_CACHE_REJECTED    /* The cached parameters did not work, the memory was probed */
+} fast_boot_cache_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+void fast_boot_mark(fast_boot_mark_t mark);
+cy_rslt_t fast_boot_qspi_init(const cy_stc_smif_mem_config_t *mem_config, uint32_t hz);
+cy_rslt_t fast_boot_first_xip(void);
+cy_rslt_t fast_boot_cache_update(void);
+cy_rslt_t fast_boot_cache_invalidate(void);
+fast_boot_cache_t fast_boot_get_cache_state(void);
+void fast_boot_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FAST_BOOT_H */
+
+/* [] END OF FILE */
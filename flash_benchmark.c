@@ -0,0 +1,356 @@
+/******************************************************************************
+* File Name:   flash_benchmark.c
+*
+* Description: This file contains the external flash throughput benchmark. It
+*              measures read, page program, and erase throughput across
+*              transfer sizes and prints a table over the debug UART.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "flash_benchmark.h"
+#include "qspi_bus.h"
+#include "smif_mmio.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const uint32_t bench_sizes[] = FLASH_BENCHMARK_SIZES;
+static const uint32_t bench_range_sectors[] = FLASH_BENCHMARK_RANGE_SECTORS;
+static uint8_t bench_buffer[FLASH_BENCHMARK_MAX_TRANSFER];
+
+/*******************************************************************************
+* Function Name: bench_print_row
+****************************************************************************//**
+* Summary:
+*  Prints one row of the result table.
+*
+* Parameters:
+*  operation - name of the operation.
+*  size - bytes per call.
+*  calls - number of calls timed.
+*  total_us - total time of all calls.
+*
+*******************************************************************************/
+static void bench_print_row(const char *operation, uint32_t size, uint32_t calls, uint64_t total_us)
+{
+    uint64_t bytes = (uint64_t)size * calls;
+    /* Throughput in hundredths of MB/s (1 MB = 10^6 bytes) */
+    uint32_t rate = (0u != total_us) ? (uint32_t)((bytes * 100u) / total_us) : 0u;
+    uint32_t per_call = (uint32_t)(total_us / calls);
+
+    if(size >= 1024u)
+    {
+        printf("%-14s %7"PRIu32" KB %12"PRIu32" %8"PRIu32".%02"PRIu32"\n",
+               operation, size / 1024u, per_call, rate / 100u, rate % 100u);
+    }
+    else
+    {
+        printf("%-14s %7"PRIu32" B  %12"PRIu32" %8"PRIu32".%02"PRIu32"\n",
+               operation, size, per_call, rate / 100u, rate % 100u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_read
+****************************************************************************//**
+* Summary:
+*  Reads FLASH_BENCHMARK_READ_TOTAL bytes sequentially through the region in
+*  transfers of the given size.
+*
+*******************************************************************************/
+static cy_rslt_t bench_read(uint32_t region, uint32_t region_size, uint32_t size)
+{
+    uint32_t calls = FLASH_BENCHMARK_READ_TOTAL / size;
+    uint32_t offset = 0u;
+    uint64_t total = 0u;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    for(uint32_t call = 0; (call < calls) && (CY_RSLT_SUCCESS == result); call++)
+    {
+        uint32_t start = cycle_counter_get();
+        result = cy_serial_flash_qspi_read(region + offset, size, bench_buffer);
+        total += cycle_counter_get() - start;
+        offset = (offset + size) % region_size;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        bench_print_row("Read", size, calls, (total * 1000000u) / SystemCoreClock);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_program
+****************************************************************************//**
+* Summary:
+*  Erases the start of the region (not timed), then programs
+*  FLASH_BENCHMARK_PROGRAM_TOTAL bytes in writes of the given size.
+*
+*******************************************************************************/
+static cy_rslt_t bench_program(uint32_t region, uint32_t sector_size, uint32_t size)
+{
+    uint32_t calls = FLASH_BENCHMARK_PROGRAM_TOTAL / size;
+    uint32_t erase_size = ((FLASH_BENCHMARK_PROGRAM_TOTAL + sector_size - 1u) / sector_size) * sector_size;
+    uint64_t total = 0u;
+    cy_rslt_t result = cy_serial_flash_qspi_erase(region, erase_size);
+
+    for(uint32_t call = 0; (call < calls) && (CY_RSLT_SUCCESS == result); call++)
+    {
+        uint32_t start = cycle_counter_get();
+        result = cy_serial_flash_qspi_write(region + (call * size), size, bench_buffer);
+        total += cycle_counter_get() - start;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        bench_print_row("Program", size, calls, (total * 1000000u) / SystemCoreClock);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_range
+****************************************************************************//**
+* Summary:
+*  Reads or programs the given number of whole sectors at the start of the
+*  region. The SRAM buffer is reused as the sink or source of every
+*  FLASH_BENCHMARK_MAX_TRANSFER bytes, and each of these transfers is timed
+*  on its own so that the cycle counter does not wrap. Programs erase the
+*  sectors first (not timed).
+*
+*******************************************************************************/
+static cy_rslt_t bench_range(uint32_t region, uint32_t sector_size, uint32_t sectors, bool program)
+{
+    char operation[16];
+    uint32_t range = sectors * sector_size;
+    uint64_t total = 0u;
+    cy_rslt_t result = program ? cy_serial_flash_qspi_erase(region, range) : CY_RSLT_SUCCESS;
+
+    for(uint32_t offset = 0; (offset < range) && (CY_RSLT_SUCCESS == result); offset += sizeof(bench_buffer))
+    {
+        uint32_t start = cycle_counter_get();
+
+        if(program)
+        {
+            result = cy_serial_flash_qspi_write(region + offset, sizeof(bench_buffer), bench_buffer);
+        }
+        else
+        {
+            result = cy_serial_flash_qspi_read(region + offset, sizeof(bench_buffer), bench_buffer);
+        }
+
+        total += cycle_counter_get() - start;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        (void)snprintf(operation, sizeof(operation), "%s x%"PRIu32, program ? "Program" : "Read", sectors);
+        bench_print_row(operation, range, 1u, (total * 1000000u) / SystemCoreClock);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: bench_erase
+****************************************************************************//**
+* Summary:
+*  Times an erase of the given number of sectors at the start of the region.
+*  The sectors are erased one call at a time so that the cycle counter does
+*  not wrap during a single measurement.
+*
+*******************************************************************************/
+static cy_rslt_t bench_erase(uint32_t region, uint32_t sector_size, uint32_t sectors)
+{
+    char operation[16];
+    uint64_t total = 0u;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    for(uint32_t sector = 0; (sector < sectors) && (CY_RSLT_SUCCESS == result); sector++)
+    {
+        uint32_t start = cycle_counter_get();
+        result = cy_serial_flash_qspi_erase(region + (sector * sector_size), sector_size);
+        total += cycle_counter_get() - start;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        (void)snprintf(operation, sizeof(operation), "Erase x%"PRIu32, sectors);
+        bench_print_row(operation, sectors * sector_size, 1u, (total * 1000000u) / SystemCoreClock);
+    }
+
+    return result;
+}
+
+#if (FLASH_BENCHMARK_CHIP_ERASE)
+/*******************************************************************************
+* Function Name: bench_chip_erase
+****************************************************************************//**
+* Summary:
+*  Times a chip erase. The erase runs for longer than the cycle counter can
+*  count, so the status is polled and the intervals are accumulated.
+*
+*******************************************************************************/
+static cy_rslt_t bench_chip_erase(void)
+{
+    uint64_t total = 0u;
+    uint32_t last = cycle_counter_get();
+    cy_rslt_t result = smif_mmio_chip_erase_start();
+
+    while((CY_RSLT_SUCCESS == result) && smif_mmio_is_busy())
+    {
+        uint32_t now = cycle_counter_get();
+        total += now - last;
+        last = now;
+        Cy_SysLib_Delay(1u);
+    }
+
+    total += cycle_counter_get() - last;
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        bench_print_row("Erase chip", (uint32_t)cy_serial_flash_qspi_get_size(), 1u,
+                        (total * 1000000u) / SystemCoreClock);
+    }
+
+    return result;
+}
+#endif /* FLASH_BENCHMARK_CHIP_ERASE */
+
+/*******************************************************************************
+* Function Name: flash_benchmark_run
+****************************************************************************//**
+* Summary:
+*  Runs the throughput benchmark on FLASH_BENCHMARK_REGION_SECTORS sectors at
+*  the middle of the memory, which are erased. Must be called in MMIO mode,
+*  after cy_serial_flash_qspi_init().
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t flash_benchmark_run(const cy_stc_smif_mem_config_t *mem_config)
+{
+    uint32_t mem_size = (uint32_t)cy_serial_flash_qspi_get_size();
+    uint32_t region = mem_size / 2u;
+    uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(region);
+    uint32_t region_size = FLASH_BENCHMARK_REGION_SECTORS * sector_size;
+    cy_rslt_t result = smif_mmio_init(mem_config);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    region -= region % sector_size;
+
+    if(((region + region_size) > mem_size) || (region_size < FLASH_BENCHMARK_PROGRAM_TOTAL) ||
+       (0u != (sector_size % sizeof(bench_buffer))) ||
+       (sector_size != cy_serial_flash_qspi_get_erase_size(region + region_size - 1u)))
+    {
+        return FLASH_BENCHMARK_RSLT_ERR_REGION;
+    }
+
+    for(uint32_t index = 0; index < sizeof(bench_buffer); index++)
+    {
+        bench_buffer[index] = (uint8_t)(index ^ (index >> 8u));
+    }
+
+    cycle_counter_init();
+
+    printf("\nFlash throughput (region 0x%08"PRIx32", %"PRIu32" x %"PRIu32" KB sectors, page %"PRIu32" B):\n",
+           region, (uint32_t)FLASH_BENCHMARK_REGION_SECTORS, sector_size / 1024u,
+           (uint32_t)cy_serial_flash_qspi_get_prog_size(region));
+    qspi_bus_print();
+    printf("%-14s %10s %12s %11s\n", "Operation", "Size", "us/call", "MB/s");
+    printf("----------------------------------------------------\n");
+
+    for(uint32_t index = 0; (index < CY_ARRAY_SIZE(bench_sizes)) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        result = bench_read(region, region_size, bench_sizes[index]);
+    }
+
+    for(uint32_t index = 0; (index < CY_ARRAY_SIZE(bench_sizes)) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        result = bench_program(region, sector_size, bench_sizes[index]);
+    }
+
+    /* Full-sector and multi-sector ranges */
+    for(uint32_t index = 0; (index < CY_ARRAY_SIZE(bench_range_sectors)) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        result = bench_range(region, sector_size, bench_range_sectors[index], false);
+    }
+
+    for(uint32_t index = 0; (index < CY_ARRAY_SIZE(bench_range_sectors)) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        result = bench_range(region, sector_size, bench_range_sectors[index], true);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = bench_erase(region, sector_size, 1u);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = bench_erase(region, sector_size, 4u);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = bench_erase(region, sector_size, FLASH_BENCHMARK_REGION_SECTORS);
+    }
+
+#if (FLASH_BENCHMARK_CHIP_ERASE)
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = bench_chip_erase();
+    }
+#endif
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,108 @@
+/******************************************************************************
+* File Name:   flash_benchmark.h
+*
+* Description: This file contains the declarations of the external flash
+*              throughput benchmark.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FLASH_BENCHMARK_H
+#define FLASH_BENCHMARK_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the read/program/erase throughput benchmark before entering
+ * XIP mode.
+ */
+#ifndef FLASH_BENCHMARK_ENABLE
+#define FLASH_BENCHMARK_ENABLE          (0u)
+#endif
+
+/* Set to 1 to include a chip erase. This erases the code and data programmed
+ * into external memory, so main() stops after the benchmark and the kit must
+ * be reprogrammed afterwards.
+ */
+#ifndef FLASH_BENCHMARK_CHIP_ERASE
+#define FLASH_BENCHMARK_CHIP_ERASE      (0u)
+#endif
+
+/* Number of sectors at the middle of the memory used by the benchmark */
+#ifndef FLASH_BENCHMARK_REGION_SECTORS
+#define FLASH_BENCHMARK_REGION_SECTORS  (16u)
+#endif
+
+/* Transfer sizes of the read and program sweeps, in bytes */
+#define FLASH_BENCHMARK_SIZES           { 16u, 64u, 256u, 1024u, 4096u, 16384u }
+
+/* Ranges of whole sectors read and programmed after the sweeps. They are
+ * transferred in FLASH_BENCHMARK_MAX_TRANSFER bytes per call and must fit in
+ * FLASH_BENCHMARK_REGION_SECTORS.
+ */
+#define FLASH_BENCHMARK_RANGE_SECTORS   { 1u, 4u }
+
+/* Largest transfer size, which is also the size of the SRAM buffer */
+#define FLASH_BENCHMARK_MAX_TRANSFER    (16384u)
+
+/* Data read per transfer size. Larger ranges wrap around the region. */
+#define FLASH_BENCHMARK_READ_TOTAL      (256u * 1024u)
+
+/* Data programmed per transfer size */
+#define FLASH_BENCHMARK_PROGRAM_TOTAL   (16u * 1024u)
+
+#define FLASH_BENCHMARK_RSLT_ERR_REGION APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_BENCHMARK, 1u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t flash_benchmark_run(const cy_stc_smif_mem_config_t *mem_config);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_BENCHMARK_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,601 @@
+/******************************************************************************
+* File Name:   flash_loader.c
+*
+* Description: This file contains an on-target flash loader for factory
+*              programming of the external memory. The host streams the image
+*              over the debug UART into two SRAM staging buffers: one chunk
+*              is received while the previous one is programmed, page by
+*              page, erasing sectors just ahead of the write head. Each chunk
+*              is checked with a CRC-32 on reception and after programming,
+*              instead of a read-back by the host.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cy_retarget_io.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "flash_loader.h"
+#include "flash_verify.h"
+#include "qspi_async.h"
+#include "smif_mmio.h"
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define LOADER_BUFFERS                  (2u)
+
+/* A rejected frame is discarded until the line stays idle this long */
+#define LOADER_DRAIN_IDLE_MS            (5u)
+
+/* Time for the last reply to leave the UART FIFO before the baud rate changes */
+#define LOADER_TX_DRAIN_MS              (20u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    flash_loader_frame_t frame;
+    uint8_t data[FLASH_LOADER_CHUNK_SIZE];
+} loader_buffer_t;
+
+typedef enum
+{
+    LOADER_RX_IDLE,
+    LOADER_RX_FRAME,
+    LOADER_RX_DATA
+} loader_rx_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* CRC-32 (reflected 0xEDB88320), four bits at a time */
+static const uint32_t loader_crc_table[16] =
+{
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu, 0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+/* Chunks are accepted into buffers[(head + count) % 2] and programmed from
+ * buffers[head]. A frame is only received into a free buffer, and a reply is
+ * only sent once that read is armed, so the host cannot overrun the UART.
+ */
+static loader_buffer_t loader_buffers[LOADER_BUFFERS];
+static uint32_t loader_head;
+static uint32_t loader_count;
+static loader_rx_t loader_rx;
+
+static uint32_t loader_prog_offset;     /* Bytes of buffers[head] programmed */
+static uint32_t loader_erased_end;      /* Sectors below this are erased */
+static uint32_t loader_image_start;
+static uint32_t loader_image_end;
+static uint32_t loader_data_end;        /* Chunks must arrive in increasing order */
+static bool loader_started;
+static bool loader_end_pending;
+static flash_loader_frame_t loader_end_frame;
+static uint8_t loader_last_seq;
+
+static flash_loader_reply_t loader_reply;
+static bool loader_reply_pending;
+static flash_loader_stats_t loader_stats;
+
+/*******************************************************************************
+* Function Name: loader_crc32
+****************************************************************************//**
+* Summary:
+*  Computes the CRC-32 of a staging buffer.
+*
+*******************************************************************************/
+static uint32_t loader_crc32(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for(uint32_t index = 0; index < length; index++)
+    {
+        crc ^= data[index];
+        crc = (crc >> 4u) ^ loader_crc_table[crc & 0x0Fu];
+        crc = (crc >> 4u) ^ loader_crc_table[crc & 0x0Fu];
+    }
+
+    return ~crc;
+}
+
+/*******************************************************************************
+* Function Name: loader_set_reply
+****************************************************************************//**
+* Summary:
+*  Prepares the reply to the last frame.
+*
+*******************************************************************************/
+static void loader_set_reply(uint8_t status, uint8_t seq)
+{
+    loader_reply.magic = FLASH_LOADER_MAGIC;
+    loader_reply.status = status;
+    loader_reply.seq = seq;
+    loader_reply.value = loader_stats.bytes;
+    loader_reply_pending = true;
+}
+
+/*******************************************************************************
+* Function Name: loader_send_reply
+****************************************************************************//**
+* Summary:
+*  Sends the prepared reply.
+*
+*******************************************************************************/
+static cy_rslt_t loader_send_reply(void)
+{
+    size_t size = sizeof(loader_reply);
+
+    loader_reply_pending = false;
+
+    return (CY_RSLT_SUCCESS == cyhal_uart_write(&cy_retarget_io_uart_obj, &loader_reply, &size)) ?
+           CY_RSLT_SUCCESS : FLASH_LOADER_RSLT_ERR_UART;
+}
+
+/*******************************************************************************
+* Function Name: loader_drain
+****************************************************************************//**
+* Summary:
+*  Discards the rest of a rejected frame, so that the next one starts in sync.
+*
+*******************************************************************************/
+static void loader_drain(void)
+{
+    do
+    {
+        (void)cyhal_uart_clear(&cy_retarget_io_uart_obj);
+        Cy_SysLib_Delay(LOADER_DRAIN_IDLE_MS);
+    } while(0u != cyhal_uart_readable(&cy_retarget_io_uart_obj));
+}
+
+/*******************************************************************************
+* Function Name: loader_rx_buffer
+****************************************************************************//**
+* Summary:
+*  Returns the buffer that receives the next frame.
+*
+*******************************************************************************/
+static inline loader_buffer_t *loader_rx_buffer(void)
+{
+    return &loader_buffers[(loader_head + loader_count) % LOADER_BUFFERS];
+}
+
+/*******************************************************************************
+* Function Name: loader_handle_frame
+****************************************************************************//**
+* Summary:
+*  Handles a received frame header: starts the reception of the data of a
+*  DATA frame, or prepares the reply to the other frames.
+*
+*******************************************************************************/
+static void loader_handle_frame(loader_buffer_t *buf)
+{
+    const flash_loader_frame_t *frame = &buf->frame;
+
+    loader_last_seq = frame->seq;
+
+    if(FLASH_LOADER_MAGIC != frame->magic)
+    {
+        loader_drain();
+        loader_set_reply(FLASH_LOADER_STATUS_PROTOCOL, frame->seq);
+        return;
+    }
+
+    switch(frame->cmd)
+    {
+        case FLASH_LOADER_CMD_START:
+        {
+            uint32_t erase_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(frame->addr);
+            uint32_t mem_size = (uint32_t)cy_serial_flash_qspi_get_size();
+
+            if((0u == erase_size) || (0u != (frame->addr % erase_size)) || (0u == frame->length) ||
+               (frame->addr >= mem_size) || (frame->length > (mem_size - frame->addr)) || (0u != loader_count))
+            {
+                loader_set_reply(FLASH_LOADER_STATUS_BOUNDS, frame->seq);
+                break;
+            }
+
+            memset(&loader_stats, 0, sizeof(loader_stats));
+            loader_image_start = frame->addr;
+            loader_image_end = frame->addr + frame->length;
+            loader_erased_end = frame->addr;
+            loader_data_end = frame->addr;
+            loader_started = true;
+            loader_set_reply(FLASH_LOADER_STATUS_ACK, frame->seq);
+            break;
+        }
+
+        case FLASH_LOADER_CMD_DATA:
+            if(!loader_started || (0u == frame->length) || (frame->length > FLASH_LOADER_CHUNK_SIZE) ||
+               (frame->addr < loader_data_end) || (frame->addr >= loader_image_end) ||
+               (frame->length > (loader_image_end - frame->addr)))
+            {
+                loader_drain();
+                loader_set_reply(loader_started ? FLASH_LOADER_STATUS_BOUNDS : FLASH_LOADER_STATUS_PROTOCOL,
+                                 frame->seq);
+            }
+            else if(CY_RSLT_SUCCESS == cyhal_uart_read_async(&cy_retarget_io_uart_obj, buf->data, frame->length))
+            {
+                loader_rx = LOADER_RX_DATA;
+            }
+            else
+            {
+                loader_drain();
+                loader_set_reply(FLASH_LOADER_STATUS_PROTOCOL, frame->seq);
+            }
+            break;
+
+        case FLASH_LOADER_CMD_END:
+            if(loader_started)
+            {
+                /* Replied to once every chunk is programmed and the range verified */
+                loader_end_frame = *frame;
+                loader_end_pending = true;
+            }
+            else
+            {
+                loader_set_reply(FLASH_LOADER_STATUS_PROTOCOL, frame->seq);
+            }
+            break;
+
+        default:
+            loader_drain();
+            loader_set_reply(FLASH_LOADER_STATUS_PROTOCOL, frame->seq);
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: loader_handle_data
+****************************************************************************//**
+* Summary:
+*  Checks the CRC of a received chunk and queues it for programming, or asks
+*  the host to send it again.
+*
+*******************************************************************************/
+static void loader_handle_data(loader_buffer_t *buf)
+{
+    const flash_loader_frame_t *frame = &buf->frame;
+
+    if(loader_crc32(buf->data, frame->length) != frame->crc)
+    {
+        loader_stats.retries++;
+        loader_set_reply(FLASH_LOADER_STATUS_NAK_CRC, frame->seq);
+        return;
+    }
+
+    loader_data_end = frame->addr + frame->length;
+    loader_count++;
+    loader_set_reply(FLASH_LOADER_STATUS_ACK, frame->seq);
+}
+
+/*******************************************************************************
+* Function Name: loader_erase_next
+****************************************************************************//**
+* Summary:
+*  Starts the erase of the sector at the erase head.
+*
+*******************************************************************************/
+static cy_rslt_t loader_erase_next(void)
+{
+    uint32_t erase_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(loader_erased_end);
+    cy_rslt_t result = smif_mmio_sector_erase_start(loader_erased_end);
+
+    loader_erased_end += erase_size;
+    loader_stats.erases++;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: loader_program_step
+****************************************************************************//**
+* Summary:
+*  Advances programming without waiting for the memory: once the previous
+*  operation has completed, erases the next sector if the write head reached
+*  it (gaps between chunks included), programs the next page of the oldest
+*  chunk, or checks the CRC of a chunk that is fully programmed and frees its
+*  buffer. After the END frame, erases the sectors that no chunk reached.
+*
+*******************************************************************************/
+static cy_rslt_t loader_program_step(void)
+{
+    if(smif_mmio_is_busy())
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    if(0u == loader_count)
+    {
+        return (loader_end_pending && (loader_erased_end < loader_image_end)) ?
+               loader_erase_next() : CY_RSLT_SUCCESS;
+    }
+
+    loader_buffer_t *buf = &loader_buffers[loader_head];
+    const flash_loader_frame_t *frame = &buf->frame;
+    uint32_t addr = frame->addr + loader_prog_offset;
+
+    if(loader_prog_offset >= frame->length)
+    {
+        uint32_t crc = 0u;
+        cy_rslt_t result = flash_verify_crc32(frame->addr, frame->length, &crc);
+
+        if((CY_RSLT_SUCCESS == result) && (crc != frame->crc))
+        {
+            result = FLASH_LOADER_RSLT_ERR_VERIFY;
+        }
+
+        loader_stats.bytes += frame->length;
+        loader_stats.chunks++;
+        loader_prog_offset = 0u;
+        loader_head = (loader_head + 1u) % LOADER_BUFFERS;
+        loader_count--;
+
+        return result;
+    }
+
+    if(addr >= loader_erased_end)
+    {
+        return loader_erase_next();
+    }
+
+    uint32_t page_size = smif_mmio_get_page_size();
+    uint32_t length = page_size - (addr % page_size);
+
+    length = ((frame->length - loader_prog_offset) < length) ? (frame->length - loader_prog_offset) : length;
+    loader_prog_offset += length;
+
+    return smif_mmio_program_start(addr, &buf->data[loader_prog_offset - length], length);
+}
+
+/*******************************************************************************
+* Function Name: loader_finish
+****************************************************************************//**
+* Summary:
+*  Checks the CRC of the whole range against the END frame and replies.
+*
+*******************************************************************************/
+static cy_rslt_t loader_finish(void)
+{
+    uint32_t crc = 0u;
+    cy_rslt_t result = flash_verify_crc32(loader_image_start, loader_image_end - loader_image_start, &crc);
+
+    if((CY_RSLT_SUCCESS == result) && (crc != loader_end_frame.crc))
+    {
+        result = FLASH_LOADER_RSLT_ERR_VERIFY;
+    }
+
+    loader_set_reply((CY_RSLT_SUCCESS == result) ? FLASH_LOADER_STATUS_ACK : FLASH_LOADER_STATUS_VERIFY,
+                     loader_end_frame.seq);
+
+    cy_rslt_t reply_result = loader_send_reply();
+
+    return (CY_RSLT_SUCCESS != result) ? result : reply_result;
+}
+
+/*******************************************************************************
+* Function Name: flash_loader_run
+****************************************************************************//**
+* Summary:
+*  Switches the debug UART to FLASH_LOADER_BAUD_RATE and serves one session
+*  of scripts/flash_loader.py: a START frame with the range to program, DATA
+*  frames with its chunks in increasing address order, and an END frame.
+*  Returns once the session is complete, or if no frame arrives for wait_ms,
+*  and restores the console baud rate. Must be called in MMIO mode. Nothing
+*  may be printed while the loader runs.
+*
+* Parameters:
+*  mem_config - memory to program.
+*  wait_ms - time to wait for the host, before and between frames.
+*  programmed - set to true if a complete image was programmed and verified.
+*
+* Return:
+*  CY_RSLT_SUCCESS if the image was programmed or no host showed up.
+*
+*******************************************************************************/
+cy_rslt_t flash_loader_run(const cy_stc_smif_mem_config_t *mem_config, uint32_t wait_ms, bool *programmed)
+{
+    cyhal_uart_t *uart = &cy_retarget_io_uart_obj;
+    uint64_t silent_cycles = 0u;
+    uint64_t session_cycles = 0u;
+    uint64_t idle_cycles = 0u;
+    uint64_t stall_cycles = 0u;
+
+    if((NULL == mem_config) || (NULL == programmed))
+    {
+        return FLASH_LOADER_RSLT_ERR_BAD_PARAM;
+    }
+
+    *programmed = false;
+
+    cy_rslt_t result = smif_mmio_init(mem_config);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = qspi_async_init(mem_config);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = flash_verify_init(mem_config);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    loader_head = 0u;
+    loader_count = 0u;
+    loader_rx = LOADER_RX_IDLE;
+    loader_prog_offset = 0u;
+    loader_started = false;
+    loader_end_pending = false;
+    loader_reply_pending = false;
+    memset(&loader_stats, 0, sizeof(loader_stats));
+
+    /* Let the console output drain first */
+    Cy_SysLib_Delay(LOADER_TX_DRAIN_MS);
+
+    if(CY_RSLT_SUCCESS != cyhal_uart_set_baud(uart, FLASH_LOADER_BAUD_RATE, NULL))
+    {
+        return FLASH_LOADER_RSLT_ERR_UART;
+    }
+
+    (void)cyhal_uart_clear(uart);
+
+    uint64_t limit_cycles = (uint64_t)wait_ms * (SystemCoreClock / 1000u);
+    uint32_t last = cycle_counter_get();
+
+    while(CY_RSLT_SUCCESS == result)
+    {
+        uint32_t now = cycle_counter_get();
+        uint32_t delta = now - last;
+
+        last = now;
+        silent_cycles += delta;
+
+        if(loader_started)
+        {
+            session_cycles += delta;
+            idle_cycles += ((0u == loader_count) && !loader_end_pending) ? delta : 0u;
+            stall_cycles += (loader_reply_pending && (LOADER_BUFFERS == loader_count)) ? delta : 0u;
+        }
+
+        /* Reception */
+        if((LOADER_RX_IDLE != loader_rx) && !cyhal_uart_is_rx_active(uart))
+        {
+            loader_rx_t stage = loader_rx;
+
+            loader_rx = LOADER_RX_IDLE;
+            silent_cycles = 0u;
+
+            if(LOADER_RX_FRAME == stage)
+            {
+                loader_handle_frame(loader_rx_buffer());
+            }
+            else
+            {
+                loader_handle_data(loader_rx_buffer());
+            }
+        }
+
+        if((LOADER_RX_IDLE == loader_rx) && !loader_end_pending && (loader_count < LOADER_BUFFERS))
+        {
+            if(CY_RSLT_SUCCESS == cyhal_uart_read_async(uart, &loader_rx_buffer()->frame,
+                                                        sizeof(flash_loader_frame_t)))
+            {
+                loader_rx = LOADER_RX_FRAME;
+            }
+            else
+            {
+                result = FLASH_LOADER_RSLT_ERR_UART;
+            }
+        }
+
+        if(loader_reply_pending && (LOADER_RX_IDLE != loader_rx))
+        {
+            result = loader_send_reply();
+        }
+
+        /* Programming */
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = loader_program_step();
+
+            if(CY_RSLT_SUCCESS != result)
+            {
+                loader_set_reply((FLASH_LOADER_RSLT_ERR_VERIFY == result) ? FLASH_LOADER_STATUS_VERIFY :
+                                 FLASH_LOADER_STATUS_FLASH, loader_last_seq);
+                (void)loader_send_reply();
+            }
+        }
+
+        if((CY_RSLT_SUCCESS == result) && loader_end_pending && (0u == loader_count) &&
+           (loader_erased_end >= loader_image_end) && !smif_mmio_is_busy())
+        {
+            result = loader_finish();
+            *programmed = (CY_RSLT_SUCCESS == result);
+            break;
+        }
+
+        if(silent_cycles > limit_cycles)
+        {
+            /* A host that went away mid-session leaves a partial image */
+            result = loader_started ? FLASH_LOADER_RSLT_ERR_TIMEOUT : CY_RSLT_SUCCESS;
+            break;
+        }
+    }
+
+    if(LOADER_RX_IDLE != loader_rx)
+    {
+        (void)cyhal_uart_read_abort(uart);
+        loader_rx = LOADER_RX_IDLE;
+    }
+
+    Cy_SysLib_Delay(LOADER_TX_DRAIN_MS);
+    (void)cyhal_uart_set_baud(uart, CY_RETARGET_IO_BAUDRATE, NULL);
+
+    loader_stats.total_us = (uint32_t)((session_cycles * 1000000u) / SystemCoreClock);
+    loader_stats.flash_idle_us = (uint32_t)((idle_cycles * 1000000u) / SystemCoreClock);
+    loader_stats.host_stall_us = (uint32_t)((stall_cycles * 1000000u) / SystemCoreClock);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_loader_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the counters of the last session.
+*
+*******************************************************************************/
+void flash_loader_get_stats(flash_loader_stats_t *stats)
+{
+    if(NULL != stats)
+    {
+        *stats = loader_stats;
+    }
+}
+
+/* [] END OF FILE */
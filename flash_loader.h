@@ -0,0 +1,143 @@
+/******************************************************************************
+* File Name:   flash_loader.h
+*
+* Description: This file contains the macros, data types and function
+*              declarations of the UART flash loader.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef FLASH_LOADER_H
+#define FLASH_LOADER_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to wait for an image from scripts/flash_loader.py at startup */
+#ifndef FLASH_LOADER_ENABLE
+#define FLASH_LOADER_ENABLE             (0u)
+#endif
+
+/* Baud rate of the debug UART while the loader runs; the script must match it */
+#ifndef FLASH_LOADER_BAUD_RATE
+#define FLASH_LOADER_BAUD_RATE          (921600u)
+#endif
+
+/* Size of each of the two SRAM staging buffers, the largest chunk of a frame */
+#ifndef FLASH_LOADER_CHUNK_SIZE
+#define FLASH_LOADER_CHUNK_SIZE         (4096u)
+#endif
+
+/* Time without a frame from the host after which the loader gives up */
+#ifndef FLASH_LOADER_WAIT_MS
+#define FLASH_LOADER_WAIT_MS            (5000u)
+#endif
+
+/* Frame protocol, see scripts/flash_loader.py */
+#define FLASH_LOADER_MAGIC              (0x4C46u)   /* "FL" */
+
+#define FLASH_LOADER_CMD_START          (1u)        /* addr, length: image range, sector aligned */
+#define FLASH_LOADER_CMD_DATA           (2u)        /* addr, length, crc: chunk, followed by length bytes */
+#define FLASH_LOADER_CMD_END            (3u)        /* crc: CRC-32 of the whole range */
+
+#define FLASH_LOADER_STATUS_ACK         (0u)
+#define FLASH_LOADER_STATUS_NAK_CRC     (1u)        /* Chunk damaged on the link; send it again */
+#define FLASH_LOADER_STATUS_PROTOCOL    (2u)
+#define FLASH_LOADER_STATUS_BOUNDS      (3u)
+#define FLASH_LOADER_STATUS_FLASH       (4u)
+#define FLASH_LOADER_STATUS_VERIFY      (5u)
+
+#define FLASH_LOADER_RSLT_ERR_BAD_PARAM APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOADER, 1u)
+#define FLASH_LOADER_RSLT_ERR_UART      APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOADER, 2u)
+#define FLASH_LOADER_RSLT_ERR_TIMEOUT   APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOADER, 3u)
+#define FLASH_LOADER_RSLT_ERR_VERIFY    APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOADER, 4u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Host to target; little-endian */
+typedef struct
+{
+    uint16_t magic;
+    uint8_t cmd;
+    uint8_t seq;
+    uint32_t addr;              /* Address in the memory (not the XIP address) */
+    uint32_t length;
+    uint32_t crc;               /* CRC-32 (IEEE 802.3) */
+} flash_loader_frame_t;
+
+/* Target to host, one per frame */
+typedef struct
+{
+    uint16_t magic;
+    uint8_t status;
+    uint8_t seq;                /* Of the frame answered */
+    uint32_t value;             /* Bytes programmed so far */
+} flash_loader_reply_t;
+
+typedef struct
+{
+    uint32_t bytes;             /* Bytes programmed */
+    uint32_t chunks;
+    uint32_t erases;
+    uint32_t retries;           /* Chunks rejected because of a link CRC error */
+    uint32_t total_us;          /* From the START frame to the END reply */
+    uint32_t flash_idle_us;     /* Flash idle, waiting for data: link bound */
+    uint32_t host_stall_us;     /* Host held, both buffers full: flash bound */
+} flash_loader_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t flash_loader_run(const cy_stc_smif_mem_config_t *mem_config, uint32_t wait_ms, bool *programmed);
+void flash_loader_get_stats(flash_loader_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_LOADER_H */
+
+/* [] END OF FILE */
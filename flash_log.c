@@ -0,0 +1,713 @@
+/******************************************************************************
+* File Name:   flash_log.c
+*
+* Description: This file contains a streaming logger to the external memory.
+*              Producers append entries to a lock-free single-producer,
+*              single-consumer ring in SRAM; flash_log_task(), run in the
+*              background, batches them into page programs and erases the
+*              next sector ahead of the write head.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "flash_log.h"
+#include "flash_suspend.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* On the memory, each entry is a 16-bit length followed by the payload. A
+ * length of 0 skips to the next sector and 0xFFFF (erased) ends the log.
+ */
+#define FLASH_LOG_HDR_SIZE              (sizeof(uint16_t))
+#define FLASH_LOG_NEXT_SECTOR           (0x0000u)
+#define FLASH_LOG_END                   (0xFFFFu)
+
+/* Benchmark: a timer interrupt produces FLASH_LOG_DEMO_ENTRY byte entries at
+ * FLASH_LOG_DEMO_RATE_HZ until FLASH_LOG_DEMO_MAX_BYTES are accepted or all
+ * but two sectors are filled.
+ */
+#define FLASH_LOG_DEMO_SECTORS          (4u)
+#define FLASH_LOG_DEMO_RATE_HZ          (1500u)
+#define FLASH_LOG_DEMO_ENTRY            (32u)
+#define FLASH_LOG_DEMO_MAX_BYTES        (256u * 1024u)
+#define FLASH_LOG_DEMO_TIMER_FREQ_HZ    (1000000u)
+#define FLASH_LOG_DEMO_INTR_PRIORITY    (2u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static bool log_ready = false;
+static uint32_t log_base;
+static uint32_t log_sector_size;
+static uint32_t log_num_sectors;
+static uint32_t log_page_size;
+
+/* The producer only writes log_ring_head, the consumer only log_ring_tail */
+static uint8_t log_ring[FLASH_LOG_RING_SIZE];
+static volatile uint32_t log_ring_head;
+static volatile uint32_t log_ring_tail;
+
+/* Cycle counter value when the producer first found the ring full, or 0 */
+static uint32_t log_stall_start;
+
+static flash_log_stats_t log_stats;
+
+/* Page being filled: only [log_page_programmed, log_page_fill) is pending */
+static uint8_t log_page[FLASH_LOG_MAX_PAGE_SIZE];
+static uint32_t log_page_addr;
+static uint32_t log_page_fill;
+static uint32_t log_page_programmed;
+
+/* Sector holding the write head, and state of the one after it */
+static uint32_t log_sector;
+static bool log_next_erased;
+static bool log_erasing;
+
+/* Benchmark producer */
+static cyhal_timer_t demo_timer;
+static volatile bool demo_done;
+static uint32_t demo_seq;
+static uint32_t demo_target;
+
+/*******************************************************************************
+* Function Name: log_ring_copy_in
+****************************************************************************//**
+* Summary:
+*  Copies data into the ring at a free-running position.
+*
+*******************************************************************************/
+static void log_ring_copy_in(uint32_t pos, const uint8_t *data, uint32_t length)
+{
+    uint32_t index = pos & (FLASH_LOG_RING_SIZE - 1u);
+    uint32_t first = ((FLASH_LOG_RING_SIZE - index) < length) ? (FLASH_LOG_RING_SIZE - index) : length;
+
+    memcpy(&log_ring[index], data, first);
+    memcpy(log_ring, &data[first], length - first);
+}
+
+/*******************************************************************************
+* Function Name: log_ring_copy_out
+****************************************************************************//**
+* Summary:
+*  Copies data out of the ring from a free-running position.
+*
+*******************************************************************************/
+static void log_ring_copy_out(uint32_t pos, uint8_t *data, uint32_t length)
+{
+    uint32_t index = pos & (FLASH_LOG_RING_SIZE - 1u);
+    uint32_t first = ((FLASH_LOG_RING_SIZE - index) < length) ? (FLASH_LOG_RING_SIZE - index) : length;
+
+    memcpy(data, &log_ring[index], first);
+    memcpy(&data[first], log_ring, length - first);
+}
+
+static inline uint32_t log_sector_addr(uint32_t sector)
+{
+    return log_base + (sector * log_sector_size);
+}
+
+static inline uint32_t log_sector_used(void)
+{
+    return (log_page_addr + log_page_fill) - log_sector_addr(log_sector);
+}
+
+/*******************************************************************************
+* Function Name: log_program
+****************************************************************************//**
+* Summary:
+*  Programs the pending bytes of the staged page.
+*
+*******************************************************************************/
+static cy_rslt_t log_program(void)
+{
+    uint32_t length = log_page_fill - log_page_programmed;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if(0u != length)
+    {
+        result = cy_serial_flash_qspi_write(log_page_addr + log_page_programmed, length,
+                                            &log_page[log_page_programmed]);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            log_page_programmed = log_page_fill;
+            log_stats.programs++;
+            log_stats.flash_bytes += length;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: log_put
+****************************************************************************//**
+* Summary:
+*  Appends bytes to the staged page, programming each page once it is full.
+*
+*******************************************************************************/
+static cy_rslt_t log_put(const uint8_t *data, uint32_t length)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while((0u != length) && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t chunk = log_page_size - log_page_fill;
+
+        chunk = (chunk < length) ? chunk : length;
+        memcpy(&log_page[log_page_fill], data, chunk);
+        log_page_fill += chunk;
+        data += chunk;
+        length -= chunk;
+
+        if(log_page_size == log_page_fill)
+        {
+            result = log_program();
+            log_page_addr += log_page_size;
+            log_page_fill = 0u;
+            log_page_programmed = 0u;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: log_next_sector
+****************************************************************************//**
+* Summary:
+*  Closes the current sector with a skip marker and moves the write head to
+*  the start of the next one, which must be erased.
+*
+*******************************************************************************/
+static cy_rslt_t log_next_sector(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if((log_sector_used() + FLASH_LOG_HDR_SIZE) <= log_sector_size)
+    {
+        const uint16_t marker = FLASH_LOG_NEXT_SECTOR;
+
+        result = log_put((const uint8_t *)&marker, FLASH_LOG_HDR_SIZE);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = log_program();
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        log_sector = (log_sector + 1u) % log_num_sectors;
+        log_page_addr = log_sector_addr(log_sector);
+        log_page_fill = 0u;
+        log_page_programmed = 0u;
+        log_next_erased = false;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_log_init
+****************************************************************************//**
+* Summary:
+*  Erases the first sector of the log and empties the ring. The log is a
+*  circular buffer of sectors: once the last one is reached, the oldest data
+*  is erased. Call in MMIO mode, after cy_serial_flash_qspi_init().
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*  base - address of the first sector.
+*  num_sectors - number of sectors, at least 2, of the same size.
+*
+*******************************************************************************/
+cy_rslt_t flash_log_init(const cy_stc_smif_mem_config_t *mem_config, uint32_t base, uint32_t num_sectors)
+{
+    log_ready = false;
+
+    if((NULL == mem_config) || (num_sectors < 2u))
+    {
+        return FLASH_LOG_RSLT_ERR_BAD_PARAM;
+    }
+
+    log_base = base;
+    log_num_sectors = num_sectors;
+    log_sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(base);
+    log_page_size = (uint32_t)cy_serial_flash_qspi_get_prog_size(base);
+
+    if((0u == log_sector_size) || (0u != (base % log_sector_size)) || (0u == log_page_size) ||
+       (log_page_size > FLASH_LOG_MAX_PAGE_SIZE) ||
+       (log_sector_size != cy_serial_flash_qspi_get_erase_size(log_sector_addr(num_sectors - 1u))))
+    {
+        return FLASH_LOG_RSLT_ERR_SECTOR_MAP;
+    }
+
+    cy_rslt_t result = flash_suspend_init(mem_config);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_erase(base, log_sector_size);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        memset(&log_stats, 0, sizeof(log_stats));
+        log_ring_head = 0u;
+        log_ring_tail = 0u;
+        log_stall_start = 0u;
+        log_sector = 0u;
+        log_page_addr = base;
+        log_page_fill = 0u;
+        log_page_programmed = 0u;
+        log_next_erased = false;
+        log_erasing = false;
+        log_ready = true;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_log_write
+****************************************************************************//**
+* Summary:
+*  Appends an entry to the ring without blocking. Safe to call from an
+*  interrupt, as long as all entries come from a single context (one
+*  interrupt, or one task).
+*
+* Parameters:
+*  entry - entry data.
+*  length - entry length, 1 to FLASH_LOG_MAX_ENTRY bytes.
+*
+* Return:
+*  FLASH_LOG_RSLT_ERR_FULL if the ring has no room; the entry is dropped.
+*
+*******************************************************************************/
+cy_rslt_t flash_log_write(const void *entry, size_t length)
+{
+    if(!log_ready)
+    {
+        return FLASH_LOG_RSLT_ERR_NOT_INIT;
+    }
+
+    if((NULL == entry) || (0u == length) || (length > FLASH_LOG_MAX_ENTRY))
+    {
+        return FLASH_LOG_RSLT_ERR_BAD_PARAM;
+    }
+
+    uint32_t head = log_ring_head;
+    uint32_t size = FLASH_LOG_HDR_SIZE + (uint32_t)length;
+    uint32_t fill = head - log_ring_tail;
+
+    if((FLASH_LOG_RING_SIZE - fill) < size)
+    {
+        log_stats.dropped++;
+        log_stall_start = (0u != log_stall_start) ? log_stall_start : (cycle_counter_get() | 1u);
+
+        return FLASH_LOG_RSLT_ERR_FULL;
+    }
+
+    if(0u != log_stall_start)
+    {
+        uint32_t stall = cycle_counter_get() - log_stall_start;
+
+        log_stats.max_stall_cycles = (stall > log_stats.max_stall_cycles) ? stall : log_stats.max_stall_cycles;
+        log_stall_start = 0u;
+    }
+
+    const uint16_t hdr = (uint16_t)length;
+
+    log_ring_copy_in(head, (const uint8_t *)&hdr, FLASH_LOG_HDR_SIZE);
+    log_ring_copy_in(head + FLASH_LOG_HDR_SIZE, (const uint8_t *)entry, (uint32_t)length);
+
+    /* Publish the entry only once its data is in the ring */
+    __DMB();
+    log_ring_head = head + size;
+
+    log_stats.entries++;
+    log_stats.bytes += (uint32_t)length;
+    log_stats.max_fill = ((fill + size) > log_stats.max_fill) ? (fill + size) : log_stats.max_fill;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: flash_log_task
+****************************************************************************//**
+* Summary:
+*  Moves entries from the ring to the memory. Call repeatedly from the main
+*  loop or a low-priority task. Each call programs at most one page (blocking
+*  for the page program time) or starts an erase, and returns immediately
+*  while an erase is in progress.
+*
+*  The sector after the write head is erased ahead of time, as soon as the
+*  ring holds at most FLASH_LOG_ERASE_MAX_FILL bytes, so that the erase falls
+*  in a quiet period rather than in a burst.
+*
+*******************************************************************************/
+cy_rslt_t flash_log_task(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t programs = log_stats.programs;
+
+    if(!log_ready)
+    {
+        return FLASH_LOG_RSLT_ERR_NOT_INIT;
+    }
+
+    if(log_erasing)
+    {
+        if(flash_suspend_is_busy())
+        {
+            return CY_RSLT_SUCCESS;
+        }
+
+        log_erasing = false;
+        log_next_erased = true;
+    }
+
+    while((CY_RSLT_SUCCESS == result) && (programs == log_stats.programs))
+    {
+        uint8_t entry[FLASH_LOG_HDR_SIZE + FLASH_LOG_MAX_ENTRY];
+        uint16_t length = 0u;
+        uint32_t tail = log_ring_tail;
+        uint32_t fill = log_ring_head - tail;
+        bool blocked = false;
+
+        if(0u != fill)
+        {
+            log_ring_copy_out(tail, (uint8_t *)&length, FLASH_LOG_HDR_SIZE);
+            blocked = ((log_sector_used() + FLASH_LOG_HDR_SIZE + length) > log_sector_size);
+        }
+
+        if(!log_next_erased && ((fill <= FLASH_LOG_ERASE_MAX_FILL) || blocked))
+        {
+            result = flash_suspend_erase_start(log_sector_addr((log_sector + 1u) % log_num_sectors));
+
+            if(CY_RSLT_SUCCESS == result)
+            {
+                log_erasing = true;
+                log_stats.erases++;
+            }
+
+            break;
+        }
+
+        if(0u == fill)
+        {
+            break;
+        }
+
+        if(blocked)
+        {
+            result = log_next_sector();
+        }
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            log_ring_copy_out(tail, entry, FLASH_LOG_HDR_SIZE + length);
+            result = log_put(entry, FLASH_LOG_HDR_SIZE + length);
+        }
+
+        /* Release the space only once the entry has been copied out */
+        __DMB();
+        log_ring_tail = tail + FLASH_LOG_HDR_SIZE + length;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_log_flush
+****************************************************************************//**
+* Summary:
+*  Moves all entries in the ring to the memory, including a partial last
+*  page, and waits for a pending erase. Blocking.
+*
+*******************************************************************************/
+cy_rslt_t flash_log_flush(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while((CY_RSLT_SUCCESS == result) && !flash_log_is_idle())
+    {
+        result = flash_log_task();
+
+        if((CY_RSLT_SUCCESS == result) && (log_ring_head == log_ring_tail) && !log_erasing)
+        {
+            result = log_program();
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_log_is_idle
+****************************************************************************//**
+* Summary:
+*  Returns true if the ring is empty, all staged data is programmed and no
+*  erase is in progress.
+*
+*******************************************************************************/
+bool flash_log_is_idle(void)
+{
+    return (log_ring_head == log_ring_tail) && !log_erasing && (log_page_fill == log_page_programmed);
+}
+
+/*******************************************************************************
+* Function Name: flash_log_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the counters of the logger.
+*
+*******************************************************************************/
+void flash_log_get_stats(flash_log_stats_t *stats)
+{
+    *stats = log_stats;
+}
+
+/*******************************************************************************
+* Function Name: demo_producer_isr
+****************************************************************************//**
+* Summary:
+*  Benchmark producer: logs one entry holding a sequence number and the cycle
+*  counter. The sequence number also advances for dropped entries.
+*
+*******************************************************************************/
+static void demo_producer_isr(void *callback_arg, cyhal_timer_event_t event)
+{
+    uint32_t entry[FLASH_LOG_DEMO_ENTRY / sizeof(uint32_t)];
+
+    CY_UNUSED_PARAMETER(callback_arg);
+    CY_UNUSED_PARAMETER(event);
+
+    if(demo_done)
+    {
+        return;
+    }
+
+    entry[0] = demo_seq++;
+    entry[1] = cycle_counter_get();
+
+    for(uint32_t index = 2u; index < (FLASH_LOG_DEMO_ENTRY / sizeof(uint32_t)); index++)
+    {
+        entry[index] = entry[0] ^ index;
+    }
+
+    (void)flash_log_write(entry, sizeof(entry));
+
+    if(log_stats.bytes >= demo_target)
+    {
+        demo_done = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: demo_verify
+****************************************************************************//**
+* Summary:
+*  Reads the log back from the first sector and checks that it holds every
+*  accepted entry, in order.
+*
+*******************************************************************************/
+static cy_rslt_t demo_verify(uint32_t expected)
+{
+    uint32_t entry[FLASH_LOG_DEMO_ENTRY / sizeof(uint32_t)];
+    uint32_t addr = log_base;
+    uint32_t count = 0u;
+    uint32_t last_seq = 0u;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while((CY_RSLT_SUCCESS == result) && (addr < log_sector_addr(log_num_sectors)))
+    {
+        uint16_t length;
+        uint32_t offset = (addr - log_base) % log_sector_size;
+
+        if((offset + FLASH_LOG_HDR_SIZE) > log_sector_size)
+        {
+            addr += log_sector_size - offset;
+            continue;
+        }
+
+        result = cy_serial_flash_qspi_read(addr, FLASH_LOG_HDR_SIZE, (uint8_t *)&length);
+
+        if((CY_RSLT_SUCCESS != result) || (FLASH_LOG_END == length))
+        {
+            break;
+        }
+
+        if(FLASH_LOG_NEXT_SECTOR == length)
+        {
+            addr += log_sector_size - offset;
+            continue;
+        }
+
+        if(sizeof(entry) != length)
+        {
+            result = FLASH_LOG_RSLT_ERR_VERIFY;
+            break;
+        }
+
+        result = cy_serial_flash_qspi_read(addr + FLASH_LOG_HDR_SIZE, length, (uint8_t *)entry);
+
+        if((CY_RSLT_SUCCESS == result) && (0u != count) && (entry[0] <= last_seq))
+        {
+            result = FLASH_LOG_RSLT_ERR_VERIFY;
+        }
+
+        last_seq = entry[0];
+        count++;
+        addr += FLASH_LOG_HDR_SIZE + length;
+    }
+
+    return ((CY_RSLT_SUCCESS == result) && (count != expected)) ? FLASH_LOG_RSLT_ERR_VERIFY : result;
+}
+
+/*******************************************************************************
+* Function Name: flash_log_benchmark
+****************************************************************************//**
+* Summary:
+*  Logs entries from a timer interrupt while the main loop runs
+*  flash_log_task(), then reports the sustained ingest rate, the drops, the
+*  peak ring usage and the longest producer stall, and verifies the log.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*  ext_addr - address of the first of FLASH_LOG_DEMO_SECTORS sectors.
+*
+*******************************************************************************/
+cy_rslt_t flash_log_benchmark(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr)
+{
+    const cyhal_timer_cfg_t timer_cfg =
+    {
+        .compare_value = 0u,
+        .period = (FLASH_LOG_DEMO_TIMER_FREQ_HZ / FLASH_LOG_DEMO_RATE_HZ) - 1u,
+        .direction = CYHAL_TIMER_DIR_UP,
+        .is_compare = false,
+        .is_continuous = true,
+        .value = 0u
+    };
+    flash_log_stats_t stats;
+
+    cy_rslt_t result = flash_log_init(mem_config, ext_addr, FLASH_LOG_DEMO_SECTORS);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    demo_target = (FLASH_LOG_DEMO_SECTORS - 2u) * log_sector_size;
+    demo_target = (demo_target < FLASH_LOG_DEMO_MAX_BYTES) ? demo_target : FLASH_LOG_DEMO_MAX_BYTES;
+    demo_seq = 0u;
+    demo_done = false;
+
+    result = cyhal_timer_init(&demo_timer, NC, NULL);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = cyhal_timer_configure(&demo_timer, &timer_cfg);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_timer_set_frequency(&demo_timer, FLASH_LOG_DEMO_TIMER_FREQ_HZ);
+    }
+
+    uint32_t start = cycle_counter_get();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        cyhal_timer_register_callback(&demo_timer, demo_producer_isr, NULL);
+        cyhal_timer_enable_event(&demo_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, FLASH_LOG_DEMO_INTR_PRIORITY, true);
+        start = cycle_counter_get();
+        result = cyhal_timer_start(&demo_timer);
+    }
+
+    while((CY_RSLT_SUCCESS == result) && !demo_done)
+    {
+        result = flash_log_task();
+    }
+
+    (void)cyhal_timer_stop(&demo_timer);
+    cyhal_timer_free(&demo_timer);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = flash_log_flush();
+    }
+
+    uint32_t elapsed_ms = cycle_counter_to_us(cycle_counter_get() - start) / 1000u;
+
+    elapsed_ms = (0u != elapsed_ms) ? elapsed_ms : 1u;
+    flash_log_get_stats(&stats);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = demo_verify(stats.entries);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("Producer: %"PRIu32" entries/s of %"PRIu32" bytes (%"PRIu32" KB/s) from a timer interrupt\n",
+               (uint32_t)FLASH_LOG_DEMO_RATE_HZ, (uint32_t)FLASH_LOG_DEMO_ENTRY,
+               (uint32_t)((FLASH_LOG_DEMO_RATE_HZ * FLASH_LOG_DEMO_ENTRY) / 1000u));
+        printf("  Logged %"PRIu32" entries (%"PRIu32" KB) in %"PRIu32" ms: %"PRIu32" KB/s sustained\n",
+               stats.entries, stats.bytes / 1000u, elapsed_ms, stats.bytes / elapsed_ms);
+        printf("  Dropped %"PRIu32", peak ring usage %"PRIu32" of %"PRIu32" bytes, longest stall %"PRIu32" us\n",
+               stats.dropped, stats.max_fill, (uint32_t)FLASH_LOG_RING_SIZE,
+               cycle_counter_to_us(stats.max_stall_cycles));
+        printf("  %"PRIu32" programs (%"PRIu32" bytes average), %"PRIu32" sectors erased ahead\n", stats.programs,
+               stats.flash_bytes / ((0u != stats.programs) ? stats.programs : 1u), stats.erases);
+        printf("Log read back, all entries verified.\n");
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,124 @@
+/******************************************************************************
+* File Name:   flash_log.h
+*
+* Description: This file contains the macros, data types and function
+*              declarations of the streaming flash logger.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the logger benchmark before entering XIP mode */
+#ifndef FLASH_LOG_DEMO_ENABLE
+#define FLASH_LOG_DEMO_ENABLE           (0u)
+#endif
+
+/* Size of the SRAM ring, a power of two. It must absorb the entries produced
+ * during a sector erase, when no page can be programmed.
+ */
+#ifndef FLASH_LOG_RING_SIZE
+#define FLASH_LOG_RING_SIZE             (32u * 1024u)
+#endif
+
+/* Largest entry payload */
+#define FLASH_LOG_MAX_ENTRY             (64u)
+
+/* Largest program page size supported by the staging buffer */
+#define FLASH_LOG_MAX_PAGE_SIZE         (512u)
+
+/* The erase of the next sector is started once the ring holds no more than
+ * this, unless the write head already needs that sector.
+ */
+#ifndef FLASH_LOG_ERASE_MAX_FILL
+#define FLASH_LOG_ERASE_MAX_FILL        (FLASH_LOG_RING_SIZE / 4u)
+#endif
+
+#if ((FLASH_LOG_RING_SIZE & (FLASH_LOG_RING_SIZE - 1u)) != 0u)
+#error "FLASH_LOG_RING_SIZE must be a power of two"
+#endif
+
+#define FLASH_LOG_RSLT_ERR_BAD_PARAM    APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOG, 1u)
+#define FLASH_LOG_RSLT_ERR_NOT_INIT     APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOG, 2u)
+#define FLASH_LOG_RSLT_ERR_FULL         APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOG, 3u)
+#define FLASH_LOG_RSLT_ERR_SECTOR_MAP   APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOG, 4u)
+#define FLASH_LOG_RSLT_ERR_VERIFY       APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_LOG, 5u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t entries;           /* Entries accepted by flash_log_write() */
+    uint32_t bytes;             /* Payload bytes accepted */
+    uint32_t dropped;           /* Entries rejected because the ring was full */
+    uint32_t max_fill;          /* Highest ring usage, in bytes */
+    uint32_t max_stall_cycles;  /* Longest time the producer found the ring full */
+    uint32_t programs;          /* Program operations issued */
+    uint32_t erases;            /* Sectors erased ahead of the write head */
+    uint32_t flash_bytes;       /* Bytes programmed, entry headers included */
+} flash_log_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t flash_log_init(const cy_stc_smif_mem_config_t *mem_config, uint32_t base, uint32_t num_sectors);
+cy_rslt_t flash_log_write(const void *entry, size_t length);
+cy_rslt_t flash_log_task(void);
+cy_rslt_t flash_log_flush(void);
+bool flash_log_is_idle(void);
+void flash_log_get_stats(flash_log_stats_t *stats);
+cy_rslt_t flash_log_benchmark(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_LOG_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,355 @@
+/******************************************************************************
+* File Name:   flash_suspend.c
+*
+* Description: This file contains the suspend-aware flash access layer and a
+*              demo that compares the worst-case read latency during a sector
+*              erase with and without erase suspend.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "flash_suspend.h"
+#include "smif_mmio.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define FLASH_SUSPEND_DEMO_READ_SIZE    (256u)
+#define FLASH_SUSPEND_DEMO_PERIOD_US    (500u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t reads;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    uint32_t erase_cycles;
+} demo_latency_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Range affected by the program or erase in progress, empty if none */
+static uint32_t busy_start = 0u;
+static uint32_t busy_end = 0u;
+
+/* Cycle counter value at the last resume */
+static uint32_t last_resume = 0u;
+
+/*******************************************************************************
+* Function Name: suspend_us_to_cycles
+****************************************************************************//**
+* Summary:
+*  Converts microseconds to CM4 clock cycles.
+*
+*******************************************************************************/
+static uint32_t suspend_us_to_cycles(uint32_t us)
+{
+    return us * (SystemCoreClock / 1000000u);
+}
+
+/*******************************************************************************
+* Function Name: flash_suspend_init
+****************************************************************************//**
+* Summary:
+*  Initializes the layer. Call after cy_serial_flash_qspi_init().
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t flash_suspend_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    busy_start = 0u;
+    busy_end = 0u;
+    cycle_counter_init();
+    last_resume = cycle_counter_get() - suspend_us_to_cycles(FLASH_SUSPEND_RESUME_GAP_US);
+
+    return smif_mmio_init(mem_config);
+}
+
+/*******************************************************************************
+* Function Name: flash_suspend_erase_start
+****************************************************************************//**
+* Summary:
+*  Starts erasing the sector that contains an address and returns without
+*  waiting. Poll flash_suspend_is_busy() to detect completion.
+*
+* Parameters:
+*  addr - address in the sector to erase.
+*
+*******************************************************************************/
+cy_rslt_t flash_suspend_erase_start(uint32_t addr)
+{
+    uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(addr);
+    uint32_t sector_start = addr - (addr % sector_size);
+    cy_rslt_t result = smif_mmio_sector_erase_start(sector_start);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        busy_start = sector_start;
+        busy_end = sector_start + sector_size;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_suspend_program_start
+****************************************************************************//**
+* Summary:
+*  Starts programming up to one page and returns without waiting. Poll
+*  flash_suspend_is_busy() to detect completion.
+*
+* Parameters:
+*  addr - address to program.
+*  buf - data to program.
+*  length - number of bytes, not crossing a page boundary.
+*
+*******************************************************************************/
+cy_rslt_t flash_suspend_program_start(uint32_t addr, const uint8_t *buf, uint32_t length)
+{
+    uint32_t page_size = smif_mmio_get_page_size();
+    cy_rslt_t result = smif_mmio_program_start(addr, buf, length);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        busy_start = addr - (addr % page_size);
+        busy_end = busy_start + page_size;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_suspend_is_busy
+****************************************************************************//**
+* Summary:
+*  Returns true while the program or erase started by this layer is in
+*  progress.
+*
+*******************************************************************************/
+bool flash_suspend_is_busy(void)
+{
+    if((busy_start != busy_end) && !smif_mmio_is_busy())
+    {
+        busy_start = 0u;
+        busy_end = 0u;
+    }
+
+    return (busy_start != busy_end);
+}
+
+/*******************************************************************************
+* Function Name: flash_suspend_read
+****************************************************************************//**
+* Summary:
+*  Reads data from the external memory. If a program or erase started by this
+*  layer is in progress, it is suspended for the duration of the read and then
+*  resumed, so the read waits at most FLASH_SUSPEND_RESUME_GAP_US plus
+*  FLASH_SUSPEND_LATENCY_US instead of the whole operation. The range must not
+*  overlap the sector or page being erased or programmed. XIP fetches cannot
+*  suspend an operation, so this applies to MMIO reads only.
+*
+* Parameters:
+*  addr - address to read.
+*  length - number of bytes.
+*  buf - buffer for the data.
+*
+*******************************************************************************/
+cy_rslt_t flash_suspend_read(uint32_t addr, uint32_t length, uint8_t *buf)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if((NULL == buf) || (0u == length))
+    {
+        return FLASH_SUSPEND_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(!flash_suspend_is_busy())
+    {
+        return smif_mmio_read(addr, buf, length);
+    }
+
+    if((addr < busy_end) && ((addr + length) > busy_start))
+    {
+        return FLASH_SUSPEND_RSLT_ERR_BUSY_REGION;
+    }
+
+    /* Let the operation progress since the last resume */
+    while((cycle_counter_get() - last_resume) < suspend_us_to_cycles(FLASH_SUSPEND_RESUME_GAP_US))
+    {
+    }
+
+    result = smif_mmio_suspend();
+
+    uint32_t start = cycle_counter_get();
+
+    while((CY_RSLT_SUCCESS == result) && smif_mmio_is_busy())
+    {
+        if((cycle_counter_get() - start) > suspend_us_to_cycles(FLASH_SUSPEND_LATENCY_US))
+        {
+            result = FLASH_SUSPEND_RSLT_ERR_TIMEOUT;
+        }
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = smif_mmio_read(addr, buf, length);
+    }
+
+    /* Resume even if the read failed, a suspended operation never completes */
+    cy_rslt_t resume_result = smif_mmio_resume();
+    last_resume = cycle_counter_get();
+
+    return (CY_RSLT_SUCCESS != result) ? result : resume_result;
+}
+
+/*******************************************************************************
+* Function Name: demo_measure
+****************************************************************************//**
+* Summary:
+*  Erases a sector while reading another one every FLASH_SUSPEND_DEMO_PERIOD_US,
+*  and records the latency of each read request.
+*
+*******************************************************************************/
+static cy_rslt_t demo_measure(uint32_t erase_addr, uint32_t read_addr, bool suspend, demo_latency_t *latency)
+{
+    static uint8_t buf[FLASH_SUSPEND_DEMO_READ_SIZE];
+    uint32_t erase_start = cycle_counter_get();
+    cy_rslt_t result = flash_suspend_erase_start(erase_addr);
+
+    latency->reads = 0u;
+    latency->max_cycles = 0u;
+    latency->total_cycles = 0u;
+
+    while((CY_RSLT_SUCCESS == result) && flash_suspend_is_busy())
+    {
+        Cy_SysLib_DelayUs(FLASH_SUSPEND_DEMO_PERIOD_US);
+
+        uint32_t start = cycle_counter_get();
+
+        if(suspend)
+        {
+            result = flash_suspend_read(read_addr, sizeof(buf), buf);
+        }
+        else
+        {
+            /* What a blocking read does: wait for the operation to complete */
+            while(flash_suspend_is_busy())
+            {
+            }
+
+            result = smif_mmio_read(read_addr, buf, sizeof(buf));
+        }
+
+        uint32_t cycles = cycle_counter_get() - start;
+
+        latency->reads++;
+        latency->total_cycles += cycles;
+        latency->max_cycles = (cycles > latency->max_cycles) ? cycles : latency->max_cycles;
+    }
+
+    latency->erase_cycles = cycle_counter_get() - erase_start;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: demo_report
+****************************************************************************//**
+* Summary:
+*  Prints the result of one demo pass.
+*
+*******************************************************************************/
+static void demo_report(const char *name, const demo_latency_t *latency)
+{
+    uint32_t average = (0u != latency->reads) ? (uint32_t)(latency->total_cycles / latency->reads) : 0u;
+
+    printf("  %-16s %4"PRIu32" reads, max %8"PRIu32" us, avg %8"PRIu32" us, erase %8"PRIu32" us\n", name,
+           latency->reads, cycle_counter_to_us(latency->max_cycles), cycle_counter_to_us(average),
+           cycle_counter_to_us(latency->erase_cycles));
+}
+
+/*******************************************************************************
+* Function Name: flash_suspend_demo
+****************************************************************************//**
+* Summary:
+*  Reports the worst-case latency of 256-byte reads issued during a sector
+*  erase, first waiting for the erase as a blocking read does, then with erase
+*  suspend. Must be called in MMIO mode.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*  erase_addr - address of a sector that may be erased.
+*  read_addr - address in another sector to read from.
+*
+*******************************************************************************/
+cy_rslt_t flash_suspend_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t erase_addr, uint32_t read_addr)
+{
+    demo_latency_t latency;
+    cy_rslt_t result = flash_suspend_init(mem_config);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("Reading %u bytes every %u us during a sector erase:\n", (unsigned int)FLASH_SUSPEND_DEMO_READ_SIZE,
+               (unsigned int)FLASH_SUSPEND_DEMO_PERIOD_US);
+        result = demo_measure(erase_addr, read_addr, false, &latency);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        demo_report("without suspend:", &latency);
+        result = demo_measure(erase_addr, read_addr, true, &latency);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        demo_report("with suspend:", &latency);
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   flash_suspend.h
+*
+* Description: This file contains the declarations of the suspend-aware flash
+*              access layer. Reads issued while an erase or program is in
+*              progress suspend the operation, read, and resume it, instead
+*              of waiting for the operation to complete.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FLASH_SUSPEND_H
+#define FLASH_SUSPEND_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the read latency demo before entering XIP mode */
+#ifndef FLASH_SUSPEND_DEMO_ENABLE
+#define FLASH_SUSPEND_DEMO_ENABLE           (0u)
+#endif
+
+/* Maximum time for the memory to enter the suspended state (tSL) */
+#define FLASH_SUSPEND_LATENCY_US            (100u)
+
+/* Minimum time between a resume and the next suspend (tRS). Without it, a
+ * steady stream of reads may keep the erase from making progress.
+ */
+#define FLASH_SUSPEND_RESUME_GAP_US         (100u)
+
+#define FLASH_SUSPEND_RSLT_ERR_BAD_PARAM    APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SUSPEND, 1u)
+#define FLASH_SUSPEND_RSLT_ERR_BUSY_REGION  APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SUSPEND, 2u)
+#define FLASH_SUSPEND_RSLT_ERR_TIMEOUT      APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_SUSPEND, 3u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t flash_suspend_init(const cy_stc_smif_mem_config_t *mem_config);
+cy_rslt_t flash_suspend_erase_start(uint32_t addr);
+cy_rslt_t flash_suspend_program_start(uint32_t addr, const uint8_t *buf, uint32_t length);
+bool flash_suspend_is_busy(void);
+cy_rslt_t flash_suspend_read(uint32_t addr, uint32_t length, uint8_t *buf);
+cy_rslt_t flash_suspend_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t erase_addr, uint32_t read_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_SUSPEND_H */
+
+/* [] END OF FILE */
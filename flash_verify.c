@@ -0,0 +1,673 @@
+/******************************************************************************
+* File Name:   flash_verify.c
+*
+* Description: This file implements the integrity engine. CRC-32 and SHA-256
+*              digests of external memory ranges are computed by the Crypto
+*              block; in XIP mode the data is read in place through the
+*              memory mapping, in MMIO mode DMA reads of the next chunk
+*              overlap the hashing of the current one.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "flash_verify.h"
+#include "qspi_async.h"
+#include "xip_read_mode.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* CRC-32 (IEEE 802.3): reflected, initial value and final XOR all ones */
+#define VERIFY_CRC32_POLYNOMIAL         (0x04C11DB7u)
+#define VERIFY_CRC32_REFLECTED          (0xEDB88320u)
+#define VERIFY_CRC32_INIT               (0xFFFFFFFFu)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    cy_rslt_t (*start)(void);
+    cy_rslt_t (*update)(const uint8_t *data, uint32_t length);
+    cy_rslt_t (*finish)(uint8_t *digest);
+} verify_engine_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const cy_stc_smif_mem_config_t *verify_mem_config = NULL;
+static flash_verify_stats_t verify_stats;
+
+/* Read by DMA in MMIO mode, alternately */
+CY_ALIGN(4) static uint8_t verify_buf[2][FLASH_VERIFY_CHUNK_SIZE];
+static volatile bool verify_read_done;
+static volatile cy_rslt_t verify_read_status;
+
+static uint32_t verify_crc_table[256];
+static uint32_t verify_crc;
+
+#if defined(CY_IP_MXCRYPTO)
+static cy_stc_crypto_sha_state_t verify_sha_state;
+#if (CY_IP_MXCRYPTO_VERSION == 1u)
+static cy_stc_crypto_v1_sha256_buffers_t verify_sha_buffers;
+#else
+static cy_stc_crypto_v2_sha256_buffers_t verify_sha_buffers;
+#endif
+#endif
+
+/*******************************************************************************
+* Function Name: verify_crc_cpu_start
+****************************************************************************//**
+* Summary:
+*  Starts a table-driven CRC-32 on the CPU.
+*
+*******************************************************************************/
+static cy_rslt_t verify_crc_cpu_start(void)
+{
+    verify_crc = VERIFY_CRC32_INIT;
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t verify_crc_cpu_update(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = verify_crc;
+
+    for(uint32_t index = 0; index < length; index++)
+    {
+        crc = verify_crc_table[(crc ^ data[index]) & 0xFFu] ^ (crc >> 8);
+    }
+
+    verify_crc = crc;
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t verify_crc_cpu_finish(uint8_t *digest)
+{
+    uint32_t crc = ~verify_crc;
+
+    memcpy(digest, &crc, sizeof(crc));
+    return CY_RSLT_SUCCESS;
+}
+
+#if defined(CY_IP_MXCRYPTO)
+/*******************************************************************************
+* Function Name: verify_crypto_status
+****************************************************************************//**
+* Summary:
+*  Converts a Crypto driver status to a result.
+*
+*******************************************************************************/
+static cy_rslt_t verify_crypto_status(cy_en_crypto_status_t status)
+{
+    return (CY_CRYPTO_SUCCESS == status) ? CY_RSLT_SUCCESS : FLASH_VERIFY_RSLT_ERR_CRYPTO;
+}
+
+/*******************************************************************************
+* Function Name: verify_crc_crypto_start
+****************************************************************************//**
+* Summary:
+*  Starts a CRC-32 in the Crypto block, in partial mode so that the data can
+*  be passed in chunks.
+*
+*******************************************************************************/
+static cy_rslt_t verify_crc_crypto_start(void)
+{
+    return verify_crypto_status(Cy_Crypto_Core_Crc_CalcInit(CRYPTO, 32u, VERIFY_CRC32_POLYNOMIAL, 1u, 0u, 1u,
+                                                            0xFFFFFFFFu, VERIFY_CRC32_INIT));
+}
+
+static cy_rslt_t verify_crc_crypto_update(const uint8_t *data, uint32_t length)
+{
+    return verify_crypto_status(Cy_Crypto_Core_Crc_CalcPartial(CRYPTO, data, length));
+}
+
+static cy_rslt_t verify_crc_crypto_finish(uint8_t *digest)
+{
+    uint32_t crc = 0u;
+    cy_rslt_t result = verify_crypto_status(Cy_Crypto_Core_Crc_CalcFinish(CRYPTO, 32u, &crc));
+
+    memcpy(digest, &crc, sizeof(crc));
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: verify_sha_start
+****************************************************************************//**
+* Summary:
+*  Starts a SHA-256 in the Crypto block.
+*
+*******************************************************************************/
+static cy_rslt_t verify_sha_start(void)
+{
+    cy_rslt_t result = verify_crypto_status(Cy_Crypto_Core_Sha_Init(CRYPTO, &verify_sha_state, CY_CRYPTO_MODE_SHA256,
+                                                                    &verify_sha_buffers));
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = verify_crypto_status(Cy_Crypto_Core_Sha_Start(CRYPTO, &verify_sha_state));
+    }
+
+    return result;
+}
+
+static cy_rslt_t verify_sha_update(const uint8_t *data, uint32_t length)
+{
+    return verify_crypto_status(Cy_Crypto_Core_Sha_Update(CRYPTO, &verify_sha_state, data, length));
+}
+
+static cy_rslt_t verify_sha_finish(uint8_t *digest)
+{
+    cy_rslt_t result = verify_crypto_status(Cy_Crypto_Core_Sha_Finish(CRYPTO, &verify_sha_state, digest));
+
+    (void)Cy_Crypto_Core_Sha_Free(CRYPTO, &verify_sha_state);
+    return result;
+}
+#endif
+
+static const verify_engine_t verify_engines[FLASH_VERIFY_ALGO_COUNT] =
+{
+    { verify_crc_cpu_start, verify_crc_cpu_update, verify_crc_cpu_finish },
+#if defined(CY_IP_MXCRYPTO)
+    { verify_crc_crypto_start, verify_crc_crypto_update, verify_crc_crypto_finish },
+    { verify_sha_start, verify_sha_update, verify_sha_finish }
+#else
+    { NULL, NULL, NULL },
+    { NULL, NULL, NULL }
+#endif
+};
+
+/*******************************************************************************
+* Function Name: verify_read_callback
+****************************************************************************//**
+* Summary:
+*  Completion callback of qspi_async_read(), called from the DMA interrupt.
+*
+*******************************************************************************/
+static void verify_read_callback(cy_rslt_t status, void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    verify_read_status = status;
+    verify_read_done = true;
+}
+
+/*******************************************************************************
+* Function Name: verify_read_start
+****************************************************************************//**
+* Summary:
+*  Starts reading a chunk into one of the buffers.
+*
+*******************************************************************************/
+static cy_rslt_t verify_read_start(uint32_t addr, uint32_t length, uint8_t *buf)
+{
+    verify_read_done = false;
+
+    cy_rslt_t result = qspi_async_read(addr, length, buf, verify_read_callback, NULL);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        verify_read_done = true;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: verify_read_wait
+****************************************************************************//**
+* Summary:
+*  Waits for the chunk being read and counts the time spent waiting.
+*
+*******************************************************************************/
+static cy_rslt_t verify_read_wait(void)
+{
+    uint32_t start = cycle_counter_get();
+
+    while(!verify_read_done)
+    {
+    }
+
+    verify_stats.wait_cycles += cycle_counter_get() - start;
+    return verify_read_status;
+}
+
+/*******************************************************************************
+* Function Name: verify_run_mapped
+****************************************************************************//**
+* Summary:
+*  Feeds the engine directly from the memory-mapped external memory. Every
+*  access goes through the SMIF cache, so the time spent waiting for the
+*  memory is part of the engine time.
+*
+*******************************************************************************/
+static cy_rslt_t verify_run_mapped(const verify_engine_t *engine, uint32_t addr, uint32_t length)
+{
+    const uint8_t *data = (const uint8_t *)(verify_mem_config->baseAddress + addr);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while((0u != length) && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t chunk = (length < FLASH_VERIFY_CHUNK_SIZE) ? length : FLASH_VERIFY_CHUNK_SIZE;
+
+        result = engine->update(data, chunk);
+        data += chunk;
+        length -= chunk;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: verify_run_mmio
+****************************************************************************//**
+* Summary:
+*  Feeds the engine from the SRAM buffers, starting the DMA read of the next
+*  chunk before the current one is hashed.
+*
+*******************************************************************************/
+static cy_rslt_t verify_run_mmio(const verify_engine_t *engine, uint32_t addr, uint32_t length)
+{
+    uint32_t chunk = (length < FLASH_VERIFY_CHUNK_SIZE) ? length : FLASH_VERIFY_CHUNK_SIZE;
+    uint32_t current = 0u;
+    cy_rslt_t result = verify_read_start(addr, chunk, verify_buf[current]);
+
+    while((0u != length) && (CY_RSLT_SUCCESS == result))
+    {
+        result = verify_read_wait();
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            uint32_t ready = chunk;
+
+            addr += ready;
+            length -= ready;
+
+            if(0u != length)
+            {
+                chunk = (length < FLASH_VERIFY_CHUNK_SIZE) ? length : FLASH_VERIFY_CHUNK_SIZE;
+                result = verify_read_start(addr, chunk, verify_buf[current ^ 1u]);
+            }
+
+            if(CY_RSLT_SUCCESS == result)
+            {
+                result = engine->update(verify_buf[current], ready);
+            }
+
+            current ^= 1u;
+        }
+    }
+
+    /* Do not return with a read still writing into the buffers */
+    (void)verify_read_wait();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_init
+****************************************************************************//**
+* Summary:
+*  Enables the Crypto block and prepares the CPU CRC table. Call after
+*  cy_serial_flash_qspi_init().
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init(),
+*               for the address of the memory-mapped region.
+*
+*******************************************************************************/
+cy_rslt_t flash_verify_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    if(NULL == mem_config)
+    {
+        return FLASH_VERIFY_RSLT_ERR_BAD_PARAM;
+    }
+
+    for(uint32_t index = 0; index < 256u; index++)
+    {
+        uint32_t crc = index;
+
+        for(uint32_t bit = 0; bit < 8u; bit++)
+        {
+            crc = (crc >> 1) ^ (VERIFY_CRC32_REFLECTED & (0u - (crc & 1u)));
+        }
+
+        verify_crc_table[index] = crc;
+    }
+
+#if defined(CY_IP_MXCRYPTO)
+    if(CY_CRYPTO_SUCCESS != Cy_Crypto_Core_Enable(CRYPTO))
+    {
+        return FLASH_VERIFY_RSLT_ERR_CRYPTO;
+    }
+#endif
+
+    verify_mem_config = mem_config;
+    cycle_counter_init();
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_deinit
+****************************************************************************//**
+* Summary:
+*  Disables the Crypto block.
+*
+*******************************************************************************/
+void flash_verify_deinit(void)
+{
+#if defined(CY_IP_MXCRYPTO)
+    if(NULL != verify_mem_config)
+    {
+        (void)Cy_Crypto_Core_Disable(CRYPTO);
+    }
+#endif
+
+    verify_mem_config = NULL;
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_compute
+****************************************************************************//**
+* Summary:
+*  Computes the digest of an external memory range. In XIP mode the data is
+*  read in place through the memory mapping; in MMIO mode it is read with
+*  qspi_async_read() into two alternating SRAM buffers, so that reading a
+*  chunk overlaps hashing the previous one. The engine accepts any address
+*  alignment and length.
+*
+* Parameters:
+*  algo - digest to compute.
+*  addr - start of the range in the external memory.
+*  length - size of the range.
+*  digest - receives the digest: 4 bytes for a CRC-32 (the value in little
+*           endian), FLASH_VERIFY_SHA256_SIZE bytes for SHA-256.
+*
+* Return:
+*  FLASH_VERIFY_RSLT_ERR_UNSUPPORTED if the device has no Crypto block.
+*
+*******************************************************************************/
+cy_rslt_t flash_verify_compute(flash_verify_algo_t algo, uint32_t addr, uint32_t length, uint8_t *digest)
+{
+    if((algo >= FLASH_VERIFY_ALGO_COUNT) || (NULL == digest))
+    {
+        return FLASH_VERIFY_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(NULL == verify_mem_config)
+    {
+        return FLASH_VERIFY_RSLT_ERR_NOT_INIT;
+    }
+
+    const verify_engine_t *engine = &verify_engines[algo];
+
+    if(NULL == engine->start)
+    {
+        return FLASH_VERIFY_RSLT_ERR_UNSUPPORTED;
+    }
+
+    bool mapped = (CY_SMIF_MEMORY == Cy_SMIF_GetMode(SMIF0));
+    uint32_t limit = mapped ? verify_mem_config->memMappedSize : (uint32_t)cy_serial_flash_qspi_get_size();
+
+    if((addr > limit) || (length > (limit - addr)))
+    {
+        return FLASH_VERIFY_RSLT_ERR_BOUNDS;
+    }
+
+    memset(&verify_stats, 0, sizeof(verify_stats));
+    verify_stats.bytes = length;
+    verify_stats.mapped = mapped;
+
+    uint32_t start = cycle_counter_get();
+    cy_rslt_t result = engine->start();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = mapped ? verify_run_mapped(engine, addr, length) : verify_run_mmio(engine, addr, length);
+    }
+
+    /* Finish even after an error, so that the engine is released */
+    cy_rslt_t finish = engine->finish(digest);
+
+    verify_stats.cycles = cycle_counter_get() - start;
+
+    return (CY_RSLT_SUCCESS == result) ? finish : result;
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_crc32
+****************************************************************************//**
+* Summary:
+*  Computes the CRC-32 of an external memory range, with the Crypto block
+*  when the device has one.
+*
+*******************************************************************************/
+cy_rslt_t flash_verify_crc32(uint32_t addr, uint32_t length, uint32_t *crc)
+{
+    uint8_t digest[sizeof(uint32_t)];
+
+    if(NULL == crc)
+    {
+        return FLASH_VERIFY_RSLT_ERR_BAD_PARAM;
+    }
+
+#if defined(CY_IP_MXCRYPTO)
+    cy_rslt_t result = flash_verify_compute(FLASH_VERIFY_CRC32, addr, length, digest);
+#else
+    cy_rslt_t result = flash_verify_compute(FLASH_VERIFY_CRC32_CPU, addr, length, digest);
+#endif
+
+    memcpy(crc, digest, sizeof(*crc));
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_sha256
+****************************************************************************//**
+* Summary:
+*  Computes the SHA-256 of an external memory range with the Crypto block.
+*
+*******************************************************************************/
+cy_rslt_t flash_verify_sha256(uint32_t addr, uint32_t length, uint8_t digest[FLASH_VERIFY_SHA256_SIZE])
+{
+    return flash_verify_compute(FLASH_VERIFY_SHA256, addr, length, digest);
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_check_sha256
+****************************************************************************//**
+* Summary:
+*  Checks an external memory range, for example an application image,
+*  against its expected SHA-256.
+*
+* Return:
+*  FLASH_VERIFY_RSLT_ERR_MISMATCH if the digests differ.
+*
+*******************************************************************************/
+cy_rslt_t flash_verify_check_sha256(uint32_t addr, uint32_t length, const uint8_t expected[FLASH_VERIFY_SHA256_SIZE])
+{
+    uint8_t digest[FLASH_VERIFY_SHA256_SIZE];
+    cy_rslt_t result = flash_verify_sha256(addr, length, digest);
+
+    if((CY_RSLT_SUCCESS == result) && (0 != memcmp(digest, expected, sizeof(digest))))
+    {
+        result = FLASH_VERIFY_RSLT_ERR_MISMATCH;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the timing of the last flash_verify_compute().
+*
+*******************************************************************************/
+void flash_verify_get_stats(flash_verify_stats_t *stats)
+{
+    *stats = verify_stats;
+}
+
+/*******************************************************************************
+* Function Name: demo_print_digest
+****************************************************************************//**
+* Summary:
+*  Prints the timing of the last computation and its CRC, or the first bytes
+*  of its SHA-256.
+*
+*******************************************************************************/
+static void demo_print_digest(const char *name, const uint8_t *digest, uint32_t size)
+{
+    flash_verify_stats_t stats;
+    uint32_t us;
+
+    flash_verify_get_stats(&stats);
+    us = cycle_counter_to_us(stats.cycles);
+
+    /* Hundredths of MB/s (1 MB = 10^6 bytes) */
+    uint32_t rate = (0u == us) ? 0u : (uint32_t)(((uint64_t)stats.bytes * 100u) / us);
+
+    printf("  %-12s %-6s %8"PRIu32" us %4"PRIu32".%02"PRIu32" MB/s, %3"PRIu32"%% waiting  ", name,
+           stats.mapped ? "XIP" : "MMIO", us, rate / 100u, rate % 100u,
+           (0u == stats.cycles) ? 0u : (uint32_t)(((uint64_t)stats.wait_cycles * 100u) / stats.cycles));
+
+    if(sizeof(uint32_t) == size)
+    {
+        uint32_t crc;
+
+        memcpy(&crc, digest, sizeof(crc));
+        printf("0x%08"PRIX32"\n", crc);
+    }
+    else
+    {
+        for(uint32_t index = 0; index < size; index++)
+        {
+            printf("%02X", digest[index]);
+        }
+
+        printf("...\n");
+    }
+}
+
+/*******************************************************************************
+* Function Name: flash_verify_demo
+****************************************************************************//**
+* Summary:
+*  Computes the CRC-32 on the CPU and the CRC-32 and SHA-256 with the Crypto
+*  block over the start of the external memory, first through the XIP
+*  mapping and then by pipelined MMIO reads, and checks that all of them
+*  agree. Must be called in XIP mode, after xip_read_mode_init(); returns in
+*  XIP mode.
+*
+*******************************************************************************/
+cy_rslt_t flash_verify_demo(const cy_stc_smif_mem_config_t *mem_config)
+{
+    static const char *const names[FLASH_VERIFY_ALGO_COUNT] = { "CRC-32 CPU", "CRC-32", "SHA-256" };
+    static const uint32_t sizes[FLASH_VERIFY_ALGO_COUNT] = { 4u, 4u, 8u };
+    uint8_t digests[2][FLASH_VERIFY_ALGO_COUNT][FLASH_VERIFY_SHA256_SIZE];
+    bool computed[FLASH_VERIFY_ALGO_COUNT] = { false };
+    uint32_t length = FLASH_VERIFY_DEMO_SIZE;
+
+    memset(digests, 0, sizeof(digests));
+
+    cy_rslt_t result = flash_verify_init(mem_config);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    length = (length < mem_config->memMappedSize) ? length : mem_config->memMappedSize;
+    length = (length < cy_serial_flash_qspi_get_size()) ? length : (uint32_t)cy_serial_flash_qspi_get_size();
+    printf("Hashing %"PRIu32" bytes in %u-byte chunks\n", length, (unsigned int)FLASH_VERIFY_CHUNK_SIZE);
+
+    for(uint32_t pass = 0; (pass < 2u) && (CY_RSLT_SUCCESS == result); pass++)
+    {
+        if(1u == pass)
+        {
+            result = xip_read_mode_exit_xip();
+        }
+
+        for(uint32_t algo = 0; (algo < FLASH_VERIFY_ALGO_COUNT) && (CY_RSLT_SUCCESS == result); algo++)
+        {
+            (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+            result = flash_verify_compute((flash_verify_algo_t)algo, 0u, length, digests[pass][algo]);
+
+            if(FLASH_VERIFY_RSLT_ERR_UNSUPPORTED == result)
+            {
+                memset(digests[pass][algo], 0, FLASH_VERIFY_SHA256_SIZE);
+                result = CY_RSLT_SUCCESS;
+            }
+            else if(CY_RSLT_SUCCESS == result)
+            {
+                computed[algo] = true;
+                demo_print_digest(names[algo], digests[pass][algo], sizes[algo]);
+            }
+        }
+
+        if(1u == pass)
+        {
+            cy_rslt_t enter = xip_read_mode_enter_xip();
+            result = (CY_RSLT_SUCCESS == result) ? enter : result;
+        }
+    }
+
+    flash_verify_deinit();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        /* Same data in both passes, and the same CRC from the CPU and, if present, the Crypto block */
+        if((0 != memcmp(digests[0], digests[1], sizeof(digests[0]))) ||
+           (computed[FLASH_VERIFY_CRC32] &&
+            (0 != memcmp(digests[0][FLASH_VERIFY_CRC32_CPU], digests[0][FLASH_VERIFY_CRC32], sizeof(uint32_t)))))
+        {
+            result = FLASH_VERIFY_RSLT_ERR_MISMATCH;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
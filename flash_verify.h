@@ -0,0 +1,123 @@
+/******************************************************************************
+* File Name:   flash_verify.h
+*
+* Description: This file contains the declarations of the integrity engine
+*              that computes CRC-32 and SHA-256 digests of external memory
+*              ranges with the Crypto block.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef FLASH_VERIFY_H
+#define FLASH_VERIFY_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the verification benchmark in XIP mode */
+#ifndef FLASH_VERIFY_DEMO_ENABLE
+#define FLASH_VERIFY_DEMO_ENABLE        (0u)
+#endif
+
+/* Bytes handed to the engine at a time. In MMIO mode, two SRAM buffers of
+ * this size alternate: one is read by DMA while the other is hashed.
+ */
+#ifndef FLASH_VERIFY_CHUNK_SIZE
+#define FLASH_VERIFY_CHUNK_SIZE         (4096u)
+#endif
+
+/* Bytes hashed by the demo, from the start of the external memory */
+#ifndef FLASH_VERIFY_DEMO_SIZE
+#define FLASH_VERIFY_DEMO_SIZE          (1024u * 1024u)
+#endif
+
+#define FLASH_VERIFY_SHA256_SIZE        (32u)
+
+#define FLASH_VERIFY_RSLT_ERR_BAD_PARAM     APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_VERIFY, 1u)
+#define FLASH_VERIFY_RSLT_ERR_NOT_INIT      APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_VERIFY, 2u)
+#define FLASH_VERIFY_RSLT_ERR_BOUNDS        APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_VERIFY, 3u)
+#define FLASH_VERIFY_RSLT_ERR_CRYPTO        APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_VERIFY, 4u)
+#define FLASH_VERIFY_RSLT_ERR_UNSUPPORTED   APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_VERIFY, 5u)
+#define FLASH_VERIFY_RSLT_ERR_MISMATCH      APP_RSLT_ERR(APP_RSLT_RANGE_FLASH_VERIFY, 6u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef enum
+{
+    FLASH_VERIFY_CRC32_CPU,     /* CRC-32 (IEEE 802.3) computed by the CPU */
+    FLASH_VERIFY_CRC32,         /* CRC-32 (IEEE 802.3) computed by the Crypto block */
+    FLASH_VERIFY_SHA256,        /* SHA-256 computed by the Crypto block */
+    FLASH_VERIFY_ALGO_COUNT
+} flash_verify_algo_t;
+
+/* Timing of the last flash_verify_compute() */
+typedef struct
+{
+    uint32_t bytes;
+    uint32_t cycles;            /* Whole computation */
+    uint32_t wait_cycles;       /* CPU idle, waiting for data from the memory */
+    bool mapped;                /* Read through the XIP mapping, not by MMIO */
+} flash_verify_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t flash_verify_init(const cy_stc_smif_mem_config_t *mem_config);
+void flash_verify_deinit(void);
+cy_rslt_t flash_verify_compute(flash_verify_algo_t algo, uint32_t addr, uint32_t length, uint8_t *digest);
+cy_rslt_t flash_verify_crc32(uint32_t addr, uint32_t length, uint32_t *crc);
+cy_rslt_t flash_verify_sha256(uint32_t addr, uint32_t length, uint8_t digest[FLASH_VERIFY_SHA256_SIZE]);
+cy_rslt_t flash_verify_check_sha256(uint32_t addr, uint32_t length, const uint8_t expected[FLASH_VERIFY_SHA256_SIZE]);
+void flash_verify_get_stats(flash_verify_stats_t *stats);
+cy_rslt_t flash_verify_demo(const cy_stc_smif_mem_config_t *mem_config);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_VERIFY_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,864 @@
+/******************************************************************************
+* File Name:   flash_model.c
+*
+* Description: Timing and storage model of the QSPI NOR memory and the SMIF
+*              XIP cache. Every operation advances a virtual clock that
+*              drives the DWT cycle counter, so the trace points of main.c
+*              measure the modeled latencies.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "flash_model.h"
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define MODEL_ERASED_BYTE               (0xFFu)
+#define MODEL_LINE_BUFFER_SIZE          (256u)
+#define MODEL_NS_PER_US                 (1000u)
+#define MODEL_NS_PER_S                  (1000000000ull)
+
+/* Commands that are not reads are always sent on one data line */
+#define MODEL_SINGLE_LANE               (1u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    const char *name;
+    size_t offset;
+    const char *unit;
+} model_param_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+#define MODEL_PARAM(field, unit)        { #field, offsetof(flash_model_config_t, field), unit }
+
+static const model_param_t model_params[] =
+{
+    MODEL_PARAM(cpu_hz, "Hz"),
+    MODEL_PARAM(bus_hz, "Hz"),
+    MODEL_PARAM(cmd_lanes, "lines"),
+    MODEL_PARAM(addr_lanes, "lines"),
+    MODEL_PARAM(data_lanes, "lines"),
+    MODEL_PARAM(prog_addr_lanes, "lines"),
+    MODEL_PARAM(prog_data_lanes, "lines"),
+    MODEL_PARAM(addr_bytes, "bytes"),
+    MODEL_PARAM(mode_cycles, "cycles"),
+    MODEL_PARAM(dummy_cycles, "cycles"),
+    MODEL_PARAM(mem_size, "bytes"),
+    MODEL_PARAM(page_size, "bytes"),
+    MODEL_PARAM(sector_size, "bytes"),
+    MODEL_PARAM(page_setup_us, "us"),
+    MODEL_PARAM(page_program_us, "us"),
+    MODEL_PARAM(sector_erase_us, "us"),
+    MODEL_PARAM(call_overhead_ns, "ns"),
+    MODEL_PARAM(init_us, "us"),
+    MODEL_PARAM(xip_switch_us, "us"),
+    MODEL_PARAM(cache_size, "bytes"),
+    MODEL_PARAM(cache_line, "bytes"),
+    MODEL_PARAM(cache_ways, "ways"),
+    MODEL_PARAM(cache_prefetch, "0/1"),
+};
+
+static flash_model_config_t model_config;
+static uint8_t *model_mem = NULL;
+static uint32_t model_requested_hz = 0u;
+static bool model_continuous = false;
+static bool model_xip = false;
+
+static uint64_t model_time_ns = 0u;
+static uint64_t model_cycles = 0u;
+
+/* Cache lines, model_cache_sets * ways entries; a stamp of 0 is an empty way */
+static uint32_t model_cache_sets = 0u;
+static uint32_t *model_cache_tags = NULL;
+static uint64_t *model_cache_stamps = NULL;
+static uint64_t model_cache_clock = 0u;
+static uint32_t model_last_miss = UINT32_MAX;
+static flash_model_stats_t model_stats;
+
+/*******************************************************************************
+* Function Name: model_is_pow2
+****************************************************************************//**
+* Summary:
+*  Returns true if value is a non-zero power of two.
+*
+*******************************************************************************/
+static bool model_is_pow2(uint32_t value)
+{
+    return (0u != value) && (0u == (value & (value - 1u)));
+}
+
+/*******************************************************************************
+* Function Name: model_field
+****************************************************************************//**
+* Summary:
+*  Returns the field of config described by param.
+*
+*******************************************************************************/
+static uint32_t *model_field(flash_model_config_t *config, const model_param_t *param)
+{
+    return (uint32_t *)((uint8_t *)config + param->offset);
+}
+
+/*******************************************************************************
+* Function Name: model_clocks
+****************************************************************************//**
+* Summary:
+*  Returns the bus cycles needed to shift bytes on lanes data lines.
+*
+*******************************************************************************/
+static uint64_t model_clocks(uint32_t bytes, uint32_t lanes)
+{
+    return (((uint64_t)bytes * 8u) + lanes - 1u) / lanes;
+}
+
+/*******************************************************************************
+* Function Name: model_bus_ns
+****************************************************************************//**
+* Summary:
+*  Converts bus cycles to nanoseconds at the current bus frequency.
+*
+*******************************************************************************/
+static uint64_t model_bus_ns(uint64_t clocks)
+{
+    uint32_t hz = flash_model_get_bus_hz();
+
+    return ((clocks * MODEL_NS_PER_S) + hz - 1u) / hz;
+}
+
+/*******************************************************************************
+* Function Name: model_in_range
+****************************************************************************//**
+* Summary:
+*  Returns true if [addr, addr + length) is inside the memory.
+*
+*******************************************************************************/
+static bool model_in_range(uint32_t addr, uint32_t length)
+{
+    return (addr <= model_config.mem_size) && (length <= (model_config.mem_size - addr));
+}
+
+/*******************************************************************************
+* Function Name: model_status_poll_clocks
+****************************************************************************//**
+* Summary:
+*  Returns the bus cycles of the Write Enable command and of the final status
+*  register read that ends a page program or a sector erase.
+*
+*******************************************************************************/
+static uint64_t model_status_poll_clocks(void)
+{
+    return model_clocks(1u, model_config.cmd_lanes) + model_clocks(2u, MODEL_SINGLE_LANE);
+}
+
+/*******************************************************************************
+* Function Name: flash_model_get_defaults
+****************************************************************************//**
+* Summary:
+*  Fills config with the timing of the S25FL512S on the CY8CPROTO-062-4343W,
+*  read with the Quad I/O command (0xEB) and programmed with Quad Page
+*  Program (0x34), and with the PSoC 6 SMIF fast cache.
+*
+* Parameters:
+*  config - configuration to fill in.
+*
+*******************************************************************************/
+void flash_model_get_defaults(flash_model_config_t *config)
+{
+    *config = (flash_model_config_t)
+    {
+        .cpu_hz = 100000000u,
+        .bus_hz = 0u,
+        .cmd_lanes = 1u,
+        .addr_lanes = 4u,
+        .data_lanes = 4u,
+        .prog_addr_lanes = 1u,
+        .prog_data_lanes = 4u,
+        .addr_bytes = 3u,
+        .mode_cycles = 2u,
+        .dummy_cycles = 4u,
+        .mem_size = 64u * 1024u * 1024u,
+        .page_size = 512u,
+        .sector_size = 256u * 1024u,
+        .page_setup_us = 40u,
+        .page_program_us = 340u,
+        .sector_erase_us = 520000u,
+        .call_overhead_ns = 2000u,
+        .init_us = 1500u,
+        .xip_switch_us = 5u,
+        .cache_size = 4096u,
+        .cache_line = 16u,
+        .cache_ways = 4u,
+        .cache_prefetch = 1u,
+    };
+}
+
+/*******************************************************************************
+* Function Name: flash_model_set
+****************************************************************************//**
+* Summary:
+*  Sets one parameter by name. Values are decimal, or hexadecimal with 0x.
+*
+* Parameters:
+*  config - configuration to change.
+*  key - name of the field of flash_model_config_t.
+*  value - new value.
+*
+* Return:
+*  False if the parameter does not exist or the value is not a number.
+*
+*******************************************************************************/
+bool flash_model_set(flash_model_config_t *config, const char *key, const char *value)
+{
+    for(size_t index = 0; index < (sizeof(model_params) / sizeof(model_params[0])); index++)
+    {
+        if(0 == strcmp(key, model_params[index].name))
+        {
+            char *end;
+            errno = 0;
+            unsigned long parsed = strtoul(value, &end, 0);
+
+            if((end == value) || ('\0' != *end) || (0 != errno) || (parsed > UINT32_MAX) || ('-' == *value))
+            {
+                fprintf(stderr, "bad value '%s' for %s\n", value, key);
+                return false;
+            }
+
+            *model_field(config, &model_params[index]) = (uint32_t)parsed;
+            return true;
+        }
+    }
+
+    fprintf(stderr, "unknown parameter '%s'\n", key);
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_load
+****************************************************************************//**
+* Summary:
+*  Applies a configuration file of 'key = value' lines, as written by
+*  flash_model_print(). '#' starts a comment.
+*
+* Parameters:
+*  config - configuration to change.
+*  path - file to read.
+*
+* Return:
+*  False if the file cannot be read or has a bad line.
+*
+*******************************************************************************/
+bool flash_model_load(flash_model_config_t *config, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[MODEL_LINE_BUFFER_SIZE];
+    uint32_t lineno = 0u;
+    bool ok = (NULL != file);
+
+    if(!ok)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+
+    while(ok && (NULL != fgets(line, sizeof(line), file)))
+    {
+        char *key = line;
+        char *value;
+        char *end;
+
+        lineno++;
+        line[strcspn(line, "#\r\n")] = '\0';
+        while(isspace((unsigned char)*key))
+        {
+            key++;
+        }
+        if('\0' == *key)
+        {
+            continue;
+        }
+
+        value = strchr(key, '=');
+        if(NULL == value)
+        {
+            fprintf(stderr, "%s:%"PRIu32": expected key = value\n", path, lineno);
+            ok = false;
+            break;
+        }
+
+        /* Trim both sides of the key and the value */
+        end = value;
+        *value++ = '\0';
+        while((end > key) && isspace((unsigned char)end[-1]))
+        {
+            *--end = '\0';
+        }
+        while(isspace((unsigned char)*value))
+        {
+            value++;
+        }
+        end = value + strlen(value);
+        while((end > value) && isspace((unsigned char)end[-1]))
+        {
+            *--end = '\0';
+        }
+
+        if(!flash_model_set(config, key, value))
+        {
+            fprintf(stderr, "%s:%"PRIu32": bad line\n", path, lineno);
+            ok = false;
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_print
+****************************************************************************//**
+* Summary:
+*  Writes config in the format read by flash_model_load().
+*
+*******************************************************************************/
+void flash_model_print(const flash_model_config_t *config, FILE *stream)
+{
+    for(size_t index = 0; index < (sizeof(model_params) / sizeof(model_params[0])); index++)
+    {
+        const uint32_t *value = model_field((flash_model_config_t *)config, &model_params[index]);
+
+        fprintf(stream, "%-18s = %-10"PRIu32" # %s\n", model_params[index].name, *value, model_params[index].unit);
+    }
+}
+
+/*******************************************************************************
+* Function Name: flash_model_init
+****************************************************************************//**
+* Summary:
+*  Checks config, erases the memory and empties the cache. The virtual clock
+*  keeps running across calls.
+*
+* Parameters:
+*  config - configuration to use, copied.
+*
+* Return:
+*  False if a parameter is out of range.
+*
+*******************************************************************************/
+bool flash_model_init(const flash_model_config_t *config)
+{
+    const uint32_t lanes[] = { config->cmd_lanes, config->addr_lanes, config->data_lanes,
+                               config->prog_addr_lanes, config->prog_data_lanes };
+
+    for(size_t index = 0; index < (sizeof(lanes) / sizeof(lanes[0])); index++)
+    {
+        if(!model_is_pow2(lanes[index]) || (lanes[index] > 8u))
+        {
+            fprintf(stderr, "lanes must be 1, 2, 4 or 8\n");
+            return false;
+        }
+    }
+
+    if((0u == config->cpu_hz) || !model_is_pow2(config->page_size) || !model_is_pow2(config->sector_size) ||
+       (config->page_size > config->sector_size) || (0u == config->mem_size) ||
+       (0u != (config->mem_size % config->sector_size)) || (config->page_setup_us > config->page_program_us) ||
+       (0u == config->addr_bytes) || (config->addr_bytes > 4u))
+    {
+        fprintf(stderr, "bad memory geometry or timing\n");
+        return false;
+    }
+
+    if((0u != config->cache_size) &&
+       (!model_is_pow2(config->cache_line) || (0u == config->cache_ways) ||
+        (0u != (config->cache_size % (config->cache_line * config->cache_ways)))))
+    {
+        fprintf(stderr, "cache_size must be a multiple of cache_line * cache_ways\n");
+        return false;
+    }
+
+    flash_model_deinit();
+    model_config = *config;
+
+    model_mem = malloc(model_config.mem_size);
+    model_cache_sets = (0u == model_config.cache_size) ? 0u :
+                       (model_config.cache_size / (model_config.cache_line * model_config.cache_ways));
+    if(0u != model_cache_sets)
+    {
+        model_cache_tags = calloc((size_t)model_cache_sets * model_config.cache_ways, sizeof(uint32_t));
+        model_cache_stamps = calloc((size_t)model_cache_sets * model_config.cache_ways, sizeof(uint64_t));
+    }
+    if((NULL == model_mem) ||
+       ((0u != model_cache_sets) && ((NULL == model_cache_tags) || (NULL == model_cache_stamps))))
+    {
+        fprintf(stderr, "out of memory\n");
+        flash_model_deinit();
+        return false;
+    }
+
+    memset(model_mem, MODEL_ERASED_BYTE, model_config.mem_size);
+    model_requested_hz = 0u;
+    model_continuous = false;
+    model_xip = false;
+    flash_model_flush_cache();
+    flash_model_reset_stats();
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_deinit
+****************************************************************************//**
+* Summary:
+*  Frees the memory and the cache.
+*
+*******************************************************************************/
+void flash_model_deinit(void)
+{
+    free(model_mem);
+    free(model_cache_tags);
+    free(model_cache_stamps);
+    model_mem = NULL;
+    model_cache_tags = NULL;
+    model_cache_stamps = NULL;
+    model_cache_sets = 0u;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_get_config
+****************************************************************************//**
+* Summary:
+*  Returns the configuration passed to flash_model_init().
+*
+*******************************************************************************/
+const flash_model_config_t *flash_model_get_config(void)
+{
+    return &model_config;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_request_bus
+****************************************************************************//**
+* Summary:
+*  Records the bus frequency the application asked for; it is used unless the
+*  bus_hz parameter overrides it.
+*
+*******************************************************************************/
+void flash_model_request_bus(uint32_t hz)
+{
+    model_requested_hz = hz;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_get_bus_hz
+****************************************************************************//**
+* Summary:
+*  Returns the bus frequency the model runs at.
+*
+*******************************************************************************/
+uint32_t flash_model_get_bus_hz(void)
+{
+    if(0u != model_config.bus_hz)
+    {
+        return model_config.bus_hz;
+    }
+
+    /* The serial-flash library defaults to 50 MHz when no frequency is given */
+    return (0u != model_requested_hz) ? model_requested_hz : 50000000u;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_set_continuous
+****************************************************************************//**
+* Summary:
+*  Enables continuous read mode: XIP cache misses skip the command byte.
+*
+*******************************************************************************/
+void flash_model_set_continuous(bool enable)
+{
+    model_continuous = enable;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_set_xip
+****************************************************************************//**
+* Summary:
+*  Switches between memory-mapped and MMIO mode. Leaving XIP mode invalidates
+*  the cache, as the memory can be changed behind it.
+*
+*******************************************************************************/
+void flash_model_set_xip(bool enable)
+{
+    if(model_xip && !enable)
+    {
+        flash_model_flush_cache();
+    }
+    model_xip = enable;
+    flash_model_advance_ns((uint64_t)model_config.xip_switch_us * MODEL_NS_PER_US);
+}
+
+/*******************************************************************************
+* Function Name: flash_model_is_xip
+****************************************************************************//**
+* Summary:
+*  Returns true in memory-mapped mode.
+*
+*******************************************************************************/
+bool flash_model_is_xip(void)
+{
+    return model_xip;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_get_time_ns
+****************************************************************************//**
+* Summary:
+*  Returns the virtual time.
+*
+*******************************************************************************/
+uint64_t flash_model_get_time_ns(void)
+{
+    return model_time_ns;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_advance_ns
+****************************************************************************//**
+* Summary:
+*  Advances the virtual time, and the DWT cycle counter by the matching number
+*  of CPU cycles while it is enabled.
+*
+*******************************************************************************/
+void flash_model_advance_ns(uint64_t ns)
+{
+    model_time_ns += ns;
+
+    uint64_t cycles = (uint64_t)(((double)model_time_ns * model_config.cpu_hz) / (double)MODEL_NS_PER_S);
+
+    if(0u != (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        DWT->CYCCNT += (uint32_t)(cycles - model_cycles);
+    }
+    model_cycles = cycles;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_read_ns
+****************************************************************************//**
+* Summary:
+*  Returns the time of an MMIO read: command, address, mode and dummy cycles,
+*  then the data, plus the driver overhead.
+*
+*******************************************************************************/
+uint64_t flash_model_read_ns(uint32_t length)
+{
+    uint64_t clocks = model_clocks(1u, model_config.cmd_lanes) +
+                      model_clocks(model_config.addr_bytes, model_config.addr_lanes) +
+                      model_config.mode_cycles + model_config.dummy_cycles +
+                      model_clocks(length, model_config.data_lanes);
+
+    return model_bus_ns(clocks) + model_config.call_overhead_ns;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_write_ns
+****************************************************************************//**
+* Summary:
+*  Returns the time of a program split on page boundaries. Each page costs a
+*  Write Enable, the Page Program transfer, the program time scaled by the
+*  length and the final status poll.
+*
+*******************************************************************************/
+uint64_t flash_model_write_ns(uint32_t addr, uint32_t length)
+{
+    uint64_t ns = model_config.call_overhead_ns;
+
+    while(0u != length)
+    {
+        uint32_t chunk = model_config.page_size - (addr & (model_config.page_size - 1u));
+        chunk = (chunk < length) ? chunk : length;
+
+        uint64_t clocks = model_status_poll_clocks() + model_clocks(1u, model_config.cmd_lanes) +
+                          model_clocks(model_config.addr_bytes, model_config.prog_addr_lanes) +
+                          model_clocks(chunk, model_config.prog_data_lanes);
+        uint64_t program_ns = ((uint64_t)model_config.page_setup_us * MODEL_NS_PER_US) +
+                              (((uint64_t)(model_config.page_program_us - model_config.page_setup_us) *
+                                MODEL_NS_PER_US * chunk) / model_config.page_size);
+
+        ns += model_bus_ns(clocks) + program_ns;
+        addr += chunk;
+        length -= chunk;
+    }
+
+    return ns;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_erase_ns
+****************************************************************************//**
+* Summary:
+*  Returns the time to erase every sector that [addr, addr + length) touches.
+*
+*******************************************************************************/
+uint64_t flash_model_erase_ns(uint32_t addr, uint32_t length)
+{
+    uint64_t ns = model_config.call_overhead_ns;
+
+    if(0u != length)
+    {
+        uint32_t sectors = (((addr + length - 1u) / model_config.sector_size) - (addr / model_config.sector_size)) + 1u;
+        uint64_t clocks = model_status_poll_clocks() + model_clocks(1u, model_config.cmd_lanes) +
+                          model_clocks(model_config.addr_bytes, MODEL_SINGLE_LANE);
+
+        ns += sectors * (model_bus_ns(clocks) + ((uint64_t)model_config.sector_erase_us * MODEL_NS_PER_US));
+    }
+
+    return ns;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_read
+****************************************************************************//**
+* Summary:
+*  Copies memory contents to buf and advances the clock by the read time.
+*
+* Return:
+*  False if the range is outside the memory.
+*
+*******************************************************************************/
+bool flash_model_read(uint32_t addr, uint32_t length, uint8_t *buf)
+{
+    if(!model_in_range(addr, length))
+    {
+        return false;
+    }
+
+    memcpy(buf, &model_mem[addr], length);
+    flash_model_advance_ns(flash_model_read_ns(length));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_write
+****************************************************************************//**
+* Summary:
+*  Programs buf like a NOR memory, which can only clear bits, and advances
+*  the clock by the program time.
+*
+* Return:
+*  False if the range is outside the memory.
+*
+*******************************************************************************/
+bool flash_model_write(uint32_t addr, uint32_t length, const uint8_t *buf)
+{
+    if(!model_in_range(addr, length))
+    {
+        return false;
+    }
+
+    for(uint32_t index = 0; index < length; index++)
+    {
+        model_mem[addr + index] &= buf[index];
+    }
+    flash_model_advance_ns(flash_model_write_ns(addr, length));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_erase
+****************************************************************************//**
+* Summary:
+*  Erases every sector that [addr, addr + length) touches and advances the
+*  clock by the erase time.
+*
+* Return:
+*  False if the range is outside the memory.
+*
+*******************************************************************************/
+bool flash_model_erase(uint32_t addr, uint32_t length)
+{
+    if(!model_in_range(addr, length))
+    {
+        return false;
+    }
+
+    if(0u != length)
+    {
+        uint32_t first = addr & ~(model_config.sector_size - 1u);
+        uint32_t last = (addr + length - 1u) | (model_config.sector_size - 1u);
+
+        memset(&model_mem[first], MODEL_ERASED_BYTE, (size_t)(last - first) + 1u);
+    }
+    flash_model_advance_ns(flash_model_erase_ns(addr, length));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_fetch
+****************************************************************************//**
+* Summary:
+*  Fetches [offset, offset + length) of the memory-mapped region through the
+*  SMIF cache, which is set-associative with LRU replacement. A miss reads a
+*  line with the XIP read command; with prefetching, a miss on the line that
+*  follows the previous miss continues that burst and only costs the data.
+*
+* Parameters:
+*  offset - offset from the start of the memory-mapped region.
+*  length - bytes fetched.
+*
+*******************************************************************************/
+void flash_model_fetch(uint32_t offset, uint32_t length)
+{
+    if(0u == length)
+    {
+        return;
+    }
+
+    uint32_t line_size = model_config.cache_line;
+    uint32_t last_line = (uint32_t)(((uint64_t)offset + length - 1u) / line_size);
+
+    for(uint32_t line = offset / line_size; line <= last_line; line++)
+    {
+        bool hit = false;
+
+        if(0u != model_cache_sets)
+        {
+            uint32_t *tags = &model_cache_tags[(line % model_cache_sets) * model_config.cache_ways];
+            uint64_t *stamps = &model_cache_stamps[(line % model_cache_sets) * model_config.cache_ways];
+            uint32_t victim = 0u;
+
+            model_cache_clock++;
+            for(uint32_t way = 0; way < model_config.cache_ways; way++)
+            {
+                if((0u != stamps[way]) && (tags[way] == line))
+                {
+                    stamps[way] = model_cache_clock;
+                    hit = true;
+                    break;
+                }
+                if(stamps[way] < stamps[victim])
+                {
+                    victim = way;
+                }
+            }
+
+            if(!hit)
+            {
+                tags[victim] = line;
+                stamps[victim] = model_cache_clock;
+            }
+        }
+
+        if(hit)
+        {
+            model_stats.hits++;
+            continue;
+        }
+
+        uint64_t clocks = model_clocks(line_size, model_config.data_lanes);
+
+        if((0u != model_config.cache_prefetch) && (UINT32_MAX != model_last_miss) && (line == (model_last_miss + 1u)))
+        {
+            model_stats.prefetched++;
+        }
+        else
+        {
+            clocks += (model_continuous ? 0u : model_clocks(1u, model_config.cmd_lanes)) +
+                      model_clocks(model_config.addr_bytes, model_config.addr_lanes) +
+                      model_config.mode_cycles + model_config.dummy_cycles;
+        }
+
+        uint64_t ns = model_bus_ns(clocks);
+
+        model_stats.misses++;
+        model_stats.stall_ns += ns;
+        model_last_miss = line;
+        flash_model_advance_ns(ns);
+    }
+}
+
+/*******************************************************************************
+* Function Name: flash_model_flush_cache
+****************************************************************************//**
+* Summary:
+*  Invalidates the SMIF cache.
+*
+*******************************************************************************/
+void flash_model_flush_cache(void)
+{
+    if(0u != model_cache_sets)
+    {
+        memset(model_cache_stamps, 0, (size_t)model_cache_sets * model_config.cache_ways * sizeof(uint64_t));
+    }
+    model_cache_clock = 0u;
+    model_last_miss = UINT32_MAX;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the XIP fetch counters.
+*
+*******************************************************************************/
+void flash_model_get_stats(flash_model_stats_t *stats)
+{
+    *stats = model_stats;
+}
+
+/*******************************************************************************
+* Function Name: flash_model_reset_stats
+****************************************************************************//**
+* Summary:
+*  Clears the XIP fetch counters.
+*
+*******************************************************************************/
+void flash_model_reset_stats(void)
+{
+    memset(&model_stats, 0, sizeof(model_stats));
+}
+
+/* [] END OF FILE */
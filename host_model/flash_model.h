@@ -0,0 +1,135 @@
+/******************************************************************************
+* File Name:   flash_model.h
+*
+* Description: Timing and storage model of the QSPI NOR memory and the SMIF
+*              XIP cache, used by the host build of the example. All
+*              parameters can be changed at run time with flash_model_set().
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef FLASH_MODEL_H
+#define FLASH_MODEL_H
+
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Timing parameters, defaults are those of the S25FL512S on the kits */
+typedef struct
+{
+    uint32_t cpu_hz;                /* SystemCoreClock, rate of the DWT cycle counter */
+    uint32_t bus_hz;                /* QSPI clock, 0 to use the frequency requested by main.c */
+    uint32_t cmd_lanes;             /* Data lines used for the command byte */
+    uint32_t addr_lanes;            /* Data lines used for the address of reads */
+    uint32_t data_lanes;            /* Data lines used for the data of reads */
+    uint32_t prog_addr_lanes;       /* Data lines used for the address of page programs */
+    uint32_t prog_data_lanes;       /* Data lines used for the data of page programs */
+    uint32_t addr_bytes;
+    uint32_t mode_cycles;           /* Mode byte of the read command, in bus cycles */
+    uint32_t dummy_cycles;
+    uint32_t mem_size;
+    uint32_t page_size;
+    uint32_t sector_size;
+    uint32_t page_setup_us;         /* Part of page_program_us that does not scale with the length */
+    uint32_t page_program_us;       /* Program time of a full page */
+    uint32_t sector_erase_us;
+    uint32_t call_overhead_ns;      /* Driver time per serial-flash library call */
+    uint32_t init_us;               /* SFDP discovery and driver setup */
+    uint32_t xip_switch_us;         /* Entering or leaving memory-mapped mode */
+    uint32_t cache_size;            /* SMIF cache, 0 to disable it */
+    uint32_t cache_line;
+    uint32_t cache_ways;
+    uint32_t cache_prefetch;        /* 1 if the next line is fetched in the same burst */
+} flash_model_config_t;
+
+/* XIP fetch counters since the last flash_model_reset_stats() */
+typedef struct
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t prefetched;            /* Misses served by continuing the previous burst */
+    uint64_t stall_ns;
+} flash_model_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+void flash_model_get_defaults(flash_model_config_t *config);
+bool flash_model_set(flash_model_config_t *config, const char *key, const char *value);
+bool flash_model_load(flash_model_config_t *config, const char *path);
+void flash_model_print(const flash_model_config_t *config, FILE *stream);
+
+bool flash_model_init(const flash_model_config_t *config);
+void flash_model_deinit(void);
+const flash_model_config_t *flash_model_get_config(void);
+
+void flash_model_request_bus(uint32_t hz);
+uint32_t flash_model_get_bus_hz(void);
+void flash_model_set_continuous(bool enable);
+void flash_model_set_xip(bool enable);
+bool flash_model_is_xip(void);
+
+uint64_t flash_model_get_time_ns(void);
+void flash_model_advance_ns(uint64_t ns);
+
+uint64_t flash_model_read_ns(uint32_t length);
+uint64_t flash_model_write_ns(uint32_t addr, uint32_t length);
+uint64_t flash_model_erase_ns(uint32_t addr, uint32_t length);
+
+bool flash_model_read(uint32_t addr, uint32_t length, uint8_t *buf);
+bool flash_model_write(uint32_t addr, uint32_t length, const uint8_t *buf);
+bool flash_model_erase(uint32_t addr, uint32_t length);
+
+void flash_model_fetch(uint32_t offset, uint32_t length);
+void flash_model_flush_cache(void);
+void flash_model_get_stats(flash_model_stats_t *stats);
+void flash_model_reset_stats(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_MODEL_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,1221 @@
+/******************************************************************************
+* File Name:   harness.c
+*
+* Description: Host-side performance model of the example. Runs the flow of
+*              main.c against the flash model and reports the latency and
+*              throughput measured by its QSPI trace points, replays traces
+*              recorded on a board, models the XIP placement of a profile,
+*              and compares the results with a baseline.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "flash_model.h"
+#include "model_backend.h"
+#include "qspi_trace.h"
+#include <inttypes.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define HARNESS_LINE_BUFFER_SIZE        (512u)
+#define HARNESS_DEFAULT_TOLERANCE_PCT   (5.0)
+#define HARNESS_DEFAULT_COLD_FRAGMENT   "../xip_placement/xip_placement_cold.ld"
+
+/* Synthetic XIP workloads, run after the flow of main.c */
+#define HARNESS_SEQ_FETCH_SIZE          (64u * 1024u)
+#define HARNESS_RANDOM_FETCH_COUNT      (1024u)
+#define HARNESS_RANDOM_FETCH_SPAN       (16u * 1024u * 1024u)
+#define HARNESS_RANDOM_FETCH_SIZE       (4u)
+
+/* Calls simulated for a placement; profiles with more calls are scaled down */
+#define HARNESS_PLACEMENT_MAX_CALLS     (1000000u)
+
+/* setjmp() values */
+#define HARNESS_JMP_LOOP                (1)
+#define HARNESS_JMP_FAILED              (2)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef enum
+{
+    HARNESS_INFO,                   /* Reported, not checked */
+    HARNESS_LOWER_IS_BETTER,
+    HARNESS_HIGHER_IS_BETTER
+} harness_direction_t;
+
+typedef struct
+{
+    const char *name;
+    const char *unit;
+    harness_direction_t direction;
+} harness_metric_info_t;
+
+typedef struct
+{
+    const harness_metric_info_t *info;
+    double value;
+} harness_metric_t;
+
+typedef struct
+{
+    uint32_t seq;
+    qspi_trace_op_t op;
+    uint32_t addr;
+    uint32_t length;
+    uint32_t status;
+    uint32_t cycles;
+} harness_record_t;
+
+typedef struct
+{
+    harness_record_t *records;
+    size_t count;
+    size_t capacity;
+    uint32_t clock_hz;              /* 0 if the log has no qspi_trace_clock line */
+} harness_trace_t;
+
+typedef struct
+{
+    char *name;
+    uint32_t addr;
+    uint32_t size;
+    uint64_t count;
+    uint32_t xip_offset;
+    bool cold;
+} harness_func_t;
+
+typedef struct
+{
+    flash_model_config_t config;
+    const char *baseline;
+    double tolerance_pct;
+    const char *profile;
+    const char *nm;
+    const char *cold_fragment;
+    bool verbose;
+} harness_options_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Names as printed by qspi_trace_dump() */
+static const char *const harness_op_names[QSPI_TRACE_OP_COUNT] =
+{
+    "init", "read", "write", "erase", "xip_enable", "xip_disable"
+};
+
+static const harness_metric_info_t harness_metric_infos[] =
+{
+    { "flow_failed",        "",     HARNESS_LOWER_IS_BETTER },
+    { "bus_hz",             "Hz",   HARNESS_INFO },
+    { "packet_bytes",       "B",    HARNESS_INFO },
+    { "xip_image_bytes",    "B",    HARNESS_INFO },
+    { "flow_qspi_us",       "us",   HARNESS_INFO },
+    { "init_us",            "us",   HARNESS_LOWER_IS_BETTER },
+    { "erase_sector_us",    "us",   HARNESS_LOWER_IS_BETTER },
+    { "read_us",            "us",   HARNESS_INFO },
+    { "read_kbps",          "KB/s", HARNESS_HIGHER_IS_BETTER },
+    { "write_us",           "us",   HARNESS_INFO },
+    { "write_kbps",         "KB/s", HARNESS_HIGHER_IS_BETTER },
+    { "xip_enable_us",      "us",   HARNESS_LOWER_IS_BETTER },
+    { "xip_seq_kbps",       "KB/s", HARNESS_HIGHER_IS_BETTER },
+    { "xip_random_us",      "us",   HARNESS_LOWER_IS_BETTER },
+    { "xip_cold_bytes",     "B",    HARNESS_INFO },
+    { "xip_calls",          "",     HARNESS_INFO },
+    { "xip_hit_pct",        "%",    HARNESS_HIGHER_IS_BETTER },
+    { "xip_stall_us",       "us",   HARNESS_LOWER_IS_BETTER },
+};
+
+#define HARNESS_METRIC_COUNT            (sizeof(harness_metric_infos) / sizeof(harness_metric_infos[0]))
+
+static harness_metric_t harness_metrics[HARNESS_METRIC_COUNT];
+static size_t harness_metric_count = 0u;
+
+static jmp_buf harness_halt_jmp;
+
+/* Entry point of main.c, renamed by the Makefile */
+extern int app_main(void);
+
+/*******************************************************************************
+* Function Name: harness_usage
+****************************************************************************//**
+* Summary:
+*  Prints the command line help.
+*
+*******************************************************************************/
+static void harness_usage(void)
+{
+    fprintf(stderr,
+            "usage: qspi_model [options] run\n"
+            "       qspi_model [options] replay <uart.log>\n"
+            "       qspi_model [options] config\n"
+            "\n"
+            "  run      run main.c against the flash model and print its metrics\n"
+            "  replay   compare the latencies recorded by qspi_trace_dump() on a board\n"
+            "           with the model, e.g. to calibrate it\n"
+            "  config   print the model parameters, in the --config format\n"
+            "\n"
+            "options:\n"
+            "  -c, --config FILE     model parameters, 'key = value' lines\n"
+            "  -s, --set KEY=VALUE   set one model parameter\n"
+            "  -b, --baseline FILE   compare the metrics of run with FILE, exit 1 on regression\n"
+            "  -t, --tolerance PCT   allowed change before a regression (default %.0f)\n"
+            "  -p, --profile FILE    also model the XIP placement of this profile\n"
+            "                        (<function>,<count> or 0x<address>,<count>)\n"
+            "  -n, --nm FILE         arm-none-eabi-nm -S output of the application\n"
+            "  -l, --cold FILE       cold fragment (default %s)\n"
+            "  -v, --verbose         show the output of main.c\n",
+            HARNESS_DEFAULT_TOLERANCE_PCT, HARNESS_DEFAULT_COLD_FRAGMENT);
+}
+
+/*******************************************************************************
+* Function Name: harness_add_metric
+****************************************************************************//**
+* Summary:
+*  Records the value of a metric of harness_metric_infos[].
+*
+*******************************************************************************/
+static void harness_add_metric(const char *name, double value)
+{
+    for(size_t index = 0; index < HARNESS_METRIC_COUNT; index++)
+    {
+        if(0 == strcmp(name, harness_metric_infos[index].name))
+        {
+            harness_metrics[harness_metric_count].info = &harness_metric_infos[index];
+            harness_metrics[harness_metric_count].value = value;
+            harness_metric_count++;
+            return;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_find_metric
+****************************************************************************//**
+* Summary:
+*  Returns the recorded metric called name, or NULL.
+*
+*******************************************************************************/
+static const harness_metric_t *harness_find_metric(const char *name)
+{
+    for(size_t index = 0; index < harness_metric_count; index++)
+    {
+        if(0 == strcmp(name, harness_metrics[index].info->name))
+        {
+            return &harness_metrics[index];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: harness_print_metrics
+****************************************************************************//**
+* Summary:
+*  Prints the metrics as 'metric,<name>,<value>,<unit>' lines, the format of
+*  the baseline file.
+*
+*******************************************************************************/
+static void harness_print_metrics(void)
+{
+    for(size_t index = 0; index < harness_metric_count; index++)
+    {
+        printf("metric,%s,%.2f,%s\n", harness_metrics[index].info->name, harness_metrics[index].value,
+               harness_metrics[index].info->unit);
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_parse_trace_line
+****************************************************************************//**
+* Summary:
+*  Adds the qspi_trace record or clock of a line of qspi_trace_dump() output
+*  to trace. Other lines, and a prefix such as a terminal timestamp, are
+*  ignored.
+*
+*******************************************************************************/
+static void harness_parse_trace_line(harness_trace_t *trace, const char *line)
+{
+    const char *start = strstr(line, "qspi_trace");
+    harness_record_t record;
+    char op[16];
+    uint32_t clock_hz;
+    uint32_t start_cycles;
+
+    if(NULL == start)
+    {
+        return;
+    }
+
+    if(1 == sscanf(start, "qspi_trace_clock,%"SCNu32, &clock_hz))
+    {
+        trace->clock_hz = clock_hz;
+        return;
+    }
+
+    if(7 != sscanf(start, "qspi_trace,%"SCNu32",%15[^,],%"SCNx32",%"SCNu32",%"SCNx32",%"SCNu32",%"SCNu32,
+                   &record.seq, op, &record.addr, &record.length, &record.status, &start_cycles, &record.cycles))
+    {
+        return;
+    }
+
+    for(uint32_t index = 0; index < (uint32_t)QSPI_TRACE_OP_COUNT; index++)
+    {
+        if(0 == strcmp(op, harness_op_names[index]))
+        {
+            if(trace->count == trace->capacity)
+            {
+                size_t capacity = (0u == trace->capacity) ? 64u : (trace->capacity * 2u);
+                harness_record_t *records = realloc(trace->records, capacity * sizeof(*records));
+
+                if(NULL == records)
+                {
+                    return;
+                }
+                trace->records = records;
+                trace->capacity = capacity;
+            }
+
+            record.op = (qspi_trace_op_t)index;
+            trace->records[trace->count++] = record;
+            return;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_parse_trace
+****************************************************************************//**
+* Summary:
+*  Reads the trace lines of file, optionally echoing every line.
+*
+*******************************************************************************/
+static void harness_parse_trace(harness_trace_t *trace, FILE *file, bool echo)
+{
+    char line[HARNESS_LINE_BUFFER_SIZE];
+
+    while(NULL != fgets(line, sizeof(line), file))
+    {
+        if(echo)
+        {
+            fputs(line, stdout);
+        }
+        harness_parse_trace_line(trace, line);
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_record_us
+****************************************************************************//**
+* Summary:
+*  Returns the duration of a record in microseconds.
+*
+*******************************************************************************/
+static double harness_record_us(const harness_trace_t *trace, const harness_record_t *record)
+{
+    return ((double)record->cycles * 1e6) / trace->clock_hz;
+}
+
+/*******************************************************************************
+* Function Name: harness_predict_ns
+****************************************************************************//**
+* Summary:
+*  Returns the duration of a recorded operation according to the model.
+*
+*******************************************************************************/
+static uint64_t harness_predict_ns(const harness_record_t *record)
+{
+    const flash_model_config_t *config = flash_model_get_config();
+
+    switch(record->op)
+    {
+        case QSPI_TRACE_OP_INIT:
+            return (uint64_t)config->init_us * 1000u;
+        case QSPI_TRACE_OP_READ:
+            return flash_model_read_ns(record->length);
+        case QSPI_TRACE_OP_WRITE:
+            return flash_model_write_ns(record->addr, record->length);
+        case QSPI_TRACE_OP_ERASE:
+            return flash_model_erase_ns(record->addr, record->length);
+        default:
+            return (uint64_t)config->xip_switch_us * 1000u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_halt
+****************************************************************************//**
+* Summary:
+*  Returns from the run of main.c when it halts.
+*
+*******************************************************************************/
+static void harness_halt(bool failed)
+{
+    longjmp(harness_halt_jmp, failed ? HARNESS_JMP_FAILED : HARNESS_JMP_LOOP);
+}
+
+/*******************************************************************************
+* Function Name: harness_run_app
+****************************************************************************//**
+* Summary:
+*  Runs main.c until it reaches its LED loop or fails, with its output sent to
+*  a temporary file, then parses the trace it dumped.
+*
+* Return:
+*  True if main.c reached its LED loop.
+*
+*******************************************************************************/
+static bool harness_run_app(harness_trace_t *trace, bool verbose)
+{
+    FILE *capture = tmpfile();
+    int saved_stdout = dup(STDOUT_FILENO);
+    volatile int jmp_result;
+
+    if((NULL == capture) || (saved_stdout < 0))
+    {
+        fprintf(stderr, "cannot redirect the output of main.c\n");
+        return false;
+    }
+
+    model_backend_init(harness_halt);
+
+    fflush(stdout);
+    dup2(fileno(capture), STDOUT_FILENO);
+
+    jmp_result = setjmp(harness_halt_jmp);
+    if(0 == jmp_result)
+    {
+        (void)app_main();
+    }
+
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    rewind(capture);
+    harness_parse_trace(trace, capture, verbose);
+    fclose(capture);
+
+    if(HARNESS_JMP_LOOP != jmp_result)
+    {
+        fprintf(stderr, "main.c %s; run with -v to see its output\n",
+                (HARNESS_JMP_FAILED == jmp_result) ? "failed" : "returned");
+    }
+
+    return HARNESS_JMP_LOOP == jmp_result;
+}
+
+/*******************************************************************************
+* Function Name: harness_add_flow_metrics
+****************************************************************************//**
+* Summary:
+*  Derives the metrics of the flow of main.c from its trace records.
+*
+*******************************************************************************/
+static void harness_add_flow_metrics(const harness_trace_t *trace)
+{
+    double op_us[QSPI_TRACE_OP_COUNT] = { 0.0 };
+    uint64_t op_bytes[QSPI_TRACE_OP_COUNT] = { 0u };
+    uint32_t op_count[QSPI_TRACE_OP_COUNT] = { 0u };
+    double total_us = 0.0;
+    uint64_t sectors = 0u;
+    uint32_t sector_size = flash_model_get_config()->sector_size;
+
+    for(size_t index = 0; index < trace->count; index++)
+    {
+        const harness_record_t *record = &trace->records[index];
+        double us = harness_record_us(trace, record);
+
+        /* Failed operations end early and are covered by flow_failed */
+        if(CY_RSLT_SUCCESS != record->status)
+        {
+            continue;
+        }
+
+        op_us[record->op] += us;
+        op_bytes[record->op] += record->length;
+        op_count[record->op]++;
+        total_us += us;
+        if(QSPI_TRACE_OP_ERASE == record->op)
+        {
+            sectors += ((uint64_t)record->length + sector_size - 1u) / sector_size;
+        }
+    }
+
+    harness_add_metric("flow_qspi_us", total_us);
+    if(0u != op_count[QSPI_TRACE_OP_INIT])
+    {
+        harness_add_metric("init_us", op_us[QSPI_TRACE_OP_INIT] / op_count[QSPI_TRACE_OP_INIT]);
+    }
+    if(0u != sectors)
+    {
+        harness_add_metric("erase_sector_us", op_us[QSPI_TRACE_OP_ERASE] / (double)sectors);
+    }
+    if(0u != op_count[QSPI_TRACE_OP_READ])
+    {
+        harness_add_metric("packet_bytes", (double)op_bytes[QSPI_TRACE_OP_READ] / op_count[QSPI_TRACE_OP_READ]);
+        harness_add_metric("read_us", op_us[QSPI_TRACE_OP_READ] / op_count[QSPI_TRACE_OP_READ]);
+        harness_add_metric("read_kbps", ((double)op_bytes[QSPI_TRACE_OP_READ] * 1e6) /
+                                        (op_us[QSPI_TRACE_OP_READ] * 1024.0));
+    }
+    if(0u != op_count[QSPI_TRACE_OP_WRITE])
+    {
+        harness_add_metric("write_us", op_us[QSPI_TRACE_OP_WRITE] / op_count[QSPI_TRACE_OP_WRITE]);
+        harness_add_metric("write_kbps", ((double)op_bytes[QSPI_TRACE_OP_WRITE] * 1e6) /
+                                         (op_us[QSPI_TRACE_OP_WRITE] * 1024.0));
+    }
+    if(0u != op_count[QSPI_TRACE_OP_XIP_ENABLE])
+    {
+        harness_add_metric("xip_enable_us", op_us[QSPI_TRACE_OP_XIP_ENABLE] / op_count[QSPI_TRACE_OP_XIP_ENABLE]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_add_xip_metrics
+****************************************************************************//**
+* Summary:
+*  Measures a sequential stream and random word reads through the XIP cache,
+*  in the read mode main.c left the memory in.
+*
+*******************************************************************************/
+static void harness_add_xip_metrics(void)
+{
+    uint32_t seed = 1u;
+    uint64_t start;
+
+    flash_model_flush_cache();
+    start = flash_model_get_time_ns();
+    flash_model_fetch(0u, HARNESS_SEQ_FETCH_SIZE);
+    harness_add_metric("xip_seq_kbps", ((double)HARNESS_SEQ_FETCH_SIZE * 1e9) /
+                                       ((double)(flash_model_get_time_ns() - start) * 1024.0));
+
+    flash_model_flush_cache();
+    start = flash_model_get_time_ns();
+    for(uint32_t index = 0; index < HARNESS_RANDOM_FETCH_COUNT; index++)
+    {
+        /* Fixed LCG, so that runs are comparable */
+        seed = (seed * 1664525u) + 1013904223u;
+        flash_model_fetch((seed % HARNESS_RANDOM_FETCH_SPAN) & ~(HARNESS_RANDOM_FETCH_SIZE - 1u),
+                          HARNESS_RANDOM_FETCH_SIZE);
+    }
+    harness_add_metric("xip_random_us", ((double)(flash_model_get_time_ns() - start) / 1000.0) /
+                                        HARNESS_RANDOM_FETCH_COUNT);
+}
+
+/*******************************************************************************
+* Function Name: harness_compare_func_names
+****************************************************************************//**
+* Summary:
+*  qsort() and bsearch() comparison of harness_func_t by name.
+*
+*******************************************************************************/
+static int harness_compare_func_names(const void *a, const void *b)
+{
+    return strcmp(((const harness_func_t *)a)->name, ((const harness_func_t *)b)->name);
+}
+
+/*******************************************************************************
+* Function Name: harness_find_func
+****************************************************************************//**
+* Summary:
+*  Returns the function called name in funcs, which is sorted by name.
+*
+*******************************************************************************/
+static harness_func_t *harness_find_func(harness_func_t *funcs, size_t count, const char *name)
+{
+    harness_func_t key = { .name = (char *)name };
+
+    return bsearch(&key, funcs, count, sizeof(*funcs), harness_compare_func_names);
+}
+
+/*******************************************************************************
+* Function Name: harness_read_nm
+****************************************************************************//**
+* Summary:
+*  Reads the defined functions of 'nm -S' output, like scripts/xip_placement.py.
+*
+* Return:
+*  The functions sorted by name, or NULL on error.
+*
+*******************************************************************************/
+static harness_func_t *harness_read_nm(const char *path, size_t *count)
+{
+    FILE *file = fopen(path, "r");
+    char line[HARNESS_LINE_BUFFER_SIZE];
+    harness_func_t *funcs = NULL;
+    size_t capacity = 0u;
+
+    *count = 0u;
+    if(NULL == file)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return NULL;
+    }
+
+    while(NULL != fgets(line, sizeof(line), file))
+    {
+        char name[HARNESS_LINE_BUFFER_SIZE];
+        char type;
+        uint32_t addr;
+        uint32_t size;
+
+        /* '<addr> <size> <type> <name>'; symbols without a size are skipped */
+        if((4 != sscanf(line, "%"SCNx32" %"SCNx32" %c %s", &addr, &size, &type, name)) ||
+           (NULL == strchr("TtW", type)))
+        {
+            continue;
+        }
+
+        if(*count == capacity)
+        {
+            capacity = (0u == capacity) ? 256u : (capacity * 2u);
+            harness_func_t *grown = realloc(funcs, capacity * sizeof(*funcs));
+            if(NULL == grown)
+            {
+                break;
+            }
+            funcs = grown;
+        }
+
+        funcs[*count] = (harness_func_t){ .name = strdup(name), .addr = addr & ~1u, .size = size };
+        (*count)++;
+    }
+
+    fclose(file);
+    if(NULL != funcs)
+    {
+        qsort(funcs, *count, sizeof(*funcs), harness_compare_func_names);
+    }
+    return funcs;
+}
+
+/*******************************************************************************
+* Function Name: harness_read_profile
+****************************************************************************//**
+* Summary:
+*  Adds the counts of a profile in the format of scripts/xip_placement.py to
+*  funcs. PC samples are resolved with the addresses from nm.
+*
+* Return:
+*  False if the file cannot be read.
+*
+*******************************************************************************/
+static bool harness_read_profile(const char *path, harness_func_t *funcs, size_t count)
+{
+    FILE *file = fopen(path, "r");
+    char line[HARNESS_LINE_BUFFER_SIZE];
+    uint64_t unresolved = 0u;
+
+    if(NULL == file)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+
+    while(NULL != fgets(line, sizeof(line), file))
+    {
+        char name[HARNESS_LINE_BUFFER_SIZE];
+        uint64_t samples = 1u;
+        harness_func_t *func = NULL;
+
+        line[strcspn(line, "#\r\n")] = '\0';
+        if(sscanf(line, " %[^, \t] , %"SCNu64, name, &samples) < 1)
+        {
+            continue;
+        }
+
+        if((0 == strncmp(name, "0x", 2u)) || (0 == strncmp(name, "0X", 2u)))
+        {
+            uint32_t addr = (uint32_t)strtoul(name, NULL, 16) & ~1u;
+
+            for(size_t index = 0; (index < count) && (NULL == func); index++)
+            {
+                if((addr >= funcs[index].addr) && (addr < (funcs[index].addr + funcs[index].size)))
+                {
+                    func = &funcs[index];
+                }
+            }
+        }
+        else
+        {
+            func = harness_find_func(funcs, count, name);
+        }
+
+        if(NULL == func)
+        {
+            unresolved += samples;
+            continue;
+        }
+        func->count += samples;
+    }
+
+    fclose(file);
+    if(0u != unresolved)
+    {
+        fprintf(stderr, "warning: %"PRIu64" samples outside the functions of the nm output\n", unresolved);
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: harness_read_cold
+****************************************************************************//**
+* Summary:
+*  Lays out the functions of the cold fragment from the start of the XIP
+*  region in the order of the file, honouring its ALIGN() statements.
+*
+* Return:
+*  Bytes of the layout, or UINT32_MAX if the file cannot be read.
+*
+*******************************************************************************/
+static uint32_t harness_read_cold(const char *path, harness_func_t *funcs, size_t count)
+{
+    FILE *file = fopen(path, "r");
+    char line[HARNESS_LINE_BUFFER_SIZE];
+    uint32_t offset = 0u;
+    uint32_t missing = 0u;
+
+    if(NULL == file)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return UINT32_MAX;
+    }
+
+    while(NULL != fgets(line, sizeof(line), file))
+    {
+        char name[HARNESS_LINE_BUFFER_SIZE];
+        uint32_t align;
+
+        if(1 == sscanf(line, " . = ALIGN ( %"SCNu32" )", &align))
+        {
+            if((0u != align) && (0u == (align & (align - 1u))))
+            {
+                offset = (offset + align - 1u) & ~(align - 1u);
+            }
+        }
+        else if(1 == sscanf(line, " *(.text.%[^) \t])", name))
+        {
+            harness_func_t *func = harness_find_func(funcs, count, name);
+
+            if(NULL == func)
+            {
+                missing++;
+                continue;
+            }
+            func->cold = true;
+            func->xip_offset = offset;
+            offset += func->size;
+        }
+    }
+
+    fclose(file);
+    if(0u != missing)
+    {
+        fprintf(stderr, "warning: %"PRIu32" functions of %s are not in the nm output\n", missing, path);
+    }
+    return offset;
+}
+
+/*******************************************************************************
+* Function Name: harness_add_placement_metrics
+****************************************************************************//**
+* Summary:
+*  Replays the calls of the profile into the cold functions through the XIP
+*  cache. Calls are interleaved round-robin, each one fetching the whole
+*  function, and scaled down to HARNESS_PLACEMENT_MAX_CALLS; the stall time is
+*  scaled back up to the profile.
+*
+* Return:
+*  False if an input cannot be read.
+*
+*******************************************************************************/
+static bool harness_add_placement_metrics(const harness_options_t *options)
+{
+    size_t count;
+    harness_func_t *funcs = harness_read_nm(options->nm, &count);
+    uint64_t total = 0u;
+    uint64_t simulated = 0u;
+    uint64_t *remaining;
+    uint32_t cold_bytes;
+    bool active = true;
+    flash_model_stats_t stats;
+
+    if((NULL == funcs) || !harness_read_profile(options->profile, funcs, count))
+    {
+        return false;
+    }
+
+    cold_bytes = harness_read_cold(options->cold_fragment, funcs, count);
+    remaining = calloc(count + 1u, sizeof(*remaining));
+    if((UINT32_MAX == cold_bytes) || (NULL == remaining))
+    {
+        return false;
+    }
+
+    for(size_t index = 0; index < count; index++)
+    {
+        total += funcs[index].cold ? funcs[index].count : 0u;
+    }
+
+    double scale = (total > HARNESS_PLACEMENT_MAX_CALLS) ? ((double)HARNESS_PLACEMENT_MAX_CALLS / total) : 1.0;
+
+    for(size_t index = 0; index < count; index++)
+    {
+        if(funcs[index].cold && (0u != funcs[index].count))
+        {
+            remaining[index] = (uint64_t)((funcs[index].count * scale) + 0.5);
+            remaining[index] = (0u == remaining[index]) ? 1u : remaining[index];
+        }
+    }
+
+    flash_model_flush_cache();
+    flash_model_reset_stats();
+    while(active)
+    {
+        active = false;
+        for(size_t index = 0; index < count; index++)
+        {
+            if(0u != remaining[index])
+            {
+                flash_model_fetch(funcs[index].xip_offset, funcs[index].size);
+                remaining[index]--;
+                simulated++;
+                active = true;
+            }
+        }
+    }
+    flash_model_get_stats(&stats);
+
+    harness_add_metric("xip_cold_bytes", cold_bytes);
+    harness_add_metric("xip_calls", (double)total);
+    if(0u != (stats.hits + stats.misses))
+    {
+        harness_add_metric("xip_hit_pct", (100.0 * stats.hits) / (stats.hits + stats.misses));
+    }
+    harness_add_metric("xip_stall_us", (0u == simulated) ? 0.0 :
+                                       (((double)stats.stall_ns / 1000.0) * ((double)total / simulated)));
+
+    for(size_t index = 0; index < count; index++)
+    {
+        free(funcs[index].name);
+    }
+    free(funcs);
+    free(remaining);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: harness_check_baseline
+****************************************************************************//**
+* Summary:
+*  Compares the metrics with those of a baseline file written by 'run'. A
+*  metric regresses if it moves in its bad direction by more than the
+*  tolerance, or is missing.
+*
+* Return:
+*  Number of regressions, or -1 if the file cannot be read.
+*
+*******************************************************************************/
+static int harness_check_baseline(const char *path, double tolerance_pct)
+{
+    FILE *file = fopen(path, "r");
+    char line[HARNESS_LINE_BUFFER_SIZE];
+    double tolerance = tolerance_pct / 100.0;
+    int regressions = 0;
+    int improvements = 0;
+
+    if(NULL == file)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return -1;
+    }
+
+    while(NULL != fgets(line, sizeof(line), file))
+    {
+        char name[64];
+        double expected;
+
+        if(2 != sscanf(line, "metric,%63[^,],%lf", name, &expected))
+        {
+            continue;
+        }
+
+        const harness_metric_t *metric = harness_find_metric(name);
+        const char *verdict = "ok";
+
+        if(NULL == metric)
+        {
+            const harness_metric_info_t *info = NULL;
+
+            for(size_t index = 0; index < HARNESS_METRIC_COUNT; index++)
+            {
+                info = (0 == strcmp(name, harness_metric_infos[index].name)) ? &harness_metric_infos[index] : info;
+            }
+
+            /* Missing because the flow failed early, or unknown to this version */
+            if((NULL == info) || (HARNESS_INFO != info->direction))
+            {
+                printf("check,%s,%.2f,missing,REGRESSION\n", name, expected);
+                regressions++;
+            }
+            else
+            {
+                printf("check,%s,%.2f,missing,changed\n", name, expected);
+            }
+            continue;
+        }
+
+        double change = (0.0 == expected) ? ((0.0 == metric->value) ? 0.0 : 1.0) :
+                        ((metric->value - expected) / expected);
+
+        if(HARNESS_INFO == metric->info->direction)
+        {
+            verdict = ((change > tolerance) || (change < -tolerance)) ? "changed" : "ok";
+        }
+        else if(((HARNESS_LOWER_IS_BETTER == metric->info->direction) && (change > tolerance)) ||
+                ((HARNESS_HIGHER_IS_BETTER == metric->info->direction) && (change < -tolerance)))
+        {
+            verdict = "REGRESSION";
+            regressions++;
+        }
+        else if((change > tolerance) || (change < -tolerance))
+        {
+            verdict = "improved";
+            improvements++;
+        }
+
+        printf("check,%s,%.2f,%.2f,%+.1f%%,%s\n", name, expected, metric->value, change * 100.0, verdict);
+    }
+
+    fclose(file);
+
+    if(0 != regressions)
+    {
+        printf("%d regression(s) against %s (tolerance %.1f%%)\n", regressions, path, tolerance_pct);
+    }
+    else if(0 != improvements)
+    {
+        printf("No regressions; %d metric(s) improved, update %s with 'make baseline'\n", improvements, path);
+    }
+    else
+    {
+        printf("No regressions against %s\n", path);
+    }
+
+    return regressions;
+}
+
+/*******************************************************************************
+* Function Name: harness_run
+****************************************************************************//**
+* Summary:
+*  Implements the 'run' command.
+*
+*******************************************************************************/
+static int harness_run(const harness_options_t *options)
+{
+    harness_trace_t trace = { 0 };
+    bool passed = harness_run_app(&trace, options->verbose);
+
+    if(0u == trace.clock_hz)
+    {
+        trace.clock_hz = SystemCoreClock;
+    }
+
+    harness_add_metric("flow_failed", passed ? 0.0 : 1.0);
+    harness_add_metric("bus_hz", flash_model_get_bus_hz());
+    harness_add_metric("xip_image_bytes", model_backend_get_xip_size());
+    harness_add_flow_metrics(&trace);
+    harness_add_xip_metrics();
+    free(trace.records);
+
+    if((NULL != options->profile) && !harness_add_placement_metrics(options))
+    {
+        return EXIT_FAILURE;
+    }
+
+    harness_print_metrics();
+
+    if(NULL != options->baseline)
+    {
+        int regressions = harness_check_baseline(options->baseline, options->tolerance_pct);
+
+        if(0 != regressions)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+* Function Name: harness_replay
+****************************************************************************//**
+* Summary:
+*  Implements the 'replay' command: per operation, the recorded and predicted
+*  mean latency and throughput.
+*
+*******************************************************************************/
+static int harness_replay(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    harness_trace_t trace = { 0 };
+    double recorded_us[QSPI_TRACE_OP_COUNT] = { 0.0 };
+    double predicted_us[QSPI_TRACE_OP_COUNT] = { 0.0 };
+    uint64_t bytes[QSPI_TRACE_OP_COUNT] = { 0u };
+    uint32_t count[QSPI_TRACE_OP_COUNT] = { 0u };
+    double recorded_total = 0.0;
+    double predicted_total = 0.0;
+
+    if(NULL == file)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return EXIT_FAILURE;
+    }
+    harness_parse_trace(&trace, file, false);
+    fclose(file);
+
+    if(0u == trace.count)
+    {
+        fprintf(stderr, "no qspi_trace records in %s\n", path);
+        free(trace.records);
+        return EXIT_FAILURE;
+    }
+    if(0u == trace.clock_hz)
+    {
+        trace.clock_hz = flash_model_get_config()->cpu_hz;
+        fprintf(stderr, "warning: no qspi_trace_clock line, assuming %"PRIu32" Hz\n", trace.clock_hz);
+    }
+
+    for(size_t index = 0; index < trace.count; index++)
+    {
+        const harness_record_t *record = &trace.records[index];
+        double us = harness_record_us(&trace, record);
+        double predicted = (double)harness_predict_ns(record) / 1000.0;
+
+        recorded_us[record->op] += us;
+        predicted_us[record->op] += predicted;
+        bytes[record->op] += record->length;
+        count[record->op]++;
+        recorded_total += us;
+        predicted_total += predicted;
+    }
+
+    printf("Replay of %zu records at %"PRIu32" Hz, QSPI bus %"PRIu32" Hz\n\n", trace.count, trace.clock_hz,
+           flash_model_get_bus_hz());
+    printf("%-12s %6s %10s %13s %13s %8s %14s %14s\n", "op", "count", "bytes", "recorded us", "predicted us",
+           "error", "recorded KB/s", "predicted KB/s");
+
+    for(uint32_t op = 0; op < (uint32_t)QSPI_TRACE_OP_COUNT; op++)
+    {
+        if(0u == count[op])
+        {
+            continue;
+        }
+
+        printf("%-12s %6"PRIu32" %10"PRIu64" %13.1f %13.1f %+7.1f%%", harness_op_names[op], count[op], bytes[op],
+               recorded_us[op] / count[op], predicted_us[op] / count[op],
+               (0.0 == recorded_us[op]) ? 0.0 : (100.0 * (predicted_us[op] - recorded_us[op]) / recorded_us[op]));
+        if((0u != bytes[op]) && (0.0 != recorded_us[op]) && (0.0 != predicted_us[op]))
+        {
+            printf(" %14.1f %14.1f", ((double)bytes[op] * 1e6) / (recorded_us[op] * 1024.0),
+                   ((double)bytes[op] * 1e6) / (predicted_us[op] * 1024.0));
+        }
+        printf("\n");
+    }
+
+    printf("\n%-12s %6zu %10s %13.1f %13.1f %+7.1f%%\n", "total", trace.count, "", recorded_total, predicted_total,
+           (0.0 == recorded_total) ? 0.0 : (100.0 * (predicted_total - recorded_total) / recorded_total));
+
+    free(trace.records);
+    return EXIT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: harness_parse_options
+****************************************************************************//**
+* Summary:
+*  Parses the options before the command.
+*
+* Return:
+*  Index of the command in argv, or -1 on error.
+*
+*******************************************************************************/
+static int harness_parse_options(int argc, char *argv[], harness_options_t *options)
+{
+    int index = 1;
+
+    for(; (index < argc) && ('-' == argv[index][0]); index++)
+    {
+        const char *option = argv[index];
+        const char *value = ((index + 1) < argc) ? argv[index + 1] : NULL;
+
+        if((0 == strcmp(option, "-v")) || (0 == strcmp(option, "--verbose")))
+        {
+            options->verbose = true;
+            continue;
+        }
+
+        if(NULL == value)
+        {
+            fprintf(stderr, "%s needs a value\n", option);
+            return -1;
+        }
+        index++;
+
+        if((0 == strcmp(option, "-c")) || (0 == strcmp(option, "--config")))
+        {
+            if(!flash_model_load(&options->config, value))
+            {
+                return -1;
+            }
+        }
+        else if((0 == strcmp(option, "-s")) || (0 == strcmp(option, "--set")))
+        {
+            char key[64];
+            const char *equals = strchr(value, '=');
+
+            if((NULL == equals) || ((size_t)(equals - value) >= sizeof(key)))
+            {
+                fprintf(stderr, "expected KEY=VALUE, not '%s'\n", value);
+                return -1;
+            }
+            memcpy(key, value, (size_t)(equals - value));
+            key[equals - value] = '\0';
+            if(!flash_model_set(&options->config, key, equals + 1))
+            {
+                return -1;
+            }
+        }
+        else if((0 == strcmp(option, "-b")) || (0 == strcmp(option, "--baseline")))
+        {
+            options->baseline = value;
+        }
+        else if((0 == strcmp(option, "-t")) || (0 == strcmp(option, "--tolerance")))
+        {
+            options->tolerance_pct = strtod(value, NULL);
+        }
+        else if((0 == strcmp(option, "-p")) || (0 == strcmp(option, "--profile")))
+        {
+            options->profile = value;
+        }
+        else if((0 == strcmp(option, "-n")) || (0 == strcmp(option, "--nm")))
+        {
+            options->nm = value;
+        }
+        else if((0 == strcmp(option, "-l")) || (0 == strcmp(option, "--cold")))
+        {
+            options->cold_fragment = value;
+        }
+        else
+        {
+            fprintf(stderr, "unknown option %s\n", option);
+            return -1;
+        }
+    }
+
+    if((NULL != options->profile) && (NULL == options->nm))
+    {
+        fprintf(stderr, "--profile needs --nm for the function sizes\n");
+        return -1;
+    }
+
+    return (index < argc) ? index : -1;
+}
+
+/*******************************************************************************
+* Function Name: main
+****************************************************************************//**
+* Summary:
+*  Entry point of the harness.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    harness_options_t options =
+    {
+        .tolerance_pct = HARNESS_DEFAULT_TOLERANCE_PCT,
+        .cold_fragment = HARNESS_DEFAULT_COLD_FRAGMENT
+    };
+    int command;
+    int status = EXIT_FAILURE;
+
+    flash_model_get_defaults(&options.config);
+    command = harness_parse_options(argc, argv, &options);
+    if(command < 0)
+    {
+        harness_usage();
+        return EXIT_FAILURE;
+    }
+
+    if(0 == strcmp(argv[command], "config"))
+    {
+        flash_model_print(&options.config, stdout);
+        return EXIT_SUCCESS;
+    }
+
+    if(!flash_model_init(&options.config))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if(0 == strcmp(argv[command], "run"))
+    {
+        status = harness_run(&options);
+    }
+    else if((0 == strcmp(argv[command], "replay")) && ((command + 1) < argc))
+    {
+        status = harness_replay(argv[command + 1]);
+    }
+    else
+    {
+        harness_usage();
+    }
+
+    flash_model_deinit();
+    return status;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,215 @@
+/******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: Host build of the example: the subset of the PDL types, macros
+*              and CMSIS core registers that main.c and the headers it
+*              includes use. Hardware registers are plain variables owned by
+*              the flash model.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "cy_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Sections are placed at the device addresses by host_model.ld */
+#define CY_SECTION(name)                __attribute__((section(name)))
+#define CY_ALIGN(align)                 __attribute__((aligned(align)))
+#define CY_NOINIT                       __attribute__((section(".noinit")))
+#define CY_UNUSED_PARAMETER(param)      (void)(param)
+#define CY_ASSERT(x)                    do { } while(false)
+#define CY_HALT()                       __builtin_trap()
+
+#define CY_XIP_BASE                     (0x18000000UL)
+#define CY_SRAM_BASE                    (0x08000000UL)
+#define CY_FLASH_SIZEOF_ROW             (512u)
+#define CY_IPC_CHAN_USER                (8u)
+#define CY_IPC_INTR_USER                (8u)
+
+/* CMSIS core debug registers */
+#define DWT_CTRL_CYCCNTENA_Msk          (1uL)
+#define DWT_CTRL_NOCYCCNT_Msk           (1uL << 25u)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1uL << 24u)
+#define ITM_TCR_ITMENA_Msk              (1uL)
+
+#define SMIF_DEVICE_RD_DATA_CTL_DDR_MODE_Msk (1uL << 8u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile union
+    {
+        volatile uint8_t u8;
+        volatile uint16_t u16;
+        volatile uint32_t u32;
+    } PORT[32];
+    volatile uint32_t TER;
+    volatile uint32_t TCR;
+} ITM_Type;
+
+typedef struct
+{
+    volatile uint32_t CTL;
+} SMIF_Type;
+
+typedef enum
+{
+    CY_SMIF_SUCCESS = 0,
+    CY_SMIF_EXCEED_TIMEOUT,
+    CY_SMIF_BAD_PARAM,
+    CY_SMIF_BUSY
+} cy_en_smif_status_t;
+
+typedef enum
+{
+    CY_SMIF_WIDTH_SINGLE,
+    CY_SMIF_WIDTH_DUAL,
+    CY_SMIF_WIDTH_QUAD,
+    CY_SMIF_WIDTH_OCTAL
+} cy_en_smif_txfr_width_t;
+
+typedef enum
+{
+    CY_SMIF_CACHE_SLOW = 1,
+    CY_SMIF_CACHE_FAST = 2,
+    CY_SMIF_CACHE_BOTH = 3
+} cy_en_smif_cache_t;
+
+typedef enum
+{
+    CY_SMIF_SEL_OUTPUT_CLK,
+    CY_SMIF_SEL_INV_OUTPUT_CLK,
+    CY_SMIF_SEL_FEEDBACK_CLK,
+    CY_SMIF_SEL_INV_FEEDBACK_CLK,
+    CY_SMIF_SEL_INTERNAL_CLK,
+    CY_SMIF_SEL_INV_INTERNAL_CLK
+} cy_en_smif_clk_select_t;
+
+typedef struct
+{
+    uint32_t command;
+    cy_en_smif_txfr_width_t cmdWidth;
+    cy_en_smif_txfr_width_t addrWidth;
+    uint32_t mode;
+    cy_en_smif_txfr_width_t modeWidth;
+    uint32_t dummyCycles;
+    cy_en_smif_txfr_width_t dataWidth;
+} cy_stc_smif_mem_cmd_t;
+
+typedef struct
+{
+    uint32_t numOfAddrBytes;
+    uint32_t memSize;
+    cy_stc_smif_mem_cmd_t *readCmd;
+    cy_stc_smif_mem_cmd_t *programCmd;
+    uint32_t eraseSize;
+    uint32_t programSize;
+    uint32_t eraseTime;
+    uint32_t programTime;
+} cy_stc_smif_mem_device_cfg_t;
+
+typedef struct
+{
+    uint32_t flags;
+    uint32_t baseAddress;
+    uint32_t memMappedSize;
+    cy_stc_smif_mem_device_cfg_t *deviceCfg;
+} cy_stc_smif_mem_config_t;
+
+/*******************************************************************************
+* Global variables
+********************************************************************************/
+extern uint32_t SystemCoreClock;
+extern DWT_Type *DWT;
+extern CoreDebug_Type *CoreDebug;
+extern ITM_Type *ITM;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+static inline void __enable_irq(void) {}
+static inline void __DMB(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+static inline uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    return *addr;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    *addr = value;
+    return 0u;
+}
+
+static inline uint32_t Cy_SysLib_EnterCriticalSection(void) { return 0u; }
+static inline void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus) { (void)savedIntrStatus; }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_PDL_H */
+
+/* [] END OF FILE */
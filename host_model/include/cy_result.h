@@ -0,0 +1,73 @@
+/******************************************************************************
+* File Name:   cy_result.h
+*
+* Description: Host build of the example: result codes of the ModusToolbox
+*              core library.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef CY_RESULT_H
+#define CY_RESULT_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define CY_RSLT_SUCCESS                 ((cy_rslt_t)0x00000000u)
+#define CY_RSLT_TYPE_INFO               (0u)
+#define CY_RSLT_TYPE_WARNING            (1u)
+#define CY_RSLT_TYPE_ERROR              (2u)
+#define CY_RSLT_TYPE_FATAL              (3u)
+#define CY_RSLT_MODULE_MIDDLEWARE_BASE  (0x1A0u)
+
+#define CY_RSLT_CREATE(type, module, code) \
+    ((((module) & 0x3FFFu) << 18u) | (((code) & 0xFFFFu) << 0u) | (((type) & 0x3u) << 16u))
+#define CY_RSLT_GET_TYPE(result)        (((result) >> 16u) & 0x3u)
+#define CY_RSLT_GET_MODULE(result)      (((result) >> 18u) & 0x3FFFu)
+#define CY_RSLT_GET_CODE(result)        ((result) & 0xFFFFu)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef uint32_t cy_rslt_t;
+
+#endif /* CY_RESULT_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,85 @@
+/******************************************************************************
+* File Name:   cy_serial_flash_qspi.h
+*
+* Description: Host build of the example: the serial-flash library API,
+*              implemented on top of the flash model.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef CY_SERIAL_FLASH_QSPI_H
+#define CY_SERIAL_FLASH_QSPI_H
+
+#include "cyhal.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define CY_SERIAL_FLASH_QSPI_THREAD_SAFE    (0u)
+
+#define CY_RSLT_MODULE_SERIAL_FLASH         (0x1A1u)
+#define CY_RSLT_SERIAL_FLASH_ERR_BAD_PARAM  CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_SERIAL_FLASH, 2u)
+#define CY_RSLT_SERIAL_FLASH_ERR_QSPI_BUSY  CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_SERIAL_FLASH, 5u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t cy_serial_flash_qspi_init(const cy_stc_smif_mem_config_t *mem_config, cyhal_gpio_t io0, cyhal_gpio_t io1,
+                                    cyhal_gpio_t io2, cyhal_gpio_t io3, cyhal_gpio_t io4, cyhal_gpio_t io5,
+                                    cyhal_gpio_t io6, cyhal_gpio_t io7, cyhal_gpio_t sclk, cyhal_gpio_t ssel,
+                                    uint32_t hz);
+void cy_serial_flash_qspi_deinit(void);
+size_t cy_serial_flash_qspi_get_size(void);
+size_t cy_serial_flash_qspi_get_erase_size(uint32_t addr);
+size_t cy_serial_flash_qspi_get_prog_size(uint32_t addr);
+cy_rslt_t cy_serial_flash_qspi_read(uint32_t addr, size_t length, uint8_t *buf);
+cy_rslt_t cy_serial_flash_qspi_write(uint32_t addr, size_t length, const uint8_t *buf);
+cy_rslt_t cy_serial_flash_qspi_erase(uint32_t addr, size_t length);
+cy_rslt_t cy_serial_flash_qspi_enable_xip(bool enable);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_SERIAL_FLASH_QSPI_H */
+
+/* [] END OF FILE */
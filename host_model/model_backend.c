@@ -0,0 +1,399 @@
+/******************************************************************************
+* File Name:   model_backend.c
+*
+* Description: Host build of the example: implements the serial-flash
+*              library, the XIP read mode module, the BSP, the HAL functions
+*              and the core registers used by main.c on top of the flash
+*              model.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycfg_qspi_memslot.h"
+#include "flash_model.h"
+#include "model_backend.h"
+#include "xip_read_mode.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Memory-mapped size of the slot, as generated by the QSPI Configurator */
+#define BACKEND_MEM_MAPPED_SIZE         (0x04000000u)
+
+/* Bytes read in continuous read mode to put the memory into it */
+#define BACKEND_MODE_ENTRY_BYTES        (4u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+uint32_t SystemCoreClock = 0u;
+
+static DWT_Type backend_dwt;
+static CoreDebug_Type backend_core_debug;
+static ITM_Type backend_itm;
+DWT_Type *DWT = &backend_dwt;
+CoreDebug_Type *CoreDebug = &backend_core_debug;
+ITM_Type *ITM = &backend_itm;
+
+/* Read command with a mode byte, so that continuous read mode can be used */
+static cy_stc_smif_mem_cmd_t backend_read_cmd =
+{
+    .command = 0xEBu,
+    .cmdWidth = CY_SMIF_WIDTH_SINGLE,
+    .addrWidth = CY_SMIF_WIDTH_QUAD,
+    .mode = 0x00u,
+    .modeWidth = CY_SMIF_WIDTH_QUAD,
+    .dummyCycles = 4u,
+    .dataWidth = CY_SMIF_WIDTH_QUAD
+};
+
+static cy_stc_smif_mem_device_cfg_t backend_device_cfg =
+{
+    .readCmd = &backend_read_cmd
+};
+
+static cy_stc_smif_mem_config_t backend_mem_config =
+{
+    .flags = 0u,
+    .baseAddress = CY_XIP_BASE,
+    .memMappedSize = BACKEND_MEM_MAPPED_SIZE,
+    .deviceCfg = &backend_device_cfg
+};
+
+const cy_stc_smif_mem_config_t *const smifMemConfigs[CY_SMIF_DEVICE_NUM] = { &backend_mem_config };
+
+static model_backend_halt_t backend_halt = NULL;
+static bool backend_initialized = false;
+static bool backend_read_mode_initialized = false;
+static bool backend_continuous = false;
+
+/* Linker symbols of host_model.ld */
+extern uint8_t __cy_xip_start[];
+extern uint8_t __cy_xip_end[];
+
+/*******************************************************************************
+* Function Name: model_backend_init
+****************************************************************************//**
+* Summary:
+*  Resets the backend for a new run of main.c. Call after flash_model_init().
+*
+* Parameters:
+*  halt - called when main.c halts.
+*
+*******************************************************************************/
+void model_backend_init(model_backend_halt_t halt)
+{
+    const flash_model_config_t *config = flash_model_get_config();
+
+    backend_halt = halt;
+    backend_initialized = false;
+    backend_read_mode_initialized = false;
+    backend_continuous = false;
+
+    SystemCoreClock = config->cpu_hz;
+    memset(&backend_dwt, 0, sizeof(backend_dwt));
+    memset(&backend_core_debug, 0, sizeof(backend_core_debug));
+    memset(&backend_itm, 0, sizeof(backend_itm));
+
+    backend_device_cfg.numOfAddrBytes = config->addr_bytes;
+    backend_device_cfg.memSize = config->mem_size;
+    backend_device_cfg.eraseSize = config->sector_size;
+    backend_device_cfg.programSize = config->page_size;
+    backend_device_cfg.eraseTime = config->sector_erase_us / 1000u;
+    backend_device_cfg.programTime = config->page_program_us;
+    backend_read_cmd.dummyCycles = config->dummy_cycles;
+}
+
+/*******************************************************************************
+* Function Name: model_backend_get_xip_size
+****************************************************************************//**
+* Summary:
+*  Returns the size of the .cy_xip and .cy_xip_code sections of the host
+*  build, i.e. what main.c places in the external memory.
+*
+*******************************************************************************/
+uint32_t model_backend_get_xip_size(void)
+{
+    return (uint32_t)(__cy_xip_end - __cy_xip_start);
+}
+
+/*******************************************************************************
+* Function Name: backend_check
+****************************************************************************//**
+* Summary:
+*  Returns the result of an MMIO access: the library must be initialized, out
+*  of XIP mode, and the range inside the memory.
+*
+*******************************************************************************/
+static cy_rslt_t backend_check(uint32_t addr, size_t length)
+{
+    if(!backend_initialized || flash_model_is_xip())
+    {
+        return CY_RSLT_SERIAL_FLASH_ERR_QSPI_BUSY;
+    }
+
+    if((length > UINT32_MAX) || ((uint64_t)addr + length) > flash_model_get_config()->mem_size)
+    {
+        return CY_RSLT_SERIAL_FLASH_ERR_BAD_PARAM;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Serial-flash library
+*******************************************************************************/
+cy_rslt_t cy_serial_flash_qspi_init(const cy_stc_smif_mem_config_t *mem_config, cyhal_gpio_t io0, cyhal_gpio_t io1,
+                                    cyhal_gpio_t io2, cyhal_gpio_t io3, cyhal_gpio_t io4, cyhal_gpio_t io5,
+                                    cyhal_gpio_t io6, cyhal_gpio_t io7, cyhal_gpio_t sclk, cyhal_gpio_t ssel,
+                                    uint32_t hz)
+{
+    (void)io0;
+    (void)io1;
+    (void)io2;
+    (void)io3;
+    (void)io4;
+    (void)io5;
+    (void)io6;
+    (void)io7;
+    (void)sclk;
+    (void)ssel;
+
+    if(NULL == mem_config)
+    {
+        return CY_RSLT_SERIAL_FLASH_ERR_BAD_PARAM;
+    }
+
+    flash_model_request_bus(hz);
+    flash_model_advance_ns((uint64_t)flash_model_get_config()->init_us * 1000u);
+    backend_initialized = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+void cy_serial_flash_qspi_deinit(void)
+{
+    backend_initialized = false;
+}
+
+size_t cy_serial_flash_qspi_get_size(void)
+{
+    return flash_model_get_config()->mem_size;
+}
+
+size_t cy_serial_flash_qspi_get_erase_size(uint32_t addr)
+{
+    (void)addr;
+    return flash_model_get_config()->sector_size;
+}
+
+size_t cy_serial_flash_qspi_get_prog_size(uint32_t addr)
+{
+    (void)addr;
+    return flash_model_get_config()->page_size;
+}
+
+cy_rslt_t cy_serial_flash_qspi_read(uint32_t addr, size_t length, uint8_t *buf)
+{
+    cy_rslt_t result = backend_check(addr, length);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        (void)flash_model_read(addr, (uint32_t)length, buf);
+    }
+
+    return result;
+}
+
+cy_rslt_t cy_serial_flash_qspi_write(uint32_t addr, size_t length, const uint8_t *buf)
+{
+    cy_rslt_t result = backend_check(addr, length);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        (void)flash_model_write(addr, (uint32_t)length, buf);
+    }
+
+    return result;
+}
+
+cy_rslt_t cy_serial_flash_qspi_erase(uint32_t addr, size_t length)
+{
+    cy_rslt_t result = backend_check(addr, length);
+
+    /* The library only erases whole sectors */
+    if((CY_RSLT_SUCCESS == result) &&
+       ((0u != (addr % flash_model_get_config()->sector_size)) ||
+        (0u != (length % flash_model_get_config()->sector_size))))
+    {
+        result = CY_RSLT_SERIAL_FLASH_ERR_BAD_PARAM;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        (void)flash_model_erase(addr, (uint32_t)length);
+    }
+
+    return result;
+}
+
+cy_rslt_t cy_serial_flash_qspi_enable_xip(bool enable)
+{
+    if(!backend_initialized)
+    {
+        return CY_RSLT_SERIAL_FLASH_ERR_QSPI_BUSY;
+    }
+
+    flash_model_set_xip(enable);
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* XIP read mode module, without the SMIF register accesses
+*******************************************************************************/
+cy_rslt_t xip_read_mode_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    if((NULL == mem_config) || !backend_initialized)
+    {
+        return XIP_READ_MODE_RSLT_ERR_NOT_INIT;
+    }
+
+    backend_read_mode_initialized = true;
+    backend_continuous = false;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t xip_read_mode_set_continuous(bool enable)
+{
+    if(!backend_read_mode_initialized)
+    {
+        return XIP_READ_MODE_RSLT_ERR_NOT_INIT;
+    }
+
+    if(flash_model_is_xip())
+    {
+        return XIP_READ_MODE_RSLT_ERR_MODE;
+    }
+
+    backend_continuous = enable;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t xip_read_mode_enter_xip(void)
+{
+    if(backend_continuous)
+    {
+        /* Read with the continuous mode code to put the memory into it */
+        flash_model_advance_ns(flash_model_read_ns(BACKEND_MODE_ENTRY_BYTES));
+    }
+
+    flash_model_set_continuous(backend_continuous);
+    return cy_serial_flash_qspi_enable_xip(true);
+}
+
+cy_rslt_t xip_read_mode_exit_xip(void)
+{
+    cy_rslt_t result = cy_serial_flash_qspi_enable_xip(false);
+
+    if((CY_RSLT_SUCCESS == result) && backend_continuous)
+    {
+        /* Mode bit reset, about as long as an empty read */
+        flash_model_advance_ns(flash_model_read_ns(0u));
+    }
+
+    flash_model_set_continuous(false);
+    return result;
+}
+
+/*******************************************************************************
+* BSP, HAL and console
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_retarget_io_init(cyhal_gpio_t tx, cyhal_gpio_t rx, uint32_t baudrate)
+{
+    (void)tx;
+    (void)rx;
+    (void)baudrate;
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction, cyhal_gpio_drive_mode_t drive_mode,
+                          bool init_val)
+{
+    (void)pin;
+    (void)direction;
+    (void)drive_mode;
+    (void)init_val;
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value)
+{
+    /* check_status() and check_address() turn the LED on, then spin forever */
+    if((CYBSP_USER_LED == pin) && (CYBSP_LED_STATE_ON == value) && (NULL != backend_halt))
+    {
+        backend_halt(true);
+    }
+}
+
+void cyhal_gpio_toggle(cyhal_gpio_t pin)
+{
+    (void)pin;
+}
+
+cy_rslt_t cyhal_system_delay_ms(uint32_t milliseconds)
+{
+    /* Only the LED loop at the end of main() waits */
+    (void)milliseconds;
+    if(NULL != backend_halt)
+    {
+        backend_halt(false);
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,1126 @@
+/******************************************************************************
+* File Name:   kv_store.c
+*
+* Description: This file contains a log-structured key-value store built on
+*              the serial-flash library. Records are appended to a circular
+*              log of sectors and located through a hash index in SRAM.
+*              Garbage collection moves the live records of the oldest sector
+*              to the head of the log and erases it. All state is rebuilt
+*              from the memory by kv_store_init(), so an interrupted update
+*              leaves the previous value in place.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "kv_store.h"
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define KV_SECTOR_MAGIC                 (0x3153564Bu)   /* "KVS1" */
+#define KV_RECORD_FLAG_DELETED          (0x01u)
+
+/* Sequence number of a sector that is not part of the log */
+#define KV_SEQ_FREE                     (0u)
+
+/* Index entries without a record */
+#define KV_INDEX_EMPTY                  (0xFFFFFFFFu)
+#define KV_INDEX_DELETED                (0xFFFFFFFEu)
+
+#define KV_ALIGN(size)                  (((size) + 3u) & ~3u)
+#define KV_RECORD_MAX_SIZE              KV_ALIGN(sizeof(kv_record_hdr_t) + KV_STORE_MAX_KEY_LEN + \
+                                                 KV_STORE_MAX_VALUE_LEN)
+
+/* Benchmark parameters */
+#define KV_DEMO_SECTORS                 (4u)
+#define KV_DEMO_KEYS                    (32u)
+#define KV_DEMO_VALUE_LEN               (64u)
+#define KV_DEMO_MAX_UPDATES             (100000u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Written once when a sector becomes the head of the log */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t seq;               /* Position of the sector in the log */
+    uint32_t erase_count;       /* Erases of the sector before this use */
+    uint32_t crc;               /* CRC-32 of the fields above */
+} kv_sector_hdr_t;
+
+/* Followed by the key, the value and 0xFF padding to 4 bytes */
+typedef struct
+{
+    uint32_t crc;               /* CRC-32 of the rest of the header, key and value */
+    uint16_t value_len;
+    uint8_t key_len;
+    uint8_t flags;
+} kv_record_hdr_t;
+
+typedef enum
+{
+    KV_SCAN_RECORD,             /* Valid record */
+    KV_SCAN_BLANK,              /* End of the data of the sector */
+    KV_SCAN_CORRUPT             /* Interrupted write, the sector must not grow */
+} kv_scan_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static bool kv_mounted = false;
+static uint32_t kv_base;
+static uint32_t kv_sector_size;
+static uint32_t kv_num_sectors;
+
+static uint32_t kv_seq[KV_STORE_MAX_SECTORS];
+static uint32_t kv_erase_count[KV_STORE_MAX_SECTORS];
+static uint32_t kv_live[KV_STORE_MAX_SECTORS];
+static uint32_t kv_head;
+static uint32_t kv_head_offset;
+static uint32_t kv_next_seq;
+
+/* Open-addressing hash index: key hash and address of its latest record */
+static uint32_t kv_index_hash[KV_STORE_INDEX_SIZE];
+static uint32_t kv_index_addr[KV_STORE_INDEX_SIZE];
+
+static kv_store_stats_t kv_stats;
+
+/* Record being written, read back or moved */
+static uint8_t kv_record[KV_RECORD_MAX_SIZE];
+
+/*******************************************************************************
+* Function Name: kv_crc32
+****************************************************************************//**
+* Summary:
+*  Updates a CRC-32 (IEEE 802.3) with a buffer. Start with 0.
+*
+*******************************************************************************/
+static uint32_t kv_crc32(uint32_t crc, const uint8_t *buf, size_t length)
+{
+    crc = ~crc;
+
+    for(size_t index = 0; index < length; index++)
+    {
+        crc ^= buf[index];
+
+        for(uint32_t bit = 0; bit < 8u; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+
+    return ~crc;
+}
+
+/*******************************************************************************
+* Function Name: kv_hash
+****************************************************************************//**
+* Summary:
+*  Returns the FNV-1a hash of a key.
+*
+*******************************************************************************/
+static uint32_t kv_hash(const uint8_t *key, uint32_t key_len)
+{
+    uint32_t hash = 2166136261u;
+
+    for(uint32_t index = 0; index < key_len; index++)
+    {
+        hash = (hash ^ key[index]) * 16777619u;
+    }
+
+    return hash;
+}
+
+static inline uint32_t kv_sector_addr(uint32_t sector)
+{
+    return kv_base + (sector * kv_sector_size);
+}
+
+static inline uint32_t kv_addr_to_sector(uint32_t addr)
+{
+    return (addr - kv_base) / kv_sector_size;
+}
+
+static inline uint32_t kv_record_size(const kv_record_hdr_t *hdr)
+{
+    return KV_ALIGN(sizeof(kv_record_hdr_t) + hdr->key_len + hdr->value_len);
+}
+
+/*******************************************************************************
+* Function Name: kv_is_blank
+****************************************************************************//**
+* Summary:
+*  Returns true if all bytes of a buffer are erased.
+*
+*******************************************************************************/
+static bool kv_is_blank(const uint8_t *buf, size_t length)
+{
+    for(size_t index = 0; index < length; index++)
+    {
+        if(0xFFu != buf[index])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: kv_read_record
+****************************************************************************//**
+* Summary:
+*  Reads the record at an offset of a sector into kv_record and checks it.
+*
+* Parameters:
+*  sector - sector index.
+*  offset - offset of the record in the sector.
+*
+*******************************************************************************/
+static kv_scan_t kv_read_record(uint32_t sector, uint32_t offset)
+{
+    kv_record_hdr_t *hdr = (kv_record_hdr_t *)kv_record;
+
+    if((offset + sizeof(kv_record_hdr_t)) > kv_sector_size)
+    {
+        return KV_SCAN_BLANK;
+    }
+
+    if(CY_RSLT_SUCCESS != cy_serial_flash_qspi_read(kv_sector_addr(sector) + offset, sizeof(kv_record_hdr_t),
+                                                    kv_record))
+    {
+        return KV_SCAN_CORRUPT;
+    }
+
+    if(kv_is_blank(kv_record, sizeof(kv_record_hdr_t)))
+    {
+        return KV_SCAN_BLANK;
+    }
+
+    uint32_t size = kv_record_size(hdr);
+    uint32_t data_len = hdr->key_len + hdr->value_len;
+
+    if((0u == hdr->key_len) || (hdr->key_len > KV_STORE_MAX_KEY_LEN) || (hdr->value_len > KV_STORE_MAX_VALUE_LEN) ||
+       ((offset + size) > kv_sector_size))
+    {
+        return KV_SCAN_CORRUPT;
+    }
+
+    if(CY_RSLT_SUCCESS != cy_serial_flash_qspi_read(kv_sector_addr(sector) + offset + sizeof(kv_record_hdr_t),
+                                                    data_len, &kv_record[sizeof(kv_record_hdr_t)]))
+    {
+        return KV_SCAN_CORRUPT;
+    }
+
+    uint32_t crc = kv_crc32(0u, &kv_record[sizeof(hdr->crc)],
+                            sizeof(kv_record_hdr_t) - sizeof(hdr->crc) + data_len);
+
+    return (crc == hdr->crc) ? KV_SCAN_RECORD : KV_SCAN_CORRUPT;
+}
+
+/*******************************************************************************
+* Function Name: kv_index_find
+****************************************************************************//**
+* Summary:
+*  Looks a key up in the index. Entries with the same hash are confirmed by
+*  reading the key of their record.
+*
+* Parameters:
+*  key - key.
+*  key_len - length of the key.
+*  slot - receives the entry of the key if found, or else the entry to use
+*         for inserting it.
+*
+* Return:
+*  true if the key is in the index.
+*
+*******************************************************************************/
+static bool kv_index_find(const uint8_t *key, uint32_t key_len, uint32_t *slot)
+{
+    uint8_t stored[sizeof(kv_record_hdr_t) + KV_STORE_MAX_KEY_LEN];
+    uint32_t hash = kv_hash(key, key_len);
+    uint32_t index = hash & (KV_STORE_INDEX_SIZE - 1u);
+    uint32_t insert = KV_INDEX_EMPTY;
+
+    for(uint32_t probe = 0; probe < KV_STORE_INDEX_SIZE; probe++)
+    {
+        uint32_t addr = kv_index_addr[index];
+
+        if(KV_INDEX_EMPTY == addr)
+        {
+            break;
+        }
+
+        if(KV_INDEX_DELETED == addr)
+        {
+            insert = (KV_INDEX_EMPTY == insert) ? index : insert;
+        }
+        else if((hash == kv_index_hash[index]) &&
+                (CY_RSLT_SUCCESS == cy_serial_flash_qspi_read(addr, sizeof(kv_record_hdr_t) + key_len, stored)) &&
+                (key_len == ((kv_record_hdr_t *)stored)->key_len) &&
+                (0 == memcmp(&stored[sizeof(kv_record_hdr_t)], key, key_len)))
+        {
+            *slot = index;
+            return true;
+        }
+
+        index = (index + 1u) & (KV_STORE_INDEX_SIZE - 1u);
+    }
+
+    *slot = (KV_INDEX_EMPTY == insert) ? index : insert;
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: kv_index_update
+****************************************************************************//**
+* Summary:
+*  Points the index to a new record of a key, or removes the key for a
+*  deletion record, and moves the live bytes of the previous record. The key
+*  follows the record header in memory.
+*
+*******************************************************************************/
+static void kv_index_update(uint32_t slot, bool found, uint32_t addr, const kv_record_hdr_t *hdr)
+{
+    if(found)
+    {
+        kv_record_hdr_t old;
+
+        if(CY_RSLT_SUCCESS == cy_serial_flash_qspi_read(kv_index_addr[slot], sizeof(old), (uint8_t *)&old))
+        {
+            kv_live[kv_addr_to_sector(kv_index_addr[slot])] -= kv_record_size(&old);
+        }
+    }
+
+    if(0u != (hdr->flags & KV_RECORD_FLAG_DELETED))
+    {
+        if(found)
+        {
+            kv_index_addr[slot] = KV_INDEX_DELETED;
+            kv_stats.keys--;
+        }
+    }
+    else
+    {
+        kv_index_hash[slot] = kv_hash((const uint8_t *)&hdr[1], hdr->key_len);
+        kv_index_addr[slot] = addr;
+        kv_live[kv_addr_to_sector(addr)] += kv_record_size(hdr);
+        kv_stats.keys += found ? 0u : 1u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: kv_sector_erase
+****************************************************************************//**
+* Summary:
+*  Erases a sector and removes it from the log.
+*
+*******************************************************************************/
+static cy_rslt_t kv_sector_erase(uint32_t sector)
+{
+    cy_rslt_t result = cy_serial_flash_qspi_erase(kv_sector_addr(sector), kv_sector_size);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        kv_seq[sector] = KV_SEQ_FREE;
+        kv_live[sector] = 0u;
+        kv_erase_count[sector]++;
+        kv_stats.erases++;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: kv_sector_open
+****************************************************************************//**
+* Summary:
+*  Writes the header of an erased sector, making it the head of the log.
+*
+*******************************************************************************/
+static cy_rslt_t kv_sector_open(uint32_t sector)
+{
+    kv_sector_hdr_t hdr;
+
+    hdr.magic = KV_SECTOR_MAGIC;
+    hdr.seq = kv_next_seq;
+    hdr.erase_count = kv_erase_count[sector];
+    hdr.crc = kv_crc32(0u, (const uint8_t *)&hdr, offsetof(kv_sector_hdr_t, crc));
+
+    cy_rslt_t result = cy_serial_flash_qspi_write(kv_sector_addr(sector), sizeof(hdr), (const uint8_t *)&hdr);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        kv_seq[sector] = kv_next_seq++;
+        kv_head = sector;
+        kv_head_offset = sizeof(hdr);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: kv_append
+****************************************************************************//**
+* Summary:
+*  Writes the record in kv_record at the head of the log. The caller has
+*  checked that it fits.
+*
+*******************************************************************************/
+static cy_rslt_t kv_append(uint32_t *addr)
+{
+    uint32_t size = kv_record_size((const kv_record_hdr_t *)kv_record);
+
+    *addr = kv_sector_addr(kv_head) + kv_head_offset;
+    kv_head_offset += size;
+
+    return cy_serial_flash_qspi_write(*addr, size, kv_record);
+}
+
+/*******************************************************************************
+* Function Name: kv_count_free
+****************************************************************************//**
+* Summary:
+*  Returns the number of sectors outside the log and the oldest log sector.
+*
+*******************************************************************************/
+static uint32_t kv_count_free(uint32_t *oldest)
+{
+    uint32_t free_sectors = 0u;
+
+    *oldest = kv_head;
+
+    for(uint32_t sector = 0; sector < kv_num_sectors; sector++)
+    {
+        if(KV_SEQ_FREE == kv_seq[sector])
+        {
+            free_sectors++;
+        }
+        else if(kv_seq[sector] < kv_seq[*oldest])
+        {
+            *oldest = sector;
+        }
+    }
+
+    return free_sectors;
+}
+
+/*******************************************************************************
+* Function Name: kv_live_bytes
+****************************************************************************//**
+* Summary:
+*  Returns the bytes of the latest record of each key.
+*
+*******************************************************************************/
+static uint32_t kv_live_bytes(void)
+{
+    uint32_t live = 0u;
+
+    for(uint32_t sector = 0; sector < kv_num_sectors; sector++)
+    {
+        live += kv_live[sector];
+    }
+
+    return live;
+}
+
+/*******************************************************************************
+* Function Name: kv_gc
+****************************************************************************//**
+* Summary:
+*  Moves the live records of a sector to the head of the log, then erases
+*  the sector. Records are live if the index points to them; deletion records
+*  are dropped, since older records of their key can only be in this sector
+*  or in sectors already reclaimed.
+*
+*******************************************************************************/
+static cy_rslt_t kv_gc(uint32_t sector)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    const kv_record_hdr_t *hdr = (const kv_record_hdr_t *)kv_record;
+    uint32_t offset = sizeof(kv_sector_hdr_t);
+
+    while((CY_RSLT_SUCCESS == result) && (KV_SCAN_RECORD == kv_read_record(sector, offset)))
+    {
+        uint32_t slot;
+        uint32_t size = kv_record_size(hdr);
+        uint32_t addr = kv_sector_addr(sector) + offset;
+        bool found = kv_index_find(&kv_record[sizeof(kv_record_hdr_t)], hdr->key_len, &slot);
+
+        if(found && (addr == kv_index_addr[slot]))
+        {
+            if((kv_head_offset + size) > kv_sector_size)
+            {
+                result = KV_STORE_RSLT_ERR_FULL;
+            }
+            else
+            {
+                result = kv_append(&addr);
+            }
+
+            if(CY_RSLT_SUCCESS == result)
+            {
+                kv_live[sector] -= size;
+                kv_live[kv_head] += size;
+                kv_index_addr[slot] = addr;
+                kv_stats.gc_copied++;
+            }
+        }
+
+        offset += size;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = kv_sector_erase(sector);
+        kv_stats.gc_runs++;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: kv_reserve
+****************************************************************************//**
+* Summary:
+*  Makes room for a record of the given size at the head of the log. When the
+*  head is full, the next sector is opened; if no erased sector is left after
+*  that, the oldest one is reclaimed, so that one is always available.
+*
+*******************************************************************************/
+static cy_rslt_t kv_reserve(uint32_t size)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t oldest;
+
+    for(uint32_t attempt = 0; (kv_head_offset + size) > kv_sector_size; attempt++)
+    {
+        uint32_t next = (kv_head + 1u) % kv_num_sectors;
+
+        if((attempt >= kv_num_sectors) || (KV_SEQ_FREE != kv_seq[next]))
+        {
+            return KV_STORE_RSLT_ERR_FULL;
+        }
+
+        result = kv_sector_open(next);
+
+        if((CY_RSLT_SUCCESS == result) && (0u == kv_count_free(&oldest)))
+        {
+            result = kv_gc(oldest);
+        }
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: kv_check_key
+****************************************************************************//**
+* Summary:
+*  Returns the length of a key, or 0 if it is not valid.
+*
+*******************************************************************************/
+static uint32_t kv_check_key(const char *key)
+{
+    size_t key_len = (NULL != key) ? strlen(key) : 0u;
+
+    return (key_len <= KV_STORE_MAX_KEY_LEN) ? (uint32_t)key_len : 0u;
+}
+
+/*******************************************************************************
+* Function Name: kv_write
+****************************************************************************//**
+* Summary:
+*  Appends a record for a key and updates the index.
+*
+*******************************************************************************/
+static cy_rslt_t kv_write(const char *key, uint32_t key_len, const uint8_t *value, size_t length, uint8_t flags)
+{
+    uint32_t slot;
+    uint32_t addr;
+    kv_record_hdr_t *hdr = (kv_record_hdr_t *)kv_record;
+    uint32_t size = KV_ALIGN(sizeof(kv_record_hdr_t) + key_len + length);
+    bool found = kv_index_find((const uint8_t *)key, key_len, &slot);
+
+    if(!found && (0u != (flags & KV_RECORD_FLAG_DELETED)))
+    {
+        return KV_STORE_RSLT_ERR_NOT_FOUND;
+    }
+
+    if(!found && (kv_stats.keys >= KV_STORE_MAX_KEYS))
+    {
+        return KV_STORE_RSLT_ERR_FULL;
+    }
+
+    /* Two sectors are kept for the head and the garbage collection */
+    if((kv_live_bytes() + size) > ((kv_num_sectors - 2u) * (kv_sector_size - sizeof(kv_sector_hdr_t))))
+    {
+        return KV_STORE_RSLT_ERR_FULL;
+    }
+
+    cy_rslt_t result = kv_reserve(size);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    memset(kv_record, 0xFF, size);
+    hdr->value_len = (uint16_t)length;
+    hdr->key_len = (uint8_t)key_len;
+    hdr->flags = flags;
+    memcpy(&kv_record[sizeof(kv_record_hdr_t)], key, key_len);
+
+    if(0u != length)
+    {
+        memcpy(&kv_record[sizeof(kv_record_hdr_t) + key_len], value, length);
+    }
+
+    hdr->crc = kv_crc32(0u, &kv_record[sizeof(hdr->crc)],
+                        sizeof(kv_record_hdr_t) - sizeof(hdr->crc) + key_len + length);
+
+    result = kv_append(&addr);
+
+    /* The garbage collection may have moved the previous record, but not the
+     * index entry, so the slot is still valid.
+     */
+    if(CY_RSLT_SUCCESS == result)
+    {
+        kv_index_update(slot, found, addr, hdr);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: kv_store_init
+****************************************************************************//**
+* Summary:
+*  Mounts the store: reads the sector headers, replays the records of the log
+*  in order to rebuild the index and finds the end of the log. Sectors with
+*  an invalid header, left by an interrupted erase or header write, are
+*  erased. If the last record of the head was interrupted, a new sector is
+*  used for the next record. Blank memory is formatted on the first write.
+*  The erase count of sectors found erased is estimated as the highest one.
+*
+* Parameters:
+*  base - address of the first sector.
+*  num_sectors - number of sectors, 3 to KV_STORE_MAX_SECTORS, of the same
+*                size.
+*
+*******************************************************************************/
+cy_rslt_t kv_store_init(uint32_t base, uint32_t num_sectors)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    kv_sector_hdr_t hdr;
+    uint32_t max_erase_count = 0u;
+    uint32_t max_seq = KV_SEQ_FREE;
+
+    kv_mounted = false;
+
+    if((num_sectors < 3u) || (num_sectors > KV_STORE_MAX_SECTORS))
+    {
+        return KV_STORE_RSLT_ERR_BAD_PARAM;
+    }
+
+    kv_base = base;
+    kv_num_sectors = num_sectors;
+    kv_sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(base);
+
+    if((0u == kv_sector_size) || (0u != (base % kv_sector_size)) ||
+       (kv_sector_size < (sizeof(kv_sector_hdr_t) + KV_RECORD_MAX_SIZE)))
+    {
+        return KV_STORE_RSLT_ERR_SECTOR_MAP;
+    }
+
+    memset(&kv_stats, 0, sizeof(kv_stats));
+    memset(kv_index_addr, 0xFF, sizeof(kv_index_addr));
+
+    for(uint32_t sector = 0; (sector < num_sectors) && (CY_RSLT_SUCCESS == result); sector++)
+    {
+        kv_seq[sector] = KV_SEQ_FREE;
+        kv_erase_count[sector] = 0u;
+        kv_live[sector] = 0u;
+
+        if(kv_sector_size != cy_serial_flash_qspi_get_erase_size(kv_sector_addr(sector)))
+        {
+            return KV_STORE_RSLT_ERR_SECTOR_MAP;
+        }
+
+        result = cy_serial_flash_qspi_read(kv_sector_addr(sector), sizeof(hdr), (uint8_t *)&hdr);
+
+        if((CY_RSLT_SUCCESS == result) && !kv_is_blank((const uint8_t *)&hdr, sizeof(hdr)))
+        {
+            if((KV_SECTOR_MAGIC == hdr.magic) && (KV_SEQ_FREE != hdr.seq) &&
+               (hdr.crc == kv_crc32(0u, (const uint8_t *)&hdr, offsetof(kv_sector_hdr_t, crc))))
+            {
+                kv_seq[sector] = hdr.seq;
+                kv_erase_count[sector] = hdr.erase_count;
+                max_erase_count = (hdr.erase_count > max_erase_count) ? hdr.erase_count : max_erase_count;
+
+                if(hdr.seq > max_seq)
+                {
+                    max_seq = hdr.seq;
+                    kv_head = sector;
+                }
+            }
+            else
+            {
+                result = kv_sector_erase(sector);
+            }
+        }
+    }
+
+    for(uint32_t sector = 0; sector < num_sectors; sector++)
+    {
+        if(KV_SEQ_FREE == kv_seq[sector])
+        {
+            kv_erase_count[sector] = (kv_erase_count[sector] > max_erase_count) ? kv_erase_count[sector] :
+                                     max_erase_count;
+        }
+    }
+
+    /* Replay the log from the oldest sector */
+    for(uint32_t seq = 0u; (CY_RSLT_SUCCESS == result) && (KV_SEQ_FREE != max_seq); )
+    {
+        uint32_t sector = num_sectors;
+
+        for(uint32_t candidate = 0; candidate < num_sectors; candidate++)
+        {
+            if((kv_seq[candidate] > seq) && ((num_sectors == sector) || (kv_seq[candidate] < kv_seq[sector])))
+            {
+                sector = candidate;
+            }
+        }
+
+        if(num_sectors == sector)
+        {
+            break;
+        }
+
+        const kv_record_hdr_t *rec = (const kv_record_hdr_t *)kv_record;
+        uint32_t offset = sizeof(kv_sector_hdr_t);
+        kv_scan_t scan;
+
+        while(KV_SCAN_RECORD == (scan = kv_read_record(sector, offset)))
+        {
+            uint32_t slot;
+            bool found = kv_index_find(&kv_record[sizeof(kv_record_hdr_t)], rec->key_len, &slot);
+
+            if(found || (0u == (rec->flags & KV_RECORD_FLAG_DELETED)))
+            {
+                if(!found && (kv_stats.keys >= KV_STORE_MAX_KEYS))
+                {
+                    return KV_STORE_RSLT_ERR_CORRUPT;
+                }
+
+                kv_index_update(slot, found, kv_sector_addr(sector) + offset, rec);
+            }
+
+            offset += kv_record_size(rec);
+        }
+
+        if(sector == kv_head)
+        {
+            kv_head_offset = (KV_SCAN_BLANK == scan) ? offset : kv_sector_size;
+        }
+
+        seq = kv_seq[sector];
+    }
+
+    kv_next_seq = max_seq + 1u;
+
+    if((CY_RSLT_SUCCESS == result) && (KV_SEQ_FREE == max_seq))
+    {
+        /* Empty store: the first record opens sector 0 */
+        kv_head = num_sectors - 1u;
+        kv_head_offset = kv_sector_size;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        uint32_t oldest;
+
+        /* Restore the spare sector if an interruption came before the
+         * garbage collection that follows the opening of a sector.
+         */
+        if((0u == kv_count_free(&oldest)) && (oldest != kv_head))
+        {
+            result = kv_gc(oldest);
+        }
+    }
+
+    kv_mounted = (CY_RSLT_SUCCESS == result);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: kv_store_format
+****************************************************************************//**
+* Summary:
+*  Erases the sectors of the store, then mounts it empty.
+*
+* Parameters:
+*  base - address of the first sector.
+*  num_sectors - number of sectors.
+*
+*******************************************************************************/
+cy_rslt_t kv_store_format(uint32_t base, uint32_t num_sectors)
+{
+    size_t sector_size = cy_serial_flash_qspi_get_erase_size(base);
+
+    if((num_sectors < 3u) || (num_sectors > KV_STORE_MAX_SECTORS) || (0u == sector_size))
+    {
+        return KV_STORE_RSLT_ERR_BAD_PARAM;
+    }
+
+    cy_rslt_t result = cy_serial_flash_qspi_erase(base, num_sectors * sector_size);
+
+    return (CY_RSLT_SUCCESS == result) ? kv_store_init(base, num_sectors) : result;
+}
+
+/*******************************************************************************
+* Function Name: kv_store_set
+****************************************************************************//**
+* Summary:
+*  Stores a value for a key. Nothing is written if the value is unchanged.
+*
+* Parameters:
+*  key - NUL-terminated key of 1 to KV_STORE_MAX_KEY_LEN characters.
+*  value - value.
+*  length - length of the value, up to KV_STORE_MAX_VALUE_LEN.
+*
+*******************************************************************************/
+cy_rslt_t kv_store_set(const char *key, const uint8_t *value, size_t length)
+{
+    uint32_t key_len = kv_check_key(key);
+
+    if(!kv_mounted)
+    {
+        return KV_STORE_RSLT_ERR_NOT_INIT;
+    }
+
+    if((0u == key_len) || (length > KV_STORE_MAX_VALUE_LEN) || ((NULL == value) && (0u != length)))
+    {
+        return KV_STORE_RSLT_ERR_BAD_PARAM;
+    }
+
+    uint32_t slot;
+
+    if(kv_index_find((const uint8_t *)key, key_len, &slot))
+    {
+        const kv_record_hdr_t *hdr = (const kv_record_hdr_t *)kv_record;
+
+        if((KV_SCAN_RECORD == kv_read_record(kv_addr_to_sector(kv_index_addr[slot]),
+                                             (kv_index_addr[slot] - kv_base) % kv_sector_size)) &&
+           (length == hdr->value_len) &&
+           ((0u == length) || (0 == memcmp(&kv_record[sizeof(kv_record_hdr_t) + key_len], value, length))))
+        {
+            return CY_RSLT_SUCCESS;
+        }
+    }
+
+    return kv_write(key, key_len, value, length, 0u);
+}
+
+/*******************************************************************************
+* Function Name: kv_store_get
+****************************************************************************//**
+* Summary:
+*  Reads the value of a key.
+*
+* Parameters:
+*  key - NUL-terminated key.
+*  value - buffer for the value.
+*  size - size of the buffer.
+*  length - receives the length of the value, also when the buffer is too
+*           small.
+*
+*******************************************************************************/
+cy_rslt_t kv_store_get(const char *key, uint8_t *value, size_t size, size_t *length)
+{
+    uint32_t slot;
+    uint32_t key_len = kv_check_key(key);
+    const kv_record_hdr_t *hdr = (const kv_record_hdr_t *)kv_record;
+
+    if(!kv_mounted)
+    {
+        return KV_STORE_RSLT_ERR_NOT_INIT;
+    }
+
+    if((0u == key_len) || (NULL == length) || ((NULL == value) && (0u != size)))
+    {
+        return KV_STORE_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(!kv_index_find((const uint8_t *)key, key_len, &slot))
+    {
+        return KV_STORE_RSLT_ERR_NOT_FOUND;
+    }
+
+    if(KV_SCAN_RECORD != kv_read_record(kv_addr_to_sector(kv_index_addr[slot]),
+                                        (kv_index_addr[slot] - kv_base) % kv_sector_size))
+    {
+        return KV_STORE_RSLT_ERR_CORRUPT;
+    }
+
+    *length = hdr->value_len;
+
+    if(size < hdr->value_len)
+    {
+        return KV_STORE_RSLT_ERR_BUF_SIZE;
+    }
+
+    memcpy(value, &kv_record[sizeof(kv_record_hdr_t) + key_len], hdr->value_len);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: kv_store_delete
+****************************************************************************//**
+* Summary:
+*  Removes a key by appending a deletion record.
+*
+* Parameters:
+*  key - NUL-terminated key.
+*
+*******************************************************************************/
+cy_rslt_t kv_store_delete(const char *key)
+{
+    uint32_t key_len = kv_check_key(key);
+
+    if(!kv_mounted)
+    {
+        return KV_STORE_RSLT_ERR_NOT_INIT;
+    }
+
+    if(0u == key_len)
+    {
+        return KV_STORE_RSLT_ERR_BAD_PARAM;
+    }
+
+    return kv_write(key, key_len, NULL, 0u, KV_RECORD_FLAG_DELETED);
+}
+
+/*******************************************************************************
+* Function Name: kv_store_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the usage and wear counters of the store.
+*
+*******************************************************************************/
+void kv_store_get_stats(kv_store_stats_t *stats)
+{
+    uint32_t oldest;
+
+    *stats = kv_stats;
+    stats->live_bytes = kv_live_bytes();
+    stats->min_erase_count = UINT32_MAX;
+    stats->max_erase_count = 0u;
+    stats->free_sectors = kv_mounted ? kv_count_free(&oldest) : 0u;
+
+    for(uint32_t sector = 0; sector < kv_num_sectors; sector++)
+    {
+        stats->min_erase_count = (kv_erase_count[sector] < stats->min_erase_count) ? kv_erase_count[sector] :
+                                 stats->min_erase_count;
+        stats->max_erase_count = (kv_erase_count[sector] > stats->max_erase_count) ? kv_erase_count[sector] :
+                                 stats->max_erase_count;
+    }
+
+    stats->min_erase_count = (0u != kv_num_sectors) ? stats->min_erase_count : 0u;
+}
+
+/*******************************************************************************
+* Function Name: kv_store_print_wear
+****************************************************************************//**
+* Summary:
+*  Prints the erase count, log position and live data of each sector.
+*
+*******************************************************************************/
+void kv_store_print_wear(void)
+{
+    kv_store_stats_t stats;
+
+    kv_store_get_stats(&stats);
+
+    printf("%-8s %12s %10s %8s %12s\n", "Sector", "Address", "Erases", "Seq", "Live bytes");
+
+    for(uint32_t sector = 0; sector < kv_num_sectors; sector++)
+    {
+        printf("%-8"PRIu32"   0x%08"PRIx32" %10"PRIu32, sector, kv_sector_addr(sector), kv_erase_count[sector]);
+
+        if(KV_SEQ_FREE == kv_seq[sector])
+        {
+            printf(" %8s %12s\n", "free", "-");
+        }
+        else
+        {
+            printf(" %8"PRIu32" %12"PRIu32"\n", kv_seq[sector], kv_live[sector]);
+        }
+    }
+
+    printf("Erase count spread: %"PRIu32" - %"PRIu32", %"PRIu32" keys, %"PRIu32" live bytes\n",
+           stats.min_erase_count, stats.max_erase_count, stats.keys, stats.live_bytes);
+}
+
+/*******************************************************************************
+* Function Name: kv_store_benchmark
+****************************************************************************//**
+* Summary:
+*  Formats a store of KV_DEMO_SECTORS sectors and measures the latency of
+*  inserts, lookups and updates. The updates run until every sector has been
+*  reclaimed once. The store is then mounted again, as after a reset, and all
+*  values are checked before printing the wear report.
+*
+* Parameters:
+*  ext_addr - address of the first sector of the store.
+*
+*******************************************************************************/
+cy_rslt_t kv_store_benchmark(uint32_t ext_addr)
+{
+    static uint8_t values[KV_DEMO_KEYS][KV_DEMO_VALUE_LEN];
+    uint8_t value[KV_DEMO_VALUE_LEN];
+    char key[KV_STORE_MAX_KEY_LEN + 1u];
+    uint32_t insert_cycles = 0u;
+    uint32_t lookup_cycles = 0u;
+    uint32_t update_cycles = 0u;
+    uint32_t max_cycles = 0u;
+    uint32_t updates = 0u;
+    uint32_t lcg = 1u;
+    size_t length;
+    kv_store_stats_t stats;
+
+    cycle_counter_init();
+
+    cy_rslt_t result = kv_store_format(ext_addr, KV_DEMO_SECTORS);
+
+    for(uint32_t id = 0; (id < KV_DEMO_KEYS) && (CY_RSLT_SUCCESS == result); id++)
+    {
+        (void)snprintf(key, sizeof(key), "cfg/%02"PRIu32, id);
+        memset(values[id], (int)id, KV_DEMO_VALUE_LEN);
+
+        uint32_t start = cycle_counter_get();
+        result = kv_store_set(key, values[id], KV_DEMO_VALUE_LEN);
+        insert_cycles += cycle_counter_get() - start;
+    }
+
+    for(uint32_t id = 0; (id < KV_DEMO_KEYS) && (CY_RSLT_SUCCESS == result); id++)
+    {
+        (void)snprintf(key, sizeof(key), "cfg/%02"PRIu32, id);
+
+        uint32_t start = cycle_counter_get();
+        result = kv_store_get(key, value, sizeof(value), &length);
+        lookup_cycles += cycle_counter_get() - start;
+
+        if((CY_RSLT_SUCCESS == result) && (0 != memcmp(value, values[id], KV_DEMO_VALUE_LEN)))
+        {
+            result = KV_STORE_RSLT_ERR_VERIFY;
+        }
+    }
+
+    kv_store_get_stats(&stats);
+
+    while((CY_RSLT_SUCCESS == result) && (stats.gc_runs < KV_DEMO_SECTORS) && (updates < KV_DEMO_MAX_UPDATES))
+    {
+        lcg = (lcg * 1103515245u) + 12345u;
+
+        uint32_t id = (lcg >> 16) % KV_DEMO_KEYS;
+
+        (void)snprintf(key, sizeof(key), "cfg/%02"PRIu32, id);
+        values[id][updates % KV_DEMO_VALUE_LEN]++;
+
+        uint32_t start = cycle_counter_get();
+        result = kv_store_set(key, values[id], KV_DEMO_VALUE_LEN);
+        uint32_t cycles = cycle_counter_get() - start;
+
+        update_cycles += cycles;
+        max_cycles = (cycles > max_cycles) ? cycles : max_cycles;
+        updates++;
+        kv_store_get_stats(&stats);
+    }
+
+    /* Mount again from the memory only */
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = kv_store_init(ext_addr, KV_DEMO_SECTORS);
+    }
+
+    for(uint32_t id = 0; (id < KV_DEMO_KEYS) && (CY_RSLT_SUCCESS == result); id++)
+    {
+        (void)snprintf(key, sizeof(key), "cfg/%02"PRIu32, id);
+        result = kv_store_get(key, value, sizeof(value), &length);
+
+        if((CY_RSLT_SUCCESS == result) && (0 != memcmp(value, values[id], KV_DEMO_VALUE_LEN)))
+        {
+            result = KV_STORE_RSLT_ERR_VERIFY;
+        }
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("%"PRIu32" keys of %"PRIu32" bytes in %"PRIu32" sectors:\n", (uint32_t)KV_DEMO_KEYS, (uint32_t)KV_DEMO_VALUE_LEN,
+               (uint32_t)KV_DEMO_SECTORS);
+        printf("  insert %"PRIu32" us, lookup %"PRIu32" us (average)\n",
+               cycle_counter_to_us(insert_cycles / KV_DEMO_KEYS), cycle_counter_to_us(lookup_cycles / KV_DEMO_KEYS));
+        printf("  %"PRIu32" updates: %"PRIu32" us average, %"PRIu32" us worst (with garbage collection)\n", updates,
+               cycle_counter_to_us(update_cycles / ((0u != updates) ? updates : 1u)), cycle_counter_to_us(max_cycles));
+        printf("  %"PRIu32" sector erases, %"PRIu32" records moved; erasing for every update would take %"PRIu32"\n",
+               stats.erases, stats.gc_copied, updates);
+        printf("Mounted again, all values verified.\n");
+        kv_store_print_wear();
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,124 @@
+/******************************************************************************
+* File Name:   kv_store.h
+*
+* Description: This file contains the macros, data types and function
+*              declarations of the log-structured key-value store.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef KV_STORE_H
+#define KV_STORE_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the key-value store benchmark before entering XIP mode */
+#ifndef KV_STORE_DEMO_ENABLE
+#define KV_STORE_DEMO_ENABLE            (0u)
+#endif
+
+/* Maximum number of sectors of the store, and of live keys */
+#ifndef KV_STORE_MAX_SECTORS
+#define KV_STORE_MAX_SECTORS            (16u)
+#endif
+
+#ifndef KV_STORE_MAX_KEYS
+#define KV_STORE_MAX_KEYS               (64u)
+#endif
+
+/* Entries of the SRAM index, a power of two of at least twice the keys */
+#define KV_STORE_INDEX_SIZE             (2u * KV_STORE_MAX_KEYS)
+
+/* Maximum key length (without the terminating NUL) and value length */
+#define KV_STORE_MAX_KEY_LEN            (16u)
+#define KV_STORE_MAX_VALUE_LEN          (256u)
+
+#if ((KV_STORE_INDEX_SIZE & (KV_STORE_INDEX_SIZE - 1u)) != 0u)
+#error "KV_STORE_MAX_KEYS must be a power of two"
+#endif
+
+#define KV_STORE_RSLT_ERR_BAD_PARAM     APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 1u)
+#define KV_STORE_RSLT_ERR_SECTOR_MAP    APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 2u)
+#define KV_STORE_RSLT_ERR_NOT_INIT      APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 3u)
+#define KV_STORE_RSLT_ERR_NOT_FOUND     APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 4u)
+#define KV_STORE_RSLT_ERR_FULL          APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 5u)
+#define KV_STORE_RSLT_ERR_BUF_SIZE      APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 6u)
+#define KV_STORE_RSLT_ERR_CORRUPT       APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 7u)
+#define KV_STORE_RSLT_ERR_VERIFY        APP_RSLT_ERR(APP_RSLT_RANGE_KV_STORE, 8u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t keys;              /* Live keys */
+    uint32_t live_bytes;        /* Bytes of the latest record of each key */
+    uint32_t free_sectors;      /* Erased sectors, not yet part of the log */
+    uint32_t gc_runs;           /* Sectors reclaimed by garbage collection */
+    uint32_t gc_copied;         /* Live records moved by garbage collection */
+    uint32_t erases;            /* Sector erases since kv_store_init() */
+    uint32_t min_erase_count;   /* Lifetime erase counts of the sectors */
+    uint32_t max_erase_count;
+} kv_store_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t kv_store_init(uint32_t base, uint32_t num_sectors);
+cy_rslt_t kv_store_format(uint32_t base, uint32_t num_sectors);
+cy_rslt_t kv_store_set(const char *key, const uint8_t *value, size_t length);
+cy_rslt_t kv_store_get(const char *key, uint8_t *value, size_t size, size_t *length);
+cy_rslt_t kv_store_delete(const char *key);
+void kv_store_get_stats(kv_store_stats_t *stats);
+void kv_store_print_wear(void);
+cy_rslt_t kv_store_benchmark(uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* KV_STORE_H */
+
+/* [] END OF FILE */
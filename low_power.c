@@ -0,0 +1,461 @@
+/******************************************************************************
+* File Name:   low_power.c
+*
+* Description: This file contains the low-power integration of the QSPI
+*              memory. A Deep Sleep callback leaves XIP, snapshots the SMIF
+*              configuration and puts the memory in deep power-down; on wake-
+*              up it checks the SMIF registers against the snapshot, releases
+*              the memory and goes back to XIP, without a
+*              cy_serial_flash_qspi_init(), and times the path up to the
+*              first XIP fetch.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "low_power.h"
+#include "cy_retarget_io.h"
+#include "cycle_counter.h"
+#include "smif_mmio.h"
+#include "xip_asset.h"
+#include "xip_read_mode.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* JESD216: SFDP header and the parameter header of the basic table */
+#define LP_SFDP_SIGNATURE               (0x50444653u)   /* "SFDP" */
+#define LP_SFDP_HEADER_SIZE             (16u)
+#define LP_SFDP_BASIC_DPD_DWORD         (14u)           /* JESD216B, 1-based */
+
+/* Basic parameter table DWORD 14 */
+#define LP_DPD_UNSUPPORTED_Msk          (0x80000000u)
+#define LP_DPD_ENTER_Pos                (23u)
+#define LP_DPD_EXIT_Pos                 (15u)
+#define LP_DPD_DELAY_UNIT_Pos           (13u)
+#define LP_DPD_DELAY_COUNT_Pos          (8u)
+#define LP_DPD_DELAY_COUNT_Msk          (0x1Fu)
+
+/* Time for the memory to enter deep power-down (tDP), for common parts */
+#define LP_POWER_DOWN_DELAY_US          (3u)
+
+/* SMIF CTL plus the registers of the SMIF device of the memory */
+#define LP_REG_COUNT                    (15u)
+
+/* Word read through XIP to time the first fetch after wake-up */
+#define LP_XIP_PROBE_VALUE              (0x5AA5C33Cu)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static bool lp_syspm_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback_mode_t mode, void *arg);
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+XIP_ASSET static const uint32_t lp_xip_probe = LP_XIP_PROBE_VALUE;
+
+static const cy_stc_smif_mem_config_t *lp_mem_config = NULL;
+static volatile uint32_t *lp_regs[LP_REG_COUNT];
+static uint32_t lp_saved[LP_REG_COUNT];
+static bool lp_was_xip;
+static cy_rslt_t lp_error;
+static low_power_stats_t lp_stats;
+static cyhal_lptimer_t lp_timer;
+
+static cyhal_syspm_callback_data_t lp_callback_data =
+{
+    .callback = lp_syspm_callback,
+    .states = CYHAL_SYSPM_CB_CPU_DEEPSLEEP,
+    .ignore_modes = (cyhal_syspm_callback_mode_t)0,
+    .args = NULL,
+    .next = NULL
+};
+
+/*******************************************************************************
+* Function Name: lp_read_dpd_params
+****************************************************************************//**
+* Summary:
+*  Reads the deep power-down commands and exit delay from DWORD 14 of the
+*  basic SFDP parameter table. Leaves power_down false if the memory has no
+*  SFDP, a JESD216A table that stops before DWORD 14, or no deep power-down.
+*
+*******************************************************************************/
+static cy_rslt_t lp_read_dpd_params(void)
+{
+    uint8_t header[LP_SFDP_HEADER_SIZE];
+    uint32_t dword;
+
+    cy_rslt_t result = smif_mmio_read_sfdp(0u, header, sizeof(header));
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    memcpy(&dword, header, sizeof(dword));
+
+    /* Byte 11 of the first parameter header: length of the basic table in DWORDs */
+    if((LP_SFDP_SIGNATURE != dword) || (header[11] < LP_SFDP_BASIC_DPD_DWORD))
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    uint32_t table = (uint32_t)header[12] | ((uint32_t)header[13] << 8) | ((uint32_t)header[14] << 16);
+
+    result = smif_mmio_read_sfdp(table + ((LP_SFDP_BASIC_DPD_DWORD - 1u) * 4u), (uint8_t *)&dword, sizeof(dword));
+
+    if((CY_RSLT_SUCCESS == result) && (0u == (dword & LP_DPD_UNSUPPORTED_Msk)))
+    {
+        /* Units of 128 ns, 1 us, 8 us and 64 us */
+        static const uint16_t unit_ns[4] = { 128u, 1000u, 8000u, 64000u };
+        uint32_t count = ((dword >> LP_DPD_DELAY_COUNT_Pos) & LP_DPD_DELAY_COUNT_Msk) + 1u;
+        uint32_t delay_ns = count * unit_ns[(dword >> LP_DPD_DELAY_UNIT_Pos) & 0x3u];
+
+        lp_stats.power_down = true;
+        lp_stats.power_down_cmd = (uint8_t)(dword >> LP_DPD_ENTER_Pos);
+        lp_stats.release_cmd = (uint8_t)(dword >> LP_DPD_EXIT_Pos);
+        lp_stats.release_delay_us = (uint16_t)((delay_ns + 999u) / 1000u);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: lp_record
+****************************************************************************//**
+* Summary:
+*  Keeps the first error of the callback, which cannot report it itself.
+*
+*******************************************************************************/
+static inline void lp_record(cy_rslt_t result)
+{
+    if(CY_RSLT_SUCCESS == lp_error)
+    {
+        lp_error = result;
+    }
+}
+
+/*******************************************************************************
+* Function Name: lp_enter
+****************************************************************************//**
+* Summary:
+*  Leaves XIP, saves the SMIF configuration and powers the memory down.
+*
+*******************************************************************************/
+static void lp_enter(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    lp_was_xip = (CY_SMIF_MEMORY == Cy_SMIF_GetMode(SMIF0));
+
+    /* Also takes the memory out of continuous read mode, which would take the command as an address */
+    if(lp_was_xip)
+    {
+        result = xip_read_mode_exit_xip();
+    }
+
+    for(uint32_t index = 0u; index < LP_REG_COUNT; index++)
+    {
+        lp_saved[index] = *lp_regs[index];
+    }
+
+    if((CY_RSLT_SUCCESS == result) && lp_stats.power_down)
+    {
+        result = smif_mmio_send_command(lp_stats.power_down_cmd);
+        Cy_SysLib_DelayUs(LP_POWER_DOWN_DELAY_US);
+    }
+
+    lp_stats.deep_sleeps++;
+    lp_record(result);
+}
+
+/*******************************************************************************
+* Function Name: lp_exit
+****************************************************************************//**
+* Summary:
+*  Restores the SMIF registers that differ from the snapshot, releases the
+*  memory from deep power-down, returns to XIP if the SMIF was in XIP before
+*  and reads a word through XIP. The SMIF registers are retained in Deep
+*  Sleep, so only the release delay of the memory is normally spent here.
+*
+*******************************************************************************/
+static void lp_exit(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t start = cycle_counter_get();
+
+    for(uint32_t index = 0u; index < LP_REG_COUNT; index++)
+    {
+        if(*lp_regs[index] != lp_saved[index])
+        {
+            *lp_regs[index] = lp_saved[index];
+            lp_stats.restored_regs++;
+        }
+    }
+
+    if(lp_stats.power_down)
+    {
+        result = smif_mmio_send_command(lp_stats.release_cmd);
+        Cy_SysLib_DelayUs(lp_stats.release_delay_us);
+    }
+
+    uint32_t restored = cycle_counter_get();
+
+    if((CY_RSLT_SUCCESS == result) && lp_was_xip)
+    {
+        /* The first fetch must reach the memory, not lines cached before Deep Sleep */
+        (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+        result = xip_read_mode_enter_xip();
+
+        if((CY_RSLT_SUCCESS == result) && (LP_XIP_PROBE_VALUE != *(const volatile uint32_t *)&lp_xip_probe))
+        {
+            result = LOW_POWER_RSLT_ERR_VERIFY;
+        }
+    }
+
+    uint32_t wake_us = cycle_counter_to_us(cycle_counter_get() - start);
+
+    lp_stats.last_restore_us = cycle_counter_to_us(restored - start);
+    lp_stats.last_wake_us = wake_us;
+    lp_stats.min_wake_us = (wake_us < lp_stats.min_wake_us) ? wake_us : lp_stats.min_wake_us;
+    lp_stats.max_wake_us = (wake_us > lp_stats.max_wake_us) ? wake_us : lp_stats.max_wake_us;
+    lp_stats.total_wake_us += wake_us;
+    lp_record(result);
+}
+
+/*******************************************************************************
+* Function Name: lp_syspm_callback
+****************************************************************************//**
+* Summary:
+*  Deep Sleep callback. Refuses Deep Sleep while a SMIF transfer or, in MMIO
+*  mode, a program or erase is in progress: the memory would ignore the
+*  power-down command.
+*
+*******************************************************************************/
+static bool lp_syspm_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback_mode_t mode, void *arg)
+{
+    bool allow = true;
+
+    CY_UNUSED_PARAMETER(state);
+    CY_UNUSED_PARAMETER(arg);
+
+    switch(mode)
+    {
+        case CYHAL_SYSPM_CHECK_READY:
+            allow = !Cy_SMIF_BusyCheck(SMIF0) &&
+                    ((CY_SMIF_NORMAL != Cy_SMIF_GetMode(SMIF0)) || !smif_mmio_is_busy());
+            break;
+
+        case CYHAL_SYSPM_BEFORE_TRANSITION:
+            lp_enter();
+            break;
+
+        case CYHAL_SYSPM_AFTER_TRANSITION:
+            lp_exit();
+            break;
+
+        default:
+            break;
+    }
+
+    return allow;
+}
+
+/*******************************************************************************
+* Function Name: low_power_init
+****************************************************************************//**
+* Summary:
+*  Reads the deep power-down parameters of the memory, sets up the wake-up
+*  timer and registers the Deep Sleep callback. Call in MMIO mode, after
+*  cy_serial_flash_qspi_init(). From then on, the memory is powered down in
+*  every Deep Sleep, entered through low_power_sleep_ms() or otherwise.
+*  Interrupts taken between the callback and wake-up must not use XIP.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t low_power_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    uint32_t index = 0u;
+
+    if(NULL == mem_config)
+    {
+        return LOW_POWER_RSLT_ERR_BAD_PARAM;
+    }
+
+    cy_rslt_t result = smif_mmio_init(mem_config);
+
+    memset(&lp_stats, 0, sizeof(lp_stats));
+    lp_stats.min_wake_us = UINT32_MAX;
+    lp_error = CY_RSLT_SUCCESS;
+
+    if((CY_RSLT_SUCCESS == result) && LOW_POWER_FLASH_POWER_DOWN)
+    {
+        result = lp_read_dpd_params();
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_lptimer_init(&lp_timer);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    /* The SMIF device registers are indexed by slave select line */
+    while((index < 3u) && (0u == ((uint32_t)mem_config->slaveSelect & (1u << index))))
+    {
+        index++;
+    }
+
+    SMIF_DEVICE_Type volatile *device = &SMIF_DEVICE_IDX(SMIF0, index);
+    volatile uint32_t *regs[LP_REG_COUNT] =
+    {
+        &SMIF0->CTL, &device->CTL, &device->ADDR, &device->MASK, &device->ADDR_CTL,
+        &device->RD_CMD_CTL, &device->RD_ADDR_CTL, &device->RD_MODE_CTL, &device->RD_DUMMY_CTL,
+        &device->RD_DATA_CTL, &device->WR_CMD_CTL, &device->WR_ADDR_CTL, &device->WR_MODE_CTL,
+        &device->WR_DUMMY_CTL, &device->WR_DATA_CTL
+    };
+
+    memcpy(lp_regs, regs, sizeof(lp_regs));
+
+    if(NULL == lp_mem_config)
+    {
+        cyhal_syspm_register_callback(&lp_callback_data);
+    }
+
+    lp_mem_config = mem_config;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: low_power_sleep_ms
+****************************************************************************//**
+* Summary:
+*  Spends the given time in Deep Sleep, woken up by the low-power timer. If a
+*  driver refuses Deep Sleep (e.g. the UART is still sending), spends it in
+*  Sleep instead.
+*
+* Parameters:
+*  ms - time to sleep.
+*
+* Return:
+*  The first error of the Deep Sleep callback since low_power_init(), if any.
+*
+*******************************************************************************/
+cy_rslt_t low_power_sleep_ms(uint32_t ms)
+{
+    uint32_t actual_ms = 0u;
+
+    if(NULL == lp_mem_config)
+    {
+        return LOW_POWER_RSLT_ERR_NOT_INIT;
+    }
+
+    if(CY_RSLT_SUCCESS != cyhal_syspm_tickless_deepsleep(&lp_timer, ms, &actual_ms))
+    {
+        lp_stats.refused++;
+        (void)cyhal_syspm_tickless_sleep(&lp_timer, ms, &actual_ms);
+    }
+
+    return lp_error;
+}
+
+/*******************************************************************************
+* Function Name: low_power_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the Deep Sleep statistics since low_power_init().
+*
+*******************************************************************************/
+void low_power_get_stats(low_power_stats_t *stats)
+{
+    if(NULL != stats)
+    {
+        *stats = lp_stats;
+    }
+}
+
+/*******************************************************************************
+* Function Name: low_power_report
+****************************************************************************//**
+* Summary:
+*  Prints the Deep Sleep statistics and the wake-up latency, and waits for
+*  the console output to drain, which would otherwise refuse the next Deep
+*  Sleep.
+*
+*******************************************************************************/
+void low_power_report(void)
+{
+    uint32_t wakes = lp_stats.deep_sleeps;
+
+    if(lp_stats.power_down)
+    {
+        printf("Memory deep power-down: 0x%02X, release 0x%02X, %u us\n", lp_stats.power_down_cmd,
+               lp_stats.release_cmd, (unsigned int)lp_stats.release_delay_us);
+    }
+    else
+    {
+        printf("Memory deep power-down: not supported, standby during Deep Sleep\n");
+    }
+
+    printf("Deep Sleep entries %"PRIu32", refused %"PRIu32", SMIF registers restored %"PRIu32"\n",
+           wakes, lp_stats.refused, lp_stats.restored_regs);
+
+    if(0u != wakes)
+    {
+        printf("Wake-up to first XIP fetch: last %"PRIu32" us (%"PRIu32" us before XIP), min %"PRIu32
+               " us, max %"PRIu32" us, avg %"PRIu32" us\n", lp_stats.last_wake_us, lp_stats.last_restore_us,
+               lp_stats.min_wake_us, lp_stats.max_wake_us, (uint32_t)(lp_stats.total_wake_us / wakes));
+    }
+
+    (void)fflush(stdout);
+
+    while(cyhal_uart_is_tx_active(&cy_retarget_io_uart_obj))
+    {
+    }
+}
+
+/* [] END OF FILE */
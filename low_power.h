@@ -0,0 +1,115 @@
+/******************************************************************************
+* File Name:   low_power.h
+*
+* Description: This file contains the declarations of the low-power
+*              integration of the QSPI memory: Deep Sleep entry and exit with
+*              deep power-down of the memory and a fast return to XIP.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to spend the LED blink delay of the main loop in Deep Sleep */
+#ifndef LOW_POWER_ENABLE
+#define LOW_POWER_ENABLE                (0u)
+#endif
+
+/* Set to 0 to keep the memory in standby during Deep Sleep. With 1, the
+ * memory is put in deep power-down if its SFDP tables (JESD216B, DWORD 14 of
+ * the basic parameter table) say it supports it; S25FL-S parts do not.
+ */
+#ifndef LOW_POWER_FLASH_POWER_DOWN
+#define LOW_POWER_FLASH_POWER_DOWN      (1u)
+#endif
+
+/* Wake-ups between two statistics reports of the main loop */
+#ifndef LOW_POWER_REPORT_WAKEUPS
+#define LOW_POWER_REPORT_WAKEUPS        (10u)
+#endif
+
+#define LOW_POWER_RSLT_ERR_BAD_PARAM    APP_RSLT_ERR(APP_RSLT_RANGE_LOW_POWER, 1u)
+#define LOW_POWER_RSLT_ERR_NOT_INIT     APP_RSLT_ERR(APP_RSLT_RANGE_LOW_POWER, 2u)
+#define LOW_POWER_RSLT_ERR_VERIFY       APP_RSLT_ERR(APP_RSLT_RANGE_LOW_POWER, 3u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t deep_sleeps;       /* Deep Sleep entries */
+    uint32_t refused;           /* Deep Sleep refused by a driver; Sleep used instead */
+    uint32_t restored_regs;     /* SMIF registers found changed on wake-up; normally 0 */
+    uint32_t last_wake_us;      /* Deep Sleep exit callback to the first XIP fetch */
+    uint32_t min_wake_us;
+    uint32_t max_wake_us;
+    uint64_t total_wake_us;
+    uint32_t last_restore_us;   /* Part of last_wake_us spent before XIP is enabled */
+    bool power_down;            /* Memory put in deep power-down */
+    uint8_t power_down_cmd;     /* From SFDP */
+    uint8_t release_cmd;
+    uint16_t release_delay_us;
+} low_power_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t low_power_init(const cy_stc_smif_mem_config_t *mem_config);
+cy_rslt_t low_power_sleep_ms(uint32_t ms);
+void low_power_get_stats(low_power_stats_t *stats);
+void low_power_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LOW_POWER_H */
+
+/* [] END OF FILE */
@@ -46,6 +46,36 @@
 #include "cy_retarget_io.h"
 #include "cy_serial_flash_qspi.h"
 #include "cycfg_qspi_memslot.h"
+#include "erase_planner.h"
+#include "fast_boot.h"
+#include "flash_benchmark.h"
+#include "flash_loader.h"
+#include "flash_log.h"
+#include "flash_suspend.h"
+#include "flash_verify.h"
+#include "kv_store.h"
+#include "low_power.h"
+#include "mem_slots.h"
+#include "qspi_async.h"
+#include "qspi_bus.h"
+#include "qspi_stream.h"
+#include "qspi_trace.h"
+#include "qspi_tuning.h"
+#include "ramfunc.h"
+#include "smif_arb.h"
+#include "smif_cache.h"
+#include "smart_write.h"
+#include "wear_alloc.h"
+#include "write_coalesce.h"
+#include "xip_asset.h"
+#include "xip_benchmark.h"
+#include "xip_crypto.h"
+#include "xip_read_mode.h"
+#include "xip_switch.h"
+#include "xip_zasset.h"
+#if defined(COMPONENT_FREERTOS)
+#include "flash_service.h"
+#endif
 #include <inttypes.h>
 
 /*******************************************************************************
@@ -55,7 +85,27 @@
 #define NUM_BYTES_PER_LINE      (16u)     /* Used when array of data is printed on the console */
 #define LED_TOGGLE_DELAY_MSEC   (1000u)   /* LED blink delay */
 #define MEM_SLOT_NUM            (0u)      /* Slot number of the memory to use */
-#define QSPI_BUS_FREQUENCY_HZ   (50000000lu)
+#define QSPI_BUS_FREQUENCY_HZ   (50000000lu) /* Bus frequency, or known-good start point of QSPI_TUNING_ENABLE */
+
+/* These demos program plaintext through MMIO and read it back through XIP */
+#if (XIP_CRYPTO_ENABLE) && ((XIP_SWITCH_DEMO_ENABLE) || (SMIF_ARB_DEMO_ENABLE) || (FLASH_VERIFY_DEMO_ENABLE))
+#error "The XIP switch, SMIF arbiter and integrity verification demos do not support XIP_CRYPTO_ENABLE"
+#endif
+
+/* The fast-boot path executes from the external memory before the loader could program it */
+#if (FLASH_LOADER_ENABLE) && (FAST_BOOT_ENABLE)
+#error "FLASH_LOADER_ENABLE does not support FAST_BOOT_ENABLE"
+#endif
+
+/* In dual-quad mode both memories already act as one */
+#if (MEM_SLOTS_DEMO_ENABLE) && (QSPI_BUS_MODE == QSPI_BUS_MODE_DUAL_QUAD)
+#error "MEM_SLOTS_DEMO_ENABLE needs QSPI_BUS_MODE_QUAD with separate slave selects, not dual-quad mode"
+#endif
+
+/* The FreeRTOS variant hands over to the scheduler instead of blinking the LED */
+#if defined(COMPONENT_FREERTOS) && (LOW_POWER_ENABLE)
+#error "LOW_POWER_ENABLE is not supported with COMPONENTS=FREERTOS"
+#endif
 
 /*******************************************************************************
 * Global Variables
@@ -67,6 +117,7 @@ const char *hi_word CY_SECTION(".cy_xip") __attribute__((used)) = "Hello from th
 * Function declarations
 *******************************************************************************/
 CY_SECTION(".cy_xip_code") __attribute__((used)) void print_from_external_memory(const char *buf);
+APP_RAMFUNC void print_from_internal_ram(const char *buf);
 
 /********************************************************
 * Function Name: print_from_external_memory
@@ -83,6 +134,21 @@ void print_from_external_memory(const char *buf)
     printf("%s", buf);
 }
 
+/********************************************************
+* Function Name: print_from_internal_ram
+*********************************************************
+* Summary:
+*  Prints the passed string to a UART.
+*  Executes from SRAM (copied from internal flash at startup).
+*
+* Parameters:
+*   buf: The string to be printed
+********************************************************/
+void print_from_internal_ram(const char *buf)
+{
+    printf("%s", buf);
+}
+
 /*******************************************************************************
 * Function Name: check_status
 ****************************************************************************//**
@@ -104,6 +170,9 @@ void check_status(char *message, uint32_t status)
         printf("Error Code: 0x%08lX\n", (unsigned long)status);
         printf("\n================================================================================\n");
 
+        /* Show the QSPI operations that led to the failure */
+        qspi_trace_dump();
+
         /* On failure, turn the LED ON */
         cyhal_gpio_write(CYBSP_USER_LED, CYBSP_LED_STATE_ON);
         while(true); /* Wait forever here when error occurs. */
@@ -165,6 +234,35 @@ void check_address(char *message, uint32_t addr)
         while(true); /* Wait forever here when error occurs. */
     }
 }
+
+/*******************************************************************************
+* Function Name: check_ram_address
+****************************************************************************//**
+* Summary:
+*  Checks the address of the passed function. If the address is not in the
+*  SRAM-executed code section (.cy_ramfunc), then prints a failure message and
+*  exits.
+*
+* Parameters:
+*  message - message to print if address is not in the .cy_ramfunc section.
+*  addr - address for evaluation.
+*
+*******************************************************************************/
+void check_ram_address(char *message, uint32_t addr)
+{
+    if(!ramfunc_contains(addr))
+    {
+        printf("\n================================================================================\n");
+        printf("FAIL: %s\n", message);
+        printf("Address: 0x%08"PRIx32"\n", addr);
+        printf("\n================================================================================\n");
+
+        /* On failure, turn the LED ON */
+        cyhal_gpio_write(CYBSP_USER_LED, CYBSP_LED_STATE_ON);
+        while(true); /* Wait forever here when error occurs. */
+    }
+}
+
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
@@ -175,7 +273,8 @@ void check_address(char *message, uint32_t addr)
 *     2. Performs erase followed by write and verifies the written data by
 *        reading it back.
 *     3. Transitions the SMIF block into XIP mode and prints a string from
-*        external memory and calls a function from external memory.
+*        external memory and calls a function from external memory and a
+*        function from SRAM.
 *
 * Parameters:
 *  void
@@ -189,6 +288,10 @@ int main(void)
     uint32_t addr;
     cy_rslt_t result;
 
+#if (FAST_BOOT_ENABLE)
+    fast_boot_mark(FAST_BOOT_MARK_MAIN);
+#endif
+
     /* Initialize the device and board peripherals */
     result = cybsp_init();
     CY_ASSERT(result == CY_RSLT_SUCCESS);
@@ -196,6 +299,25 @@ int main(void)
     /* Enable global interrupts */
     __enable_irq();
 
+#if (FAST_BOOT_ENABLE)
+    /* Bring up the QSPI memory and reach XIP before the console; the result
+     * is checked once the console can report it.
+     */
+    fast_boot_mark(FAST_BOOT_MARK_BSP);
+    cy_rslt_t fastBootResult = fast_boot_qspi_init(smifMemConfigs[MEM_SLOT_NUM], QSPI_BUS_FREQUENCY_HZ);
+    fast_boot_mark(FAST_BOOT_MARK_QSPI);
+#if (XIP_CRYPTO_ENABLE)
+    if(CY_RSLT_SUCCESS == fastBootResult)
+    {
+        fastBootResult = xip_crypto_init(smifMemConfigs[MEM_SLOT_NUM]);
+    }
+#endif
+    if(CY_RSLT_SUCCESS == fastBootResult)
+    {
+        fastBootResult = fast_boot_first_xip();
+    }
+#endif
+
     /* Initialize retarget-io to use the debug UART port */
     cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX, CY_RETARGET_IO_BAUDRATE);
 
@@ -206,12 +328,61 @@ int main(void)
     printf("\x1b[2J\x1b[;H");
     printf("*************** PSoC 6 MCU: External Flash Access in XIP Mode ***************\n\n");
 
+    /* Record the QSPI operations below with their latency */
+    qspi_trace_init();
+    uint32_t traceStart = qspi_trace_begin();
+
     /* Initialize the QSPI block */
-    result = cy_serial_flash_qspi_init(smifMemConfigs[MEM_SLOT_NUM], CYBSP_QSPI_D0, CYBSP_QSPI_D1,
-                                       CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC, NC, NC, CYBSP_QSPI_SCK,
-                                       CYBSP_QSPI_SS, QSPI_BUS_FREQUENCY_HZ);
+#if (FAST_BOOT_ENABLE)
+    /* Already initialized before the console */
+    result = fastBootResult;
+#elif (QSPI_TUNING_ENABLE)
+    qspi_tuning_setting_t qspiSetting;
+    result = qspi_tuning_run(smifMemConfigs[MEM_SLOT_NUM], QSPI_BUS_FREQUENCY_HZ, &qspiSetting);
+#else
+    result = qspi_bus_init(smifMemConfigs[MEM_SLOT_NUM], QSPI_BUS_FREQUENCY_HZ);
+#endif
+    qspi_trace_end(QSPI_TRACE_OP_INIT, traceStart, 0u, 0u, result);
     check_status("Serial Flash initialization failed", result);
 
+#if (XIP_CRYPTO_ENABLE)
+    /* Load the decryption key before anything is fetched from the external memory */
+    result = xip_crypto_init(smifMemConfigs[MEM_SLOT_NUM]);
+    check_status("XIP decryption setup failed", result);
+#endif
+
+#if (FLASH_LOADER_ENABLE)
+    /* Program the external memory if scripts/flash_loader.py is waiting; nothing in it may run before */
+    printf("Waiting %lu ms for scripts/flash_loader.py at %lu baud...\n", (unsigned long)FLASH_LOADER_WAIT_MS,
+           (unsigned long)FLASH_LOADER_BAUD_RATE);
+    bool imageProgrammed;
+    result = flash_loader_run(smifMemConfigs[MEM_SLOT_NUM], FLASH_LOADER_WAIT_MS, &imageProgrammed);
+    check_status("Flash loader failed", result);
+
+    if(imageProgrammed)
+    {
+        flash_loader_stats_t loaderStats;
+        flash_loader_get_stats(&loaderStats);
+        printf("Programmed %"PRIu32" bytes in %"PRIu32" chunks, %"PRIu32" sectors erased, %"PRIu32" retries\n",
+               loaderStats.bytes, loaderStats.chunks, loaderStats.erases, loaderStats.retries);
+        printf("Total %"PRIu32" us, flash idle %"PRIu32" us, host stalled %"PRIu32" us\n",
+               loaderStats.total_us, loaderStats.flash_idle_us, loaderStats.host_stall_us);
+        printf("External memory programmed and verified; reset the device to run the new image.\n");
+        for(;;)
+        {
+        }
+    }
+    printf("No image received, continuing.\n\n");
+#endif
+
+#if (FAST_BOOT_ENABLE)
+    fast_boot_report();
+
+    /* Store the SFDP parameters for the next boot */
+    result = fast_boot_cache_update();
+    check_status("Storing the SFDP cache failed", result);
+#endif
+
     /* Initialize the transfer buffers */
     uint8_t txBuffer[PACKET_SIZE];
     uint8_t rxBuffer[PACKET_SIZE];
@@ -228,28 +399,61 @@ int main(void)
     size_t sectorSize = cy_serial_flash_qspi_get_erase_size(extMemAddress);
     extMemAddress = sectorSize;
 
-    printf("\n1. Total Flash Size: %u bytes.\n", cy_serial_flash_qspi_get_size());
+    printf("\n1. Total Flash Size: %u bytes.\n", (unsigned int)cy_serial_flash_qspi_get_size());
+
+#if (WEAR_ALLOC_ENABLE)
+    /* Spread the erases of steps 1 to 4 over a pool instead of always wearing the second sector */
+    uint32_t testAddress;
+    result = wear_alloc_init(extMemAddress + (25u * sectorSize), WEAR_ALLOC_DEMO_SECTORS);
+    check_status("Wear-leveling allocator init failed", result);
+
+    /* The example keeps nothing in the pool, so a sector still used was lost to a reset or a halt */
+    uint32_t reclaimed;
+    result = wear_alloc_reclaim(&reclaimed);
+    check_status("Reclaiming used sectors failed", result);
+    if(0u != reclaimed)
+    {
+        printf("Reclaimed %"PRIu32" sector(s) left used by a previous run\n", reclaimed);
+    }
+
+    printf("\n1. Erasing the least-worn sector of the pool.\n");
+    traceStart = qspi_trace_begin();
+    result = wear_alloc_get(&testAddress);
+    qspi_trace_end(QSPI_TRACE_OP_ERASE, traceStart, testAddress, sectorSize, result);
+    check_status("Allocating a sector failed", result);
+    printf("Using the sector at 0x%08"PRIx32"\n", testAddress);
+#else
+    uint32_t testAddress = extMemAddress;
 
     /* Erase before write */
-    printf("\n1. Erasing %u bytes of memory.\n", sectorSize);
-    result = cy_serial_flash_qspi_erase(extMemAddress, sectorSize);
+    printf("\n1. Erasing %u bytes of memory.\n", (unsigned int)sectorSize);
+    traceStart = qspi_trace_begin();
+    result = cy_serial_flash_qspi_erase(testAddress, sectorSize);
+    qspi_trace_end(QSPI_TRACE_OP_ERASE, traceStart, testAddress, sectorSize, result);
     check_status("Erasing memory failed", result);
+#endif
 
     /* Read after Erase to confirm that all data is 0xFF */
     printf("\n2. Reading after Erase. Ensure that the data read is 0xFF for each byte.\n");
-    result = cy_serial_flash_qspi_read(extMemAddress, PACKET_SIZE, rxBuffer);
+    traceStart = qspi_trace_begin();
+    result = cy_serial_flash_qspi_read(testAddress, PACKET_SIZE, rxBuffer);
+    qspi_trace_end(QSPI_TRACE_OP_READ, traceStart, testAddress, PACKET_SIZE, result);
     check_status("Reading memory failed", result);
     print_array("Received Data", rxBuffer, PACKET_SIZE);
 
     /* Write the content of the txBuffer to the memory */
     printf("\n3. Writing data to memory.\n");
-    result = cy_serial_flash_qspi_write(extMemAddress, PACKET_SIZE, txBuffer);
+    traceStart = qspi_trace_begin();
+    result = cy_serial_flash_qspi_write(testAddress, PACKET_SIZE, txBuffer);
+    qspi_trace_end(QSPI_TRACE_OP_WRITE, traceStart, testAddress, PACKET_SIZE, result);
     check_status("Writing to memory failed", result);
     print_array("Written Data", txBuffer, PACKET_SIZE);
 
     /* Read back after Write for verification */
     printf("\n4. Reading back for verification.\n");
-    result = cy_serial_flash_qspi_read(extMemAddress, PACKET_SIZE, rxBuffer);
+    traceStart = qspi_trace_begin();
+    result = cy_serial_flash_qspi_read(testAddress, PACKET_SIZE, rxBuffer);
+    qspi_trace_end(QSPI_TRACE_OP_READ, traceStart, testAddress, PACKET_SIZE, result);
     check_status("Reading memory failed", result);
     print_array("Received Data", rxBuffer, PACKET_SIZE);
 
@@ -257,13 +461,122 @@ int main(void)
     check_status("Read data does not match with written data. Read/Write operation failed.",
             memcmp(txBuffer, rxBuffer, PACKET_SIZE));
 
+#if (WEAR_ALLOC_ENABLE)
+    /* Return the sector to the pool and show how the erases are spread */
+    result = wear_alloc_put(testAddress);
+    check_status("Freeing the sector failed", result);
+    wear_alloc_print();
+#endif
+
     printf("\n================================================================================\n");
     printf("\nSUCCESS: Read data matches with written data!\n");
     printf("\n================================================================================\n");
 
+#if (QSPI_ASYNC_DEMO_ENABLE)
+    /* Overlap QSPI transfers with CPU work, using the sector after the one above */
+    printf("\nRunning the asynchronous QSPI transfer demo.\n");
+    result = qspi_async_init(smifMemConfigs[MEM_SLOT_NUM]);
+    check_status("Asynchronous QSPI initialization failed", result);
+    result = qspi_async_demo(extMemAddress + sectorSize);
+    check_status("Asynchronous QSPI transfer demo failed", result);
+#endif
+
+#if (QSPI_STREAM_DEMO_ENABLE)
+    /* Feed a fixed-rate consumer with on-demand reads, then from read-ahead streams; only reads */
+    printf("\nRunning the streaming reader demo.\n");
+    result = qspi_async_init(smifMemConfigs[MEM_SLOT_NUM]);
+    check_status("Asynchronous QSPI initialization failed", result);
+    result = qspi_stream_demo(extMemAddress);
+    check_status("Streaming reader demo failed", result);
+#endif
+
+#if (WRITE_COALESCE_DEMO_ENABLE)
+    /* Gather small writes into full program pages, two sectors after the one above */
+    printf("\nRunning the write coalescing demo.\n");
+    result = write_coalesce_demo(extMemAddress + (2u * sectorSize));
+    check_status("Write coalescing demo failed", result);
+#endif
+
+#if (SMART_WRITE_DEMO_ENABLE)
+    /* Skip erases of blank sectors, using the four sectors after the ones above */
+    printf("\nRunning the erase-avoidance demo.\n");
+    result = smart_write_demo(extMemAddress + (3u * sectorSize));
+    check_status("Erase-avoidance demo failed", result);
+#endif
+
+#if (ERASE_PLANNER_DEMO_ENABLE)
+    /* Erase an unaligned range with a planned command sequence, after the sectors above */
+    printf("\nRunning the erase planner demo.\n");
+    result = erase_planner_demo(smifMemConfigs[MEM_SLOT_NUM], extMemAddress + (7u * sectorSize));
+    check_status("Erase planner demo failed", result);
+#endif
+
+#if (FLASH_SUSPEND_DEMO_ENABLE)
+    /* Read from one sector while erasing the next one, after the sectors above */
+    printf("\nRunning the erase suspend demo.\n");
+    result = flash_suspend_demo(smifMemConfigs[MEM_SLOT_NUM], extMemAddress + (11u * sectorSize),
+                                extMemAddress + (12u * sectorSize));
+    check_status("Erase suspend demo failed", result);
+#endif
+
+#if (MEM_SLOTS_DEMO_ENABLE)
+    /* Same sector on every memory of smifBlockConfig, after the sectors above */
+    printf("\nRunning the multi-slot demo.\n");
+    result = mem_slots_demo(extMemAddress + (13u * sectorSize));
+    check_status("Multi-slot demo failed", result);
+#endif
+
+#if (KV_STORE_DEMO_ENABLE)
+    /* Four sectors after the sectors above */
+    printf("\nRunning the key-value store benchmark.\n");
+    result = kv_store_benchmark(extMemAddress + (14u * sectorSize));
+    check_status("Key-value store benchmark failed", result);
+#endif
+
+#if (FLASH_LOG_DEMO_ENABLE)
+    /* Four sectors after the key-value store */
+    printf("\nRunning the flash logger benchmark.\n");
+    result = flash_log_benchmark(smifMemConfigs[MEM_SLOT_NUM], extMemAddress + (18u * sectorSize));
+    check_status("Flash logger benchmark failed", result);
+#endif
+
+#if (FLASH_BENCHMARK_ENABLE)
+    /* Measure read, program, and erase throughput across transfer sizes */
+    printf("\nRunning the flash throughput benchmark.\n");
+    result = flash_benchmark_run(smifMemConfigs[MEM_SLOT_NUM]);
+    check_status("Flash throughput benchmark failed", result);
+
+#if (FLASH_BENCHMARK_CHIP_ERASE)
+    /* The string and function placed in external memory are erased now, so
+     * XIP mode cannot be entered.
+     */
+    printf("\nThe chip erase removed the code and data in external memory. Reprogram the kit to run the example.\n");
+    while(true);
+#endif
+#endif
+
+#if (LOW_POWER_ENABLE)
+    /* Read the deep power-down parameters of the memory while still in MMIO mode */
+    result = low_power_init(smifMemConfigs[MEM_SLOT_NUM]);
+    check_status("Low-power initialization failed", result);
+#endif
+
     /* Put the device in XIP mode */
     printf("\n5. Entering XIP Mode.\n");
-    cy_serial_flash_qspi_enable_xip(true);
+    result = xip_read_mode_init(smifMemConfigs[MEM_SLOT_NUM]);
+    check_status("XIP read mode initialization failed", result);
+    result = xip_read_mode_set_continuous(XIP_READ_MODE_CONTINUOUS_ENABLE);
+    check_status("Continuous read mode not supported by the memory configuration", result);
+    traceStart = qspi_trace_begin();
+    result = xip_read_mode_enter_xip();
+    qspi_trace_end(QSPI_TRACE_OP_XIP_ENABLE, traceStart, 0u, 0u, result);
+    check_status("Entering XIP mode failed", result);
+
+#if (XIP_CRYPTO_ENABLE)
+    /* Read a known marker before running code from the external memory */
+    result = xip_crypto_check();
+    check_status("External memory image not encrypted with XIP_CRYPTO_KEY", result);
+#endif
 
     addr = (uint32_t)&hi_word;
     check_address("String not found in external memory.", addr);
@@ -278,14 +591,117 @@ int main(void)
     printf("\n-------------------------------------------------------");
     print_from_external_memory("\nHello from the external function!\n");
 
+    addr = (uint32_t)&print_from_internal_ram;
+    check_ram_address("Function not found in SRAM.", addr);
+    /* Print by calling function that was copied to SRAM at startup */
+    printf("\nFunction call from SRAM address: 0x%08"PRIx32"\n", addr);
+    printf("\n-------------------------------------------------------");
+    print_from_internal_ram("\nHello from the SRAM function!\n");
+
     printf("\n================================================================================\n");
     printf("\nSUCCESS: Data successfully accessed in XIP mode!\n");
     printf("\n================================================================================\n");
 
+#if (XIP_ASSET_DEMO_ENABLE)
+    /* Read constant data in place from the memory-mapped external memory */
+    printf("\nRunning the zero-copy asset demo.\n");
+    result = xip_asset_demo();
+    check_status("Zero-copy asset demo failed", result);
+#endif
+
+#if (XIP_ZASSET_DEMO_ENABLE)
+    /* Decode compressed blocks from external memory on demand into an SRAM cache */
+    printf("\nRunning the compressed asset demo.\n");
+    result = xip_zasset_demo();
+    check_status("Compressed asset demo failed", result);
+#endif
+
+#if (FLASH_VERIFY_DEMO_ENABLE)
+    /* Hash the external memory with the Crypto block, in place and by pipelined MMIO reads */
+    printf("\nRunning the integrity verification demo.\n");
+    result = flash_verify_demo(smifMemConfigs[MEM_SLOT_NUM]);
+    check_status("Integrity verification demo failed", result);
+#endif
+
+#if (SMIF_ARB_DEMO_ENABLE)
+    /* Queue an erase and programs through the dual-core arbiter, after the flash logger sectors */
+    printf("\nRunning the dual-core SMIF arbiter demo.\n");
+    result = smif_arb_demo(smifMemConfigs[MEM_SLOT_NUM], extMemAddress + (22u * sectorSize));
+    check_status("Dual-core SMIF arbiter demo failed", result);
+#endif
+
+#if (XIP_READ_MODE_DEMO_ENABLE)
+    /* Compare the XIP cache miss latency with and without the read command byte */
+    printf("\nRunning the continuous read mode demo.\n");
+    result = xip_read_mode_demo();
+    check_status("Continuous read mode demo failed", result);
+#endif
+
+#if (XIP_SWITCH_DEMO_ENABLE)
+    /* Update data in the external memory while still running code from it */
+    printf("\nRunning the runtime mode switch demo.\n");
+    result = xip_switch_demo(smifMemConfigs[MEM_SLOT_NUM], extMemAddress + (10u * sectorSize));
+    check_status("Runtime mode switch demo failed", result);
+#endif
+
+#if (SMIF_CACHE_DEMO_ENABLE)
+    /* Estimate the SMIF cache hit rates of sequential reads, with and without prefetching */
+    printf("\nRunning the SMIF cache instrumentation demo.\n");
+    result = smif_cache_demo();
+    check_status("SMIF cache demo failed", result);
+#endif
+
+#if (XIP_CRYPTO_ENABLE)
+    /* Cost of the on-the-fly decryption on XIP reads */
+    printf("\nRunning the XIP decryption benchmark.\n");
+    result = xip_crypto_benchmark();
+    check_status("XIP decryption benchmark failed", result);
+#endif
+
+#if (XIP_BENCHMARK_ENABLE)
+    /* Time the same kernels from external memory, internal flash and SRAM */
+    printf("\nRunning the XIP execution benchmark.\n");
+    result = xip_benchmark_run();
+    check_status("XIP benchmark failed", result);
+#endif
+
+#if (QSPI_TRACE_ENABLE)
+    /* Latency of each QSPI operation, for scripts/qspi_trace.py */
+    printf("\nQSPI operation trace:\n");
+    qspi_trace_dump();
+#endif
+
+#if defined(COMPONENT_FREERTOS)
+    /* Leave XIP and share the memory between tasks through the flash service */
+    printf("\nStarting the flash service demo.\n");
+    traceStart = qspi_trace_begin();
+    result = xip_read_mode_exit_xip();
+    qspi_trace_end(QSPI_TRACE_OP_XIP_DISABLE, traceStart, 0u, 0u, result);
+    check_status("Exiting XIP mode failed", result);
+    result = flash_service_demo_start(smifMemConfigs[MEM_SLOT_NUM], extMemAddress + (23u * sectorSize));
+    check_status("Flash service demo failed", result);
+#endif
+
+#if (LOW_POWER_ENABLE)
+    /* Blink in Deep Sleep, with the memory powered down between wake-ups */
+    printf("\nBlinking the LED from Deep Sleep.\n");
+    uint32_t wakeups = 0u;
+#endif
+
     for(;;)
     {
         cyhal_gpio_toggle(CYBSP_USER_LED);
+#if (LOW_POWER_ENABLE)
+        result = low_power_sleep_ms(LED_TOGGLE_DELAY_MSEC);
+        check_status("Deep Sleep exit failed", result);
+
+        if(0u == (++wakeups % LOW_POWER_REPORT_WAKEUPS))
+        {
+            low_power_report();
+        }
+#else
         cyhal_system_delay_ms(LED_TOGGLE_DELAY_MSEC);
+#endif
     }
 }
 
@@ -0,0 +1,644 @@
+/******************************************************************************
+* File Name:   mem_slots.c
+*
+* Description: This file contains the multi-slot memory layer. It drives
+*              several memories of smifBlockConfig, one per SMIF slave
+*              select, either one at a time or striped: sequential data is
+*              spread across the memories in MEM_SLOTS_STRIPE_SIZE units so
+*              that their program and erase operations overlap.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cycfg_qspi_memslot.h"
+#include "cycle_counter.h"
+#include "erase_planner.h"
+#include "mem_slots.h"
+#include "smif_mmio.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Size of the transfer timed by the demo */
+#define MEM_SLOTS_DEMO_SIZE             (4096u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Used only for Cy_SMIF_MemInit() of the memories; the commands themselves
+ * are issued through smif_mmio, one memory at a time.
+ */
+static cy_stc_smif_context_t slots_context;
+static const cy_stc_smif_mem_config_t *slots_config[MEM_SLOTS_MAX];
+static uint32_t slots_count = 0u;
+
+static uint8_t demo_tx[MEM_SLOTS_DEMO_SIZE];
+static uint8_t demo_rx[MEM_SLOTS_DEMO_SIZE];
+
+/*******************************************************************************
+* Function Name: slots_same_geometry
+****************************************************************************//**
+* Summary:
+*  Checks that two memories have the same size, sector map and page size, so
+*  that a device address means the same sector on both.
+*
+*******************************************************************************/
+static bool slots_same_geometry(const cy_stc_smif_mem_device_cfg_t *a, const cy_stc_smif_mem_device_cfg_t *b)
+{
+    return (a->memSize == b->memSize) && (a->eraseSize == b->eraseSize) &&
+           (a->programSize == b->programSize) && (a->hybridRegionCount == b->hybridRegionCount);
+}
+
+/*******************************************************************************
+* Function Name: slots_wait_ready
+****************************************************************************//**
+* Summary:
+*  Selects a memory and polls it until the program or erase in progress
+*  completes or the timeout expires.
+*
+*******************************************************************************/
+static cy_rslt_t slots_wait_ready(uint32_t slot, uint32_t timeout_ms)
+{
+    uint32_t polls = ((timeout_ms * 1000u) / MEM_SLOTS_POLL_US) + 1u;
+    cy_rslt_t result = smif_mmio_select(slots_config[slot]);
+
+    while((CY_RSLT_SUCCESS == result) && smif_mmio_is_busy())
+    {
+        if(0u == polls--)
+        {
+            result = MEM_SLOTS_RSLT_ERR_TIMEOUT;
+        }
+        else
+        {
+            Cy_SysLib_DelayUs(MEM_SLOTS_POLL_US);
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: slots_wait_all
+****************************************************************************//**
+* Summary:
+*  Waits for the operations in progress on memories [first, first + num).
+*
+*******************************************************************************/
+static cy_rslt_t slots_wait_all(uint32_t first, uint32_t num, uint32_t timeout_ms)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    for(uint32_t slot = first; (slot < (first + num)) && (CY_RSLT_SUCCESS == result); slot++)
+    {
+        result = slots_wait_ready(slot, timeout_ms);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: slots_map
+****************************************************************************//**
+* Summary:
+*  Maps an address of the space formed by memories [first, first + num),
+*  interleaved in units of unit bytes, to a memory and an address in it.
+*
+* Return:
+*  Number of bytes from the address to the end of its unit.
+*
+*******************************************************************************/
+static uint32_t slots_map(uint32_t first, uint32_t num, uint32_t unit, uint32_t addr, uint32_t *slot,
+                          uint32_t *dev_addr)
+{
+    uint32_t index = addr / unit;
+
+    *slot = first + (index % num);
+    *dev_addr = ((index / num) * unit) + (addr % unit);
+
+    return unit - (addr % unit);
+}
+
+/*******************************************************************************
+* Function Name: slots_read
+****************************************************************************//**
+* Summary:
+*  Reads from the space formed by memories [first, first + num).
+*
+*******************************************************************************/
+static cy_rslt_t slots_read(uint32_t first, uint32_t num, uint32_t unit, uint32_t addr, uint8_t *buf,
+                            uint32_t length)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while((0u != length) && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t slot;
+        uint32_t dev_addr;
+        uint32_t chunk = slots_map(first, num, unit, addr, &slot, &dev_addr);
+
+        chunk = (chunk < length) ? chunk : length;
+        result = smif_mmio_select(slots_config[slot]);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = smif_mmio_read(dev_addr, buf, chunk);
+        }
+
+        addr += chunk;
+        buf += chunk;
+        length -= chunk;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: slots_program
+****************************************************************************//**
+* Summary:
+*  Programs the space formed by memories [first, first + num). A memory is
+*  only waited for before its next command, so while one memory programs a
+*  page the next pages are sent to the other memories.
+*
+*******************************************************************************/
+static cy_rslt_t slots_program(uint32_t first, uint32_t num, uint32_t unit, uint32_t addr, const uint8_t *buf,
+                               uint32_t length)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while((0u != length) && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t slot;
+        uint32_t dev_addr;
+        uint32_t chunk = slots_map(first, num, unit, addr, &slot, &dev_addr);
+
+        chunk = (chunk < length) ? chunk : length;
+        result = slots_wait_ready(slot, MEM_SLOTS_PROGRAM_TIMEOUT_MS);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = smif_mmio_program_start(dev_addr, buf, chunk);
+        }
+
+        addr += chunk;
+        buf += chunk;
+        length -= chunk;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = slots_wait_all(first, num, MEM_SLOTS_PROGRAM_TIMEOUT_MS);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_init
+****************************************************************************//**
+* Summary:
+*  Initializes the first MEM_SLOTS_COUNT memories of smifBlockConfig. Call
+*  after cy_serial_flash_qspi_init(), which only sets up the first memory;
+*  the slave select pins of the other memories are configured by the BSP
+*  together with smifBlockConfig. All memories must have the same geometry.
+*
+* Return:
+*  MEM_SLOTS_RSLT_ERR_SLOT_COUNT if smifBlockConfig has fewer memories.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_init(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    slots_count = 0u;
+
+    if(smifBlockConfig.memCount < MEM_SLOTS_COUNT)
+    {
+        return MEM_SLOTS_RSLT_ERR_SLOT_COUNT;
+    }
+
+    memset(&slots_context, 0, sizeof(slots_context));
+    slots_context.timeout = SMIF_MMIO_TIMEOUT_US;
+
+    if(CY_SMIF_SUCCESS != Cy_SMIF_MemInit(SMIF0, &smifBlockConfig, &slots_context))
+    {
+        return MEM_SLOTS_RSLT_ERR_INIT;
+    }
+
+    for(uint32_t slot = 0; slot < MEM_SLOTS_COUNT; slot++)
+    {
+        slots_config[slot] = smifBlockConfig.memConfig[slot];
+
+        if((0u != (slots_config[slot]->deviceCfg->programSize % MEM_SLOTS_STRIPE_SIZE)) ||
+           !slots_same_geometry(slots_config[0]->deviceCfg, slots_config[slot]->deviceCfg))
+        {
+            return MEM_SLOTS_RSLT_ERR_MEM_CONFIG;
+        }
+    }
+
+    if(NULL == smif_mmio_get_mem_config())
+    {
+        result = smif_mmio_init(slots_config[0]);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        slots_count = MEM_SLOTS_COUNT;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_get_count
+****************************************************************************//**
+* Summary:
+*  Returns the number of memories in use, or 0 if not initialized.
+*
+*******************************************************************************/
+uint32_t mem_slots_get_count(void)
+{
+    return slots_count;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_get_config
+****************************************************************************//**
+* Summary:
+*  Returns the memory configuration of a slot, or NULL if out of range.
+*
+*******************************************************************************/
+const cy_stc_smif_mem_config_t *mem_slots_get_config(uint32_t slot)
+{
+    return (slot < slots_count) ? slots_config[slot] : NULL;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_read
+****************************************************************************//**
+* Summary:
+*  Reads from one memory.
+*
+* Parameters:
+*  slot - index of the memory.
+*  addr - address in the memory.
+*  buf - buffer for the data.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_read(uint32_t slot, uint32_t addr, uint8_t *buf, uint32_t length)
+{
+    if((slot >= slots_count) || (NULL == buf) ||
+       (addr >= slots_config[slot]->deviceCfg->memSize) || (length > (slots_config[slot]->deviceCfg->memSize - addr)))
+    {
+        return MEM_SLOTS_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_config_t *selected = smif_mmio_get_mem_config();
+    cy_rslt_t result = slots_read(slot, 1u, slots_config[slot]->deviceCfg->memSize, addr, buf, length);
+
+    (void)smif_mmio_select(selected);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_write
+****************************************************************************//**
+* Summary:
+*  Programs erased bytes of one memory, page by page.
+*
+* Parameters:
+*  slot - index of the memory.
+*  addr - address in the memory.
+*  buf - data to program.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_write(uint32_t slot, uint32_t addr, const uint8_t *buf, uint32_t length)
+{
+    if((slot >= slots_count) || (NULL == buf) ||
+       (addr >= slots_config[slot]->deviceCfg->memSize) || (length > (slots_config[slot]->deviceCfg->memSize - addr)))
+    {
+        return MEM_SLOTS_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_config_t *selected = smif_mmio_get_mem_config();
+    cy_rslt_t result = slots_program(slot, 1u, slots_config[slot]->deviceCfg->programSize, addr, buf, length);
+
+    (void)smif_mmio_select(selected);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_erase
+****************************************************************************//**
+* Summary:
+*  Erases the sectors of one memory that contain [addr, addr + length), see
+*  erase_planner_plan().
+*
+* Parameters:
+*  slot - index of the memory.
+*  addr - address in the memory.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_erase(uint32_t slot, uint32_t addr, uint32_t length)
+{
+    erase_plan_t plan;
+
+    if(slot >= slots_count)
+    {
+        return MEM_SLOTS_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_config_t *selected = smif_mmio_get_mem_config();
+    cy_rslt_t result = erase_planner_plan(slots_config[slot], addr, length, &plan);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = smif_mmio_select(slots_config[slot]);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = erase_planner_execute(&plan);
+    }
+
+    (void)smif_mmio_select(selected);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_stripe_get_size
+****************************************************************************//**
+* Summary:
+*  Returns the size of the striped address space, the total of all memories.
+*
+*******************************************************************************/
+uint32_t mem_slots_stripe_get_size(void)
+{
+    return (0u != slots_count) ? (slots_count * slots_config[0]->deviceCfg->memSize) : 0u;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_stripe_read
+****************************************************************************//**
+* Summary:
+*  Reads from the striped address space. The memories share the data lines,
+*  so reads are not faster than from one memory; only programs and erases,
+*  limited by the memories rather than by the bus, overlap.
+*
+* Parameters:
+*  addr - striped address.
+*  buf - buffer for the data.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_stripe_read(uint32_t addr, uint8_t *buf, uint32_t length)
+{
+    uint32_t size = mem_slots_stripe_get_size();
+
+    if((NULL == buf) || (addr >= size) || (length > (size - addr)))
+    {
+        return MEM_SLOTS_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_config_t *selected = smif_mmio_get_mem_config();
+    cy_rslt_t result = slots_read(0u, slots_count, MEM_SLOTS_STRIPE_SIZE, addr, buf, length);
+
+    (void)smif_mmio_select(selected);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_stripe_write
+****************************************************************************//**
+* Summary:
+*  Programs erased bytes of the striped address space. Consecutive stripe
+*  units go to consecutive memories, which program them in parallel.
+*
+* Parameters:
+*  addr - striped address.
+*  buf - data to program.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_stripe_write(uint32_t addr, const uint8_t *buf, uint32_t length)
+{
+    uint32_t size = mem_slots_stripe_get_size();
+
+    if((NULL == buf) || (addr >= size) || (length > (size - addr)))
+    {
+        return MEM_SLOTS_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_config_t *selected = smif_mmio_get_mem_config();
+    cy_rslt_t result = slots_program(0u, slots_count, MEM_SLOTS_STRIPE_SIZE, addr, buf, length);
+
+    (void)smif_mmio_select(selected);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_stripe_erase
+****************************************************************************//**
+* Summary:
+*  Erases the striped address space covering [addr, addr + length). Each
+*  sector of the plan is erased on all memories at once, so the range grows
+*  to whole sectors of every memory: with N memories, a striped sector is N
+*  times the sector size of one memory.
+*
+* Parameters:
+*  addr - striped address.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_stripe_erase(uint32_t addr, uint32_t length)
+{
+    erase_plan_t plan;
+    uint32_t size = mem_slots_stripe_get_size();
+
+    if((0u == length) || (addr >= size) || (length > (size - addr)))
+    {
+        return MEM_SLOTS_RSLT_ERR_BAD_PARAM;
+    }
+
+    /* Device range holding the stripe units of [addr, addr + length) */
+    uint32_t row = slots_count * MEM_SLOTS_STRIPE_SIZE;
+    uint32_t dev_start = (addr / row) * MEM_SLOTS_STRIPE_SIZE;
+    uint32_t dev_end = (((addr + length) + row - 1u) / row) * MEM_SLOTS_STRIPE_SIZE;
+
+    const cy_stc_smif_mem_config_t *selected = smif_mmio_get_mem_config();
+    cy_rslt_t result = erase_planner_plan(slots_config[0], dev_start, dev_end - dev_start, &plan);
+
+    for(uint32_t index = 0; (index < plan.num_steps) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        const erase_plan_step_t *step = &plan.steps[index];
+
+        for(uint32_t sector = 0; (sector < step->count) && (CY_RSLT_SUCCESS == result); sector++)
+        {
+            for(uint32_t slot = 0; (slot < slots_count) && (CY_RSLT_SUCCESS == result); slot++)
+            {
+                result = slots_wait_ready(slot, step->max_time_ms);
+
+                if(CY_RSLT_SUCCESS == result)
+                {
+                    result = (ERASE_PLAN_OP_CHIP == step->op) ? smif_mmio_chip_erase_start() :
+                             smif_mmio_sector_erase_start(step->addr + (sector * step->sector_size));
+                }
+            }
+        }
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = slots_wait_all(0u, slots_count, step->max_time_ms);
+        }
+    }
+
+    (void)smif_mmio_select(selected);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: mem_slots_demo
+****************************************************************************//**
+* Summary:
+*  Writes MEM_SLOTS_DEMO_SIZE bytes to the first memory alone and then striped
+*  across all memories, verifies both and prints the time of each write. The
+*  demo is skipped if smifBlockConfig has a single memory.
+*
+* Parameters:
+*  ext_addr - sector-aligned address, used on every memory.
+*
+*******************************************************************************/
+cy_rslt_t mem_slots_demo(uint32_t ext_addr)
+{
+    cy_rslt_t result = mem_slots_init();
+
+    if(MEM_SLOTS_RSLT_ERR_SLOT_COUNT == result)
+    {
+        printf("smifBlockConfig has %"PRIu32" memory, multi-slot demo skipped\n", (uint32_t)smifBlockConfig.memCount);
+        return CY_RSLT_SUCCESS;
+    }
+
+    for(uint32_t index = 0; index < MEM_SLOTS_DEMO_SIZE; index++)
+    {
+        demo_tx[index] = (uint8_t)(index ^ (index >> 8));
+    }
+
+    cycle_counter_init();
+
+    /* Single memory */
+    uint32_t single_cycles = 0u;
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = mem_slots_erase(0u, ext_addr, MEM_SLOTS_DEMO_SIZE);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        uint32_t start = cycle_counter_get();
+        result = mem_slots_write(0u, ext_addr, demo_tx, MEM_SLOTS_DEMO_SIZE);
+        single_cycles = cycle_counter_get() - start;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = mem_slots_read(0u, ext_addr, demo_rx, MEM_SLOTS_DEMO_SIZE);
+    }
+
+    if((CY_RSLT_SUCCESS == result) && (0 != memcmp(demo_tx, demo_rx, MEM_SLOTS_DEMO_SIZE)))
+    {
+        result = MEM_SLOTS_RSLT_ERR_VERIFY;
+    }
+
+    /* Striped; the striped address of ext_addr on every memory */
+    uint32_t stripe_addr = ext_addr * slots_count;
+    uint32_t stripe_cycles = 0u;
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = mem_slots_stripe_erase(stripe_addr, MEM_SLOTS_DEMO_SIZE);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        uint32_t start = cycle_counter_get();
+        result = mem_slots_stripe_write(stripe_addr, demo_tx, MEM_SLOTS_DEMO_SIZE);
+        stripe_cycles = cycle_counter_get() - start;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        memset(demo_rx, 0, sizeof(demo_rx));
+        result = mem_slots_stripe_read(stripe_addr, demo_rx, MEM_SLOTS_DEMO_SIZE);
+    }
+
+    if((CY_RSLT_SUCCESS == result) && (0 != memcmp(demo_tx, demo_rx, MEM_SLOTS_DEMO_SIZE)))
+    {
+        result = MEM_SLOTS_RSLT_ERR_VERIFY;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        uint32_t single_us = cycle_counter_to_us(single_cycles);
+        uint32_t stripe_us = cycle_counter_to_us(stripe_cycles);
+
+        stripe_us = (0u != stripe_us) ? stripe_us : 1u;
+
+        printf("Write of %"PRIu32" bytes, stripe unit %"PRIu32" bytes:\n", (uint32_t)MEM_SLOTS_DEMO_SIZE,
+               (uint32_t)MEM_SLOTS_STRIPE_SIZE);
+        printf("  1 memory:   %8"PRIu32" us\n", single_us);
+        printf("  %"PRIu32" memories: %8"PRIu32" us (%"PRIu32".%02"PRIu32"x)\n", slots_count, stripe_us,
+               single_us / stripe_us, ((single_us % stripe_us) * 100u) / stripe_us);
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,119 @@
+/******************************************************************************
+* File Name:   mem_slots.h
+*
+* Description: This file contains the macros, data types and function
+*              declarations of the multi-slot memory layer.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef MEM_SLOTS_H
+#define MEM_SLOTS_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+#include "qspi_bus.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the multi-slot demo before entering XIP mode */
+#ifndef MEM_SLOTS_DEMO_ENABLE
+#define MEM_SLOTS_DEMO_ENABLE               (0u)
+#endif
+
+/* Number of memories of smifBlockConfig used, one per slave select */
+#ifndef MEM_SLOTS_COUNT
+#define MEM_SLOTS_COUNT                     (2u)
+#endif
+
+/* Bytes stored on one memory before moving to the next one in striped mode.
+ * Must divide the program page size, so that a stripe unit is programmed
+ * with a single command.
+ */
+#ifndef MEM_SLOTS_STRIPE_SIZE
+#define MEM_SLOTS_STRIPE_SIZE               (256u)
+#endif
+
+/* Maximum time of one page program, erases use the time of the sector map */
+#define MEM_SLOTS_PROGRAM_TIMEOUT_MS        (10u)
+
+/* Interval between status register polls while waiting for a memory */
+#define MEM_SLOTS_POLL_US                   (10u)
+
+#define MEM_SLOTS_MAX                       (4u)
+
+#if ((MEM_SLOTS_COUNT < 1u) || (MEM_SLOTS_COUNT > MEM_SLOTS_MAX))
+#error "MEM_SLOTS_COUNT must be 1 to 4 (one memory per SMIF slave select)"
+#endif
+
+#define MEM_SLOTS_RSLT_ERR_BAD_PARAM        APP_RSLT_ERR(APP_RSLT_RANGE_MEM_SLOTS, 1u)
+#define MEM_SLOTS_RSLT_ERR_SLOT_COUNT       APP_RSLT_ERR(APP_RSLT_RANGE_MEM_SLOTS, 2u)
+#define MEM_SLOTS_RSLT_ERR_MEM_CONFIG       APP_RSLT_ERR(APP_RSLT_RANGE_MEM_SLOTS, 3u)
+#define MEM_SLOTS_RSLT_ERR_INIT             APP_RSLT_ERR(APP_RSLT_RANGE_MEM_SLOTS, 4u)
+#define MEM_SLOTS_RSLT_ERR_TIMEOUT          APP_RSLT_ERR(APP_RSLT_RANGE_MEM_SLOTS, 5u)
+#define MEM_SLOTS_RSLT_ERR_VERIFY           APP_RSLT_ERR(APP_RSLT_RANGE_MEM_SLOTS, 6u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t mem_slots_init(void);
+uint32_t mem_slots_get_count(void);
+const cy_stc_smif_mem_config_t *mem_slots_get_config(uint32_t slot);
+
+cy_rslt_t mem_slots_read(uint32_t slot, uint32_t addr, uint8_t *buf, uint32_t length);
+cy_rslt_t mem_slots_write(uint32_t slot, uint32_t addr, const uint8_t *buf, uint32_t length);
+cy_rslt_t mem_slots_erase(uint32_t slot, uint32_t addr, uint32_t length);
+
+uint32_t mem_slots_stripe_get_size(void);
+cy_rslt_t mem_slots_stripe_read(uint32_t addr, uint8_t *buf, uint32_t length);
+cy_rslt_t mem_slots_stripe_write(uint32_t addr, const uint8_t *buf, uint32_t length);
+cy_rslt_t mem_slots_stripe_erase(uint32_t addr, uint32_t length);
+
+cy_rslt_t mem_slots_demo(uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* MEM_SLOTS_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,613 @@
+/******************************************************************************
+* File Name:   qspi_async.c
+*
+* Description: This file contains the non-blocking QSPI read/write interface.
+*              Reads use the DMA-driven asynchronous read of the serial-flash
+*              library. Writes are split into program pages; each page is
+*              issued in MMIO mode and a timer interrupt polls the memory
+*              status, so the CPU is free while the flash programs.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cy_serial_flash_qspi.h"
+#include "qspi_async.h"
+#include "smif_mmio.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define QSPI_ASYNC_TIMER_FREQ_HZ        (1000000u)
+
+#define QSPI_ASYNC_DEMO_READ_SIZE       (64u * 1024u)
+#define QSPI_ASYNC_DEMO_WRITE_SIZE      (4u * 1024u)
+#define QSPI_ASYNC_DEMO_WORK_SIZE       (64u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef enum
+{
+    ASYNC_IDLE,
+    ASYNC_READ,
+    ASYNC_WRITE
+} async_state_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static volatile async_state_t async_state = ASYNC_IDLE;
+static qspi_async_callback_t async_callback;
+static void *async_callback_arg;
+
+/* Progress of the ongoing write */
+static uint32_t write_addr;
+static const uint8_t *write_buf;
+static size_t write_remaining;
+
+/* Timer polls since the current page was issued, and the allowed number */
+static volatile uint32_t write_polls;
+static uint32_t write_max_polls;
+
+static cyhal_timer_t poll_timer;
+static bool poll_timer_ready = false;
+
+/* Demo state */
+static uint8_t demo_buffer[QSPI_ASYNC_DEMO_READ_SIZE];
+static volatile bool demo_done;
+static volatile cy_rslt_t demo_status;
+
+/*******************************************************************************
+* Function Name: async_complete
+****************************************************************************//**
+* Summary:
+*  Returns to idle and reports the status of the operation to the caller. The
+*  state is released before the callback runs so that the callback can start
+*  the next operation.
+*
+*******************************************************************************/
+static void async_complete(cy_rslt_t status)
+{
+    qspi_async_callback_t callback = async_callback;
+    void *arg = async_callback_arg;
+
+    if(ASYNC_WRITE == async_state)
+    {
+        (void)cyhal_timer_stop(&poll_timer);
+    }
+
+    async_state = ASYNC_IDLE;
+
+    if(NULL != callback)
+    {
+        callback(status, arg);
+    }
+}
+
+/*******************************************************************************
+* Function Name: async_read_done
+****************************************************************************//**
+* Summary:
+*  Completion callback of cy_serial_flash_qspi_read_async(), called from the
+*  DMA interrupt.
+*
+*******************************************************************************/
+static void async_read_done(cy_rslt_t operation_status, void *callback_arg)
+{
+    CY_UNUSED_PARAMETER(callback_arg);
+    async_complete(operation_status);
+}
+
+/*******************************************************************************
+* Function Name: async_write_next
+****************************************************************************//**
+* Summary:
+*  Issues the program command for the next chunk of the ongoing write. A chunk
+*  ends at the next program page boundary. Restarts the program time of the
+*  page.
+*
+*******************************************************************************/
+static cy_rslt_t async_write_next(void)
+{
+    uint32_t page_size = smif_mmio_get_page_size();
+    uint32_t chunk = page_size - (write_addr % page_size);
+
+    if(chunk > write_remaining)
+    {
+        chunk = (uint32_t)write_remaining;
+    }
+
+    cy_rslt_t result = smif_mmio_program_start(write_addr, write_buf, chunk);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        write_addr += chunk;
+        write_buf += chunk;
+        write_remaining -= chunk;
+        write_polls = 0u;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: async_poll_timer_isr
+****************************************************************************//**
+* Summary:
+*  Timer interrupt handler. Once the memory has finished programming the last
+*  chunk, starts the next one or completes the write. Fails the write if the
+*  memory is still busy after its maximum page program time.
+*
+*******************************************************************************/
+static void async_poll_timer_isr(void *callback_arg, cyhal_timer_event_t event)
+{
+    CY_UNUSED_PARAMETER(callback_arg);
+    CY_UNUSED_PARAMETER(event);
+
+    if(ASYNC_WRITE != async_state)
+    {
+        return;
+    }
+
+    if(smif_mmio_is_busy())
+    {
+        write_polls++;
+
+        if(write_polls > write_max_polls)
+        {
+            async_complete(QSPI_ASYNC_RSLT_ERR_TIMEOUT);
+        }
+
+        return;
+    }
+
+    if(0u == write_remaining)
+    {
+        async_complete(CY_RSLT_SUCCESS);
+    }
+    else
+    {
+        cy_rslt_t result = async_write_next();
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            async_complete(result);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: qspi_async_init
+****************************************************************************//**
+* Summary:
+*  Initializes the asynchronous interface. Call after
+*  cy_serial_flash_qspi_init(). Allocates one timer instance.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t qspi_async_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    const cyhal_timer_cfg_t timer_cfg =
+    {
+        .compare_value = 0u,
+        .period = QSPI_ASYNC_POLL_PERIOD_US - 1u,
+        .direction = CYHAL_TIMER_DIR_UP,
+        .is_compare = false,
+        .is_continuous = true,
+        .value = 0u
+    };
+
+    cy_rslt_t result = smif_mmio_init(mem_config);
+
+    if((CY_RSLT_SUCCESS == result) && !poll_timer_ready)
+    {
+        result = cyhal_timer_init(&poll_timer, NC, NULL);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = cyhal_timer_configure(&poll_timer, &timer_cfg);
+        }
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = cyhal_timer_set_frequency(&poll_timer, QSPI_ASYNC_TIMER_FREQ_HZ);
+        }
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            cyhal_timer_register_callback(&poll_timer, async_poll_timer_isr, NULL);
+            cyhal_timer_enable_event(&poll_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT,
+                                     QSPI_ASYNC_TIMER_INTR_PRIORITY, true);
+            poll_timer_ready = true;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: qspi_async_deinit
+****************************************************************************//**
+* Summary:
+*  Releases the timer. Any ongoing operation must have completed.
+*
+*******************************************************************************/
+void qspi_async_deinit(void)
+{
+    if(poll_timer_ready)
+    {
+        cyhal_timer_free(&poll_timer);
+        poll_timer_ready = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: qspi_async_read
+****************************************************************************//**
+* Summary:
+*  Starts reading from the external memory. The SMIF RX FIFO is drained by
+*  DMA; the callback runs from the DMA interrupt when the read completes. Only
+*  one operation can be in progress at a time.
+*
+* Parameters:
+*  addr - external memory address to read from.
+*  length - number of bytes to read.
+*  buf - destination buffer; must remain valid until the callback runs.
+*  callback - completion callback, may be NULL.
+*  arg - argument passed to the callback.
+*
+*******************************************************************************/
+cy_rslt_t qspi_async_read(uint32_t addr, size_t length, uint8_t *buf, qspi_async_callback_t callback, void *arg)
+{
+    if((NULL == buf) || (0u == length) || ((addr + length) > cy_serial_flash_qspi_get_size()))
+    {
+        return QSPI_ASYNC_RSLT_ERR_BAD_PARAM;
+    }
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    if(ASYNC_IDLE != async_state)
+    {
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return QSPI_ASYNC_RSLT_ERR_BUSY;
+    }
+
+    async_state = ASYNC_READ;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    async_callback = callback;
+    async_callback_arg = arg;
+
+    cy_rslt_t result = cy_serial_flash_qspi_read_async(addr, length, buf, async_read_done, NULL);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        async_state = ASYNC_IDLE;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: qspi_async_write
+****************************************************************************//**
+* Summary:
+*  Starts writing to the external memory. The target range must be erased.
+*  The first page is issued before returning; the remaining pages are issued
+*  from the timer interrupt. The callback runs from the timer interrupt when
+*  the last page has been programmed, or with QSPI_ASYNC_RSLT_ERR_TIMEOUT if a
+*  page takes longer than the maximum program time of the memory. Only one
+*  operation can be in progress at a time, and no other SMIF access may be made
+*  until it completes.
+*
+* Parameters:
+*  addr - external memory address to write to.
+*  length - number of bytes to write.
+*  buf - source data; must remain valid until the callback runs.
+*  callback - completion callback, may be NULL.
+*  arg - argument passed to the callback.
+*
+*******************************************************************************/
+cy_rslt_t qspi_async_write(uint32_t addr, size_t length, const uint8_t *buf, qspi_async_callback_t callback,
+                           void *arg)
+{
+    if((NULL == buf) || (0u == length) || !poll_timer_ready ||
+       ((addr + length) > cy_serial_flash_qspi_get_size()))
+    {
+        return QSPI_ASYNC_RSLT_ERR_BAD_PARAM;
+    }
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    if(ASYNC_IDLE != async_state)
+    {
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return QSPI_ASYNC_RSLT_ERR_BUSY;
+    }
+
+    async_state = ASYNC_WRITE;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    async_callback = callback;
+    async_callback_arg = arg;
+    write_addr = addr;
+    write_buf = buf;
+    write_remaining = length;
+    write_max_polls = (smif_mmio_get_mem_config()->deviceCfg->programTime / QSPI_ASYNC_POLL_PERIOD_US) + 1u;
+
+    cy_rslt_t result = async_write_next();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        (void)cyhal_timer_reset(&poll_timer);
+        result = cyhal_timer_start(&poll_timer);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        async_state = ASYNC_IDLE;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: qspi_async_is_busy
+****************************************************************************//**
+* Summary:
+*  Returns true while an asynchronous operation is in progress.
+*
+*******************************************************************************/
+bool qspi_async_is_busy(void)
+{
+    return (ASYNC_IDLE != async_state);
+}
+
+/*******************************************************************************
+* Function Name: demo_crc32
+****************************************************************************//**
+* Summary:
+*  Bitwise CRC-32 used both as the verification checksum and as the CPU work
+*  that is overlapped with the transfers.
+*
+*******************************************************************************/
+static uint32_t demo_crc32(uint32_t crc, const uint8_t *buf, uint32_t length)
+{
+    crc = ~crc;
+
+    for(uint32_t index = 0; index < length; index++)
+    {
+        crc ^= buf[index];
+
+        for(uint32_t bit = 0; bit < 8u; bit++)
+        {
+            crc = (crc >> 1u) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+
+    return ~crc;
+}
+
+/*******************************************************************************
+* Function Name: demo_callback
+****************************************************************************//**
+* Summary:
+*  Completion callback of the demo transfers.
+*
+*******************************************************************************/
+static void demo_callback(cy_rslt_t status, void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+    demo_status = status;
+    demo_done = true;
+}
+
+/*******************************************************************************
+* Function Name: demo_overlap
+****************************************************************************//**
+* Summary:
+*  Runs CPU work until the started asynchronous operation completes.
+*
+* Parameters:
+*  start - cycle counter value when the operation was started.
+*  total_cycles - receives the time from the start of the operation until the
+*                 callback was observed.
+*  work_cycles - receives the part of that time spent on CPU work.
+*
+*******************************************************************************/
+static cy_rslt_t demo_overlap(uint32_t start, uint32_t *total_cycles, uint32_t *work_cycles)
+{
+    uint8_t work[QSPI_ASYNC_DEMO_WORK_SIZE] = { 0u };
+    uint32_t crc = 0u;
+    uint32_t work_total = 0u;
+
+    while(!demo_done)
+    {
+        uint32_t work_start = cycle_counter_get();
+        crc = demo_crc32(crc, work, sizeof(work));
+        work[0] = (uint8_t)crc;
+        work_total += cycle_counter_get() - work_start;
+    }
+
+    *total_cycles = cycle_counter_get() - start;
+    *work_cycles = work_total;
+
+    return demo_status;
+}
+
+/*******************************************************************************
+* Function Name: demo_report
+****************************************************************************//**
+* Summary:
+*  Prints the blocking and asynchronous timing of one operation.
+*
+*******************************************************************************/
+static void demo_report(const char *name, uint32_t blocking, uint32_t total, uint32_t work)
+{
+    printf("%s: blocking %"PRIu32" us, asynchronous %"PRIu32" us, CPU time returned %"PRIu32" us (%"PRIu32"%%)\n",
+           name, cycle_counter_to_us(blocking), cycle_counter_to_us(total), cycle_counter_to_us(work),
+           (0u != total) ? (uint32_t)(((uint64_t)work * 100u) / total) : 0u);
+}
+
+/*******************************************************************************
+* Function Name: qspi_async_demo
+****************************************************************************//**
+* Summary:
+*  Compares blocking and asynchronous transfers. A 64 KB read and a 4 KB write
+*  are first performed with the blocking serial-flash API, then with this
+*  interface while the CPU computes a CRC; the CPU time spent on that work is
+*  reported as the time returned to the application. Must be called in MMIO
+*  mode after qspi_async_init().
+*
+* Parameters:
+*  ext_addr - start of a sector that may be erased by the demo. The sector must
+*             be at least 8 KB.
+*
+*******************************************************************************/
+cy_rslt_t qspi_async_demo(uint32_t ext_addr)
+{
+    uint32_t start;
+    uint32_t blocking;
+    uint32_t total;
+    uint32_t work;
+    uint32_t crc_ref;
+    size_t sector_size = cy_serial_flash_qspi_get_erase_size(ext_addr);
+    size_t write_size = QSPI_ASYNC_DEMO_WRITE_SIZE;
+
+    if((0u != (ext_addr % sector_size)) || (sector_size < (2u * write_size)))
+    {
+        return QSPI_ASYNC_RSLT_ERR_BAD_PARAM;
+    }
+
+    cycle_counter_init();
+
+    /* Read: blocking reference */
+    start = cycle_counter_get();
+    cy_rslt_t result = cy_serial_flash_qspi_read(ext_addr, sizeof(demo_buffer), demo_buffer);
+    blocking = cycle_counter_get() - start;
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    crc_ref = demo_crc32(0u, demo_buffer, sizeof(demo_buffer));
+    memset(demo_buffer, 0, sizeof(demo_buffer));
+
+    /* Read: asynchronous, overlapped with CPU work */
+    demo_done = false;
+    start = cycle_counter_get();
+    result = qspi_async_read(ext_addr, sizeof(demo_buffer), demo_buffer, demo_callback, NULL);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = demo_overlap(start, &total, &work);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if(crc_ref != demo_crc32(0u, demo_buffer, sizeof(demo_buffer)))
+    {
+        return QSPI_ASYNC_RSLT_ERR_VERIFY;
+    }
+
+    demo_report("64 KB read", blocking, total, work);
+
+    /* Write: the first half of the test area is written with the blocking API,
+     * the second half asynchronously.
+     */
+    result = cy_serial_flash_qspi_erase(ext_addr, sector_size);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    for(uint32_t index = 0; index < write_size; index++)
+    {
+        demo_buffer[index] = (uint8_t)(index * 7u);
+    }
+
+    start = cycle_counter_get();
+    result = cy_serial_flash_qspi_write(ext_addr, write_size, demo_buffer);
+    blocking = cycle_counter_get() - start;
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    demo_done = false;
+    start = cycle_counter_get();
+    result = qspi_async_write(ext_addr + write_size, write_size, demo_buffer, demo_callback, NULL);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = demo_overlap(start, &total, &work);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_read(ext_addr + write_size, write_size, &demo_buffer[write_size]);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if(0 != memcmp(demo_buffer, &demo_buffer[write_size], write_size))
+    {
+        return QSPI_ASYNC_RSLT_ERR_VERIFY;
+    }
+
+    demo_report("4 KB write", blocking, total, work);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
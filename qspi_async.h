@@ -0,0 +1,97 @@
+/******************************************************************************
+* File Name:   qspi_async.h
+*
+* Description: This file contains the declarations of the non-blocking QSPI
+*              read/write interface.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef QSPI_ASYNC_H
+#define QSPI_ASYNC_H
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the asynchronous transfer demo before entering XIP mode */
+#ifndef QSPI_ASYNC_DEMO_ENABLE
+#define QSPI_ASYNC_DEMO_ENABLE          (0u)
+#endif
+
+/* Interval at which the status of an ongoing program operation is polled */
+#define QSPI_ASYNC_POLL_PERIOD_US       (50u)
+
+/* Priority of the timer interrupt that drives asynchronous writes */
+#define QSPI_ASYNC_TIMER_INTR_PRIORITY  (3u)
+
+#define QSPI_ASYNC_RSLT_ERR_BUSY        APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_ASYNC, 1u)
+#define QSPI_ASYNC_RSLT_ERR_BAD_PARAM   APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_ASYNC, 2u)
+#define QSPI_ASYNC_RSLT_ERR_VERIFY      APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_ASYNC, 3u)
+#define QSPI_ASYNC_RSLT_ERR_TIMEOUT     APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_ASYNC, 4u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Called from interrupt context when an asynchronous operation completes */
+typedef void (*qspi_async_callback_t)(cy_rslt_t status, void *arg);
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t qspi_async_init(const cy_stc_smif_mem_config_t *mem_config);
+void qspi_async_deinit(void);
+cy_rslt_t qspi_async_read(uint32_t addr, size_t length, uint8_t *buf, qspi_async_callback_t callback, void *arg);
+cy_rslt_t qspi_async_write(uint32_t addr, size_t length, const uint8_t *buf, qspi_async_callback_t callback,
+                           void *arg);
+bool qspi_async_is_busy(void);
+cy_rslt_t qspi_async_demo(uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* QSPI_ASYNC_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,228 @@
+/******************************************************************************
+* File Name:   qspi_bus.c
+*
+* Description: This file contains the QSPI bus initialization. It maps the
+*              serial-flash library to the QSPI pins of the board, so that
+*              every (re-)initialization in this example uses the same pin
+*              configuration.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycfg_qspi_memslot.h"
+#include "qspi_bus.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#if (QSPI_BUS_MODE == QSPI_BUS_MODE_QUAD)
+#define QSPI_BUS_UPPER_PINS             NC, NC, NC, NC
+#else
+#define QSPI_BUS_UPPER_PINS             QSPI_BUS_D4, QSPI_BUS_D5, QSPI_BUS_D6, QSPI_BUS_D7
+#endif
+
+/* Timeout of the transfers issued while the second memory is initialized */
+#define QSPI_BUS_TIMEOUT_US             (1000u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Frequency requested by the last qspi_bus_init() call */
+static uint32_t bus_frequency_hz = 0u;
+
+#if (QSPI_BUS_MODE == QSPI_BUS_MODE_DUAL_QUAD)
+static cy_stc_smif_context_t bus_context;
+#endif
+
+#if (QSPI_BUS_MODE == QSPI_BUS_MODE_DUAL_QUAD)
+/*******************************************************************************
+* Function Name: bus_check_dual_quad
+****************************************************************************//**
+* Summary:
+*  Checks that smifBlockConfig was generated for dual-quad mode and starts
+*  with the given memory configuration.
+*
+*******************************************************************************/
+static bool bus_check_dual_quad(const cy_stc_smif_mem_config_t *mem_config)
+{
+    if((smifBlockConfig.memCount < 2u) || (mem_config != smifBlockConfig.memConfig[0]))
+    {
+        return false;
+    }
+
+    for(uint32_t index = 0; index < smifBlockConfig.memCount; index++)
+    {
+        if(0u == smifBlockConfig.memConfig[index]->dualQuadSlots)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: qspi_bus_init
+****************************************************************************//**
+* Summary:
+*  Initializes the serial-flash library on the QSPI pins of the board, using
+*  D4-D7 as well when QSPI_BUS_MODE is octal or dual-quad. In dual-quad mode,
+*  all memories of smifBlockConfig are then initialized so that the
+*  memory-mapped region interleaves both of them; the serial-flash library
+*  itself only sends MMIO commands to the first memory.
+*
+* Parameters:
+*  mem_config - memory configuration of the device, the first entry of
+*               smifBlockConfig in dual-quad mode.
+*  hz - QSPI bus frequency.
+*
+* Return:
+*  Result of cy_serial_flash_qspi_init(), or an error if the memory
+*  configuration does not match QSPI_BUS_MODE.
+*
+*******************************************************************************/
+cy_rslt_t qspi_bus_init(const cy_stc_smif_mem_config_t *mem_config, uint32_t hz)
+{
+#if (QSPI_BUS_MODE == QSPI_BUS_MODE_DUAL_QUAD)
+    if(!bus_check_dual_quad(mem_config))
+    {
+        return QSPI_BUS_RSLT_ERR_MEM_CONFIG;
+    }
+#endif
+
+    cy_rslt_t result = cy_serial_flash_qspi_init(mem_config, CYBSP_QSPI_D0, CYBSP_QSPI_D1,
+                                                 CYBSP_QSPI_D2, CYBSP_QSPI_D3, QSPI_BUS_UPPER_PINS,
+                                                 CYBSP_QSPI_SCK, CYBSP_QSPI_SS, hz);
+
+#if (QSPI_BUS_MODE == QSPI_BUS_MODE_OCTAL)
+    /* Checked after initialization, when SFDP has filled in the read command */
+    if((CY_RSLT_SUCCESS == result) && (CY_SMIF_WIDTH_OCTAL != mem_config->deviceCfg->readCmd->dataWidth))
+    {
+        cy_serial_flash_qspi_deinit();
+        result = QSPI_BUS_RSLT_ERR_MEM_CONFIG;
+    }
+#elif (QSPI_BUS_MODE == QSPI_BUS_MODE_DUAL_QUAD)
+    if(CY_RSLT_SUCCESS == result)
+    {
+        memset(&bus_context, 0, sizeof(bus_context));
+        bus_context.timeout = QSPI_BUS_TIMEOUT_US;
+
+        if(CY_SMIF_SUCCESS != Cy_SMIF_MemInit(SMIF0, &smifBlockConfig, &bus_context))
+        {
+            result = QSPI_BUS_RSLT_ERR_DUAL_QUAD;
+        }
+    }
+#endif
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        bus_frequency_hz = hz;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: qspi_bus_get_frequency
+****************************************************************************//**
+* Summary:
+*  Returns the frequency requested by the last successful qspi_bus_init().
+*
+*******************************************************************************/
+uint32_t qspi_bus_get_frequency(void)
+{
+    return bus_frequency_hz;
+}
+
+/*******************************************************************************
+* Function Name: bus_get_mode_name
+****************************************************************************//**
+* Summary:
+*  Returns the name of the bus mode selected at build time.
+*
+*******************************************************************************/
+static const char *bus_get_mode_name(void)
+{
+#if (QSPI_BUS_MODE == QSPI_BUS_MODE_OCTAL)
+    return "octal";
+#elif (QSPI_BUS_MODE == QSPI_BUS_MODE_DUAL_QUAD)
+    return "dual-quad";
+#else
+    return "quad";
+#endif
+}
+
+/*******************************************************************************
+* Function Name: qspi_bus_get_peak_bandwidth
+****************************************************************************//**
+* Summary:
+*  Returns the raw data bandwidth of the bus in bytes per second, at the
+*  frequency of the last qspi_bus_init() and QSPI_BUS_DATA_LINES lines of
+*  single data rate transfers.
+*
+*******************************************************************************/
+uint32_t qspi_bus_get_peak_bandwidth(void)
+{
+    return (bus_frequency_hz / 8u) * QSPI_BUS_DATA_LINES;
+}
+
+/*******************************************************************************
+* Function Name: qspi_bus_print
+****************************************************************************//**
+* Summary:
+*  Prints the bus mode, frequency and peak bandwidth, so that benchmark results
+*  of builds with different QSPI_BUS_MODE settings can be compared.
+*
+*******************************************************************************/
+void qspi_bus_print(void)
+{
+    /* Hundredths of MB/s (1 MB = 10^6 bytes) */
+    uint32_t peak = qspi_bus_get_peak_bandwidth() / 10000u;
+
+    printf("QSPI bus: %s, %u data lines at %"PRIu32" Hz, peak %"PRIu32".%02"PRIu32" MB/s\n", bus_get_mode_name(),
+           (unsigned int)QSPI_BUS_DATA_LINES, bus_frequency_hz, peak / 100u, peak % 100u);
+}
+
+/* [] END OF FILE */
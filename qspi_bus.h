@@ -0,0 +1,105 @@
+/******************************************************************************
+* File Name:   qspi_bus.h
+*
+* Description: This file contains the declaration of the QSPI bus
+*              initialization shared by main.c and the application modules,
+*              and the build-time selection of the bus width.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef QSPI_BUS_H
+#define QSPI_BUS_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Bus modes selectable with QSPI_BUS_MODE */
+#define QSPI_BUS_MODE_QUAD              (0u)    /* One memory on D0-D3 */
+#define QSPI_BUS_MODE_OCTAL             (1u)    /* One 8-bit memory on D0-D7 */
+#define QSPI_BUS_MODE_DUAL_QUAD         (2u)    /* Two quad memories on D0-D3 and D4-D7 */
+
+/* Set QSPI_BUS_MODE (for example, through DEFINES in the Makefile) on boards
+ * that route D4-D7, together with a memslot configuration generated for the
+ * same mode by the QSPI Configurator.
+ */
+#ifndef QSPI_BUS_MODE
+#define QSPI_BUS_MODE                   QSPI_BUS_MODE_QUAD
+#endif
+
+#if (QSPI_BUS_MODE == QSPI_BUS_MODE_QUAD)
+#define QSPI_BUS_DATA_LINES             (4u)
+#else
+#define QSPI_BUS_DATA_LINES             (8u)
+
+/* Pins of the upper data lines; default to the BSP names */
+#ifndef QSPI_BUS_D4
+#if !defined(CYBSP_QSPI_D4)
+#error "QSPI_BUS_MODE needs D4-D7: define QSPI_BUS_D4..QSPI_BUS_D7 for this board"
+#endif
+#define QSPI_BUS_D4                     CYBSP_QSPI_D4
+#define QSPI_BUS_D5                     CYBSP_QSPI_D5
+#define QSPI_BUS_D6                     CYBSP_QSPI_D6
+#define QSPI_BUS_D7                     CYBSP_QSPI_D7
+#endif
+#endif
+
+#define QSPI_BUS_RSLT_ERR_MEM_CONFIG    APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_BUS, 1u)
+#define QSPI_BUS_RSLT_ERR_DUAL_QUAD     APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_BUS, 2u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t qspi_bus_init(const cy_stc_smif_mem_config_t *mem_config, uint32_t hz);
+uint32_t qspi_bus_get_frequency(void);
+uint32_t qspi_bus_get_peak_bandwidth(void);
+void qspi_bus_print(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* QSPI_BUS_H */
+
+/* [] END OF FILE */
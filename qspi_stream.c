@@ -0,0 +1,513 @@
+/******************************************************************************
+* File Name:   qspi_stream.c
+*
+* Description: This file contains the streaming reader for sequential
+*              consumers of the external memory (audio, frame buffers, model
+*              weights). A ring of SRAM buffers is kept filled ahead of the
+*              consumer by chaining qspi_async_read() from its completion
+*              interrupt, so that the consumer only waits when it outruns the
+*              memory.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "qspi_stream.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "qspi_async.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+CY_ALIGN(4) static uint8_t demo_storage[QSPI_STREAM_DEMO_DEPTH * QSPI_STREAM_DEMO_CHUNK_SIZE];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static void stream_read_done(cy_rslt_t status, void *arg);
+
+/*******************************************************************************
+* Function Name: stream_kick
+****************************************************************************//**
+* Summary:
+*  Starts reading the next chunk into the first free buffer, unless a read is
+*  already in progress, the ring is full or the end is reached. Called with
+*  interrupts masked or from the completion interrupt. If the asynchronous
+*  interface is busy with another operation, the read is tried again at the
+*  next call.
+*
+*******************************************************************************/
+static void stream_kick(qspi_stream_t *stream)
+{
+    if(stream->in_flight || (stream->queued >= stream->depth) || (stream->next_addr >= stream->end_addr) ||
+       (CY_RSLT_SUCCESS != stream->error))
+    {
+        return;
+    }
+
+    uint32_t length = stream->end_addr - stream->next_addr;
+    uint8_t *buf = &stream->storage[((stream->head + stream->queued) % stream->depth) * stream->chunk_size];
+
+    length = (length < stream->chunk_size) ? length : stream->chunk_size;
+
+    /* Claimed first: the completion may run before qspi_async_read() returns */
+    stream->in_flight = true;
+    stream->queued++;
+    stream->next_addr += length;
+
+    cy_rslt_t result = qspi_async_read(stream->next_addr - length, length, buf, stream_read_done, stream);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        stream->in_flight = false;
+        stream->queued--;
+        stream->next_addr -= length;
+
+        if(QSPI_ASYNC_RSLT_ERR_BUSY != result)
+        {
+            stream->error = result;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: stream_read_done
+****************************************************************************//**
+* Summary:
+*  Completion callback of qspi_async_read(), called from the DMA interrupt:
+*  marks the buffer ready and starts the next read right away.
+*
+*******************************************************************************/
+static void stream_read_done(cy_rslt_t status, void *arg)
+{
+    qspi_stream_t *stream = (qspi_stream_t *)arg;
+
+    stream->in_flight = false;
+
+    if(CY_RSLT_SUCCESS != status)
+    {
+        stream->error = status;
+        return;
+    }
+
+    stream->ready++;
+    stream_kick(stream);
+}
+
+/*******************************************************************************
+* Function Name: qspi_stream_open
+****************************************************************************//**
+* Summary:
+*  Opens a stream over a range of the external memory and starts filling the
+*  ring. Must be called in MMIO mode after qspi_async_init(). Only one
+*  asynchronous operation runs at a time, so a single stream should be open;
+*  other users of qspi_async delay the read-ahead but do not break it.
+*
+* Parameters:
+*  stream - stream object.
+*  addr - start of the range.
+*  length - length of the range.
+*  storage - depth * chunk_size bytes of SRAM for the ring, 4-byte aligned.
+*  chunk_size - size of each buffer, the unit handed to the consumer.
+*  depth - number of buffers. 1 reads on demand, 2 double-buffers; more
+*          absorbs longer memory latency or consumer bursts.
+*
+*******************************************************************************/
+cy_rslt_t qspi_stream_open(qspi_stream_t *stream, uint32_t addr, uint32_t length, uint8_t *storage,
+                           uint32_t chunk_size, uint32_t depth)
+{
+    if((NULL == stream) || (NULL == storage) || (0u == chunk_size) || (0u == depth) || (0u == length) ||
+       (length > (UINT32_MAX - addr)))
+    {
+        return QSPI_STREAM_RSLT_ERR_BAD_PARAM;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    stream->storage = storage;
+    stream->chunk_size = chunk_size;
+    stream->depth = depth;
+    stream->consume_addr = addr;
+    stream->next_addr = addr;
+    stream->end_addr = addr + length;
+    stream->error = CY_RSLT_SUCCESS;
+    stream->stats.min_ahead = depth;
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    stream_kick(stream);
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return stream->error;
+}
+
+/*******************************************************************************
+* Function Name: qspi_stream_acquire
+****************************************************************************//**
+* Summary:
+*  Returns the next chunk of the stream, waiting for it if it has not been
+*  read yet; the time waited is counted as a stall. The chunk stays valid
+*  until qspi_stream_release(). The last chunk may be shorter than the
+*  others.
+*
+* Parameters:
+*  stream - stream object.
+*  data - set to the chunk.
+*  length - set to its length.
+*
+* Return:
+*  QSPI_STREAM_RSLT_END once the whole range was consumed.
+*
+*******************************************************************************/
+cy_rslt_t qspi_stream_acquire(qspi_stream_t *stream, const uint8_t **data, uint32_t *length)
+{
+    if((NULL == stream) || (NULL == data) || (NULL == length) || stream->acquired)
+    {
+        return QSPI_STREAM_RSLT_ERR_STATE;
+    }
+
+    if(stream->consume_addr >= stream->end_addr)
+    {
+        return QSPI_STREAM_RSLT_END;
+    }
+
+    uint32_t ahead = stream->ready;
+
+    if(0u == ahead)
+    {
+        uint32_t start = cycle_counter_get();
+
+        while((0u == stream->ready) && (CY_RSLT_SUCCESS == stream->error))
+        {
+            /* Retries a read deferred by another qspi_async user */
+            uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+            stream_kick(stream);
+            Cy_SysLib_ExitCriticalSection(interrupt_state);
+        }
+
+        uint32_t stall_us = cycle_counter_to_us(cycle_counter_get() - start);
+
+        stream->stats.stalls++;
+        stream->stats.stall_us += stall_us;
+        stream->stats.max_stall_us = (stall_us > stream->stats.max_stall_us) ? stall_us : stream->stats.max_stall_us;
+    }
+
+    /* Neither the first chunk nor the tail of the stream, once fully read, tell the margin */
+    if((0u != stream->stats.chunks) && (stream->next_addr < stream->end_addr))
+    {
+        stream->stats.min_ahead = (ahead < stream->stats.min_ahead) ? ahead : stream->stats.min_ahead;
+    }
+
+    if(0u == stream->ready)
+    {
+        return stream->error;
+    }
+
+    uint32_t remaining = stream->end_addr - stream->consume_addr;
+
+    *data = &stream->storage[stream->head * stream->chunk_size];
+    *length = (remaining < stream->chunk_size) ? remaining : stream->chunk_size;
+    stream->acquired = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: qspi_stream_release
+****************************************************************************//**
+* Summary:
+*  Hands the chunk returned by qspi_stream_acquire() back to the ring, to be
+*  refilled with data further ahead.
+*
+*******************************************************************************/
+void qspi_stream_release(qspi_stream_t *stream)
+{
+    if((NULL == stream) || !stream->acquired)
+    {
+        return;
+    }
+
+    uint32_t remaining = stream->end_addr - stream->consume_addr;
+
+    stream->consume_addr += (remaining < stream->chunk_size) ? remaining : stream->chunk_size;
+    stream->head = (stream->head + 1u) % stream->depth;
+    stream->acquired = false;
+    stream->stats.chunks++;
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    stream->ready--;
+    stream->queued--;
+    stream_kick(stream);
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: qspi_stream_close
+****************************************************************************//**
+* Summary:
+*  Stops the read-ahead and waits for the read in progress, after which the
+*  storage may be reused.
+*
+*******************************************************************************/
+void qspi_stream_close(qspi_stream_t *stream)
+{
+    if(NULL == stream)
+    {
+        return;
+    }
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    stream->end_addr = stream->next_addr;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    while(stream->in_flight)
+    {
+    }
+
+    stream->acquired = false;
+}
+
+/*******************************************************************************
+* Function Name: qspi_stream_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the consumer statistics of the stream.
+*
+*******************************************************************************/
+void qspi_stream_get_stats(const qspi_stream_t *stream, qspi_stream_stats_t *stats)
+{
+    if((NULL != stream) && (NULL != stats))
+    {
+        *stats = stream->stats;
+    }
+}
+
+/*******************************************************************************
+* Function Name: demo_checksum
+****************************************************************************//**
+* Summary:
+*  FNV-1a over the data: stands in for the consumer touching every byte, and
+*  tells whether all readers delivered the same stream.
+*
+*******************************************************************************/
+static uint32_t demo_checksum(uint32_t hash, const uint8_t *data, uint32_t length)
+{
+    for(uint32_t index = 0u; index < length; index++)
+    {
+        hash = (hash ^ data[index]) * 16777619u;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+* Function Name: demo_play
+****************************************************************************//**
+* Summary:
+*  Consumes a chunk at the demo bit rate: the chunk is held, as a sink DMA
+*  would hold it, for the time it takes to play.
+*
+*******************************************************************************/
+static uint32_t demo_play(uint32_t hash, const uint8_t *data, uint32_t length)
+{
+    uint32_t start = cycle_counter_get();
+    uint32_t play_cycles = (uint32_t)(((uint64_t)length * 8u * SystemCoreClock) / QSPI_STREAM_DEMO_BITRATE);
+
+    hash = demo_checksum(hash, data, length);
+
+    while((cycle_counter_get() - start) < play_cycles)
+    {
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+* Function Name: demo_on_demand
+****************************************************************************//**
+* Summary:
+*  Reference consumer: reads every chunk with the blocking serial-flash API
+*  when it is needed, so that every read is a stall.
+*
+*******************************************************************************/
+static cy_rslt_t demo_on_demand(uint32_t ext_addr, qspi_stream_stats_t *stats, uint32_t *hash)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    memset(stats, 0, sizeof(*stats));
+    *hash = 2166136261u;
+
+    for(uint32_t offset = 0u; (offset < QSPI_STREAM_DEMO_SIZE) && (CY_RSLT_SUCCESS == result);
+        offset += QSPI_STREAM_DEMO_CHUNK_SIZE)
+    {
+        uint32_t length = QSPI_STREAM_DEMO_SIZE - offset;
+        uint32_t start = cycle_counter_get();
+
+        length = (length < QSPI_STREAM_DEMO_CHUNK_SIZE) ? length : QSPI_STREAM_DEMO_CHUNK_SIZE;
+        result = cy_serial_flash_qspi_read(ext_addr + offset, length, demo_storage);
+
+        uint32_t stall_us = cycle_counter_to_us(cycle_counter_get() - start);
+
+        stats->chunks++;
+        stats->stalls++;
+        stats->stall_us += stall_us;
+        stats->max_stall_us = (stall_us > stats->max_stall_us) ? stall_us : stats->max_stall_us;
+        *hash = demo_play(*hash, demo_storage, length);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: demo_streamed
+****************************************************************************//**
+* Summary:
+*  Same consumer, fed by a stream of the given depth.
+*
+*******************************************************************************/
+static cy_rslt_t demo_streamed(uint32_t ext_addr, uint32_t depth, qspi_stream_stats_t *stats, uint32_t *hash)
+{
+    qspi_stream_t stream;
+    const uint8_t *data;
+    uint32_t length;
+
+    *hash = 2166136261u;
+
+    cy_rslt_t result = qspi_stream_open(&stream, ext_addr, QSPI_STREAM_DEMO_SIZE, demo_storage,
+                                        QSPI_STREAM_DEMO_CHUNK_SIZE, depth);
+
+    while(CY_RSLT_SUCCESS == result)
+    {
+        result = qspi_stream_acquire(&stream, &data, &length);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            *hash = demo_play(*hash, data, length);
+            qspi_stream_release(&stream);
+        }
+    }
+
+    qspi_stream_close(&stream);
+    qspi_stream_get_stats(&stream, stats);
+
+    return (QSPI_STREAM_RSLT_END == result) ? CY_RSLT_SUCCESS : result;
+}
+
+/*******************************************************************************
+* Function Name: demo_report
+****************************************************************************//**
+* Summary:
+*  Prints the stall counters of one reader.
+*
+*******************************************************************************/
+static void demo_report(const char *name, const qspi_stream_stats_t *stats, bool streamed)
+{
+    printf("%-12s %8"PRIu32" %10"PRIu32" us %8"PRIu32" us ", name, stats->stalls, stats->stall_us,
+           stats->max_stall_us);
+
+    if(streamed)
+    {
+        printf("%10"PRIu32"\n", stats->min_ahead);
+    }
+    else
+    {
+        printf("%10s\n", "-");
+    }
+}
+
+/*******************************************************************************
+* Function Name: qspi_stream_demo
+****************************************************************************//**
+* Summary:
+*  Feeds a consumer that plays QSPI_STREAM_DEMO_SIZE bytes at
+*  QSPI_STREAM_DEMO_BITRATE, in QSPI_STREAM_DEMO_CHUNK_SIZE chunks, first
+*  with on-demand blocking reads, then from streams of depth 1, 2 and
+*  QSPI_STREAM_DEMO_DEPTH, and prints how often and how long it stalled. The
+*  memory contents are only read. Must be called in MMIO mode after
+*  qspi_async_init().
+*
+* Parameters:
+*  ext_addr - start of the range to stream.
+*
+*******************************************************************************/
+cy_rslt_t qspi_stream_demo(uint32_t ext_addr)
+{
+    static const uint32_t depths[] = { 1u, 2u, QSPI_STREAM_DEMO_DEPTH };
+    qspi_stream_stats_t stats;
+    uint32_t reference;
+    uint32_t hash;
+
+    cycle_counter_init();
+
+    cy_rslt_t result = demo_on_demand(ext_addr, &stats, &reference);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    printf("%"PRIu32" KB at %"PRIu32" kbit/s in %"PRIu32"-byte chunks\n", (uint32_t)(QSPI_STREAM_DEMO_SIZE / 1024u),
+           (uint32_t)(QSPI_STREAM_DEMO_BITRATE / 1000u), (uint32_t)QSPI_STREAM_DEMO_CHUNK_SIZE);
+    printf("Reader         Stalls     Stall time    Max stall  Min ahead\n");
+    demo_report("On demand", &stats, false);
+
+    for(uint32_t index = 0u; index < CY_ARRAY_SIZE(depths); index++)
+    {
+        char name[16];
+
+        result = demo_streamed(ext_addr, depths[index], &stats, &hash);
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        if(hash != reference)
+        {
+            return QSPI_STREAM_RSLT_ERR_VERIFY;
+        }
+
+        (void)snprintf(name, sizeof(name), "Depth %"PRIu32, depths[index]);
+        demo_report(name, &stats, true);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/******************************************************************************
+* File Name:   qspi_stream.h
+*
+* Description: This file contains the declarations of the streaming reader,
+*              which keeps a ring of SRAM buffers filled ahead of a
+*              sequential consumer with asynchronous QSPI reads.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef QSPI_STREAM_H
+#define QSPI_STREAM_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the streaming reader demo before entering XIP mode */
+#ifndef QSPI_STREAM_DEMO_ENABLE
+#define QSPI_STREAM_DEMO_ENABLE         (0u)
+#endif
+
+/* Simulated consumer of the demo: data rate, chunk size and stream length */
+#ifndef QSPI_STREAM_DEMO_BITRATE
+#define QSPI_STREAM_DEMO_BITRATE        (12000000u)     /* bit/s */
+#endif
+
+#ifndef QSPI_STREAM_DEMO_CHUNK_SIZE
+#define QSPI_STREAM_DEMO_CHUNK_SIZE     (512u)
+#endif
+
+#ifndef QSPI_STREAM_DEMO_SIZE
+#define QSPI_STREAM_DEMO_SIZE           (128u * 1024u)
+#endif
+
+/* Deepest ring tried by the demo */
+#ifndef QSPI_STREAM_DEMO_DEPTH
+#define QSPI_STREAM_DEMO_DEPTH          (4u)
+#endif
+
+#define QSPI_STREAM_RSLT_ERR_BAD_PARAM  APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_STREAM, 1u)
+#define QSPI_STREAM_RSLT_ERR_STATE      APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_STREAM, 2u)
+#define QSPI_STREAM_RSLT_ERR_VERIFY     APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_STREAM, 3u)
+#define QSPI_STREAM_RSLT_END            APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_STREAM, 4u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t chunks;            /* Chunks handed to the consumer */
+    uint32_t stalls;            /* Chunks the consumer had to wait for */
+    uint32_t stall_us;          /* Total time waited */
+    uint32_t max_stall_us;
+    uint32_t min_ahead;         /* Fewest chunks ready when the consumer asked for one */
+} qspi_stream_stats_t;
+
+/* Ring of depth buffers of chunk_size bytes in storage. The buffers from head
+ * on are ready (the first 'ready' ones), then being read (one at most); the
+ * others are free. Fields written from the DMA interrupt are volatile.
+ */
+typedef struct
+{
+    uint8_t *storage;
+    uint32_t chunk_size;
+    uint32_t depth;
+    uint32_t consume_addr;      /* Address of the consumer's chunk */
+    uint32_t next_addr;         /* Next address to read ahead */
+    uint32_t end_addr;
+    uint32_t head;              /* Buffer of the consumer's chunk */
+    volatile uint32_t queued;   /* Buffers ready or being read */
+    volatile uint32_t ready;
+    volatile bool in_flight;
+    volatile cy_rslt_t error;
+    bool acquired;
+    qspi_stream_stats_t stats;
+} qspi_stream_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t qspi_stream_open(qspi_stream_t *stream, uint32_t addr, uint32_t length, uint8_t *storage,
+                           uint32_t chunk_size, uint32_t depth);
+cy_rslt_t qspi_stream_acquire(qspi_stream_t *stream, const uint8_t **data, uint32_t *length);
+void qspi_stream_release(qspi_stream_t *stream);
+void qspi_stream_close(qspi_stream_t *stream);
+void qspi_stream_get_stats(const qspi_stream_t *stream, qspi_stream_stats_t *stats);
+cy_rslt_t qspi_stream_demo(uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* QSPI_STREAM_H */
+
+/* [] END OF FILE */
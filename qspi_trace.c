@@ -0,0 +1,217 @@
+/******************************************************************************
+* File Name:   qspi_trace.c
+*
+* Description: Trace points for QSPI operations. Each operation is recorded
+*              with its cycle stamps, address, length and status in a lock-
+*              free SRAM ring, optionally streamed over ITM, and dumped over
+*              the UART for scripts/qspi_trace.py.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "qspi_trace.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#if (QSPI_TRACE_ENABLE)
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define TRACE_INDEX_MASK                (QSPI_TRACE_BUFFER_SIZE - 1u)
+
+#if (0u != (QSPI_TRACE_BUFFER_SIZE & TRACE_INDEX_MASK))
+#error "QSPI_TRACE_BUFFER_SIZE must be a power of two"
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const char *const trace_op_names[QSPI_TRACE_OP_COUNT] =
+{
+    "init", "read", "write", "erase", "xip_enable", "xip_disable"
+};
+
+static qspi_trace_record_t trace_buffer[QSPI_TRACE_BUFFER_SIZE];
+
+/* Records claimed so far; the next one goes to trace_buffer[trace_head % size] */
+static volatile uint32_t trace_head;
+
+#if (QSPI_TRACE_ITM_ENABLE)
+/*******************************************************************************
+* Function Name: trace_itm_send
+****************************************************************************//**
+* Summary:
+*  Sends a record on the ITM stimulus port as seven words, starting with
+*  QSPI_TRACE_ITM_SYNC | op, if the debugger has enabled the port. Interrupts
+*  are masked so that records from different contexts are not interleaved.
+*
+*******************************************************************************/
+static void trace_itm_send(const uint32_t *words, uint32_t count)
+{
+    if((0u == (ITM->TCR & ITM_TCR_ITMENA_Msk)) || (0u == (ITM->TER & (1uL << QSPI_TRACE_ITM_PORT))))
+    {
+        return;
+    }
+
+    uint32_t savedIntrStatus = Cy_SysLib_EnterCriticalSection();
+
+    for(uint32_t index = 0u; index < count; index++)
+    {
+        /* Wait for room in the stimulus port FIFO */
+        while(0u == ITM->PORT[QSPI_TRACE_ITM_PORT].u32)
+        {
+        }
+
+        ITM->PORT[QSPI_TRACE_ITM_PORT].u32 = words[index];
+    }
+
+    Cy_SysLib_ExitCriticalSection(savedIntrStatus);
+}
+#endif
+
+/*******************************************************************************
+* Function Name: qspi_trace_init
+****************************************************************************//**
+* Summary:
+*  Clears the trace and starts the cycle counter. Call before the first trace
+*  point.
+*
+*******************************************************************************/
+void qspi_trace_init(void)
+{
+    (void)memset(trace_buffer, 0, sizeof(trace_buffer));
+    trace_head = 0u;
+    cycle_counter_init();
+}
+
+/*******************************************************************************
+* Function Name: qspi_trace_end
+****************************************************************************//**
+* Summary:
+*  Records an operation that started at a qspi_trace_begin() stamp. Can be
+*  called from any context: the slot is claimed with an exclusive store, so
+*  an interrupt recording in between makes the claim retry instead of
+*  sharing the slot.
+*
+* Parameters:
+*  op - operation.
+*  start - value returned by qspi_trace_begin().
+*  addr - external memory address, or 0.
+*  length - bytes transferred or erased, or 0.
+*  status - result of the operation.
+*
+*******************************************************************************/
+void qspi_trace_end(qspi_trace_op_t op, uint32_t start, uint32_t addr, uint32_t length, uint32_t status)
+{
+    uint32_t cycles = cycle_counter_get() - start;
+    uint32_t index;
+
+    do
+    {
+        index = __LDREXW(&trace_head);
+    } while(0u != __STREXW(index + 1u, &trace_head));
+
+    qspi_trace_record_t *record = &trace_buffer[index & TRACE_INDEX_MASK];
+
+    /* Invalid while it is being filled */
+    record->seq = 0u;
+    __DMB();
+    record->start = start;
+    record->cycles = cycles;
+    record->addr = addr;
+    record->length = length;
+    record->status = status;
+    record->op = (uint32_t)op;
+    __DMB();
+    record->seq = index + 1u;
+
+#if (QSPI_TRACE_ITM_ENABLE)
+    const uint32_t words[] = { QSPI_TRACE_ITM_SYNC | (uint32_t)op, index + 1u, start, cycles, addr, length, status };
+
+    trace_itm_send(words, CY_ARRAY_SIZE(words));
+#endif
+}
+
+/*******************************************************************************
+* Function Name: qspi_trace_dump
+****************************************************************************//**
+* Summary:
+*  Prints the records in SRAM, oldest first, as lines for
+*  scripts/qspi_trace.py:
+*    qspi_trace_clock,<CPU clock in Hz>
+*    qspi_trace,<seq>,<op>,<addr>,<length>,<status>,<start>,<cycles>
+*  Records being written or overwritten while dumping are left out.
+*
+*******************************************************************************/
+void qspi_trace_dump(void)
+{
+    uint32_t head = trace_head;
+    uint32_t first = (head > QSPI_TRACE_BUFFER_SIZE) ? (head - QSPI_TRACE_BUFFER_SIZE) : 0u;
+
+    printf("qspi_trace_clock,%"PRIu32"\n", SystemCoreClock);
+
+    for(uint32_t index = first; index != head; index++)
+    {
+        const qspi_trace_record_t *slot = &trace_buffer[index & TRACE_INDEX_MASK];
+        qspi_trace_record_t record;
+
+        record.seq = slot->seq;
+        __DMB();
+        record.start = slot->start;
+        record.cycles = slot->cycles;
+        record.addr = slot->addr;
+        record.length = slot->length;
+        record.status = slot->status;
+        record.op = slot->op;
+        __DMB();
+
+        if((record.seq != (index + 1u)) || (slot->seq != record.seq) || (record.op >= (uint32_t)QSPI_TRACE_OP_COUNT))
+        {
+            continue;
+        }
+
+        printf("qspi_trace,%"PRIu32",%s,0x%08"PRIx32",%"PRIu32",0x%08"PRIx32",%"PRIu32",%"PRIu32"\n", record.seq,
+               trace_op_names[record.op], record.addr, record.length, record.status, record.start, record.cycles);
+    }
+}
+
+#endif /* QSPI_TRACE_ENABLE */
+
+/* [] END OF FILE */
@@ -0,0 +1,146 @@
+/******************************************************************************
+* File Name:   qspi_trace.h
+*
+* Description: Trace points for QSPI operations. Each operation is recorded
+*              with its cycle stamps, address, length and status in a lock-
+*              free SRAM ring, optionally streamed over ITM, and dumped over
+*              the UART for scripts/qspi_trace.py.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef QSPI_TRACE_H
+#define QSPI_TRACE_H
+
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to record the QSPI operations of main.c */
+#ifndef QSPI_TRACE_ENABLE
+#define QSPI_TRACE_ENABLE               (0u)
+#endif
+
+/* Records kept in SRAM, a power of two; the oldest ones are overwritten */
+#define QSPI_TRACE_BUFFER_SIZE          (256u)
+
+/* Set to 1 to also stream each record on ITM stimulus port QSPI_TRACE_ITM_PORT.
+ * Records are only sent when the debugger has enabled the port.
+ */
+#ifndef QSPI_TRACE_ITM_ENABLE
+#define QSPI_TRACE_ITM_ENABLE           (0u)
+#endif
+#define QSPI_TRACE_ITM_PORT             (1u)
+
+/* First word of a record on ITM, with the operation in the low byte */
+#define QSPI_TRACE_ITM_SYNC             (0x51540000u)   /* "TQ" */
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef enum
+{
+    QSPI_TRACE_OP_INIT,
+    QSPI_TRACE_OP_READ,
+    QSPI_TRACE_OP_WRITE,
+    QSPI_TRACE_OP_ERASE,
+    QSPI_TRACE_OP_XIP_ENABLE,
+    QSPI_TRACE_OP_XIP_DISABLE,
+    QSPI_TRACE_OP_COUNT
+} qspi_trace_op_t;
+
+/* Valid once seq is written, last; seq is the index of the record plus one */
+typedef struct
+{
+    volatile uint32_t seq;
+    uint32_t start;             /* DWT cycle counter at the start */
+    uint32_t cycles;            /* Duration */
+    uint32_t addr;
+    uint32_t length;
+    uint32_t status;
+    uint32_t op;
+} qspi_trace_record_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+#if (QSPI_TRACE_ENABLE)
+void qspi_trace_init(void);
+void qspi_trace_end(qspi_trace_op_t op, uint32_t start, uint32_t addr, uint32_t length, uint32_t status);
+void qspi_trace_dump(void);
+
+/*******************************************************************************
+* Function Name: qspi_trace_begin
+****************************************************************************//**
+* Summary:
+*  Returns the start stamp of an operation, to pass to qspi_trace_end().
+*
+*******************************************************************************/
+static inline uint32_t qspi_trace_begin(void)
+{
+    return cycle_counter_get();
+}
+#else
+/* Trace points compile to nothing */
+static inline void qspi_trace_init(void) {}
+static inline uint32_t qspi_trace_begin(void) { return 0u; }
+static inline void qspi_trace_end(qspi_trace_op_t op, uint32_t start, uint32_t addr, uint32_t length,
+                                  uint32_t status)
+{
+    (void)op;
+    (void)start;
+    (void)addr;
+    (void)length;
+    (void)status;
+}
+static inline void qspi_trace_dump(void) {}
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* QSPI_TRACE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,313 @@
+/******************************************************************************
+* File Name:   qspi_tuning.c
+*
+* Description: This file contains the QSPI link-speed auto-tuning. It steps
+*              through bus frequencies and RX sampling clocks, checks a known
+*              pattern at each step, and keeps the fastest stable setting.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "qspi_tuning.h"
+#include "qspi_bus.h"
+#include <inttypes.h>
+#include <string.h>
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const uint32_t tuning_frequencies[] = QSPI_TUNING_FREQUENCIES_HZ;
+
+/* RX sampling clocks in order of preference. The one selected by the HAL at
+ * initialization is always tried first.
+ */
+static const cy_en_smif_clk_select_t tuning_rx_clocks[] =
+{
+    CY_SMIF_SEL_INV_INTERNAL_CLK,
+    CY_SMIF_SEL_INTERNAL_CLK,
+    CY_SMIF_SEL_INV_FEEDBACK_CLK,
+    CY_SMIF_SEL_FEEDBACK_CLK,
+    CY_SMIF_SEL_INV_OUTPUT_CLK,
+    CY_SMIF_SEL_OUTPUT_CLK
+};
+
+static const char *const tuning_rx_clock_names[] =
+{
+    [CY_SMIF_SEL_OUTPUT_CLK]        = "OUT",
+    [CY_SMIF_SEL_INV_OUTPUT_CLK]    = "INV_OUT",
+    [CY_SMIF_SEL_FEEDBACK_CLK]      = "FB",
+    [CY_SMIF_SEL_INV_FEEDBACK_CLK]  = "INV_FB",
+    [CY_SMIF_SEL_INTERNAL_CLK]      = "INT",
+    [CY_SMIF_SEL_INV_INTERNAL_CLK]  = "INV_INT"
+};
+
+static uint8_t tuning_pattern[QSPI_TUNING_PATTERN_SIZE];
+static uint8_t tuning_readback[QSPI_TUNING_PATTERN_SIZE];
+
+/*******************************************************************************
+* Function Name: tuning_rx_clock_name
+****************************************************************************//**
+* Summary:
+*  Returns the printable name of an RX sampling clock.
+*
+*******************************************************************************/
+static const char *tuning_rx_clock_name(cy_en_smif_clk_select_t rx_clock)
+{
+    return ((uint32_t)rx_clock < CY_ARRAY_SIZE(tuning_rx_clock_names)) ? tuning_rx_clock_names[rx_clock] : "?";
+}
+
+/*******************************************************************************
+* Function Name: tuning_make_pattern
+****************************************************************************//**
+* Summary:
+*  Builds the test pattern: walking ones and zeros to catch stuck or crossed
+*  data lines, alternating 0x55/0xAA for maximum toggle rate, and
+*  pseudo-random data.
+*
+*******************************************************************************/
+static void tuning_make_pattern(void)
+{
+    uint32_t seed = 0xC0FFEE11u;
+
+    for(uint32_t index = 0; index < QSPI_TUNING_PATTERN_SIZE; index++)
+    {
+        uint8_t value;
+
+        if(index < 32u)
+        {
+            value = (uint8_t)(1u << (index % 8u));
+        }
+        else if(index < 64u)
+        {
+            value = (uint8_t)~(1u << (index % 8u));
+        }
+        else if(index < 128u)
+        {
+            value = (0u != (index & 1u)) ? 0xAAu : 0x55u;
+        }
+        else
+        {
+            seed = (seed * 1664525u) + 1013904223u;
+            value = (uint8_t)(seed >> 24u);
+        }
+
+        tuning_pattern[index] = value;
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuning_pattern_matches
+****************************************************************************//**
+* Summary:
+*  Reads the pattern back the given number of times and compares it.
+*
+*******************************************************************************/
+static bool tuning_pattern_matches(uint32_t addr, uint32_t passes)
+{
+    for(uint32_t pass = 0; pass < passes; pass++)
+    {
+        memset(tuning_readback, 0, sizeof(tuning_readback));
+
+        if((CY_RSLT_SUCCESS != cy_serial_flash_qspi_read(addr, sizeof(tuning_readback), tuning_readback)) ||
+           (0 != memcmp(tuning_pattern, tuning_readback, sizeof(tuning_pattern))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: tuning_set_rx_clock
+****************************************************************************//**
+* Summary:
+*  Selects the clock used by the SMIF to sample the RX data. Must be called
+*  while no transfer is in progress.
+*
+*******************************************************************************/
+static void tuning_set_rx_clock(cy_en_smif_clk_select_t rx_clock)
+{
+    SMIF0->CTL = _CLR_SET_FLD32U(SMIF0->CTL, SMIF_CTL_CLOCK_IF_RX_SEL, (uint32_t)rx_clock);
+}
+
+/*******************************************************************************
+* Function Name: qspi_tuning_apply
+****************************************************************************//**
+* Summary:
+*  Initializes the serial-flash library with a tuned setting. The library
+*  must not be initialized.
+*
+* Parameters:
+*  mem_config - memory configuration of the device.
+*  setting - setting returned by qspi_tuning_run().
+*
+*******************************************************************************/
+cy_rslt_t qspi_tuning_apply(const cy_stc_smif_mem_config_t *mem_config, const qspi_tuning_setting_t *setting)
+{
+    cy_rslt_t result = qspi_bus_init(mem_config, setting->frequency_hz);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        tuning_set_rx_clock(setting->rx_clock);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: qspi_tuning_run
+****************************************************************************//**
+* Summary:
+*  Initializes the serial-flash library at the fastest stable setting. The
+*  test pattern is written at the known-good frequency to the last sector of
+*  the memory, unless it is already present from a previous run. Then each
+*  candidate frequency is tried, fastest first, with every RX sampling clock;
+*  a setting is stable if the pattern reads back correctly
+*  QSPI_TUNING_READ_PASSES times in a row. The sweep stops at the first
+*  frequency with a stable setting, and the results are printed.
+*
+*  If no candidate is stable, the library is left initialized at safe_hz
+*  with the default RX clock, which is returned as the selected setting.
+*
+* Parameters:
+*  mem_config - memory configuration of the device.
+*  safe_hz - known-good frequency used to write the pattern.
+*  selected - receives the selected setting.
+*
+* Return:
+*  Error if the library cannot be initialized or the pattern written at
+*  safe_hz, success otherwise.
+*
+*******************************************************************************/
+cy_rslt_t qspi_tuning_run(const cy_stc_smif_mem_config_t *mem_config, uint32_t safe_hz,
+                          qspi_tuning_setting_t *selected)
+{
+    cy_rslt_t result = qspi_bus_init(mem_config, safe_hz);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    size_t mem_size = cy_serial_flash_qspi_get_size();
+    size_t sector_size = cy_serial_flash_qspi_get_erase_size((uint32_t)(mem_size - 1u));
+    uint32_t pattern_addr = (uint32_t)(mem_size - sector_size);
+    cy_en_smif_clk_select_t default_rx_clock =
+        (cy_en_smif_clk_select_t)_FLD2VAL(SMIF_CTL_CLOCK_IF_RX_SEL, SMIF0->CTL);
+
+    selected->frequency_hz = safe_hz;
+    selected->rx_clock = default_rx_clock;
+
+    tuning_make_pattern();
+
+    if(!tuning_pattern_matches(pattern_addr, 1u))
+    {
+        result = cy_serial_flash_qspi_erase(pattern_addr, sector_size);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            result = cy_serial_flash_qspi_write(pattern_addr, sizeof(tuning_pattern), tuning_pattern);
+        }
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        if(!tuning_pattern_matches(pattern_addr, QSPI_TUNING_READ_PASSES))
+        {
+            return QSPI_TUNING_RSLT_ERR_PATTERN;
+        }
+    }
+
+    printf("\nQSPI link tuning (pattern at 0x%08"PRIx32", %u reads per setting):\n",
+           pattern_addr, (unsigned int)QSPI_TUNING_READ_PASSES);
+
+    bool found = false;
+
+    for(uint32_t freq = 0; (freq < CY_ARRAY_SIZE(tuning_frequencies)) && !found; freq++)
+    {
+        cy_serial_flash_qspi_deinit();
+        printf("%3"PRIu32" MHz:", tuning_frequencies[freq] / 1000000u);
+
+        if(CY_RSLT_SUCCESS != qspi_bus_init(mem_config, tuning_frequencies[freq]))
+        {
+            printf(" initialization failed\n");
+            continue;
+        }
+
+        /* The default clock first, then the others in order of preference */
+        for(uint32_t rx = 0; rx <= CY_ARRAY_SIZE(tuning_rx_clocks); rx++)
+        {
+            cy_en_smif_clk_select_t rx_clock = (0u == rx) ? default_rx_clock : tuning_rx_clocks[rx - 1u];
+
+            if((0u != rx) && (rx_clock == default_rx_clock))
+            {
+                continue;
+            }
+
+            tuning_set_rx_clock(rx_clock);
+            bool stable = tuning_pattern_matches(pattern_addr, QSPI_TUNING_READ_PASSES);
+            printf(" %s:%s", tuning_rx_clock_name(rx_clock), stable ? "pass" : "fail");
+
+            if(stable && !found)
+            {
+                found = true;
+                selected->frequency_hz = tuning_frequencies[freq];
+                selected->rx_clock = rx_clock;
+            }
+        }
+
+        printf("\n");
+    }
+
+    cy_serial_flash_qspi_deinit();
+    result = qspi_tuning_apply(mem_config, selected);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("%s %"PRIu32" MHz, RX clock %s\n", found ? "Selected" : "No stable candidate, falling back to",
+               selected->frequency_hz / 1000000u, tuning_rx_clock_name(selected->rx_clock));
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,102 @@
+/******************************************************************************
+* File Name:   qspi_tuning.h
+*
+* Description: This file contains the declarations of the QSPI link-speed
+*              auto-tuning.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef QSPI_TUNING_H
+#define QSPI_TUNING_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to select the QSPI bus frequency and RX sampling clock at startup
+ * instead of using QSPI_BUS_FREQUENCY_HZ.
+ */
+#ifndef QSPI_TUNING_ENABLE
+#define QSPI_TUNING_ENABLE              (0u)
+#endif
+
+/* Candidate bus frequencies, fastest first */
+#ifndef QSPI_TUNING_FREQUENCIES_HZ
+#define QSPI_TUNING_FREQUENCIES_HZ      { 80000000lu, 75000000lu, 66000000lu, 60000000lu, \
+                                          50000000lu, 40000000lu, 25000000lu }
+#endif
+
+/* Number of consecutive error-free pattern reads for a setting to be stable */
+#ifndef QSPI_TUNING_READ_PASSES
+#define QSPI_TUNING_READ_PASSES         (8u)
+#endif
+
+/* Size of the pattern written to the last sector of the memory */
+#define QSPI_TUNING_PATTERN_SIZE        (256u)
+
+#define QSPI_TUNING_RSLT_ERR_PATTERN    APP_RSLT_ERR(APP_RSLT_RANGE_QSPI_TUNING, 2u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t frequency_hz;              /* Requested QSPI bus frequency */
+    cy_en_smif_clk_select_t rx_clock;   /* Clock used to sample the RX data */
+} qspi_tuning_setting_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t qspi_tuning_run(const cy_stc_smif_mem_config_t *mem_config, uint32_t safe_hz,
+                          qspi_tuning_setting_t *selected);
+cy_rslt_t qspi_tuning_apply(const cy_stc_smif_mem_config_t *mem_config, const qspi_tuning_setting_t *setting);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* QSPI_TUNING_H */
+
+/* [] END OF FILE */
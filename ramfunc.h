@@ -0,0 +1,89 @@
+/******************************************************************************
+* File Name:   ramfunc.h
+*
+* Description: This file provides the section macro and the linker symbols of
+*              the SRAM-executed code section (.cy_ramfunc).
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef RAMFUNC_H
+#define RAMFUNC_H
+
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Places a function in the .cy_ramfunc section of the linker file. The code is
+ * copied from internal flash to SRAM at startup, so it executes without QSPI
+ * fetch stalls and keeps running while the SMIF is out of XIP mode. Do not
+ * call code placed in .cy_xip_code from a function in this section.
+ */
+#define APP_RAMFUNC             CY_SECTION(".cy_ramfunc") __attribute__((used, noinline))
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Defined by the linker file */
+extern uint8_t __cy_ramfunc_start[];
+extern uint8_t __cy_ramfunc_end[];
+
+/*******************************************************************************
+* Function Name: ramfunc_contains
+****************************************************************************//**
+* Summary:
+*  Checks whether an address (for example, of a function) lies in the SRAM
+*  copy of the .cy_ramfunc section.
+*
+*******************************************************************************/
+static inline bool ramfunc_contains(uint32_t addr)
+{
+    return (addr >= (uint32_t)__cy_ramfunc_start) && (addr < (uint32_t)__cy_ramfunc_end);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* RAMFUNC_H */
+
+/* [] END OF FILE */
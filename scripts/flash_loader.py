@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+###############################################################################
+# File Name:   flash_loader.py
+#
+# Description: Host side of flash_loader.c: programs the external memory
+#              part of an Intel HEX image over the debug UART, much faster
+#              than the debugger's CY_ENABLE_XIP_PROGRAM flow.
+#
+# Related Document: See README.md
+#
+###############################################################################
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such
+# system or application assumes all risk as well as any liability arising from
+# such use and indemnifies Cypress against all such liability.
+###############################################################################
+"""Program the external memory through the on-target flash loader.
+
+Build the application with FLASH_LOADER_ENABLE=1, program it once with the
+debugger (or keep the internal flash part up to date), then run this script
+and reset the kit. The loader waits FLASH_LOADER_WAIT_MS after reset for the
+START frame, so the script keeps sending it until it is answered.
+
+The data records of the image between --start and --end (the XIP region by
+default) are packed into one range, starting on an --align boundary, with
+gaps filled with 0xFF. The range is sent in --chunk byte DATA frames, each
+with its CRC-32; chunks that are all 0xFF are skipped (the loader erases the
+whole range). A chunk damaged on the link is sent again. The END frame
+carries the CRC-32 of the whole range, which the loader checks against the
+memory before it answers: no read-back is needed.
+
+Requires pyserial.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from xip_encrypt import read_hex  # noqa: E402
+
+MAGIC = 0x4C46
+CMD_START, CMD_DATA, CMD_END = 1, 2, 3
+STATUS = {0: "ACK", 1: "NAK_CRC", 2: "PROTOCOL", 3: "BOUNDS", 4: "FLASH",
+          5: "VERIFY"}
+FRAME = struct.Struct("<HBBIII")
+REPLY = struct.Struct("<HBBI")
+# Fixed by FLASH_LOADER_CHUNK_SIZE in flash_loader.h
+MAX_CHUNK = 4096
+RETRIES = 5
+
+
+def build_image(records, start, end, align):
+    """Return (offset in the memory, bytes) of the data between start, end."""
+    chunks = [(addr, data) for kind, _, addr, data in records
+              if kind == 0x00 and data and start <= addr < end]
+    if not chunks:
+        sys.exit("no data between 0x%08X and 0x%08X" % (start, end))
+    lo = min(addr for addr, _ in chunks)
+    lo -= (lo - start) % align
+    hi = max(addr + len(data) for addr, data in chunks)
+    if hi > end:
+        sys.exit("data past 0x%08X" % end)
+    image = bytearray(b"\xff" * (hi - lo))
+    for addr, data in chunks:
+        image[addr - lo:addr - lo + len(data)] = data
+    return lo - start, bytes(image)
+
+
+class Loader:
+    def __init__(self, port):
+        self.port = port
+        self.seq = 0
+
+    def transact(self, cmd, addr, length, crc, payload=b"", timeout=2.0):
+        self.seq = (self.seq + 1) & 0xFF
+        self.port.write(FRAME.pack(MAGIC, cmd, self.seq, addr, length, crc) +
+                        payload)
+        self.port.timeout = timeout
+        while True:
+            raw = self.port.read(REPLY.size)
+            if len(raw) < REPLY.size:
+                return None, 0
+            magic, status, seq, value = REPLY.unpack(raw)
+            if magic != MAGIC:
+                # Console output left over from before the loader started
+                self.port.reset_input_buffer()
+                return None, 0
+            if seq == self.seq:
+                return status, value
+
+    def start(self, addr, length, wait):
+        deadline = time.monotonic() + wait
+        while time.monotonic() < deadline:
+            status, _ = self.transact(CMD_START, addr, length, 0, timeout=0.2)
+            if status is not None:
+                return status
+        return None
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("hex", help="application image")
+    parser.add_argument("--port", required=True, help="e.g. COM5, /dev/ttyACM0")
+    parser.add_argument("--baud", type=int, default=921600,
+                        help="FLASH_LOADER_BAUD_RATE (default 921600)")
+    parser.add_argument("--chunk", type=int, default=MAX_CHUNK,
+                        help="bytes per DATA frame (default %d)" % MAX_CHUNK)
+    parser.add_argument("--align", type=lambda x: int(x, 0), default=0x40000,
+                        help="erase sector size (default 0x40000)")
+    parser.add_argument("--start", type=lambda x: int(x, 0),
+                        default=0x18000000, help="XIP address of the memory")
+    parser.add_argument("--end", type=lambda x: int(x, 0),
+                        default=0x20000000, help="end of the XIP region")
+    parser.add_argument("--wait", type=float, default=30.0,
+                        help="seconds to wait for the kit (default 30)")
+    args = parser.parse_args()
+
+    if not 0 < args.chunk <= MAX_CHUNK:
+        sys.exit("--chunk must be 1..%d" % MAX_CHUNK)
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required: pip install pyserial")
+
+    offset, image = build_image(read_hex(args.hex), args.start, args.end,
+                                args.align)
+    print("%s: 0x%X bytes at offset 0x%X" % (args.hex, len(image), offset))
+
+    with serial.Serial(args.port, args.baud) as port:
+        loader = Loader(port)
+        print("waiting for the kit (reset it)...")
+        status = loader.start(offset, len(image), args.wait)
+        if status is None:
+            sys.exit("no answer from the loader")
+        if status != 0:
+            sys.exit("START rejected: %s" % STATUS.get(status, status))
+
+        began = time.monotonic()
+        sent = 0
+        for pos in range(0, len(image), args.chunk):
+            chunk = image[pos:pos + args.chunk]
+            if chunk.count(0xFF) == len(chunk):
+                continue
+            for _ in range(RETRIES):
+                status, value = loader.transact(
+                    CMD_DATA, offset + pos, len(chunk), zlib.crc32(chunk),
+                    chunk)
+                if status != 1:
+                    break
+            if status != 0:
+                sys.exit("chunk at 0x%X: %s" % (
+                    offset + pos, "timeout" if status is None
+                    else STATUS.get(status, status)))
+            sent += len(chunk)
+            print("\r%3d%%" % (100 * (pos + len(chunk)) // len(image)),
+                  end="", flush=True)
+
+        # The loader answers once the range is programmed and verified
+        status, value = loader.transact(CMD_END, offset, len(image),
+                                        zlib.crc32(image), timeout=60.0)
+        elapsed = time.monotonic() - began
+        print()
+        if status != 0:
+            sys.exit("END: %s" % ("timeout" if status is None
+                                  else STATUS.get(status, status)))
+
+    print("programmed and verified %d bytes (%d sent) in %.2f s, %.1f KB/s"
+          % (len(image), sent, elapsed, len(image) / 1024.0 / elapsed))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+###############################################################################
+# File Name:   qspi_trace.py
+#
+# Description: Host side of qspi_trace.c: builds per-operation latency
+#              histograms from a UART log containing qspi_trace_dump()
+#              output or from a raw SWO capture of the ITM records.
+#
+# Related Document: See README.md
+#
+###############################################################################
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such
+# system or application assumes all risk as well as any liability arising from
+# such use and indemnifies Cypress against all such liability.
+###############################################################################
+"""Build QSPI operation latency histograms from a qspi_trace capture.
+
+Inputs
+  log       UART log with the lines printed by qspi_trace_dump():
+              qspi_trace_clock,<Hz>
+              qspi_trace,<seq>,<op>,<addr>,<length>,<status>,<start>,<cycles>
+            Other lines are ignored, so a plain terminal log works. Several
+            dumps in one log are combined (records seen twice count once).
+  --itm     the input is instead a raw SWO capture (UART/NRZ or Manchester
+            decoded to bytes, e.g. by a J-Link or OpenOCD 'tpiu' output
+            file). Records are taken from stimulus port --port. It carries no
+            clock, so --clock is required.
+
+For each operation the script prints the count, failures and latency
+percentiles, then a histogram with power-of-two microsecond buckets. --top
+lists the slowest records with their address, to find where the tail comes
+from.
+"""
+
+import argparse
+import sys
+
+OPS = ["init", "read", "write", "erase", "xip_enable", "xip_disable"]
+# QSPI_TRACE_ITM_SYNC in qspi_trace.h; a record is seven words
+ITM_SYNC = 0x51540000
+ITM_WORDS = 7
+
+
+def parse_log(path):
+    records = {}
+    clock = None
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            # Tolerate a terminal prefix such as a timestamp
+            pos = line.find("qspi_trace")
+            if pos < 0:
+                continue
+            fields = line[pos:].split(",")
+            if fields[0] == "qspi_trace_clock" and len(fields) == 2:
+                clock = int(fields[1])
+            elif fields[0] == "qspi_trace" and len(fields) == 8:
+                try:
+                    seq = int(fields[1])
+                    rec = (fields[2], int(fields[3], 16), int(fields[4]),
+                           int(fields[5], 16), int(fields[6]), int(fields[7]))
+                except ValueError:
+                    continue
+                records[seq] = rec
+    return records, clock
+
+
+def itm_words(data, port):
+    """Yield the 32-bit words written to one ITM stimulus port."""
+    pos = 0
+    while pos < len(data):
+        header = data[pos]
+        pos += 1
+        if header == 0x00 or header == 0x80 or header == 0x70:
+            # Synchronization (run of zeros ending in 0x80), overflow
+            continue
+        if header & 0x03:
+            size = {1: 1, 2: 2, 3: 4}[header & 0x03]
+            payload = data[pos:pos + size]
+            pos += size
+            # Instrumentation (software source) packets only, full words
+            if not header & 0x04 and header >> 3 == port and size == 4:
+                yield int.from_bytes(payload, "little")
+            continue
+        # Timestamp and extension packets, with continuation bytes
+        if header & 0x80:
+            while pos < len(data) and data[pos] & 0x80:
+                pos += 1
+            pos += 1
+
+
+def parse_itm(path, port):
+    with open(path, "rb") as f:
+        words = list(itm_words(f.read(), port))
+    records = {}
+    index = 0
+    while index + ITM_WORDS <= len(words):
+        word = words[index]
+        if (word & 0xFFFF0000) != ITM_SYNC or (word & 0xFFFF) >= len(OPS):
+            index += 1
+            continue
+        seq, start, cycles, addr, length, status = words[index + 1:index + 7]
+        records[seq] = (OPS[word & 0xFFFF], addr, length, status, start,
+                        cycles)
+        index += ITM_WORDS
+    return records
+
+
+def percentile(values, fraction):
+    return values[min(len(values) - 1, int(fraction * len(values)))]
+
+
+def report(records, clock, top):
+    by_op = {}
+    for seq, (op, addr, length, status, start, cycles) in records.items():
+        by_op.setdefault(op, []).append(cycles * 1e6 / clock)
+    ops = [op for op in OPS if op in by_op] + sorted(set(by_op) - set(OPS))
+
+    print("%-12s %6s %6s %10s %10s %10s %10s %10s" % (
+        "Operation", "Count", "Fail", "Min us", "p50 us", "p90 us",
+        "p99 us", "Max us"))
+    for op in ops:
+        values = sorted(by_op[op])
+        failed = sum(1 for r in records.values() if r[0] == op and r[3])
+        print("%-12s %6d %6d %10.1f %10.1f %10.1f %10.1f %10.1f" % (
+            op, len(values), failed, values[0], percentile(values, 0.5),
+            percentile(values, 0.9), percentile(values, 0.99), values[-1]))
+
+    for op in ops:
+        buckets = {}
+        for us in by_op[op]:
+            bucket = 1
+            while bucket < us:
+                bucket *= 2
+            buckets[bucket] = buckets.get(bucket, 0) + 1
+        widest = max(buckets.values())
+        print("\n%s" % op)
+        for bucket in sorted(buckets):
+            count = buckets[bucket]
+            print("  <= %9d us %6d %s" % (bucket, count,
+                                         "#" * max(1, 50 * count // widest)))
+
+    if top:
+        print("\nSlowest records")
+        print("%8s %-12s %10s %8s %10s %10s" % (
+            "Seq", "Operation", "Address", "Length", "Status", "us"))
+        slowest = sorted(records.items(), key=lambda x: -x[1][5])[:top]
+        for seq, (op, addr, length, status, start, cycles) in slowest:
+            print("%8d %-12s 0x%08x %8d 0x%08x %10.1f" % (
+                seq, op, addr, length, status, cycles * 1e6 / clock))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("log", help="UART log, or SWO capture with --itm")
+    parser.add_argument("--itm", action="store_true",
+                        help="input is a raw SWO capture")
+    parser.add_argument("--port", type=int, default=1,
+                        help="ITM stimulus port (QSPI_TRACE_ITM_PORT)")
+    parser.add_argument("--clock", type=int,
+                        help="CPU clock in Hz (default: from the log)")
+    parser.add_argument("--top", type=int, default=10,
+                        help="slowest records to list (default 10)")
+    args = parser.parse_args()
+
+    if args.itm:
+        records, clock = parse_itm(args.log, args.port), None
+    else:
+        records, clock = parse_log(args.log)
+    clock = args.clock or clock
+    if not clock:
+        sys.exit("CPU clock unknown, use --clock")
+    if not records:
+        sys.exit("no qspi_trace records found in %s" % args.log)
+
+    report(records, clock, args.top)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+###############################################################################
+# File Name:   xip_compress.py
+#
+# Description: Compresses read-only assets into independently decodable
+#              LZ4 blocks and generates the C source that places them in
+#              the cy_xip section, for the on-demand decoder in xip_zasset.c.
+#
+# Related Document: See README.md
+#
+###############################################################################
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such
+# system or application assumes all risk as well as any liability arising from
+# such use and indemnifies Cypress against all such liability.
+###############################################################################
+"""Compress assets for xip_zasset.c.
+
+Each asset is split into blocks of --block-size bytes (the last block may be
+shorter). Every block is compressed on its own in the LZ4 block format, so
+that any block can be decoded without the others; a block that does not
+shrink is stored raw. For every 'name=path' argument the generated source
+defines:
+
+  const xip_zasset_t name          descriptor, in internal flash
+  name_blocks[], name_offsets[]    compressed data and block table, in cy_xip
+  name_raw[]                       with --raw, the uncompressed asset in cy_xip
+                                   (for comparisons)
+
+Outputs <out>.c and <out>.h. With --guard MACRO, the contents are only
+compiled when MACRO is non-zero.
+"""
+
+import argparse
+import os
+import sys
+
+MIN_MATCH = 4
+MF_LIMIT = 12           # the last match must start this far from the end
+LAST_LITERALS = 5       # the block must end with at least this many literals
+MAX_OFFSET = 65535
+RAW_FLAG = 0x80000000   # set in an offset entry: the block is stored raw
+
+
+def put_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def emit(out, literals, offset=0, match_len=0):
+    lit = len(literals)
+    ml = match_len - MIN_MATCH if match_len else 0
+    out.append((min(lit, 15) << 4) | min(ml, 15))
+    if lit >= 15:
+        put_length(out, lit - 15)
+    out += literals
+    if match_len:
+        out += bytes((offset & 0xFF, offset >> 8))
+        if ml >= 15:
+            put_length(out, ml - 15)
+
+
+def lz4_compress(src, depth=64):
+    """LZ4 block compressor: hash chains with up to 'depth' candidates."""
+    n = len(src)
+    out = bytearray()
+    anchor = 0
+    pos = 0
+    head = {}
+    prev = [-1] * n
+    match_limit = n - LAST_LITERALS
+    inserted = 0
+
+    def insert(upto):
+        nonlocal inserted
+        while inserted < upto and inserted + MIN_MATCH <= n:
+            key = bytes(src[inserted:inserted + MIN_MATCH])
+            prev[inserted] = head.get(key, -1)
+            head[key] = inserted
+            inserted += 1
+
+    while pos + MF_LIMIT <= n:
+        insert(pos)
+        best_len = 0
+        best_cand = -1
+        cand = head.get(bytes(src[pos:pos + MIN_MATCH]), -1)
+        for _ in range(depth):
+            if cand < 0 or pos - cand > MAX_OFFSET:
+                break
+            length = 0
+            while pos + length < match_limit and src[cand + length] == src[pos + length]:
+                length += 1
+            if length > best_len:
+                best_len, best_cand = length, cand
+            cand = prev[cand]
+
+        if best_len < MIN_MATCH:
+            pos += 1
+            continue
+
+        cand = best_cand
+        while pos > anchor and cand > 0 and src[pos - 1] == src[cand - 1]:
+            pos -= 1
+            cand -= 1
+            best_len += 1
+
+        emit(out, src[anchor:pos], pos - cand, best_len)
+        pos += best_len
+        anchor = pos
+
+    emit(out, src[anchor:])
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    """Reference decoder, used to check every block before it is emitted."""
+    out = bytearray()
+    pos = 0
+    while pos < len(src):
+        token = src[pos]
+        pos += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                lit += src[pos]
+                pos += 1
+                if src[pos - 1] != 255:
+                    break
+        out += src[pos:pos + lit]
+        pos += lit
+        if pos == len(src):
+            break
+        offset = src[pos] | (src[pos + 1] << 8)
+        pos += 2
+        ml = token & 15
+        if ml == 15:
+            while True:
+                ml += src[pos]
+                pos += 1
+                if src[pos - 1] != 255:
+                    break
+        for _ in range(ml + MIN_MATCH):
+            out.append(out[-offset])
+    if len(out) != size:
+        raise ValueError("decoded %d bytes, expected %d" % (len(out), size))
+    return bytes(out)
+
+
+def compress_asset(data, block_size):
+    blocks = bytearray()
+    offsets = []
+    for start in range(0, len(data), block_size):
+        raw = data[start:start + block_size]
+        packed = lz4_compress(raw)
+        if lz4_decompress(packed, len(raw)) != raw:
+            sys.exit("internal error: block at %d does not round-trip" % start)
+        if len(packed) < len(raw):
+            offsets.append(len(blocks))
+            blocks += packed
+        else:
+            offsets.append(len(blocks) | RAW_FLAG)
+            blocks += raw
+    offsets.append(len(blocks))
+    return bytes(blocks), offsets
+
+
+def c_bytes(data, indent="    "):
+    lines = []
+    for start in range(0, len(data), 16):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[start:start + 16]) + ",")
+    return "\n".join(lines)
+
+
+def c_words(words, indent="    "):
+    lines = []
+    for start in range(0, len(words), 6):
+        lines.append(indent + ", ".join("0x%08Xu" % w for w in words[start:start + 6]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("assets", nargs="+", metavar="name=path")
+    parser.add_argument("--block-size", type=int, default=1024,
+                        help="uncompressed bytes per block (default 1024, "
+                             "at most XIP_ZASSET_MAX_BLOCK_SIZE)")
+    parser.add_argument("--raw", action="store_true",
+                        help="also emit the uncompressed assets")
+    parser.add_argument("--guard", help="compile the output only if this macro is non-zero")
+    parser.add_argument("--out", required=True, help="output path without extension")
+    args = parser.parse_args()
+
+    if not 16 <= args.block_size <= 65535:
+        sys.exit("--block-size must be 16 to 65535")
+
+    base = os.path.basename(args.out)
+    guard_open = "#if (%s)\n\n" % args.guard if args.guard else ""
+    guard_close = "#endif /* %s */\n\n" % args.guard if args.guard else ""
+    source = ["/* Generated by scripts/xip_compress.py - do not edit. */\n\n",
+              "#include \"%s.h\"\n\n" % base, guard_open]
+    header = ["/* Generated by scripts/xip_compress.py - do not edit. */\n\n",
+              "#ifndef %s_H\n#define %s_H\n\n" % (base.upper(), base.upper()),
+              "#include \"xip_zasset.h\"\n\n", guard_open]
+
+    for spec in args.assets:
+        name, sep, path = spec.partition("=")
+        if not sep or not name.isidentifier():
+            sys.exit("bad asset '%s', expected name=path" % spec)
+        with open(path, "rb") as f:
+            data = f.read()
+        if not data:
+            sys.exit("%s is empty" % path)
+        blocks, offsets = compress_asset(data, args.block_size)
+        count = len(offsets) - 1
+
+        source.append("/* %s: %d bytes in %d blocks, %d bytes compressed */\n"
+                      % (path.replace(os.sep, "/"), len(data), count, len(blocks)))
+        source.append("static const uint8_t %s_blocks[%d] XIP_ASSET =\n{\n%s\n};\n\n"
+                      % (name, len(blocks), c_bytes(blocks)))
+        source.append("static const uint32_t %s_offsets[%d] XIP_ASSET =\n{\n%s\n};\n\n"
+                      % (name, count + 1, c_words(offsets)))
+        source.append("const xip_zasset_t %s =\n{\n" % name)
+        source.append("    .blocks = %s_blocks,\n    .offsets = %s_offsets,\n" % (name, name))
+        source.append("    .size = %du,\n    .block_size = %du,\n    .block_count = %du\n};\n\n"
+                      % (len(data), args.block_size, count))
+        header.append("extern const xip_zasset_t %s;\n" % name)
+        if args.raw:
+            source.append("const uint8_t %s_raw[%d] XIP_ASSET =\n{\n%s\n};\n\n"
+                          % (name, len(data), c_bytes(data)))
+            header.append("extern const uint8_t %s_raw[%d];\n" % (name, len(data)))
+
+        print("%-24s %7d -> %7d bytes (%.1f%%), %d blocks"
+              % (name, len(data), len(blocks), 100.0 * len(blocks) / len(data), count))
+
+    source.append(guard_close)
+    header += ["\n", guard_close, "#endif /* %s_H */\n" % base.upper()]
+
+    with open(args.out + ".c", "w") as f:
+        f.write("".join(source).rstrip("\n") + "\n")
+    with open(args.out + ".h", "w") as f:
+        f.write("".join(header).rstrip("\n") + "\n")
+
+
+if __name__ == "__main__":
+    main()
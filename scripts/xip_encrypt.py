@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+###############################################################################
+# File Name:   xip_encrypt.py
+#
+# Description: Post-build step that encrypts the external memory part of
+#              an Intel HEX image for the SMIF on-the-fly AES-128
+#              decryption set up by xip_crypto.c.
+#
+# Related Document: See README.md
+#
+###############################################################################
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such
+# system or application assumes all risk as well as any liability arising from
+# such use and indemnifies Cypress against all such liability.
+###############################################################################
+"""Encrypt the XIP part of an Intel HEX image for SMIF on-the-fly decryption.
+
+The SMIF decrypts an XIP read by XORing the data with the AES-128 encryption,
+under the key of its CRYPTO_KEY registers, of the 16-byte block
+{address of the 16-byte aligned block, 0, 0, 0} (four little-endian words).
+This script applies the same XOR to every data byte of the image between
+--start and --end (the XIP region by default). The key is given as the four
+32-bit words written to CRYPTO_KEY0..3, as in the XIP_CRYPTO_KEY Makefile
+variable.
+
+The image must contain the 16-byte marker of xip_crypto.c. It is used to tell
+a plaintext image from one that was already encrypted (the step then does
+nothing, so running it twice is harmless) and to detect a missing marker.
+"""
+
+import argparse
+import struct
+import sys
+
+MARKER = b"XIP_CRYPTO_CHECK"
+BLOCK = 16
+
+SBOX = bytes.fromhex(
+    "637c777bf26b6fc53001672bfed7ab76ca82c97dfa5947f0add4a2af9ca472c0"
+    "b7fd9326363ff7cc34a5e5f171d8311504c723c31896059a071280e2eb27b275"
+    "09832c1a1b6e5aa0523bd6b329e32f8453d100ed20fcb15b6acbbe394a4c58cf"
+    "d0efaafb434d338545f9027f503c9fa851a3408f929d38f5bcb6da2110fff3d2"
+    "cd0c13ec5f974417c4a77e3d645d197360814fdc222a908846eeb814de5e0bdb"
+    "e0323a0a4906245cc2d3ac629195e479e7c8376d8dd54ea96c56f4ea657aae08"
+    "ba78252e1ca6b4c6e8dd741f4bbd8b8a703eb5664803f60e613557b986c11d9e"
+    "e1f8981169d98e949b1e87e9ce5528df8ca1890dbfe6426841992d0fb054bb16")
+
+
+def xtime(b):
+    b <<= 1
+    return (b ^ 0x1B) & 0xFF if b & 0x100 else b
+
+
+def expand_key(key):
+    words = [list(key[i:i + 4]) for i in range(0, 16, 4)]
+    rcon = 1
+    for i in range(4, 44):
+        t = list(words[i - 1])
+        if i % 4 == 0:
+            t = [SBOX[b] for b in t[1:] + t[:1]]
+            t[0] ^= rcon
+            rcon = xtime(rcon)
+        words.append([a ^ b for a, b in zip(words[i - 4], t)])
+    return [sum(words[r * 4:r * 4 + 4], []) for r in range(11)]
+
+
+def aes128_encrypt(round_keys, block):
+    s = [a ^ b for a, b in zip(block, round_keys[0])]
+    for rnd in range(1, 11):
+        s = [SBOX[b] for b in s]
+        # ShiftRows on the column-major state
+        s = [s[(i + 4 * (i % 4)) % 16] for i in range(16)]
+        if rnd != 10:
+            mixed = []
+            for c in range(4):
+                a = s[4 * c:4 * c + 4]
+                x = a[0] ^ a[1] ^ a[2] ^ a[3]
+                mixed += [a[i] ^ x ^ xtime(a[i] ^ a[(i + 1) % 4])
+                          for i in range(4)]
+            s = mixed
+        s = [a ^ b for a, b in zip(s, round_keys[rnd])]
+    return bytes(s)
+
+
+class KeyStream:
+    def __init__(self, key_words):
+        self.round_keys = expand_key(struct.pack("<4I", *key_words))
+        self.cache = {}
+
+    def block(self, addr):
+        if addr not in self.cache:
+            self.cache[addr] = aes128_encrypt(
+                self.round_keys, struct.pack("<4I", addr, 0, 0, 0))
+        return self.cache[addr]
+
+    def xor(self, addr, data):
+        out = bytearray(data)
+        for i in range(len(out)):
+            a = addr + i
+            out[i] ^= self.block(a & ~(BLOCK - 1))[a % BLOCK]
+        return bytes(out)
+
+
+def read_hex(path):
+    """Return a list of [kind, address, data] records, addresses absolute."""
+    records = []
+    base = 0
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if not line:
+                continue
+            if not line.startswith(":"):
+                sys.exit("%s:%d: not an Intel HEX record" % (path, lineno))
+            raw = bytes.fromhex(line[1:])
+            if len(raw) < 5 or len(raw) != raw[0] + 5 or sum(raw) & 0xFF:
+                sys.exit("%s:%d: bad record" % (path, lineno))
+            kind = raw[3]
+            offset = (raw[1] << 8) | raw[2]
+            data = raw[4:-1]
+            if kind == 0x02:
+                base = ((data[0] << 8) | data[1]) << 4
+            elif kind == 0x04:
+                base = ((data[0] << 8) | data[1]) << 16
+            records.append([kind, offset, base + offset, data])
+    return records
+
+
+def write_hex(path, records):
+    with open(path, "w") as f:
+        for kind, offset, _, data in records:
+            raw = bytes((len(data), offset >> 8, offset & 0xFF, kind)) + data
+            f.write(":%s%02X\n" % (raw.hex().upper(), -sum(raw) & 0xFF))
+
+
+def find_marker(records, start, end, keystream):
+    """Return 'plain' or 'encrypted' from the first marker block found."""
+    mem = {}
+    for kind, _, addr, data in records:
+        if kind == 0x00 and start <= addr < end:
+            for i, b in enumerate(data):
+                mem[addr + i] = b
+    for addr in sorted(a for a in mem if a % BLOCK == 0):
+        block = bytes(mem.get(addr + i, -1) & 0xFF for i in range(BLOCK))
+        if block == MARKER:
+            return "plain"
+        if keystream.xor(addr, block) == MARKER:
+            return "encrypted"
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("hex", help="image to encrypt in place")
+    parser.add_argument("--key", nargs=4, required=True, metavar="WORD",
+                        help="CRYPTO_KEY0..3, e.g. 0x16157E2B ...")
+    parser.add_argument("--start", type=lambda x: int(x, 0),
+                        default=0x18000000, help="first encrypted address")
+    parser.add_argument("--end", type=lambda x: int(x, 0),
+                        default=0x20000000, help="end of the encrypted range")
+    parser.add_argument("--out", help="output file (default: in place)")
+    args = parser.parse_args()
+
+    keystream = KeyStream([int(w, 0) for w in args.key])
+    records = read_hex(args.hex)
+
+    state = find_marker(records, args.start, args.end, keystream)
+    if state is None:
+        sys.exit("%s: XIP_CRYPTO_CHECK marker not found; build with "
+                 "XIP_CRYPTO=1" % args.hex)
+    if state == "encrypted":
+        print("%s: already encrypted" % args.hex)
+        if args.out and args.out != args.hex:
+            write_hex(args.out, records)
+        return
+
+    count = 0
+    for record in records:
+        kind, _, addr, data = record
+        if kind == 0x00 and addr < args.end and addr + len(data) > args.start:
+            lo = max(addr, args.start) - addr
+            hi = min(addr + len(data), args.end) - addr
+            record[3] = (data[:lo] + keystream.xor(addr + lo, data[lo:hi]) +
+                         data[hi:])
+            count += hi - lo
+    write_hex(args.out or args.hex, records)
+    print("%s: encrypted %d bytes in 0x%08X-0x%08X"
+          % (args.out or args.hex, count, args.start, args.end))
+
+
+if __name__ == "__main__":
+    main()
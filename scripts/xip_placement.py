@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+###############################################################################
+# File Name:   xip_placement.py
+#
+# Description: Generates the hot/cold linker script fragments included by
+#              templates/*/linker.ld from a function execution profile.
+#              Hot functions stay in internal flash (and are reported as
+#              SRAM candidates), cold functions are moved into .cy_xip_code
+#              and ordered so that functions that call each other share
+#              SMIF cache lines.
+#
+# Related Document: See README.md
+#
+###############################################################################
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer of such
+# system or application assumes all risk as well as any liability arising from
+# such use and indemnifies Cypress against all such liability.
+###############################################################################
+"""Generate profile-guided XIP placement fragments.
+
+Inputs
+  profile   CSV, one entry per line, '#' starts a comment:
+              <function>,<count>     call counts (e.g. DWT/ITM trace)
+              0x<address>,<count>    PC samples (needs --nm to resolve)
+  --nm      output of 'arm-none-eabi-nm -S --defined-only <app>.elf'. Gives
+            function sizes, resolves PC samples and lists functions that
+            never showed up in the profile (count 0, i.e. coldest).
+  --edges   optional CSV '<caller>,<callee>,<count>'. Cold functions are
+            grouped with the Pettis-Hansen greedy merge so that callers and
+            callees end up next to each other in the same SMIF cache lines.
+  --pin-file
+            functions that must stay out of XIP, in the profile format
+            (counts ignored). Use a profile captured while XIP is disabled.
+
+Outputs (in --out, default xip_placement/)
+  xip_placement_hot.ld   hot functions, placed first in .text (internal flash)
+  xip_placement_cold.ld  cold functions, placed in .cy_xip_code (XIP)
+
+The application must be compiled with -ffunction-sections (ModusToolbox
+default) so that every function lives in its own .text.<name> section.
+"""
+
+import argparse
+import fnmatch
+import os
+import sys
+
+# Functions that must never be executed from XIP: startup and fault
+# handlers, the PDL/HAL/BSP (used before XIP is enabled and while the SMIF is
+# in MMIO mode), the FreeRTOS kernel and the C library routines they call.
+# The modules of this example use MMIO mode, so both their public API and
+# their static helpers are listed, as are the helpers of main.c that run
+# before XIP is enabled. A new module must add the prefixes of its functions
+# here. Other application code that runs in MMIO mode is added with
+# --pin/--pin-file.
+DEFAULT_PINNED = [
+    "Reset_Handler", "SystemInit", "*_Handler", "main",
+    "check_status", "check_address", "check_ram_address", "print_array",
+    "print_from_internal_ram",
+    "Cy_*", "cy_*", "cyhal_*", "_cyhal_*", "cybsp_*",
+    # Public API of the example modules
+    "smif_mmio_*", "xip_switch_*", "xip_read_mode_*", "flash_suspend_*",
+    "qspi_*", "smif_cache_*", "smart_write*", "erase_planner_*",
+    "write_coalesce_*", "flash_benchmark_*", "mem_slots_*", "kv_store_*",
+    "flash_log_*", "fast_boot_*", "smif_arb_*", "xip_crypto_*",
+    "flash_loader_*", "low_power_*", "flash_service_*", "wear_alloc_*",
+    "flash_verify_*",
+    # Static helpers of the example modules
+    "mmio_*", "tuning_*", "read_*", "planner_*", "coalesce_*", "bench_*",
+    "kv_*", "log_*", "slots_*", "async_*", "stream_*", "verify_*", "bus_*",
+    "cache_*", "suspend_*", "trace_*", "fb_*", "arb_*", "crypto_*",
+    "loader_*", "lp_*", "service_*", "wear_*", "demo_*", "workload",
+    "v[A-Z]*", "x[A-Z]*", "pv[A-Z]*", "ux[A-Z]*", "ul[A-Z]*", "prv*",
+    "mem*", "str*", "*printf*", "_*_r", "_write", "__aeabi_*", "__*",
+]
+
+# SMIF cache line size in bytes; each cold group starts on a line boundary.
+SMIF_CACHE_LINE = 16
+
+
+def strip_comment(line):
+    return line.split("#", 1)[0].strip()
+
+
+def read_nm(path):
+    """Return {name: (address, size)} for all defined functions."""
+    funcs = {}
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            # '<addr> <size> <type> <name>'; symbols without a size are
+            # labels or assembler entries and cannot be placed anyway.
+            if len(fields) != 4 or fields[2] not in ("T", "t", "W"):
+                continue
+            addr = int(fields[0], 16) & ~1
+            funcs[fields[3]] = (addr, int(fields[1], 16))
+    return funcs
+
+
+def resolve_address(funcs_by_addr, addr):
+    addr &= ~1
+    for start, size, name in funcs_by_addr:
+        if start <= addr < start + size:
+            return name
+    return None
+
+
+def read_profile(path, funcs):
+    counts = {}
+    funcs_by_addr = sorted((a, s, n) for n, (a, s) in funcs.items())
+    unresolved = 0
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = strip_comment(line)
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(",")]
+            try:
+                count = int(fields[1]) if len(fields) > 1 else 1
+            except ValueError:
+                sys.exit("%s:%d: bad count '%s'" % (path, lineno, fields[1]))
+            name = fields[0]
+            if name.lower().startswith("0x"):
+                if not funcs:
+                    sys.exit("%s:%d: PC samples require --nm" % (path, lineno))
+                name = resolve_address(funcs_by_addr, int(name, 16))
+                if name is None:
+                    unresolved += count
+                    continue
+            counts[name] = counts.get(name, 0) + count
+    if unresolved:
+        print("warning: %d samples outside known functions" % unresolved,
+              file=sys.stderr)
+    return counts
+
+
+def read_edges(path):
+    edges = {}
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = strip_comment(line)
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(",")]
+            if len(fields) != 3:
+                sys.exit("%s:%d: expected caller,callee,count" % (path, lineno))
+            key = tuple(sorted(fields[:2]))
+            edges[key] = edges.get(key, 0) + int(fields[2])
+    return edges
+
+
+def is_pinned(name, patterns):
+    return any(fnmatch.fnmatchcase(name, p) for p in patterns)
+
+
+def split_hot_cold(counts, coverage):
+    """Hot = smallest set of functions covering 'coverage' of all samples."""
+    total = sum(counts.values())
+    hot = []
+    covered = 0
+    for name, count in sorted(counts.items(), key=lambda x: (-x[1], x[0])):
+        if count == 0 or (total and covered >= coverage * total):
+            break
+        hot.append(name)
+        covered += count
+    return hot, covered, total
+
+
+def group_cold(cold, counts, edges):
+    """Pettis-Hansen: merge chains along the heaviest edges first."""
+    chain_of = {name: [name] for name in cold}
+    for (a, b), _ in sorted(edges.items(), key=lambda x: (-x[1], x[0])):
+        if a not in chain_of or b not in chain_of:
+            continue
+        ca, cb = chain_of[a], chain_of[b]
+        if ca is cb:
+            continue
+        merged = ca + cb
+        for name in merged:
+            chain_of[name] = merged
+    chains = []
+    seen = set()
+    for name in cold:
+        chain = chain_of[name]
+        if id(chain) not in seen:
+            seen.add(id(chain))
+            chains.append(chain)
+    # Busier groups first so they are closest to the start of the XIP region.
+    chains.sort(key=lambda c: (-sum(counts.get(n, 0) for n in c), c[0]))
+    return chains
+
+
+def write_fragment(path, header, groups, align):
+    with open(path, "w") as f:
+        f.write("/* Generated by scripts/xip_placement.py - do not edit.\n")
+        for line in header:
+            f.write(" * %s\n" % line)
+        f.write(" */\n")
+        for group in groups:
+            if align and len(groups) > 1:
+                f.write(". = ALIGN(%d);\n" % align)
+            for name in group:
+                f.write("*(.text.%s)\n" % name)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("profile")
+    parser.add_argument("--nm", help="arm-none-eabi-nm -S output")
+    parser.add_argument("--edges", help="caller,callee,count CSV")
+    parser.add_argument("--coverage", type=float, default=0.99,
+                        help="fraction of samples kept hot (default 0.99)")
+    parser.add_argument("--sram-budget", type=int, default=0,
+                        help="bytes of SRAM for APP_RAMFUNC candidates")
+    parser.add_argument("--pin", action="append", default=[],
+                        help="extra glob of functions never moved to XIP")
+    parser.add_argument("--pin-file", help="functions never moved to XIP")
+    parser.add_argument("--out", default="xip_placement")
+    args = parser.parse_args()
+
+    funcs = read_nm(args.nm) if args.nm else {}
+    counts = read_profile(args.profile, funcs)
+    for name in funcs:
+        counts.setdefault(name, 0)
+    edges = read_edges(args.edges) if args.edges else {}
+    pinned = DEFAULT_PINNED + args.pin
+    if args.pin_file:
+        pinned += list(read_profile(args.pin_file, funcs))
+
+    hot, covered, total = split_hot_cold(counts, args.coverage)
+    hot_set = set(hot)
+    cold = sorted((n for n in counts
+                   if n not in hot_set and not is_pinned(n, pinned)),
+                  key=lambda n: (-counts[n], n))
+    groups = group_cold(cold, counts, edges)
+
+    def size_of(names):
+        return sum(funcs.get(n, (0, 0))[1] for n in names)
+
+    os.makedirs(args.out, exist_ok=True)
+    write_fragment(os.path.join(args.out, "xip_placement_hot.ld"),
+                   ["%d functions, %d bytes, %d of %d samples"
+                    % (len(hot), size_of(hot), covered, total)],
+                   [hot], 0)
+    write_fragment(os.path.join(args.out, "xip_placement_cold.ld"),
+                   ["%d functions in %d groups, %d bytes"
+                    % (len(cold), len(groups), size_of(cold))],
+                   groups, SMIF_CACHE_LINE)
+
+    print("hot : %4d functions %7d bytes (%.1f%% of samples)"
+          % (len(hot), size_of(hot), 100.0 * covered / total if total else 0))
+    print("cold: %4d functions %7d bytes in %d groups -> .cy_xip_code"
+          % (len(cold), size_of(cold), len(groups)))
+
+    # Hot functions are placed by the linker in internal flash only: .data
+    # (and .cy_ramfunc within it) follows .text in the linker script, so it
+    # cannot claim .text.* sections. Report the densest ones to tag instead.
+    if args.sram_budget:
+        if not funcs:
+            sys.exit("--sram-budget requires --nm for function sizes")
+        used = 0
+        print("SRAM candidates (tag with APP_RAMFUNC from ramfunc.h):")
+        for name in sorted(hot, key=lambda n: (-counts[n] /
+                                                max(size_of([n]), 1), n)):
+            size = size_of([name])
+            if size == 0 or is_pinned(name, ["Reset_Handler", "main"]):
+                continue
+            if used + size > args.sram_budget:
+                continue
+            used += size
+            print("  %-40s %6d bytes %10d samples" % (name, size, counts[name]))
+        print("  total %d of %d bytes" % (used, args.sram_budget))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,329 @@
+/******************************************************************************
+* File Name:   smart_write.c
+*
+* Description: This file contains the erase-avoiding write. Before writing,
+*              each sector overlapped by the target range is blank-checked
+*              with a quick read-back, and only sectors that are not blank
+*              are erased, using the erase granularity reported by
+*              cy_serial_flash_qspi_get_erase_size().
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "smart_write.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define SMART_WRITE_DEMO_SECTORS        (4u)
+#define SMART_WRITE_DEMO_SIZE           (256u)
+
+/*******************************************************************************
+* Function Name: smart_write_is_blank
+****************************************************************************//**
+* Summary:
+*  Checks whether a range of the external memory is erased (all bytes 0xFF).
+*  The range is read back in SMART_WRITE_CHECK_CHUNK chunks and the check
+*  stops at the first programmed byte.
+*
+* Parameters:
+*  addr - start of the range.
+*  length - length of the range.
+*  blank - receives the result of the check.
+*
+*******************************************************************************/
+cy_rslt_t smart_write_is_blank(uint32_t addr, size_t length, bool *blank)
+{
+    uint32_t chunk[SMART_WRITE_CHECK_CHUNK / sizeof(uint32_t)];
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    *blank = true;
+
+    while((length > 0u) && *blank && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t size = (length < sizeof(chunk)) ? (uint32_t)length : sizeof(chunk);
+        const uint8_t *bytes = (const uint8_t *)chunk;
+
+        result = cy_serial_flash_qspi_read(addr, size, (uint8_t *)chunk);
+
+        for(uint32_t index = 0; (index < (size / sizeof(uint32_t))) && *blank; index++)
+        {
+            *blank = (0xFFFFFFFFu == chunk[index]);
+        }
+
+        for(uint32_t index = size & ~(sizeof(uint32_t) - 1u); (index < size) && *blank; index++)
+        {
+            *blank = (0xFFu == bytes[index]);
+        }
+
+        addr += size;
+        length -= size;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smart_write
+****************************************************************************//**
+* Summary:
+*  Writes data to the external memory, erasing only what is needed. For each
+*  sector overlapped by the range, the part inside the range is blank-checked;
+*  if it is not blank, the whole sector is erased, and its contents outside
+*  the range are lost, as with an erase followed by a write. Consecutive
+*  sectors that need erasing are erased with a single call, so that the
+*  serial-flash library can use its largest erase granularity (including a
+*  chip erase when the range covers the whole memory). Sectors that are
+*  already blank are left untouched. Must be called in MMIO mode.
+*
+* Parameters:
+*  addr - external memory address.
+*  length - number of bytes.
+*  buf - data to write.
+*  stats - counters updated by the call, may be NULL.
+*
+*******************************************************************************/
+cy_rslt_t smart_write(uint32_t addr, size_t length, const uint8_t *buf, smart_write_stats_t *stats)
+{
+    uint32_t end = addr + length;
+    uint32_t current = addr;
+    uint32_t erase_start = 0u;
+    uint32_t erase_size = 0u;
+    smart_write_stats_t local_stats = { 0u };
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if((NULL == buf) || (0u == length) || (end > cy_serial_flash_qspi_get_size()))
+    {
+        return SMART_WRITE_RSLT_ERR_BAD_PARAM;
+    }
+
+    while((current < end) && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(current);
+        uint32_t sector_start = current - (current % sector_size);
+        uint32_t sector_end = sector_start + sector_size;
+        uint32_t check_end = (end < sector_end) ? end : sector_end;
+        bool blank;
+
+        result = smart_write_is_blank(current, check_end - current, &blank);
+        local_stats.sectors_checked++;
+
+        if((CY_RSLT_SUCCESS == result) && !blank)
+        {
+            local_stats.sectors_erased++;
+
+            if((0u != erase_size) && ((erase_start + erase_size) == sector_start))
+            {
+                erase_size += sector_size;
+            }
+            else
+            {
+                if(0u != erase_size)
+                {
+                    result = cy_serial_flash_qspi_erase(erase_start, erase_size);
+                    local_stats.erase_calls++;
+                }
+
+                erase_start = sector_start;
+                erase_size = sector_size;
+            }
+        }
+
+        current = sector_end;
+    }
+
+    if((CY_RSLT_SUCCESS == result) && (0u != erase_size))
+    {
+        result = cy_serial_flash_qspi_erase(erase_start, erase_size);
+        local_stats.erase_calls++;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_write(addr, length, buf);
+    }
+
+    if(NULL != stats)
+    {
+        stats->sectors_checked += local_stats.sectors_checked;
+        stats->sectors_erased += local_stats.sectors_erased;
+        stats->erase_calls += local_stats.erase_calls;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: demo_write_sectors
+****************************************************************************//**
+* Summary:
+*  Writes the demo data to the start of each demo sector, either with an
+*  unconditional erase or with smart_write(), and returns the time taken.
+*
+*******************************************************************************/
+static cy_rslt_t demo_write_sectors(uint32_t ext_addr, uint32_t sector_size, const uint8_t *data, bool smart,
+                                    smart_write_stats_t *stats, uint32_t *cycles)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t start = cycle_counter_get();
+
+    memset(stats, 0, sizeof(*stats));
+
+    for(uint32_t sector = 0; (sector < SMART_WRITE_DEMO_SECTORS) && (CY_RSLT_SUCCESS == result); sector++)
+    {
+        uint32_t addr = ext_addr + (sector * sector_size);
+
+        if(smart)
+        {
+            result = smart_write(addr, SMART_WRITE_DEMO_SIZE, data, stats);
+        }
+        else
+        {
+            result = cy_serial_flash_qspi_erase(addr, sector_size);
+            stats->sectors_checked++;
+            stats->sectors_erased++;
+            stats->erase_calls++;
+
+            if(CY_RSLT_SUCCESS == result)
+            {
+                result = cy_serial_flash_qspi_write(addr, SMART_WRITE_DEMO_SIZE, data);
+            }
+        }
+    }
+
+    *cycles = cycle_counter_get() - start;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: demo_report
+****************************************************************************//**
+* Summary:
+*  Prints the result of one demo pass.
+*
+*******************************************************************************/
+static void demo_report(const char *name, const smart_write_stats_t *stats, uint32_t cycles)
+{
+    printf("  %-24s %"PRIu32" of %"PRIu32" sectors erased, %8"PRIu32" us\n", name, stats->sectors_erased,
+           stats->sectors_checked, cycle_counter_to_us(cycles));
+}
+
+/*******************************************************************************
+* Function Name: smart_write_demo
+****************************************************************************//**
+* Summary:
+*  Writes 256 bytes to the start of four sectors, first with an unconditional
+*  erase, then with smart_write() when all sectors hold data, and finally with
+*  smart_write() after two of the sectors have been erased. Must be called in
+*  MMIO mode.
+*
+* Parameters:
+*  ext_addr - start of four uniform sectors that may be erased.
+*
+*******************************************************************************/
+cy_rslt_t smart_write_demo(uint32_t ext_addr)
+{
+    static uint8_t data[SMART_WRITE_DEMO_SIZE];
+    static uint8_t readback[SMART_WRITE_DEMO_SIZE];
+    smart_write_stats_t stats;
+    uint32_t cycles;
+    uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(ext_addr);
+
+    if((0u != (ext_addr % sector_size)) ||
+       (sector_size != cy_serial_flash_qspi_get_erase_size(ext_addr + (SMART_WRITE_DEMO_SECTORS * sector_size) - 1u)))
+    {
+        return SMART_WRITE_RSLT_ERR_BAD_PARAM;
+    }
+
+    for(uint32_t index = 0; index < SMART_WRITE_DEMO_SIZE; index++)
+    {
+        data[index] = (uint8_t)(0xA5u ^ index);
+    }
+
+    cycle_counter_init();
+    printf("Writing %u bytes to %u sectors of %"PRIu32" KB:\n", (unsigned int)SMART_WRITE_DEMO_SIZE,
+           (unsigned int)SMART_WRITE_DEMO_SECTORS, sector_size / 1024u);
+
+    cy_rslt_t result = demo_write_sectors(ext_addr, sector_size, data, false, &stats, &cycles);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        demo_report("erase always:", &stats, cycles);
+        result = demo_write_sectors(ext_addr, sector_size, data, true, &stats, &cycles);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        demo_report("smart, all sectors used:", &stats, cycles);
+
+        /* Blank every other sector */
+        for(uint32_t sector = 0; (sector < SMART_WRITE_DEMO_SECTORS) && (CY_RSLT_SUCCESS == result); sector += 2u)
+        {
+            result = cy_serial_flash_qspi_erase(ext_addr + (sector * sector_size), sector_size);
+        }
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = demo_write_sectors(ext_addr, sector_size, data, true, &stats, &cycles);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        demo_report("smart, half blank:", &stats, cycles);
+
+        for(uint32_t sector = 0; (sector < SMART_WRITE_DEMO_SECTORS) && (CY_RSLT_SUCCESS == result); sector++)
+        {
+            result = cy_serial_flash_qspi_read(ext_addr + (sector * sector_size), SMART_WRITE_DEMO_SIZE, readback);
+
+            if((CY_RSLT_SUCCESS == result) && (0 != memcmp(data, readback, SMART_WRITE_DEMO_SIZE)))
+            {
+                result = SMART_WRITE_RSLT_ERR_VERIFY;
+            }
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
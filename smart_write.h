@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   smart_write.h
+*
+* Description: This file contains the declarations of the erase-avoiding
+*              write, which erases only the sectors that are not already
+*              blank.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SMART_WRITE_H
+#define SMART_WRITE_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the erase-avoidance demo before entering XIP mode */
+#ifndef SMART_WRITE_DEMO_ENABLE
+#define SMART_WRITE_DEMO_ENABLE         (0u)
+#endif
+
+/* Size of the chunks read back by the blank check */
+#define SMART_WRITE_CHECK_CHUNK         (256u)
+
+#define SMART_WRITE_RSLT_ERR_BAD_PARAM  APP_RSLT_ERR(APP_RSLT_RANGE_SMART_WRITE, 1u)
+#define SMART_WRITE_RSLT_ERR_VERIFY     APP_RSLT_ERR(APP_RSLT_RANGE_SMART_WRITE, 2u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t sectors_checked;   /* Sectors overlapped by the written ranges */
+    uint32_t sectors_erased;    /* Sectors that had to be erased */
+    uint32_t erase_calls;       /* cy_serial_flash_qspi_erase() calls */
+} smart_write_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t smart_write_is_blank(uint32_t addr, size_t length, bool *blank);
+cy_rslt_t smart_write(uint32_t addr, size_t length, const uint8_t *buf, smart_write_stats_t *stats);
+cy_rslt_t smart_write_demo(uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SMART_WRITE_H */
+
+/* [] END OF FILE */
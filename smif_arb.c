@@ -0,0 +1,1011 @@
+/******************************************************************************
+* File Name:   smif_arb.c
+*
+* Description: This file contains the dual-core SMIF arbiter. Both cores
+*              queue read, program and erase requests locally and take the
+*              SMIF in turns through an IPC semaphore. The core that takes
+*              the bus parks the other one in SRAM through an IPC interrupt
+*              before leaving XIP, so that no XIP fetch is issued while the
+*              SMIF is in MMIO mode. CM0+ requests take priority: the CM4
+*              hands the bus over between chunks.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+#include "ramfunc.h"
+#include "smif_arb.h"
+#include "smif_mmio.h"
+#include "xip_read_mode.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#if (CY_CPU_CORTEX_M0P)
+#define ARB_LOCAL                       (SMIF_ARB_CORE_CM0P)
+#define ARB_PEER                        (SMIF_ARB_CORE_CM4)
+#define ARB_LOCAL_INTR                  (SMIF_ARB_IPC_INTR_CM0P)
+#define ARB_PEER_INTR                   (SMIF_ARB_IPC_INTR_CM4)
+#else
+#define ARB_LOCAL                       (SMIF_ARB_CORE_CM4)
+#define ARB_PEER                        (SMIF_ARB_CORE_CM0P)
+#define ARB_LOCAL_INTR                  (SMIF_ARB_IPC_INTR_CM4)
+#define ARB_PEER_INTR                   (SMIF_ARB_IPC_INTR_CM0P)
+#endif
+
+/* Marks a valid shared state ("ARB1") */
+#define ARB_SHARED_MAGIC                (0x31425241u)
+
+/* Polling interval while waiting for a program or erase */
+#define ARB_BUSY_POLL_US                (10u)
+
+/* Demo: one sector erased, then programmed by several queued requests */
+#define ARB_DEMO_REQUESTS               (4u)
+#define ARB_DEMO_REQUEST_SIZE           (512u)
+#define ARB_DEMO_SIZE                   (ARB_DEMO_REQUESTS * ARB_DEMO_REQUEST_SIZE)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* State shared by the two cores. The CM4 owns it, because it initializes the
+ * SMIF, and publishes its address through the data register of
+ * SMIF_ARB_IPC_CHAN_SHARED. Each core only writes its own entries.
+ */
+typedef struct
+{
+    uint32_t magic;
+    volatile uint32_t online[SMIF_ARB_CORE_COUNT];      /* Park interrupt armed */
+    volatile uint32_t uses_xip[SMIF_ARB_CORE_COUNT];    /* Core may fetch from XIP */
+    volatile uint32_t want[SMIF_ARB_CORE_COUNT];        /* Core is waiting for or holds the bus */
+    volatile uint32_t park_req[SMIF_ARB_CORE_COUNT];    /* Written by the bus holder */
+    volatile uint32_t parked[SMIF_ARB_CORE_COUNT];      /* Written by the parked core */
+} arb_shared_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static cy_rslt_t arb_default_exit_xip(void);
+static cy_rslt_t arb_default_enter_xip(void);
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+#if !(CY_CPU_CORTEX_M0P)
+static arb_shared_t arb_shared_state;
+#endif
+
+static arb_shared_t *arb_shared = NULL;
+static smif_arb_mode_fn_t arb_exit_xip = arb_default_exit_xip;
+static smif_arb_mode_fn_t arb_enter_xip = arb_default_enter_xip;
+static smif_arb_stats_t arb_stats;
+
+static smif_arb_request_t *arb_queue[SMIF_ARB_QUEUE_DEPTH];
+static uint32_t arb_queue_head;
+static volatile uint32_t arb_queue_count;
+
+/* Set while the bus is held, if the SMIF was in XIP mode when it was taken */
+static bool arb_from_xip;
+
+#if (SMIF_ARB_DEMO_ENABLE)
+static uint8_t demo_tx[ARB_DEMO_SIZE];
+static uint8_t demo_rx[ARB_DEMO_SIZE];
+static smif_arb_request_t demo_requests[ARB_DEMO_REQUESTS + 1u];
+static volatile uint32_t demo_completed;
+#endif
+
+/*******************************************************************************
+* Function Name: arb_default_exit_xip
+****************************************************************************//**
+* Summary:
+*  Default mode switch, for memories that are not used in continuous read
+*  mode. The CM4 registers xip_read_mode_exit_xip() instead.
+*
+*******************************************************************************/
+static cy_rslt_t arb_default_exit_xip(void)
+{
+    Cy_SMIF_SetMode(SMIF0, CY_SMIF_NORMAL);
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: arb_default_enter_xip
+****************************************************************************//**
+* Summary:
+*  Default mode switch back to XIP.
+*
+*******************************************************************************/
+static cy_rslt_t arb_default_enter_xip(void)
+{
+    Cy_SMIF_SetMode(SMIF0, CY_SMIF_MEMORY);
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: arb_park_isr
+****************************************************************************//**
+* Summary:
+*  IPC interrupt handler, raised by the other core before it leaves XIP. It
+*  acknowledges the request and spins until the other core has returned to
+*  XIP. It runs from SRAM at the highest priority, and the IPC driver
+*  functions it calls are inlined, so the parked core issues no XIP fetch
+*  whatever it was running when interrupted.
+*
+*******************************************************************************/
+APP_RAMFUNC static void arb_park_isr(void)
+{
+    IPC_INTR_STRUCT_Type *intr = Cy_IPC_Drv_GetIntrBaseAddr(ARB_LOCAL_INTR);
+
+    Cy_IPC_Drv_ClearInterrupt(intr, CY_IPC_NO_NOTIFICATION, 1u << SMIF_ARB_IPC_CHAN_NOTIFY);
+    (void)Cy_IPC_Drv_GetInterruptStatusMasked(intr);
+
+    if((NULL != arb_shared) && (0u != arb_shared->park_req[ARB_LOCAL]))
+    {
+        arb_shared->parked[ARB_LOCAL] = 1u;
+        __DMB();
+
+        while(0u != arb_shared->park_req[ARB_LOCAL])
+        {
+        }
+
+        arb_shared->parked[ARB_LOCAL] = 0u;
+        __DMB();
+        arb_stats.parks++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: arb_enable_park_isr
+****************************************************************************//**
+* Summary:
+*  Routes the notifications of SMIF_ARB_IPC_CHAN_NOTIFY on the IPC interrupt
+*  structure of this core to arb_park_isr().
+*
+*******************************************************************************/
+static cy_rslt_t arb_enable_park_isr(void)
+{
+    IRQn_Type irq = (IRQn_Type)((uint32_t)cpuss_interrupts_ipc_0_IRQn + ARB_LOCAL_INTR);
+    cy_stc_sysint_t isr_config =
+    {
+#if (CY_CPU_CORTEX_M0P) && defined(CY_IP_M4CPUSS) && (CY_IP_M4CPUSS_VERSION == 1u)
+        .intrSrc = SMIF_ARB_CM0P_NVIC_MUX,
+        .cm0pSrc = (cy_en_intr_t)irq,
+#elif (CY_CPU_CORTEX_M0P)
+        /* Bits 0-15: NVIC mux line, bits 16-31: system interrupt */
+        .intrSrc = (IRQn_Type)(((uint32_t)irq << 16u) | (uint32_t)SMIF_ARB_CM0P_NVIC_MUX),
+#else
+        .intrSrc = irq,
+#endif
+        .intrPriority = 0u
+    };
+
+#if (CY_CPU_CORTEX_M0P)
+    irq = SMIF_ARB_CM0P_NVIC_MUX;
+#endif
+
+    Cy_IPC_Drv_SetInterruptMask(Cy_IPC_Drv_GetIntrBaseAddr(ARB_LOCAL_INTR), CY_IPC_NO_NOTIFICATION,
+                                1u << SMIF_ARB_IPC_CHAN_NOTIFY);
+
+    if(CY_SYSINT_SUCCESS != Cy_SysInt_Init(&isr_config, arb_park_isr))
+    {
+        return SMIF_ARB_RSLT_ERR_BAD_PARAM;
+    }
+
+    NVIC_ClearPendingIRQ(irq);
+    NVIC_EnableIRQ(irq);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: arb_attach_shared
+****************************************************************************//**
+* Summary:
+*  On the CM4, initializes and publishes the shared state. On the CM0+,
+*  attaches to the state published by the CM4.
+*
+*******************************************************************************/
+static cy_rslt_t arb_attach_shared(void)
+{
+    IPC_STRUCT_Type *chan = Cy_IPC_Drv_GetIpcBaseAddress(SMIF_ARB_IPC_CHAN_SHARED);
+
+#if (CY_CPU_CORTEX_M0P)
+    arb_shared_t *shared = (arb_shared_t *)Cy_IPC_Drv_ReadDataValue(chan);
+
+    if(!Cy_IPC_Drv_IsLockAcquired(chan) || (NULL == shared) || (ARB_SHARED_MAGIC != shared->magic))
+    {
+        return SMIF_ARB_RSLT_ERR_NOT_READY;
+    }
+
+    arb_shared = shared;
+#else
+    if(&arb_shared_state != arb_shared)
+    {
+        /* The lock stays held: it tells the CM0+ that the address is valid */
+        if(CY_IPC_DRV_SUCCESS != Cy_IPC_Drv_LockAcquire(chan))
+        {
+            return SMIF_ARB_RSLT_ERR_NOT_READY;
+        }
+
+        memset(&arb_shared_state, 0, sizeof(arb_shared_state));
+        arb_shared_state.magic = ARB_SHARED_MAGIC;
+        arb_shared = &arb_shared_state;
+        __DMB();
+        Cy_IPC_Drv_WriteDataValue(chan, (uint32_t)&arb_shared_state);
+    }
+#endif
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: arb_notify_peer
+****************************************************************************//**
+* Summary:
+*  Raises the park interrupt of the other core.
+*
+*******************************************************************************/
+APP_RAMFUNC static void arb_notify_peer(void)
+{
+    IPC_STRUCT_Type *chan = Cy_IPC_Drv_GetIpcBaseAddress(SMIF_ARB_IPC_CHAN_NOTIFY);
+
+    while(CY_IPC_DRV_SUCCESS != Cy_IPC_Drv_LockAcquire(chan))
+    {
+    }
+
+    Cy_IPC_Drv_AcquireNotify(chan, 1u << ARB_PEER_INTR);
+    (void)Cy_IPC_Drv_LockRelease(chan, CY_IPC_NO_NOTIFICATION);
+}
+
+/*******************************************************************************
+* Function Name: arb_wait_flag
+****************************************************************************//**
+* Summary:
+*  Waits for a flag written by the other core to take a value.
+*
+* Return:
+*  True if it did within SMIF_ARB_PARK_TIMEOUT_US.
+*
+*******************************************************************************/
+APP_RAMFUNC static bool arb_wait_flag(const volatile uint32_t *flag, uint32_t value)
+{
+    for(uint32_t waited = 0u; waited < SMIF_ARB_PARK_TIMEOUT_US; waited++)
+    {
+        if(value == *flag)
+        {
+            return true;
+        }
+
+        Cy_SysLib_DelayUs(1u);
+    }
+
+    return (value == *flag);
+}
+
+/*******************************************************************************
+* Function Name: arb_should_yield
+****************************************************************************//**
+* Summary:
+*  Returns true if the CM4 must hand the bus over to the CM0+.
+*
+*******************************************************************************/
+static inline bool arb_should_yield(void)
+{
+#if (CY_CPU_CORTEX_M0P)
+    return false;
+#else
+    return (0u != arb_shared->want[SMIF_ARB_CORE_CM0P]);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: arb_unpark_peer
+****************************************************************************//**
+* Summary:
+*  Lets the other core leave arb_park_isr() and waits until it has, so that a
+*  park request that follows cannot be acknowledged by the previous one.
+*
+*******************************************************************************/
+APP_RAMFUNC static void arb_unpark_peer(void)
+{
+    if(0u != arb_shared->park_req[ARB_PEER])
+    {
+        arb_shared->park_req[ARB_PEER] = 0u;
+        __DMB();
+        (void)arb_wait_flag(&arb_shared->parked[ARB_PEER], 0u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: arb_release
+****************************************************************************//**
+* Summary:
+*  Invalidates the SMIF cache if the memory was modified, returns to XIP if
+*  the bus was taken in XIP mode, releases the other core and gives the bus
+*  up.
+*
+*******************************************************************************/
+APP_RAMFUNC static cy_rslt_t arb_release(bool modified, uint32_t interrupt_state)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if(modified)
+    {
+        /* Both cores read the external memory through the same cache */
+        (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+    }
+
+    if(arb_from_xip)
+    {
+        result = arb_enter_xip();
+        arb_from_xip = false;
+    }
+
+    arb_unpark_peer();
+
+#if (SMIF_ARB_MASK_INTERRUPTS)
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+#else
+    (void)interrupt_state;
+#endif
+
+    (void)Cy_IPC_Sema_Clear(SMIF_ARB_IPC_SEMA_NUM, false);
+    arb_shared->want[ARB_LOCAL] = 0u;
+    __DMB();
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: arb_acquire
+****************************************************************************//**
+* Summary:
+*  Takes the bus: waits for the semaphore (on the CM4, also until no CM0+
+*  request is waiting), parks the other core if it may fetch from XIP, and
+*  switches the SMIF to MMIO mode. The wait itself runs with interrupts
+*  enabled, so that this core can still be parked by the other one.
+*
+* Parameters:
+*  interrupt_state - receives the state to pass to arb_release().
+*
+*******************************************************************************/
+APP_RAMFUNC static cy_rslt_t arb_acquire(uint32_t *interrupt_state)
+{
+    uint32_t waited = 0u;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    arb_shared->want[ARB_LOCAL] = 1u;
+    __DMB();
+
+    while(arb_should_yield() || (CY_IPC_SEMA_SUCCESS != Cy_IPC_Sema_Set(SMIF_ARB_IPC_SEMA_NUM, false)))
+    {
+        Cy_SysLib_DelayUs(1u);
+        waited++;
+    }
+
+#if (SMIF_ARB_MASK_INTERRUPTS)
+    *interrupt_state = Cy_SysLib_EnterCriticalSection();
+#else
+    *interrupt_state = 0u;
+#endif
+
+    arb_stats.grants++;
+    arb_stats.max_wait_us = (waited > arb_stats.max_wait_us) ? waited : arb_stats.max_wait_us;
+    arb_from_xip = (CY_SMIF_MEMORY == Cy_SMIF_GetMode(SMIF0));
+
+    if(arb_from_xip && (0u != arb_shared->online[ARB_PEER]) && (0u != arb_shared->uses_xip[ARB_PEER]))
+    {
+        arb_shared->park_req[ARB_PEER] = 1u;
+        __DMB();
+        arb_notify_peer();
+
+        if(!arb_wait_flag(&arb_shared->parked[ARB_PEER], 1u))
+        {
+            /* The other core runs with interrupts masked; try again later */
+            arb_stats.park_timeouts++;
+            arb_from_xip = false;
+            result = SMIF_ARB_RSLT_ERR_PARK_TIMEOUT;
+        }
+    }
+
+    if((CY_RSLT_SUCCESS == result) && arb_from_xip)
+    {
+        result = arb_exit_xip();
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            /* Still in XIP mode, nothing to restore */
+            arb_from_xip = false;
+        }
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        (void)arb_release(false, *interrupt_state);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: arb_wait_ready
+****************************************************************************//**
+* Summary:
+*  Waits for the end of a program or erase.
+*
+*******************************************************************************/
+static cy_rslt_t arb_wait_ready(void)
+{
+    for(uint32_t polls = 0u; polls < ((SMIF_ARB_BUSY_TIMEOUT_MS * 1000u) / ARB_BUSY_POLL_US); polls++)
+    {
+        if(!smif_mmio_is_busy())
+        {
+            return CY_RSLT_SUCCESS;
+        }
+
+        Cy_SysLib_DelayUs(ARB_BUSY_POLL_US);
+    }
+
+    return SMIF_ARB_RSLT_ERR_BUSY_TIMEOUT;
+}
+
+/*******************************************************************************
+* Function Name: arb_erase_size
+****************************************************************************//**
+* Summary:
+*  Returns the size of the sector at the given address from the sector map of
+*  the memory, or 0 if the address is outside the memory.
+*
+*******************************************************************************/
+static uint32_t arb_erase_size(uint32_t addr)
+{
+    const cy_stc_smif_mem_config_t *mem_config = smif_mmio_get_mem_config();
+
+    if(NULL == mem_config)
+    {
+        return 0u;
+    }
+
+    const cy_stc_smif_mem_device_cfg_t *device = mem_config->deviceCfg;
+
+    for(uint32_t index = 0; index < device->hybridRegionCount; index++)
+    {
+        const cy_stc_smif_hybrid_region_info_t *region = device->hybridRegionInfo[index];
+
+        if((addr >= region->regionAddress) &&
+           (addr < (region->regionAddress + (region->sectorsCount * region->eraseSize))))
+        {
+            return region->eraseSize;
+        }
+    }
+
+    return (addr < device->memSize) ? device->eraseSize : 0u;
+}
+
+/*******************************************************************************
+* Function Name: arb_run_chunk
+****************************************************************************//**
+* Summary:
+*  Runs the next chunk of a request in MMIO mode: up to SMIF_ARB_MAX_CHUNK
+*  bytes of a read, up to the next page boundary of a program, or the whole
+*  sector erase.
+*
+*******************************************************************************/
+static cy_rslt_t arb_run_chunk(smif_arb_request_t *request)
+{
+    cy_rslt_t result;
+    uint32_t addr = request->addr + request->done;
+    uint32_t length = request->length - request->done;
+
+    switch(request->op)
+    {
+        case SMIF_ARB_OP_READ:
+            length = (length > SMIF_ARB_MAX_CHUNK) ? SMIF_ARB_MAX_CHUNK : length;
+            result = smif_mmio_read(addr, &request->buf[request->done], length);
+            break;
+
+        case SMIF_ARB_OP_PROGRAM:
+        {
+            uint32_t page_size = smif_mmio_get_page_size();
+            uint32_t page_left = page_size - (addr % page_size);
+
+            length = (length > page_left) ? page_left : length;
+            length = (length > SMIF_ARB_MAX_CHUNK) ? SMIF_ARB_MAX_CHUNK : length;
+            result = smif_mmio_program_start(addr, &request->buf[request->done], length);
+
+            if(CY_RSLT_SUCCESS == result)
+            {
+                result = arb_wait_ready();
+            }
+            break;
+        }
+
+        default:
+            result = smif_mmio_sector_erase_start(addr);
+
+            if(CY_RSLT_SUCCESS == result)
+            {
+                result = arb_wait_ready();
+            }
+            break;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        request->done += length;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: arb_dequeue
+****************************************************************************//**
+* Summary:
+*  Removes the request at the head of the local queue.
+*
+*******************************************************************************/
+static void arb_dequeue(void)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    arb_queue_head = (arb_queue_head + 1u) % SMIF_ARB_QUEUE_DEPTH;
+    arb_queue_count--;
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_init
+****************************************************************************//**
+* Summary:
+*  Initializes the arbiter on the calling core. The CM4 must call it first:
+*  on the CM0+ it fails with SMIF_ARB_RSLT_ERR_NOT_READY until the CM4 has
+*  published the shared state, and should be retried. From then on, every
+*  access of the calling core to the external memory in MMIO mode must go
+*  through the arbiter.
+*
+* Parameters:
+*  mem_config - memory accessed, as initialized by the CM4.
+*  uses_xip - true if this core runs code or reads data from XIP addresses.
+*  Such a core is parked while the other one holds the bus.
+*
+*******************************************************************************/
+cy_rslt_t smif_arb_init(const cy_stc_smif_mem_config_t *mem_config, bool uses_xip)
+{
+    uint32_t interrupt_state;
+
+    if(NULL == mem_config)
+    {
+        return SMIF_ARB_RSLT_ERR_BAD_PARAM;
+    }
+
+    cy_rslt_t result = smif_mmio_init(mem_config);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = arb_attach_shared();
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = arb_enable_park_isr();
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    arb_queue_head = 0u;
+    arb_queue_count = 0u;
+    memset(&arb_stats, 0, sizeof(arb_stats));
+
+    /* Come online while holding the semaphore, so that the other core does not
+     * see this core half way through an operation.
+     */
+    arb_shared->want[ARB_LOCAL] = 1u;
+
+    while(CY_IPC_SEMA_SUCCESS != Cy_IPC_Sema_Set(SMIF_ARB_IPC_SEMA_NUM, false))
+    {
+        Cy_SysLib_DelayUs(1u);
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    arb_shared->uses_xip[ARB_LOCAL] = uses_xip ? 1u : 0u;
+    arb_shared->online[ARB_LOCAL] = 1u;
+    __DMB();
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    (void)Cy_IPC_Sema_Clear(SMIF_ARB_IPC_SEMA_NUM, false);
+    arb_shared->want[ARB_LOCAL] = 0u;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_set_mode_hooks
+****************************************************************************//**
+* Summary:
+*  Sets the functions that leave and enter XIP while this core holds the bus.
+*  The defaults only switch the SMIF mode. The CM4 registers
+*  xip_read_mode_exit_xip() and xip_read_mode_enter_xip(); a CM0+ that shares
+*  a memory used in continuous read mode must do the same.
+*
+* Parameters:
+*  exit_xip - switch to MMIO mode, NULL for the default.
+*  enter_xip - switch to XIP mode, NULL for the default.
+*
+*******************************************************************************/
+void smif_arb_set_mode_hooks(smif_arb_mode_fn_t exit_xip, smif_arb_mode_fn_t enter_xip)
+{
+    arb_exit_xip = (NULL != exit_xip) ? exit_xip : arb_default_exit_xip;
+    arb_enter_xip = (NULL != enter_xip) ? enter_xip : arb_default_enter_xip;
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_peer_online
+****************************************************************************//**
+* Summary:
+*  Returns true if the other core has initialized its side of the arbiter.
+*  Otherwise, the bus is taken without the park handshake.
+*
+*******************************************************************************/
+bool smif_arb_peer_online(void)
+{
+    return (NULL != arb_shared) && (0u != arb_shared->online[ARB_PEER]);
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_submit
+****************************************************************************//**
+* Summary:
+*  Adds a request to the queue of the calling core. Can be called from an
+*  interrupt handler. The request runs in the next smif_arb_process() call.
+*
+* Parameters:
+*  request - request to queue. It and its buffer must remain valid until its
+*  callback has run. An erase must cover exactly one sector: its address is
+*  the start of a sector and its length the size of that sector.
+*
+*******************************************************************************/
+cy_rslt_t smif_arb_submit(smif_arb_request_t *request)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if((NULL == request) || (0u == request->length) || (request->op > SMIF_ARB_OP_ERASE) ||
+       ((SMIF_ARB_OP_ERASE != request->op) && (NULL == request->buf)))
+    {
+        return SMIF_ARB_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(NULL == arb_shared)
+    {
+        return SMIF_ARB_RSLT_ERR_NOT_INIT;
+    }
+
+    if(SMIF_ARB_OP_ERASE == request->op)
+    {
+        uint32_t erase_size = arb_erase_size(request->addr);
+
+        if((0u == erase_size) || (0u != (request->addr % erase_size)) || (request->length != erase_size))
+        {
+            return SMIF_ARB_RSLT_ERR_BAD_PARAM;
+        }
+    }
+
+    request->done = 0u;
+    request->result = CY_RSLT_SUCCESS;
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    if(arb_queue_count < SMIF_ARB_QUEUE_DEPTH)
+    {
+        arb_queue[(arb_queue_head + arb_queue_count) % SMIF_ARB_QUEUE_DEPTH] = request;
+        arb_queue_count++;
+    }
+    else
+    {
+        result = SMIF_ARB_RSLT_ERR_FULL;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_process
+****************************************************************************//**
+* Summary:
+*  Runs the queued requests of the calling core in order, taking the bus for
+*  each of them. On the CM4, the bus is given up between chunks whenever the
+*  CM0+ waits for it, and the request continues once the CM0+ is done. The
+*  result of each request is stored in it before its callback runs, with the
+*  bus released and interrupts enabled.
+*
+* Return:
+*  CY_RSLT_SUCCESS once the queue is empty, SMIF_ARB_RSLT_ERR_PARK_TIMEOUT if
+*  the other core did not park (the requests stay queued; call again later).
+*
+*******************************************************************************/
+cy_rslt_t smif_arb_process(void)
+{
+    uint32_t interrupt_state;
+
+    if(NULL == arb_shared)
+    {
+        return SMIF_ARB_RSLT_ERR_NOT_INIT;
+    }
+
+    while(0u != arb_queue_count)
+    {
+        smif_arb_request_t *request = arb_queue[arb_queue_head];
+        cy_rslt_t result = arb_acquire(&interrupt_state);
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        do
+        {
+            result = arb_run_chunk(request);
+        } while((CY_RSLT_SUCCESS == result) && (request->done < request->length) && !arb_should_yield());
+
+        cy_rslt_t release_result = arb_release(SMIF_ARB_OP_READ != request->op, interrupt_state);
+        result = (CY_RSLT_SUCCESS != result) ? result : release_result;
+
+        if((CY_RSLT_SUCCESS != result) || (request->done >= request->length))
+        {
+            arb_dequeue();
+            arb_stats.requests++;
+            request->result = result;
+
+            if(NULL != request->callback)
+            {
+                request->callback(request);
+            }
+        }
+        else
+        {
+            arb_stats.yields++;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_is_idle
+****************************************************************************//**
+* Summary:
+*  Returns true if the queue of the calling core is empty.
+*
+*******************************************************************************/
+bool smif_arb_is_idle(void)
+{
+    return (0u == arb_queue_count);
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_transfer
+****************************************************************************//**
+* Summary:
+*  Runs a single request and waits for it. The queue of the calling core must
+*  be empty.
+*
+* Parameters:
+*  op - operation.
+*  addr - address in the memory.
+*  buf - data for reads and programs, NULL for erases.
+*  length - number of bytes; for erases, the size of the sector.
+*
+*******************************************************************************/
+cy_rslt_t smif_arb_transfer(smif_arb_op_t op, uint32_t addr, uint8_t *buf, uint32_t length)
+{
+    smif_arb_request_t request =
+    {
+        .op = op, .addr = addr, .buf = buf, .length = length, .callback = NULL, .arg = NULL
+    };
+
+    if(!smif_arb_is_idle())
+    {
+        return SMIF_ARB_RSLT_ERR_FULL;
+    }
+
+    cy_rslt_t result = smif_arb_submit(&request);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = smif_arb_process();
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            /* The request lives on this stack frame and cannot stay queued */
+            arb_dequeue();
+        }
+        else
+        {
+            result = request.result;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_arb_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the counters of the calling core.
+*
+*******************************************************************************/
+void smif_arb_get_stats(smif_arb_stats_t *stats)
+{
+    if(NULL != stats)
+    {
+        *stats = arb_stats;
+    }
+}
+
+#if (SMIF_ARB_DEMO_ENABLE)
+/*******************************************************************************
+* Function Name: demo_callback
+****************************************************************************//**
+* Summary:
+*  Counts the demo requests that completed successfully.
+*
+*******************************************************************************/
+static void demo_callback(smif_arb_request_t *request)
+{
+    if(CY_RSLT_SUCCESS == request->result)
+    {
+        demo_completed++;
+    }
+}
+#endif
+
+/*******************************************************************************
+* Function Name: smif_arb_demo
+****************************************************************************//**
+* Summary:
+*  Initializes the CM4 side of the arbiter, then queues the erase of a sector
+*  and several programs to it, as a logger offloaded to another core would,
+*  and processes them while running in XIP mode. The data is checked through
+*  an arbitrated read and through its XIP address, which also checks that the
+*  SMIF cache was invalidated. Must be called in XIP mode, after
+*  xip_read_mode_init().
+*
+* Parameters:
+*  mem_config - memory configuration.
+*  ext_addr - address of a sector in the memory that may be erased.
+*
+*******************************************************************************/
+cy_rslt_t smif_arb_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr)
+{
+#if (SMIF_ARB_DEMO_ENABLE) && !(CY_CPU_CORTEX_M0P)
+    smif_arb_stats_t stats;
+
+    cy_rslt_t result = smif_arb_init(mem_config, true);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    smif_arb_set_mode_hooks(xip_read_mode_exit_xip, xip_read_mode_enter_xip);
+    printf("\nCM0+ side of the arbiter: %s\n", smif_arb_peer_online() ? "online" : "not running, no parking");
+
+    for(uint32_t index = 0; index < ARB_DEMO_SIZE; index++)
+    {
+        demo_tx[index] = (uint8_t)((index * 7u) ^ (index >> 8u));
+    }
+
+    demo_completed = 0u;
+    memset(demo_requests, 0, sizeof(demo_requests));
+    demo_requests[0].op = SMIF_ARB_OP_ERASE;
+    demo_requests[0].addr = ext_addr;
+    demo_requests[0].length = arb_erase_size(ext_addr);
+
+    for(uint32_t index = 1u; index <= ARB_DEMO_REQUESTS; index++)
+    {
+        demo_requests[index].op = SMIF_ARB_OP_PROGRAM;
+        demo_requests[index].addr = ext_addr + ((index - 1u) * ARB_DEMO_REQUEST_SIZE);
+        demo_requests[index].buf = &demo_tx[(index - 1u) * ARB_DEMO_REQUEST_SIZE];
+        demo_requests[index].length = ARB_DEMO_REQUEST_SIZE;
+    }
+
+    for(uint32_t index = 0u; (index <= ARB_DEMO_REQUESTS) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        demo_requests[index].callback = demo_callback;
+        result = smif_arb_submit(&demo_requests[index]);
+    }
+
+    uint32_t start = cycle_counter_get();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = smif_arb_process();
+    }
+
+    uint32_t cycles = cycle_counter_get() - start;
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if(demo_completed != (ARB_DEMO_REQUESTS + 1u))
+    {
+        return SMIF_ARB_RSLT_ERR_VERIFY;
+    }
+
+    result = smif_arb_transfer(SMIF_ARB_OP_READ, ext_addr, demo_rx, ARB_DEMO_SIZE);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if((0 != memcmp(demo_rx, demo_tx, ARB_DEMO_SIZE)) ||
+       (0 != memcmp((const void *)(mem_config->baseAddress + ext_addr), demo_tx, ARB_DEMO_SIZE)))
+    {
+        return SMIF_ARB_RSLT_ERR_VERIFY;
+    }
+
+    smif_arb_get_stats(&stats);
+    printf("Erase and %"PRIu32" programs of %"PRIu32" bytes through the arbiter: %"PRIu32" us\n",
+           (uint32_t)ARB_DEMO_REQUESTS, (uint32_t)ARB_DEMO_REQUEST_SIZE, cycle_counter_to_us(cycles));
+    printf("Requests %"PRIu32", bus grants %"PRIu32", yields to CM0+ %"PRIu32", parks %"PRIu32
+           ", park timeouts %"PRIu32", longest wait %"PRIu32" us\n", stats.requests, stats.grants, stats.yields,
+           stats.parks, stats.park_timeouts, stats.max_wait_us);
+    printf("Data read back in MMIO and XIP mode matches\n");
+
+    return CY_RSLT_SUCCESS;
+#else
+    (void)mem_config;
+    (void)ext_addr;
+    return CY_RSLT_SUCCESS;
+#endif
+}
+
+/* [] END OF FILE */
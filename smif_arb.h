@@ -0,0 +1,197 @@
+/******************************************************************************
+* File Name:   smif_arb.h
+*
+* Description: This file contains the macros, data types and function
+*              declarations of the dual-core SMIF arbiter.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef SMIF_ARB_H
+#define SMIF_ARB_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the arbiter demo in XIP mode */
+#ifndef SMIF_ARB_DEMO_ENABLE
+#define SMIF_ARB_DEMO_ENABLE            (0u)
+#endif
+
+/* IPC semaphore that owns the SMIF. The first semaphores are used by the PDL
+ * (flash driver, IPC pipes), so pick one above them that is free on both cores.
+ */
+#ifndef SMIF_ARB_IPC_SEMA_NUM
+#define SMIF_ARB_IPC_SEMA_NUM           (16u)
+#endif
+
+/* IPC channel whose data register publishes the shared state to the CM0+,
+ * and the channel used to notify a core that it must park.
+ */
+#ifndef SMIF_ARB_IPC_CHAN_SHARED
+#define SMIF_ARB_IPC_CHAN_SHARED        (CY_IPC_CHAN_USER)
+#endif
+
+#ifndef SMIF_ARB_IPC_CHAN_NOTIFY
+#define SMIF_ARB_IPC_CHAN_NOTIFY        (CY_IPC_CHAN_USER + 1u)
+#endif
+
+/* IPC interrupt structures that deliver the park notification to each core */
+#ifndef SMIF_ARB_IPC_INTR_CM0P
+#define SMIF_ARB_IPC_INTR_CM0P          (CY_IPC_INTR_USER)
+#endif
+
+#ifndef SMIF_ARB_IPC_INTR_CM4
+#define SMIF_ARB_IPC_INTR_CM4           (CY_IPC_INTR_USER + 1u)
+#endif
+
+/* NVIC mux line of the CM0+ used for its IPC interrupt */
+#ifndef SMIF_ARB_CM0P_NVIC_MUX
+#define SMIF_ARB_CM0P_NVIC_MUX          (NvicMux3_IRQn)
+#endif
+
+/* Requests queued per core */
+#ifndef SMIF_ARB_QUEUE_DEPTH
+#define SMIF_ARB_QUEUE_DEPTH            (8u)
+#endif
+
+/* Largest read issued while holding the bus. Reads and programs are split in
+ * chunks of at most this size (programs also at page boundaries), and the CM4
+ * hands the bus over to a waiting CM0+ between chunks.
+ */
+#ifndef SMIF_ARB_MAX_CHUNK
+#define SMIF_ARB_MAX_CHUNK              (256u)
+#endif
+
+/* Time to wait for the other core to park, and for a program or erase */
+#define SMIF_ARB_PARK_TIMEOUT_US        (1000u)
+#define SMIF_ARB_BUSY_TIMEOUT_MS        (3000u)
+
+/* Set to 1 to mask the interrupts of the core that holds the bus, so that its
+ * own interrupt handlers cannot fetch from the external memory while the SMIF
+ * is in MMIO mode. Set to 0 only if no handler of that core runs from XIP.
+ */
+#ifndef SMIF_ARB_MASK_INTERRUPTS
+#define SMIF_ARB_MASK_INTERRUPTS        (1u)
+#endif
+
+#define SMIF_ARB_RSLT_ERR_BAD_PARAM     APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_ARB, 1u)
+#define SMIF_ARB_RSLT_ERR_NOT_INIT      APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_ARB, 2u)
+#define SMIF_ARB_RSLT_ERR_NOT_READY     APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_ARB, 3u)
+#define SMIF_ARB_RSLT_ERR_FULL          APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_ARB, 4u)
+#define SMIF_ARB_RSLT_ERR_PARK_TIMEOUT  APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_ARB, 5u)
+#define SMIF_ARB_RSLT_ERR_BUSY_TIMEOUT  APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_ARB, 6u)
+#define SMIF_ARB_RSLT_ERR_VERIFY        APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_ARB, 7u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef enum
+{
+    SMIF_ARB_CORE_CM0P,
+    SMIF_ARB_CORE_CM4,
+    SMIF_ARB_CORE_COUNT
+} smif_arb_core_t;
+
+typedef enum
+{
+    SMIF_ARB_OP_READ,
+    SMIF_ARB_OP_PROGRAM,            /* Any length; split at page boundaries */
+    SMIF_ARB_OP_ERASE               /* One sector; length is its size */
+} smif_arb_op_t;
+
+struct smif_arb_request;
+
+/* Called from smif_arb_process() when a request completes or fails */
+typedef void (*smif_arb_callback_t)(struct smif_arb_request *request);
+
+/* Switches the SMIF from XIP to MMIO mode and back. They run with the bus held
+ * and the other core parked, and must not execute from the external memory.
+ */
+typedef cy_rslt_t (*smif_arb_mode_fn_t)(void);
+
+/* Owned by the caller until its callback has run */
+typedef struct smif_arb_request
+{
+    smif_arb_op_t op;
+    uint32_t addr;                  /* Address in the memory (not the XIP address) */
+    uint8_t *buf;                   /* Data for reads and programs */
+    uint32_t length;
+    smif_arb_callback_t callback;   /* May be NULL */
+    void *arg;
+    uint32_t done;                  /* Bytes completed, set by the arbiter */
+    cy_rslt_t result;               /* Set by the arbiter before the callback */
+} smif_arb_request_t;
+
+typedef struct
+{
+    uint32_t requests;              /* Requests completed */
+    uint32_t grants;                /* Times this core took the bus */
+    uint32_t yields;                /* Times the CM4 handed the bus to the CM0+ mid-request */
+    uint32_t parks;                 /* Times this core parked for the other one */
+    uint32_t park_timeouts;         /* Bus grants abandoned because the other core did not park */
+    uint32_t max_wait_us;           /* Longest wait for the bus */
+} smif_arb_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t smif_arb_init(const cy_stc_smif_mem_config_t *mem_config, bool uses_xip);
+void smif_arb_set_mode_hooks(smif_arb_mode_fn_t exit_xip, smif_arb_mode_fn_t enter_xip);
+bool smif_arb_peer_online(void);
+cy_rslt_t smif_arb_submit(smif_arb_request_t *request);
+cy_rslt_t smif_arb_process(void);
+bool smif_arb_is_idle(void);
+cy_rslt_t smif_arb_transfer(smif_arb_op_t op, uint32_t addr, uint8_t *buf, uint32_t length);
+void smif_arb_get_stats(smif_arb_stats_t *stats);
+cy_rslt_t smif_arb_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SMIF_ARB_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,348 @@
+/******************************************************************************
+* File Name:   smif_cache.c
+*
+* Description: This file contains the SMIF cache instrumentation. The fast
+*              cache serves the CM4 (fast AHB master) and the slow cache
+*              serves the CM0+, DMA and Crypto (slow AHB masters); each can
+*              be enabled and have prefetching toggled here. Because the SMIF
+*              has no hit or miss counters, hit rates are estimated by timing
+*              a workload with the caches disabled, cold and warm.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "smif_cache.h"
+#include "ramfunc.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define SMIF_CACHE_DEMO_SMALL_SIZE      (4096u)     /* Fits in the cache */
+#define SMIF_CACHE_DEMO_LARGE_SIZE      (65536u)    /* Larger than the cache */
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    const volatile uint32_t *base;
+    uint32_t words;
+    uint32_t wrap_mask;     /* Word index mask, to sweep a small buffer repeatedly */
+    uint32_t sum;
+} demo_sweep_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static uint32_t demo_sram[SMIF_CACHE_DEMO_SMALL_SIZE / sizeof(uint32_t)];
+
+/*******************************************************************************
+* Function Name: smif_cache_configure
+****************************************************************************//**
+* Summary:
+*  Enables or disables a SMIF cache and its prefetching. The fast cache
+*  serves the CM4; the slow cache serves the CM0+, DMA and Crypto.
+*
+* Parameters:
+*  cache - CY_SMIF_CACHE_FAST, CY_SMIF_CACHE_SLOW or CY_SMIF_CACHE_BOTH.
+*  enable - true to enable the cache.
+*  prefetch - true to prefetch the next line on a miss; ignored if the cache
+*             is disabled.
+*
+*******************************************************************************/
+cy_rslt_t smif_cache_configure(cy_en_smif_cache_t cache, bool enable, bool prefetch)
+{
+    cy_en_smif_status_t status;
+
+    if((CY_SMIF_CACHE_FAST != cache) && (CY_SMIF_CACHE_SLOW != cache) && (CY_SMIF_CACHE_BOTH != cache))
+    {
+        return SMIF_CACHE_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(enable)
+    {
+        status = Cy_SMIF_CacheEnable(SMIF0, cache);
+
+        if(CY_SMIF_SUCCESS == status)
+        {
+            status = prefetch ? Cy_SMIF_CachePrefetchingEnable(SMIF0, cache) :
+                     Cy_SMIF_CachePrefetchingDisable(SMIF0, cache);
+        }
+    }
+    else
+    {
+        status = Cy_SMIF_CacheDisable(SMIF0, cache);
+    }
+
+    return (CY_SMIF_SUCCESS == status) ? CY_RSLT_SUCCESS : SMIF_CACHE_RSLT_ERR_CONFIG;
+}
+
+/*******************************************************************************
+* Function Name: smif_cache_print_config
+****************************************************************************//**
+* Summary:
+*  Prints whether each cache and its prefetching are enabled.
+*
+*******************************************************************************/
+void smif_cache_print_config(void)
+{
+    uint32_t fast = SMIF0->FAST_CA_CTL;
+    uint32_t slow = SMIF0->SLOW_CA_CTL;
+
+    printf("Fast cache (CM4): %s, prefetch %s; slow cache (CM0+, DMA, Crypto): %s, prefetch %s\n",
+           (0u != (fast & SMIF_FAST_CA_CTL_ENABLED_Msk)) ? "on" : "off",
+           (0u != (fast & SMIF_FAST_CA_CTL_PREF_EN_Msk)) ? "on" : "off",
+           (0u != (slow & SMIF_SLOW_CA_CTL_ENABLED_Msk)) ? "on" : "off",
+           (0u != (slow & SMIF_SLOW_CA_CTL_PREF_EN_Msk)) ? "on" : "off");
+}
+
+/*******************************************************************************
+* Function Name: cache_time
+****************************************************************************//**
+* Summary:
+*  Runs the workload once and returns the cycles it took.
+*
+*******************************************************************************/
+static uint32_t cache_time(smif_cache_workload_t workload, void *arg)
+{
+    uint32_t start = cycle_counter_get();
+
+    workload(arg);
+
+    return cycle_counter_get() - start;
+}
+
+/*******************************************************************************
+* Function Name: smif_cache_profile
+****************************************************************************//**
+* Summary:
+*  Times a workload with the caches disabled, then with the current cache
+*  configuration just after invalidation (cold) and once more (warm).
+*  Interrupts are masked while the workload runs, and the cache configuration
+*  is restored afterwards. The SMIF must be in XIP mode.
+*
+* Parameters:
+*  workload - function to profile. It must not depend on the cache state.
+*  arg - argument passed to the workload.
+*  ideal_cycles - cycles of the workload if every access hit the cache, for
+*                 example measured on a copy in SRAM, or 0 to use the warm run.
+*  profile - receives the timings.
+*
+*******************************************************************************/
+cy_rslt_t smif_cache_profile(smif_cache_workload_t workload, void *arg, uint32_t ideal_cycles,
+                             smif_cache_profile_t *profile)
+{
+    if((NULL == workload) || (NULL == profile))
+    {
+        return SMIF_CACHE_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(CY_SMIF_MEMORY != Cy_SMIF_GetMode(SMIF0))
+    {
+        return SMIF_CACHE_RSLT_ERR_NOT_XIP;
+    }
+
+    cycle_counter_init();
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t fast_ctl = SMIF0->FAST_CA_CTL;
+    uint32_t slow_ctl = SMIF0->SLOW_CA_CTL;
+
+    (void)Cy_SMIF_CacheDisable(SMIF0, CY_SMIF_CACHE_BOTH);
+    profile->uncached_cycles = cache_time(workload, arg);
+
+    SMIF0->FAST_CA_CTL = fast_ctl;
+    SMIF0->SLOW_CA_CTL = slow_ctl;
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+    profile->cold_cycles = cache_time(workload, arg);
+    profile->warm_cycles = cache_time(workload, arg);
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    profile->ideal_cycles = (0u != ideal_cycles) ? ideal_cycles : profile->warm_cycles;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: smif_cache_hit_rate
+****************************************************************************//**
+* Summary:
+*  Estimates the hit rate of a run, in percent, by placing its cycle count
+*  between the uncached (0%) and ideal (100%) cycle counts of the profile.
+*  This assumes that every miss costs the same.
+*
+* Parameters:
+*  profile - timings returned by smif_cache_profile().
+*  cycles - cycles of the run, for example profile->cold_cycles.
+*
+*******************************************************************************/
+uint32_t smif_cache_hit_rate(const smif_cache_profile_t *profile, uint32_t cycles)
+{
+    if(cycles >= profile->uncached_cycles)
+    {
+        return 0u;
+    }
+
+    if((cycles <= profile->ideal_cycles) || (profile->uncached_cycles <= profile->ideal_cycles))
+    {
+        return 100u;
+    }
+
+    return (uint32_t)(((uint64_t)(profile->uncached_cycles - cycles) * 100u) /
+                      (profile->uncached_cycles - profile->ideal_cycles));
+}
+
+/*******************************************************************************
+* Function Name: smif_cache_print
+****************************************************************************//**
+* Summary:
+*  Prints the timings and estimated hit rates of a profile.
+*
+*******************************************************************************/
+void smif_cache_print(const char *name, const smif_cache_profile_t *profile)
+{
+    printf("%-18s %10"PRIu32" %10"PRIu32" %4"PRIu32"%% %10"PRIu32" %4"PRIu32"%%\n", name,
+           profile->uncached_cycles,
+           profile->cold_cycles, smif_cache_hit_rate(profile, profile->cold_cycles),
+           profile->warm_cycles, smif_cache_hit_rate(profile, profile->warm_cycles));
+}
+
+/*******************************************************************************
+* Function Name: demo_sweep
+****************************************************************************//**
+* Summary:
+*  Workload: reads words sequentially. Runs from SRAM, so that only the data
+*  reads can go to the external memory.
+*
+*******************************************************************************/
+APP_RAMFUNC static void demo_sweep(void *arg)
+{
+    demo_sweep_t *sweep = (demo_sweep_t *)arg;
+    uint32_t sum = 0u;
+
+    for(uint32_t index = 0; index < sweep->words; index++)
+    {
+        sum += sweep->base[index & sweep->wrap_mask];
+    }
+
+    sweep->sum = sum;
+}
+
+/*******************************************************************************
+* Function Name: demo_profile_sweeps
+****************************************************************************//**
+* Summary:
+*  Profiles sequential reads of a region that fits in the cache and of one
+*  that does not, with the ideal time taken from the same reads in SRAM.
+*
+*******************************************************************************/
+static cy_rslt_t demo_profile_sweeps(const char *config)
+{
+    static const uint32_t sizes[] = { SMIF_CACHE_DEMO_SMALL_SIZE, SMIF_CACHE_DEMO_LARGE_SIZE };
+    smif_cache_profile_t profile;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    printf("%s:\n", config);
+    smif_cache_print_config();
+
+    for(uint32_t index = 0; (index < CY_ARRAY_SIZE(sizes)) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        char name[24];
+        uint32_t words = sizes[index] / sizeof(uint32_t);
+        demo_sweep_t sram = { demo_sram, words, CY_ARRAY_SIZE(demo_sram) - 1u, 0u };
+        demo_sweep_t xip = { (const volatile uint32_t *)CY_XIP_BASE, words, UINT32_MAX, 0u };
+
+        uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+        uint32_t ideal = cache_time(demo_sweep, &sram);
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+        result = smif_cache_profile(demo_sweep, &xip, ideal, &profile);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            (void)snprintf(name, sizeof(name), "Read %"PRIu32" KB", sizes[index] / 1024u);
+            smif_cache_print(name, &profile);
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_cache_demo
+****************************************************************************//**
+* Summary:
+*  Profiles sequential data reads from the external memory with the fast
+*  cache prefetching enabled and disabled, then restores the cache
+*  configuration. Must be called in XIP mode.
+*
+*******************************************************************************/
+cy_rslt_t smif_cache_demo(void)
+{
+    uint32_t fast_ctl = SMIF0->FAST_CA_CTL;
+
+    printf("%-18s %10s %10s %5s %10s %5s\n", "Workload", "Uncached", "Cold", "Hit", "Warm", "Hit");
+    printf("---------------------------------------------------------------\n");
+
+    cy_rslt_t result = smif_cache_configure(CY_SMIF_CACHE_FAST, true, true);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = demo_profile_sweeps("Prefetch on");
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = smif_cache_configure(CY_SMIF_CACHE_FAST, true, false);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = demo_profile_sweeps("Prefetch off");
+    }
+
+    SMIF0->FAST_CA_CTL = fast_ctl;
+
+    return result;
+}
+
+/* [] END OF FILE */
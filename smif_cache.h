@@ -0,0 +1,102 @@
+/******************************************************************************
+* File Name:   smif_cache.h
+*
+* Description: This file contains the declarations of the SMIF cache
+*              instrumentation, which controls the fast and slow caches and
+*              their prefetching, and estimates how well they serve a
+*              workload.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SMIF_CACHE_H
+#define SMIF_CACHE_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the cache instrumentation demo in XIP mode */
+#ifndef SMIF_CACHE_DEMO_ENABLE
+#define SMIF_CACHE_DEMO_ENABLE          (0u)
+#endif
+
+#define SMIF_CACHE_RSLT_ERR_BAD_PARAM   APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_CACHE, 1u)
+#define SMIF_CACHE_RSLT_ERR_NOT_XIP     APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_CACHE, 2u)
+#define SMIF_CACHE_RSLT_ERR_CONFIG      APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_CACHE, 3u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Workload run from, or reading data in, the external memory */
+typedef void (*smif_cache_workload_t)(void *arg);
+
+/* The SMIF has no hit or miss counters, so a workload is timed in several
+ * cache states and the hit rate is estimated from the cycle counts.
+ */
+typedef struct
+{
+    uint32_t uncached_cycles;   /* Caches disabled: every access is a miss */
+    uint32_t cold_cycles;       /* First run after cache invalidation */
+    uint32_t warm_cycles;       /* Second run, with the cache as left by the first */
+    uint32_t ideal_cycles;      /* Every access a hit: given, or the warm run */
+} smif_cache_profile_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t smif_cache_configure(cy_en_smif_cache_t cache, bool enable, bool prefetch);
+void smif_cache_print_config(void);
+cy_rslt_t smif_cache_profile(smif_cache_workload_t workload, void *arg, uint32_t ideal_cycles,
+                             smif_cache_profile_t *profile);
+uint32_t smif_cache_hit_rate(const smif_cache_profile_t *profile, uint32_t cycles);
+void smif_cache_print(const char *name, const smif_cache_profile_t *profile);
+cy_rslt_t smif_cache_demo(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SMIF_CACHE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,571 @@
+/******************************************************************************
+* File Name:   smif_mmio.c
+*
+* Description: This file contains the direct SMIF command interface. It
+*              issues blocking SMIF transfers in MMIO (normal) mode for
+*              memory commands that are not exposed by the serial-flash
+*              library, using the memory configuration populated by
+*              cy_serial_flash_qspi_init().
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "smif_mmio.h"
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define SMIF_MMIO_MAX_ADDR_BYTES        (4u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* The serial-flash library keeps its SMIF context private. Only blocking
+ * transfers are issued through this context, which need nothing but the
+ * timeout, so the SMIF interrupt remains owned by the serial-flash library.
+ */
+static cy_stc_smif_context_t mmio_context;
+static const cy_stc_smif_mem_config_t *mmio_mem_config = NULL;
+
+/*******************************************************************************
+* Function Name: mmio_check_ready
+****************************************************************************//**
+* Summary:
+*  Checks that the interface is initialized and the SMIF is in MMIO mode.
+*
+*******************************************************************************/
+static cy_rslt_t mmio_check_ready(void)
+{
+    if(NULL == mmio_mem_config)
+    {
+        return SMIF_MMIO_RSLT_ERR_NOT_INIT;
+    }
+
+    if(CY_SMIF_NORMAL != Cy_SMIF_GetMode(SMIF0))
+    {
+        return SMIF_MMIO_RSLT_ERR_XIP_MODE;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: mmio_addr_to_bytes
+****************************************************************************//**
+* Summary:
+*  Converts an address into the big-endian byte array sent after a command.
+*
+* Return:
+*  Number of address bytes.
+*
+*******************************************************************************/
+static uint32_t mmio_addr_to_bytes(uint32_t addr, uint8_t bytes[SMIF_MMIO_MAX_ADDR_BYTES])
+{
+    uint32_t count = mmio_mem_config->deviceCfg->numOfAddrBytes;
+
+    for(uint32_t index = 0; index < count; index++)
+    {
+        bytes[index] = (uint8_t)(addr >> (8u * (count - 1u - index)));
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: mmio_send_header
+****************************************************************************//**
+* Summary:
+*  Sends the command, address, mode and dummy cycles of a memory command,
+*  leaving the slave selected for the data phase. The mode byte is sent unless
+*  it is CY_SMIF_NO_COMMAND_OR_MODE.
+*
+*******************************************************************************/
+static cy_en_smif_status_t mmio_send_header(const cy_stc_smif_mem_cmd_t *cmd, uint32_t addr, uint32_t mode)
+{
+    uint8_t addr_bytes[SMIF_MMIO_MAX_ADDR_BYTES];
+    cy_en_smif_slave_select_t ss = mmio_mem_config->slaveSelect;
+    uint32_t addr_size = mmio_addr_to_bytes(addr, addr_bytes);
+
+    cy_en_smif_status_t status = Cy_SMIF_TransmitCommand(SMIF0, (uint8_t)cmd->command, cmd->cmdWidth, addr_bytes,
+                                                         addr_size, cmd->addrWidth, ss, CY_SMIF_TX_NOT_LAST_BYTE,
+                                                         &mmio_context);
+
+    if((CY_SMIF_SUCCESS == status) && (CY_SMIF_NO_COMMAND_OR_MODE != mode))
+    {
+        status = Cy_SMIF_TransmitCommand(SMIF0, (uint8_t)mode, cmd->modeWidth, NULL, 0u, cmd->modeWidth, ss,
+                                         CY_SMIF_TX_NOT_LAST_BYTE, &mmio_context);
+    }
+
+    if((CY_SMIF_SUCCESS == status) && (0u != cmd->dummyCycles))
+    {
+        status = Cy_SMIF_SendDummyCycles(SMIF0, cmd->dummyCycles);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: mmio_send_opcode
+****************************************************************************//**
+* Summary:
+*  Sends a single-byte command with no address or data.
+*
+*******************************************************************************/
+static cy_rslt_t mmio_send_opcode(uint8_t opcode)
+{
+    cy_rslt_t result = mmio_check_ready();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        if(CY_SMIF_SUCCESS != Cy_SMIF_TransmitCommand(SMIF0, opcode, CY_SMIF_WIDTH_SINGLE, NULL, 0u,
+                                                      CY_SMIF_WIDTH_SINGLE, mmio_mem_config->slaveSelect,
+                                                      CY_SMIF_TX_LAST_BYTE, &mmio_context))
+        {
+            result = SMIF_MMIO_RSLT_ERR_TRANSFER;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_init
+****************************************************************************//**
+* Summary:
+*  Initializes the direct command interface. Call after
+*  cy_serial_flash_qspi_init() so that an SFDP-detected configuration is
+*  already populated.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    if((NULL == mem_config) || (NULL == mem_config->deviceCfg) ||
+       (mem_config->deviceCfg->numOfAddrBytes > SMIF_MMIO_MAX_ADDR_BYTES))
+    {
+        return SMIF_MMIO_RSLT_ERR_BAD_PARAM;
+    }
+
+    memset(&mmio_context, 0, sizeof(mmio_context));
+    mmio_context.timeout = SMIF_MMIO_TIMEOUT_US;
+    mmio_mem_config = mem_config;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_get_mem_config
+****************************************************************************//**
+* Summary:
+*  Returns the memory configuration in use, or NULL if not initialized.
+*
+*******************************************************************************/
+const cy_stc_smif_mem_config_t *smif_mmio_get_mem_config(void)
+{
+    return mmio_mem_config;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_select
+****************************************************************************//**
+* Summary:
+*  Directs the following commands to another memory of smifBlockConfig, e.g.
+*  the memory on a second slave select. Unlike smif_mmio_init(), the context
+*  is kept, so the commands of a memory can be interleaved with those of
+*  another one.
+*
+* Parameters:
+*  mem_config - memory configuration to use, already initialized.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_select(const cy_stc_smif_mem_config_t *mem_config)
+{
+    if(NULL == mmio_mem_config)
+    {
+        return SMIF_MMIO_RSLT_ERR_NOT_INIT;
+    }
+
+    if((NULL == mem_config) || (NULL == mem_config->deviceCfg) ||
+       (mem_config->deviceCfg->numOfAddrBytes > SMIF_MMIO_MAX_ADDR_BYTES))
+    {
+        return SMIF_MMIO_RSLT_ERR_BAD_PARAM;
+    }
+
+    mmio_mem_config = mem_config;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_get_page_size
+****************************************************************************//**
+* Summary:
+*  Returns the program page size of the memory, or 0 if not initialized.
+*
+*******************************************************************************/
+uint32_t smif_mmio_get_page_size(void)
+{
+    return (NULL != mmio_mem_config) ? mmio_mem_config->deviceCfg->programSize : 0u;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_write_enable
+****************************************************************************//**
+* Summary:
+*  Sends the Write Enable command.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_write_enable(void)
+{
+    cy_rslt_t result = mmio_check_ready();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        if(CY_SMIF_SUCCESS != Cy_SMIF_MemCmdWriteEnable(SMIF0, mmio_mem_config, &mmio_context))
+        {
+            result = SMIF_MMIO_RSLT_ERR_TRANSFER;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_program_start
+****************************************************************************//**
+* Summary:
+*  Sends Write Enable followed by a Page Program command with its data, and
+*  returns without waiting for the program operation to complete. Poll
+*  smif_mmio_is_busy() to detect completion. The range must not cross a
+*  program page boundary.
+*
+* Parameters:
+*  addr - address to program.
+*  buf - data to program.
+*  length - number of bytes, 1 to the page size.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_program_start(uint32_t addr, const uint8_t *buf, uint32_t length)
+{
+    cy_rslt_t result = mmio_check_ready();
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    uint32_t page_size = mmio_mem_config->deviceCfg->programSize;
+
+    if((NULL == buf) || (0u == length) || (((addr % page_size) + length) > page_size))
+    {
+        return SMIF_MMIO_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_cmd_t *cmd = mmio_mem_config->deviceCfg->programCmd;
+    cy_en_smif_status_t status = Cy_SMIF_MemCmdWriteEnable(SMIF0, mmio_mem_config, &mmio_context);
+
+    if(CY_SMIF_SUCCESS == status)
+    {
+        status = mmio_send_header(cmd, addr, cmd->mode);
+    }
+
+    if(CY_SMIF_SUCCESS == status)
+    {
+        status = Cy_SMIF_TransmitDataBlocking(SMIF0, buf, length, cmd->dataWidth, &mmio_context);
+    }
+
+    return (CY_SMIF_SUCCESS == status) ? CY_RSLT_SUCCESS : SMIF_MMIO_RSLT_ERR_TRANSFER;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_sector_erase_start
+****************************************************************************//**
+* Summary:
+*  Sends Write Enable followed by the Sector Erase command, and returns without
+*  waiting for the erase to complete. On hybrid-sector memories, the PDL picks
+*  the erase command of the region that contains the address. Poll
+*  smif_mmio_is_busy() to detect completion.
+*
+* Parameters:
+*  addr - address of the sector to erase.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_sector_erase_start(uint32_t addr)
+{
+    uint8_t addr_bytes[SMIF_MMIO_MAX_ADDR_BYTES];
+    cy_rslt_t result = smif_mmio_write_enable();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        (void)mmio_addr_to_bytes(addr, addr_bytes);
+
+        if(CY_SMIF_SUCCESS != Cy_SMIF_MemCmdSectorErase(SMIF0, mmio_mem_config, addr_bytes, &mmio_context))
+        {
+            result = SMIF_MMIO_RSLT_ERR_TRANSFER;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_chip_erase_start
+****************************************************************************//**
+* Summary:
+*  Sends Write Enable followed by the Chip Erase command, and returns without
+*  waiting for the erase to complete. Poll smif_mmio_is_busy() to detect
+*  completion.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_chip_erase_start(void)
+{
+    cy_rslt_t result = smif_mmio_write_enable();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        if(CY_SMIF_SUCCESS != Cy_SMIF_MemCmdChipErase(SMIF0, mmio_mem_config, &mmio_context))
+        {
+            result = SMIF_MMIO_RSLT_ERR_TRANSFER;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_is_busy
+****************************************************************************//**
+* Summary:
+*  Reads the status register and returns true while a program or erase
+*  operation is in progress (or if the status cannot be read).
+*
+*******************************************************************************/
+bool smif_mmio_is_busy(void)
+{
+    if(CY_RSLT_SUCCESS != mmio_check_ready())
+    {
+        return true;
+    }
+
+    return Cy_SMIF_MemIsBusy(SMIF0, mmio_mem_config, &mmio_context);
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_read
+****************************************************************************//**
+* Summary:
+*  Reads data with the read command of the memory configuration. Unlike
+*  cy_serial_flash_qspi_read(), the status register is not checked first, so
+*  the read can be issued while a program or erase is suspended.
+*
+* Parameters:
+*  addr - address to read.
+*  buf - buffer for the data.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_read(uint32_t addr, uint8_t *buf, uint32_t length)
+{
+    return (NULL != mmio_mem_config) ? smif_mmio_read_with_mode(addr, mmio_mem_config->deviceCfg->readCmd->mode,
+                                                                buf, length) : SMIF_MMIO_RSLT_ERR_NOT_INIT;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_read_with_mode
+****************************************************************************//**
+* Summary:
+*  Same as smif_mmio_read(), but sends the given mode byte instead of the one
+*  of the memory configuration. Used to put the memory in continuous read
+*  mode.
+*
+* Parameters:
+*  addr - address to read.
+*  mode - mode byte, or CY_SMIF_NO_COMMAND_OR_MODE for none.
+*  buf - buffer for the data.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_read_with_mode(uint32_t addr, uint32_t mode, uint8_t *buf, uint32_t length)
+{
+    cy_rslt_t result = mmio_check_ready();
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if((NULL == buf) || (0u == length))
+    {
+        return SMIF_MMIO_RSLT_ERR_BAD_PARAM;
+    }
+
+    const cy_stc_smif_mem_cmd_t *cmd = mmio_mem_config->deviceCfg->readCmd;
+    cy_en_smif_status_t status = mmio_send_header(cmd, addr, mode);
+
+    if(CY_SMIF_SUCCESS == status)
+    {
+        status = Cy_SMIF_ReceiveDataBlocking(SMIF0, buf, length, cmd->dataWidth, &mmio_context);
+    }
+
+    return (CY_SMIF_SUCCESS == status) ? CY_RSLT_SUCCESS : SMIF_MMIO_RSLT_ERR_TRANSFER;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_mode_bit_reset
+****************************************************************************//**
+* Summary:
+*  Takes the memory out of continuous read mode. While in that mode, the
+*  memory takes the first bytes of a transfer as the address and the mode
+*  byte, so all-ones bytes are clocked out on the address lines, which
+*  presents a mode byte that ends the mode, and the transfer is then ended
+*  before the data phase.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_mode_bit_reset(void)
+{
+    uint8_t ones[SMIF_MMIO_MAX_ADDR_BYTES] = { 0xFFu, 0xFFu, 0xFFu, 0xFFu };
+    cy_rslt_t result = mmio_check_ready();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        const cy_stc_smif_mem_cmd_t *cmd = mmio_mem_config->deviceCfg->readCmd;
+        uint32_t addr_size = mmio_mem_config->deviceCfg->numOfAddrBytes;
+
+        /* The first byte and the address bytes cover the address and mode phases */
+        if(CY_SMIF_SUCCESS != Cy_SMIF_TransmitCommand(SMIF0, 0xFFu, cmd->addrWidth, ones, addr_size, cmd->addrWidth,
+                                                      mmio_mem_config->slaveSelect, CY_SMIF_TX_LAST_BYTE,
+                                                      &mmio_context))
+        {
+            result = SMIF_MMIO_RSLT_ERR_TRANSFER;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_suspend
+****************************************************************************//**
+* Summary:
+*  Sends the Erase/Program Suspend command. The memory accepts reads outside
+*  the sector being erased once smif_mmio_is_busy() returns false.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_suspend(void)
+{
+    return mmio_send_opcode((uint8_t)SMIF_MMIO_CMD_SUSPEND);
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_resume
+****************************************************************************//**
+* Summary:
+*  Sends the Erase/Program Resume command.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_resume(void)
+{
+    return mmio_send_opcode((uint8_t)SMIF_MMIO_CMD_RESUME);
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_send_command
+****************************************************************************//**
+* Summary:
+*  Sends a single-byte command with no address or data, e.g. to enter or
+*  leave deep power-down.
+*
+* Parameters:
+*  opcode - command byte.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_send_command(uint8_t opcode)
+{
+    return mmio_send_opcode(opcode);
+}
+
+/*******************************************************************************
+* Function Name: smif_mmio_read_sfdp
+****************************************************************************//**
+* Summary:
+*  Reads the SFDP tables: single width, three address bytes whatever the
+*  addressing mode of the memory, and eight dummy cycles (JESD216).
+*
+* Parameters:
+*  addr - SFDP address.
+*  buf - buffer for the data.
+*  length - number of bytes.
+*
+*******************************************************************************/
+cy_rslt_t smif_mmio_read_sfdp(uint32_t addr, uint8_t *buf, uint32_t length)
+{
+    cy_rslt_t result = mmio_check_ready();
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if((NULL == buf) || (0u == length))
+    {
+        return SMIF_MMIO_RSLT_ERR_BAD_PARAM;
+    }
+
+    uint8_t addr_bytes[3] = { (uint8_t)(addr >> 16), (uint8_t)(addr >> 8), (uint8_t)addr };
+    cy_en_smif_status_t status = Cy_SMIF_TransmitCommand(SMIF0, (uint8_t)SMIF_MMIO_CMD_READ_SFDP,
+                                                         CY_SMIF_WIDTH_SINGLE, addr_bytes, sizeof(addr_bytes),
+                                                         CY_SMIF_WIDTH_SINGLE, mmio_mem_config->slaveSelect,
+                                                         CY_SMIF_TX_NOT_LAST_BYTE, &mmio_context);
+
+    if(CY_SMIF_SUCCESS == status)
+    {
+        status = Cy_SMIF_SendDummyCycles(SMIF0, SMIF_MMIO_SFDP_DUMMY_CYCLES);
+    }
+
+    if(CY_SMIF_SUCCESS == status)
+    {
+        status = Cy_SMIF_ReceiveDataBlocking(SMIF0, buf, length, CY_SMIF_WIDTH_SINGLE, &mmio_context);
+    }
+
+    return (CY_SMIF_SUCCESS == status) ? CY_RSLT_SUCCESS : SMIF_MMIO_RSLT_ERR_TRANSFER;
+}
+
+/* [] END OF FILE */
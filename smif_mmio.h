@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name:   smif_mmio.h
+*
+* Description: This file contains the declarations of the direct SMIF command
+*              interface, used by the application modules for flash commands
+*              that the serial-flash library does not expose.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SMIF_MMIO_H
+#define SMIF_MMIO_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Timeout of a single SMIF command transfer */
+#define SMIF_MMIO_TIMEOUT_US            (1000u)
+
+/* Erase/Program Suspend and Resume opcodes. The defaults are the JEDEC ones
+ * used by the S25FL-S and S25FL-L families; override them for other memories.
+ */
+#ifndef SMIF_MMIO_CMD_SUSPEND
+#define SMIF_MMIO_CMD_SUSPEND           (0x75u)
+#endif
+
+#ifndef SMIF_MMIO_CMD_RESUME
+#define SMIF_MMIO_CMD_RESUME            (0x7Au)
+#endif
+
+/* Read SFDP command and its dummy cycles, fixed by JESD216 */
+#define SMIF_MMIO_CMD_READ_SFDP         (0x5Au)
+#define SMIF_MMIO_SFDP_DUMMY_CYCLES     (8u)
+
+#define SMIF_MMIO_RSLT_ERR_NOT_INIT     APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_MMIO, 1u)
+#define SMIF_MMIO_RSLT_ERR_XIP_MODE     APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_MMIO, 2u)
+#define SMIF_MMIO_RSLT_ERR_BAD_PARAM    APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_MMIO, 3u)
+#define SMIF_MMIO_RSLT_ERR_TRANSFER     APP_RSLT_ERR(APP_RSLT_RANGE_SMIF_MMIO, 4u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t smif_mmio_init(const cy_stc_smif_mem_config_t *mem_config);
+const cy_stc_smif_mem_config_t *smif_mmio_get_mem_config(void);
+cy_rslt_t smif_mmio_select(const cy_stc_smif_mem_config_t *mem_config);
+uint32_t smif_mmio_get_page_size(void);
+cy_rslt_t smif_mmio_write_enable(void);
+cy_rslt_t smif_mmio_program_start(uint32_t addr, const uint8_t *buf, uint32_t length);
+cy_rslt_t smif_mmio_sector_erase_start(uint32_t addr);
+cy_rslt_t smif_mmio_chip_erase_start(void);
+bool smif_mmio_is_busy(void);
+cy_rslt_t smif_mmio_read(uint32_t addr, uint8_t *buf, uint32_t length);
+cy_rslt_t smif_mmio_read_with_mode(uint32_t addr, uint32_t mode, uint8_t *buf, uint32_t length);
+cy_rslt_t smif_mmio_mode_bit_reset(void);
+cy_rslt_t smif_mmio_suspend(void);
+cy_rslt_t smif_mmio_resume(void);
+cy_rslt_t smif_mmio_send_command(uint8_t opcode);
+cy_rslt_t smif_mmio_read_sfdp(uint32_t addr, uint8_t *buf, uint32_t length);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SMIF_MMIO_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,715 @@
+/******************************************************************************
+* File Name:   wear_alloc.c
+*
+* Description: This file contains a wear-leveling sector allocator. The erase
+*              count and state of every sector of a pool are mirrored in SRAM
+*              and kept on the memory as a table snapshot followed by one
+*              record per change, alternating between two sectors. Allocation
+*              pops the least-worn free sector from a short sorted candidate
+*              list, erases it and retires it if the erase fails.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "wear_alloc.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycle_counter.h"
+#include "smart_write.h"
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define WEAR_MAGIC                      (0x31524557u)   /* "WER1" */
+
+/* Table entries: erase count, state in the top two bits */
+#define WEAR_COUNT_MASK                 (0x3FFFFFFFu)
+#define WEAR_STATE_SHIFT                (30u)
+#define WEAR_ENTRY(count, state)        (((count) & WEAR_COUNT_MASK) | ((uint32_t)(state) << WEAR_STATE_SHIFT))
+
+/* Records follow the table, 8-byte aligned so that none crosses a page */
+#define WEAR_RECORDS_OFFSET(num)        ((sizeof(wear_header_t) + ((num) * sizeof(uint32_t)) + 7u) & ~7u)
+
+#define WEAR_READ_CHUNK                 (256u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Written last, after the table, when a table sector is rewritten */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t generation;        /* The valid sector with the highest one is current */
+    uint32_t num_sectors;
+    uint32_t table_crc;         /* CRC-32 of the table */
+} wear_header_t;
+
+/* New entry of one sector; all 0xFF is the end of the records */
+typedef struct
+{
+    uint16_t sector;
+    uint8_t state;
+    uint8_t check;              /* wear_record_check() of the other fields */
+    uint32_t erase_count;
+} wear_record_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* CRC-32 (reflected 0xEDB88320), four bits at a time */
+static const uint32_t wear_crc_table[16] =
+{
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu, 0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+static uint32_t wear_base;
+static uint32_t wear_sector_size;
+static uint32_t wear_num_sectors;       /* Pool sectors, 0 until initialized */
+
+static uint32_t wear_table[WEAR_ALLOC_MAX_SECTORS];
+static uint32_t wear_meta;              /* Current table sector */
+static uint32_t wear_generation;
+static uint32_t wear_record_offset;     /* Next record in the current table sector */
+
+/* Least-worn free sectors in increasing erase count order. Every free sector
+ * that is not in the list has an erase count at least that of the last one.
+ */
+static uint32_t wear_candidates[WEAR_ALLOC_CANDIDATES];
+static uint32_t wear_num_candidates;
+
+static wear_alloc_stats_t wear_stats;
+
+CY_ALIGN(4) static uint8_t wear_buffer[WEAR_READ_CHUNK];
+
+/*******************************************************************************
+* Function Name: wear_crc32
+****************************************************************************//**
+* Summary:
+*  Computes the CRC-32 of the table.
+*
+*******************************************************************************/
+static uint32_t wear_crc32(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for(uint32_t index = 0; index < length; index++)
+    {
+        crc ^= data[index];
+        crc = (crc >> 4u) ^ wear_crc_table[crc & 0x0Fu];
+        crc = (crc >> 4u) ^ wear_crc_table[crc & 0x0Fu];
+    }
+
+    return ~crc;
+}
+
+/*******************************************************************************
+* Function Name: wear_record_check
+****************************************************************************//**
+* Summary:
+*  Returns the check byte of a record. It is never 0xFF for a blank record.
+*
+*******************************************************************************/
+static uint8_t wear_record_check(const wear_record_t *record)
+{
+    uint32_t sum = record->sector ^ ((uint32_t)record->state << 16u) ^ record->erase_count;
+
+    return (uint8_t)~(sum ^ (sum >> 8u) ^ (sum >> 16u) ^ (sum >> 24u) ^ 0x5Au);
+}
+
+static inline uint32_t wear_count(uint32_t sector)
+{
+    return wear_table[sector] & WEAR_COUNT_MASK;
+}
+
+static inline wear_alloc_state_t wear_state(uint32_t sector)
+{
+    return (wear_alloc_state_t)(wear_table[sector] >> WEAR_STATE_SHIFT);
+}
+
+static inline uint32_t wear_meta_addr(uint32_t meta)
+{
+    return wear_base + (meta * wear_sector_size);
+}
+
+static inline uint32_t wear_sector_addr(uint32_t sector)
+{
+    return wear_base + ((WEAR_ALLOC_META_SECTORS + sector) * wear_sector_size);
+}
+
+/*******************************************************************************
+* Function Name: wear_write_table
+****************************************************************************//**
+* Summary:
+*  Erases a table sector and writes the SRAM table to it under the next
+*  generation, which makes it the current one. Until the header is written,
+*  the other table sector stays current.
+*
+*******************************************************************************/
+static cy_rslt_t wear_write_table(uint32_t meta)
+{
+    uint32_t addr = wear_meta_addr(meta);
+    uint32_t table_size = wear_num_sectors * sizeof(uint32_t);
+    wear_header_t header =
+    {
+        .magic = WEAR_MAGIC,
+        .generation = wear_generation + 1u,
+        .num_sectors = wear_num_sectors,
+        .table_crc = wear_crc32((const uint8_t *)wear_table, table_size),
+    };
+
+    cy_rslt_t result = cy_serial_flash_qspi_erase(addr, wear_sector_size);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_write(addr + sizeof(header), table_size, (const uint8_t *)wear_table);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_write(addr, sizeof(header), (const uint8_t *)&header);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        wear_meta = meta;
+        wear_generation = header.generation;
+        wear_record_offset = WEAR_RECORDS_OFFSET(wear_num_sectors);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: wear_log
+****************************************************************************//**
+* Summary:
+*  Makes the SRAM entry of a sector persistent: appends a record, or rewrites
+*  the table to the other table sector if the current one is full.
+*
+*******************************************************************************/
+static cy_rslt_t wear_log(uint32_t sector)
+{
+    wear_record_t record =
+    {
+        .sector = (uint16_t)sector,
+        .state = (uint8_t)wear_state(sector),
+        .erase_count = wear_count(sector),
+    };
+
+    if((wear_record_offset + sizeof(record)) > wear_sector_size)
+    {
+        wear_stats.compactions++;
+        return wear_write_table(wear_meta ^ 1u);
+    }
+
+    record.check = wear_record_check(&record);
+
+    cy_rslt_t result = cy_serial_flash_qspi_write(wear_meta_addr(wear_meta) + wear_record_offset, sizeof(record),
+                                                  (const uint8_t *)&record);
+
+    /* A failed write may have left a partial record; skip its slot */
+    wear_record_offset += sizeof(record);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: wear_load
+****************************************************************************//**
+* Summary:
+*  Loads the table of a table sector into SRAM and replays its records.
+*  Records that fail their check were interrupted and are skipped.
+*
+* Return:
+*  false if the sector does not hold a valid table.
+*
+*******************************************************************************/
+static bool wear_load(uint32_t meta, const wear_header_t *header)
+{
+    uint32_t addr = wear_meta_addr(meta);
+    uint32_t table_size = wear_num_sectors * sizeof(uint32_t);
+
+    if((CY_RSLT_SUCCESS != cy_serial_flash_qspi_read(addr + sizeof(*header), table_size, (uint8_t *)wear_table)) ||
+       (header->table_crc != wear_crc32((const uint8_t *)wear_table, table_size)))
+    {
+        return false;
+    }
+
+    wear_meta = meta;
+    wear_generation = header->generation;
+
+    for(uint32_t offset = WEAR_RECORDS_OFFSET(wear_num_sectors); offset < wear_sector_size; offset += WEAR_READ_CHUNK)
+    {
+        uint32_t length = ((wear_sector_size - offset) < WEAR_READ_CHUNK) ? (wear_sector_size - offset) :
+                          WEAR_READ_CHUNK;
+
+        if(CY_RSLT_SUCCESS != cy_serial_flash_qspi_read(addr + offset, length, wear_buffer))
+        {
+            return false;
+        }
+
+        for(uint32_t index = 0u; (index + sizeof(wear_record_t)) <= length; index += sizeof(wear_record_t))
+        {
+            wear_record_t record;
+
+            (void)memcpy(&record, &wear_buffer[index], sizeof(record));
+
+            if((0xFFFFu == record.sector) && (0xFFu == record.state) && (0xFFu == record.check) &&
+               (0xFFFFFFFFu == record.erase_count))
+            {
+                wear_record_offset = offset + index;
+                return true;
+            }
+
+            if((record.check == wear_record_check(&record)) && (record.sector < wear_num_sectors) &&
+               (record.state <= (uint8_t)WEAR_ALLOC_BAD))
+            {
+                wear_table[record.sector] = WEAR_ENTRY(record.erase_count, record.state);
+            }
+        }
+    }
+
+    wear_record_offset = wear_sector_size;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: wear_insert_candidate
+****************************************************************************//**
+* Summary:
+*  Inserts a free sector into the candidate list, dropping the most worn one
+*  if the list is full. Sectors that would break the order of the list with
+*  the free sectors left out of it are not inserted.
+*
+*******************************************************************************/
+static void wear_insert_candidate(uint32_t sector, bool scanning)
+{
+    uint32_t count = wear_count(sector);
+    uint32_t pos = wear_num_candidates;
+
+    if(0u != pos)
+    {
+        uint32_t last = wear_count(wear_candidates[pos - 1u]);
+
+        /* Sectors outside the list may be less worn than this one */
+        if(!scanning && (count > last))
+        {
+            return;
+        }
+
+        if((WEAR_ALLOC_CANDIDATES == pos) && (count >= last))
+        {
+            return;
+        }
+    }
+    else if(!scanning)
+    {
+        /* Left to the next scan */
+        return;
+    }
+
+    if(WEAR_ALLOC_CANDIDATES == pos)
+    {
+        pos--;
+    }
+    else
+    {
+        wear_num_candidates++;
+    }
+
+    while((0u != pos) && (wear_count(wear_candidates[pos - 1u]) > count))
+    {
+        wear_candidates[pos] = wear_candidates[pos - 1u];
+        pos--;
+    }
+
+    wear_candidates[pos] = sector;
+}
+
+/*******************************************************************************
+* Function Name: wear_refill
+****************************************************************************//**
+* Summary:
+*  Rebuilds the candidate list from the table. Runs when the list is empty,
+*  once every WEAR_ALLOC_CANDIDATES allocations at most.
+*
+*******************************************************************************/
+static void wear_refill(void)
+{
+    wear_num_candidates = 0u;
+    wear_stats.refills++;
+
+    for(uint32_t sector = 0u; sector < wear_num_sectors; sector++)
+    {
+        if(WEAR_ALLOC_FREE == wear_state(sector))
+        {
+            wear_insert_candidate(sector, true);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: wear_erase
+****************************************************************************//**
+* Summary:
+*  Erases a sector for allocation and records the erase. The sector becomes
+*  used, or bad if the erase failed or did not leave it blank.
+*
+*******************************************************************************/
+static cy_rslt_t wear_erase(uint32_t sector)
+{
+    uint32_t addr = wear_sector_addr(sector);
+    uint32_t start = cycle_counter_get();
+    bool blank = (CY_RSLT_SUCCESS == cy_serial_flash_qspi_erase(addr, wear_sector_size));
+    uint32_t erase_us = cycle_counter_to_us(cycle_counter_get() - start);
+
+#if (WEAR_ALLOC_VERIFY_ERASE)
+    if(blank)
+    {
+        cy_rslt_t result = smart_write_is_blank(addr, wear_sector_size, &blank);
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+    }
+#endif
+
+    wear_table[sector] = WEAR_ENTRY(wear_count(sector) + 1u, blank ? WEAR_ALLOC_USED : WEAR_ALLOC_BAD);
+    wear_stats.erases++;
+    wear_stats.max_erase_us = (erase_us > wear_stats.max_erase_us) ? erase_us : wear_stats.max_erase_us;
+
+    if(!blank)
+    {
+        wear_stats.retired++;
+    }
+
+    return wear_log(sector);
+}
+
+/*******************************************************************************
+* Function Name: wear_release
+****************************************************************************//**
+* Summary:
+*  Marks a used sector free, or retires it if it has reached
+*  WEAR_ALLOC_ENDURANCE erases, and logs the change.
+*
+*******************************************************************************/
+static cy_rslt_t wear_release(uint32_t sector)
+{
+    if(wear_count(sector) >= WEAR_ALLOC_ENDURANCE)
+    {
+        wear_table[sector] = WEAR_ENTRY(wear_count(sector), WEAR_ALLOC_BAD);
+        wear_stats.retired++;
+    }
+    else
+    {
+        wear_table[sector] = WEAR_ENTRY(wear_count(sector), WEAR_ALLOC_FREE);
+        wear_insert_candidate(sector, false);
+    }
+
+    return wear_log(sector);
+}
+
+/*******************************************************************************
+* Function Name: wear_alloc_init
+****************************************************************************//**
+* Summary:
+*  Loads the erase count table from the first WEAR_ALLOC_META_SECTORS sectors
+*  of a range, or creates it if neither holds a valid one, and builds the
+*  candidate list. The other sectors of the range form the pool. Used
+*  sectors stay used across resets until they are put back or reclaimed
+*  with wear_alloc_reclaim().
+*
+* Parameters:
+*  base - start of the range, on a sector boundary.
+*  num_sectors - sectors in the range, all of the same size.
+*
+*******************************************************************************/
+cy_rslt_t wear_alloc_init(uint32_t base, uint32_t num_sectors)
+{
+    uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(base);
+    wear_header_t headers[WEAR_ALLOC_META_SECTORS];
+    bool loaded = false;
+
+    wear_num_sectors = 0u;
+
+    if((num_sectors <= WEAR_ALLOC_META_SECTORS) ||
+       ((num_sectors - WEAR_ALLOC_META_SECTORS) > WEAR_ALLOC_MAX_SECTORS) || (0u != (base % sector_size)) ||
+       (sector_size != cy_serial_flash_qspi_get_erase_size(base + ((num_sectors - 1u) * sector_size))))
+    {
+        return WEAR_ALLOC_RSLT_ERR_BAD_PARAM;
+    }
+
+    wear_base = base;
+    wear_sector_size = sector_size;
+    wear_num_sectors = num_sectors - WEAR_ALLOC_META_SECTORS;
+    wear_generation = 0u;
+    (void)memset(&wear_stats, 0, sizeof(wear_stats));
+    cycle_counter_init();
+
+    for(uint32_t meta = 0u; meta < WEAR_ALLOC_META_SECTORS; meta++)
+    {
+        cy_rslt_t result = cy_serial_flash_qspi_read(wear_meta_addr(meta), sizeof(headers[meta]),
+                                                     (uint8_t *)&headers[meta]);
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            wear_num_sectors = 0u;
+            return result;
+        }
+    }
+
+    /* Newest valid table first */
+    for(uint32_t attempt = 0u; !loaded && (attempt < WEAR_ALLOC_META_SECTORS); attempt++)
+    {
+        uint32_t meta = ((headers[1].generation > headers[0].generation) ? 1u : 0u) ^ attempt;
+
+        loaded = (WEAR_MAGIC == headers[meta].magic) && (wear_num_sectors == headers[meta].num_sectors) &&
+                 wear_load(meta, &headers[meta]);
+    }
+
+    if(!loaded)
+    {
+        (void)memset(wear_table, 0, sizeof(wear_table));
+
+        cy_rslt_t result = wear_write_table(0u);
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            wear_num_sectors = 0u;
+            return result;
+        }
+    }
+
+    wear_refill();
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wear_alloc_get
+****************************************************************************//**
+* Summary:
+*  Erases the least-worn free sector of the pool and hands it out. Sectors
+*  that fail to erase are retired and the next candidate is tried.
+*
+* Parameters:
+*  addr - receives the address of the erased sector.
+*
+*******************************************************************************/
+cy_rslt_t wear_alloc_get(uint32_t *addr)
+{
+    if(0u == wear_num_sectors)
+    {
+        return WEAR_ALLOC_RSLT_ERR_NOT_INIT;
+    }
+
+    for(;;)
+    {
+        if(0u == wear_num_candidates)
+        {
+            wear_refill();
+
+            if(0u == wear_num_candidates)
+            {
+                return WEAR_ALLOC_RSLT_ERR_FULL;
+            }
+        }
+
+        uint32_t sector = wear_candidates[0];
+
+        wear_num_candidates--;
+        (void)memmove(&wear_candidates[0], &wear_candidates[1], wear_num_candidates * sizeof(wear_candidates[0]));
+
+        cy_rslt_t result = wear_erase(sector);
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        if(WEAR_ALLOC_USED == wear_state(sector))
+        {
+            *addr = wear_sector_addr(sector);
+            return CY_RSLT_SUCCESS;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: wear_alloc_put
+****************************************************************************//**
+* Summary:
+*  Returns a sector to the pool. It is erased again when it is next handed
+*  out, or retired if it has reached WEAR_ALLOC_ENDURANCE erases.
+*
+* Parameters:
+*  addr - address returned by wear_alloc_get().
+*
+*******************************************************************************/
+cy_rslt_t wear_alloc_put(uint32_t addr)
+{
+    if(0u == wear_num_sectors)
+    {
+        return WEAR_ALLOC_RSLT_ERR_NOT_INIT;
+    }
+
+    uint32_t sector = ((addr - wear_base) / wear_sector_size) - WEAR_ALLOC_META_SECTORS;
+
+    if((addr < wear_sector_addr(0u)) || (sector >= wear_num_sectors) || (addr != wear_sector_addr(sector)))
+    {
+        return WEAR_ALLOC_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(WEAR_ALLOC_USED != wear_state(sector))
+    {
+        return WEAR_ALLOC_RSLT_ERR_STATE;
+    }
+
+    return wear_release(sector);
+}
+
+/*******************************************************************************
+* Function Name: wear_alloc_reclaim
+****************************************************************************//**
+* Summary:
+*  Returns every used sector to the pool. Call after wear_alloc_init() when
+*  the application does not keep data in its sectors across resets, so that
+*  sectors handed out before a reset or a halt are not lost to the pool.
+*
+* Parameters:
+*  reclaimed - receives the number of sectors returned, can be NULL.
+*
+*******************************************************************************/
+cy_rslt_t wear_alloc_reclaim(uint32_t *reclaimed)
+{
+    uint32_t count = 0u;
+    cy_rslt_t result = (0u == wear_num_sectors) ? WEAR_ALLOC_RSLT_ERR_NOT_INIT : CY_RSLT_SUCCESS;
+
+    for(uint32_t sector = 0u; (CY_RSLT_SUCCESS == result) && (sector < wear_num_sectors); sector++)
+    {
+        if(WEAR_ALLOC_USED == wear_state(sector))
+        {
+            result = wear_release(sector);
+            count++;
+        }
+    }
+
+    if(NULL != reclaimed)
+    {
+        *reclaimed = count;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: wear_alloc_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the state and wear counters of the pool.
+*
+*******************************************************************************/
+void wear_alloc_get_stats(wear_alloc_stats_t *stats)
+{
+    *stats = wear_stats;
+    stats->free = 0u;
+    stats->used = 0u;
+    stats->bad = 0u;
+    stats->min_erase_count = UINT32_MAX;
+    stats->max_erase_count = 0u;
+
+    for(uint32_t sector = 0u; sector < wear_num_sectors; sector++)
+    {
+        uint32_t count = wear_count(sector);
+
+        switch(wear_state(sector))
+        {
+            case WEAR_ALLOC_FREE:
+                stats->free++;
+                break;
+
+            case WEAR_ALLOC_USED:
+                stats->used++;
+                break;
+
+            default:
+                stats->bad++;
+                continue;
+        }
+
+        stats->min_erase_count = (count < stats->min_erase_count) ? count : stats->min_erase_count;
+        stats->max_erase_count = (count > stats->max_erase_count) ? count : stats->max_erase_count;
+    }
+
+    stats->min_erase_count = (UINT32_MAX != stats->min_erase_count) ? stats->min_erase_count : 0u;
+}
+
+/*******************************************************************************
+* Function Name: wear_alloc_print
+****************************************************************************//**
+* Summary:
+*  Prints the erase count and state of each sector of the pool.
+*
+*******************************************************************************/
+void wear_alloc_print(void)
+{
+    static const char *const state_names[] = { "free", "used", "bad" };
+    wear_alloc_stats_t stats;
+
+    wear_alloc_get_stats(&stats);
+
+    printf("%-8s %12s %10s %6s\n", "Sector", "Address", "Erases", "State");
+
+    for(uint32_t sector = 0u; sector < wear_num_sectors; sector++)
+    {
+        printf("%-8"PRIu32"   0x%08"PRIx32" %10"PRIu32" %6s\n", sector, wear_sector_addr(sector), wear_count(sector),
+               state_names[wear_state(sector)]);
+    }
+
+    printf("%"PRIu32" free, %"PRIu32" used, %"PRIu32" bad, erase count spread %"PRIu32" - %"PRIu32
+           ", longest erase %"PRIu32" us\n", stats.free, stats.used, stats.bad, stats.min_erase_count,
+           stats.max_erase_count, stats.max_erase_us);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,129 @@
+/******************************************************************************
+* File Name:   wear_alloc.h
+*
+* Description: Wear-leveling sector allocator. Hands out the least-worn free
+*              sector of a pool, retires sectors that fail to erase and keeps
+*              the erase counts in a table on the external memory.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef WEAR_ALLOC_H
+#define WEAR_ALLOC_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to take the sector of steps 1 to 4 from the wear-leveled pool */
+#ifndef WEAR_ALLOC_ENABLE
+#define WEAR_ALLOC_ENABLE               (0u)
+#endif
+
+/* Sectors given to the allocator by the example, the table sectors included */
+#define WEAR_ALLOC_DEMO_SECTORS         (18u)
+
+/* The first WEAR_ALLOC_META_SECTORS sectors of the range hold the erase count
+ * table, alternately; the others, up to WEAR_ALLOC_MAX_SECTORS, are the pool.
+ */
+#define WEAR_ALLOC_META_SECTORS         (2u)
+#define WEAR_ALLOC_MAX_SECTORS          (64u)
+
+/* Least-worn free sectors kept sorted for allocation */
+#define WEAR_ALLOC_CANDIDATES           (8u)
+
+/* Sectors are retired once they reach the rated endurance of the memory */
+#define WEAR_ALLOC_ENDURANCE            (100000u)
+
+/* Set to 1 to read every erased sector back before handing it out */
+#ifndef WEAR_ALLOC_VERIFY_ERASE
+#define WEAR_ALLOC_VERIFY_ERASE         (1u)
+#endif
+
+#define WEAR_ALLOC_RSLT_ERR_BAD_PARAM   APP_RSLT_ERR(APP_RSLT_RANGE_WEAR_ALLOC, 1u)
+#define WEAR_ALLOC_RSLT_ERR_NOT_INIT    APP_RSLT_ERR(APP_RSLT_RANGE_WEAR_ALLOC, 2u)
+#define WEAR_ALLOC_RSLT_ERR_FULL        APP_RSLT_ERR(APP_RSLT_RANGE_WEAR_ALLOC, 3u)
+#define WEAR_ALLOC_RSLT_ERR_STATE       APP_RSLT_ERR(APP_RSLT_RANGE_WEAR_ALLOC, 4u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef enum
+{
+    WEAR_ALLOC_FREE,
+    WEAR_ALLOC_USED,
+    WEAR_ALLOC_BAD              /* Failed to erase or worn out; never handed out */
+} wear_alloc_state_t;
+
+typedef struct
+{
+    uint32_t free;
+    uint32_t used;
+    uint32_t bad;
+    uint32_t min_erase_count;   /* Lifetime erase counts of the sectors not retired */
+    uint32_t max_erase_count;
+    uint32_t erases;            /* Since wear_alloc_init() */
+    uint32_t retired;
+    uint32_t max_erase_us;
+    uint32_t refills;           /* Scans of the table for new candidates */
+    uint32_t compactions;       /* Table rewrites, once the record area is full */
+} wear_alloc_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t wear_alloc_init(uint32_t base, uint32_t num_sectors);
+cy_rslt_t wear_alloc_get(uint32_t *addr);
+cy_rslt_t wear_alloc_put(uint32_t addr);
+cy_rslt_t wear_alloc_reclaim(uint32_t *reclaimed);
+void wear_alloc_get_stats(wear_alloc_stats_t *stats);
+void wear_alloc_print(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* WEAR_ALLOC_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,401 @@
+/******************************************************************************
+* File Name:   write_coalesce.c
+*
+* Description: This file contains the page-aligned write coalescing buffer.
+*              Small writes are staged in SRAM and merged into program pages
+*              aligned to the program page size of the memory; a page is
+*              programmed once it is complete, when a write targets another
+*              page, on timeout, or on an explicit flush.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "write_coalesce.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define COALESCE_NO_PAGE                (0xFFFFFFFFu)
+
+#define COALESCE_DEMO_RECORD_SIZE       (16u)
+#define COALESCE_DEMO_RECORDS           (128u)
+#define COALESCE_DEMO_SIZE              (COALESCE_DEMO_RECORD_SIZE * COALESCE_DEMO_RECORDS)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static uint32_t page_size = 0u;
+
+/* Staged page. Bytes not written are kept at 0xFF, which leaves the memory
+ * unchanged when programmed, so gaps inside the page are harmless.
+ */
+static uint8_t stage_data[WRITE_COALESCE_MAX_PAGE_SIZE];
+static uint8_t stage_valid[WRITE_COALESCE_MAX_PAGE_SIZE / 8u];
+static uint32_t stage_page = COALESCE_NO_PAGE;
+static uint32_t stage_start;
+static uint32_t stage_end;
+static uint32_t stage_count;
+static uint32_t stage_time_ms;
+
+static write_coalesce_stats_t coalesce_stats;
+
+/*******************************************************************************
+* Function Name: coalesce_flush
+****************************************************************************//**
+* Summary:
+*  Programs the staged bytes of the page in a single write and empties the
+*  staging buffer. If the program fails, the page stays staged so that a
+*  later flush can retry it.
+*
+*******************************************************************************/
+static cy_rslt_t coalesce_flush(bool full)
+{
+    if(COALESCE_NO_PAGE == stage_page)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    cy_rslt_t result = cy_serial_flash_qspi_write(stage_page + stage_start, stage_end - stage_start,
+                                                  &stage_data[stage_start]);
+
+    coalesce_stats.programs++;
+    if(full)
+    {
+        coalesce_stats.flushes_full++;
+    }
+    else
+    {
+        coalesce_stats.flushes_other++;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        stage_page = COALESCE_NO_PAGE;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: write_coalesce_init
+****************************************************************************//**
+* Summary:
+*  Initializes the staging buffer for the program page size of the memory.
+*  Call after cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t write_coalesce_init(void)
+{
+    page_size = (uint32_t)cy_serial_flash_qspi_get_prog_size(0u);
+
+    if((0u == page_size) || (page_size > WRITE_COALESCE_MAX_PAGE_SIZE))
+    {
+        return WRITE_COALESCE_RSLT_ERR_PAGE_SIZE;
+    }
+
+    stage_page = COALESCE_NO_PAGE;
+    memset(&coalesce_stats, 0, sizeof(coalesce_stats));
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: write_coalesce_write
+****************************************************************************//**
+* Summary:
+*  Stages data for writing. The target range must be erased. Data is split at
+*  page boundaries; a staged page is programmed as soon as every byte of it
+*  has been written, or when a write targets a different page. If programming
+*  the staged page fails, it stays staged and the data that was not staged
+*  yet is dropped; write_coalesce_flush() or a later write retries the page.
+*
+* Parameters:
+*  addr - external memory address.
+*  length - number of bytes.
+*  buf - data to write; copied before the function returns.
+*  now_ms - current time, used for the flush timeout.
+*
+*******************************************************************************/
+cy_rslt_t write_coalesce_write(uint32_t addr, size_t length, const uint8_t *buf, uint32_t now_ms)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if((0u == page_size) || (NULL == buf) || ((addr + length) > cy_serial_flash_qspi_get_size()))
+    {
+        return WRITE_COALESCE_RSLT_ERR_BAD_PARAM;
+    }
+
+    coalesce_stats.writes++;
+
+    while((length > 0u) && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t page = addr - (addr % page_size);
+        uint32_t offset = addr - page;
+        uint32_t chunk = page_size - offset;
+
+        if(chunk > length)
+        {
+            chunk = (uint32_t)length;
+        }
+
+        if((COALESCE_NO_PAGE != stage_page) && (page != stage_page))
+        {
+            result = coalesce_flush(false);
+
+            if(CY_RSLT_SUCCESS != result)
+            {
+                break;
+            }
+        }
+
+        if(COALESCE_NO_PAGE == stage_page)
+        {
+            memset(stage_data, 0xFF, page_size);
+            memset(stage_valid, 0, sizeof(stage_valid));
+            stage_page = page;
+            stage_start = offset;
+            stage_end = offset + chunk;
+            stage_count = 0u;
+            stage_time_ms = now_ms;
+        }
+
+        memcpy(&stage_data[offset], buf, chunk);
+
+        for(uint32_t index = offset; index < (offset + chunk); index++)
+        {
+            uint8_t mask = (uint8_t)(1u << (index % 8u));
+
+            if(0u == (stage_valid[index / 8u] & mask))
+            {
+                stage_valid[index / 8u] |= mask;
+                stage_count++;
+            }
+        }
+
+        stage_start = (offset < stage_start) ? offset : stage_start;
+        stage_end = ((offset + chunk) > stage_end) ? (offset + chunk) : stage_end;
+
+        if((CY_RSLT_SUCCESS == result) && (stage_count == page_size))
+        {
+            result = coalesce_flush(true);
+        }
+
+        addr += chunk;
+        buf += chunk;
+        length -= chunk;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: write_coalesce_read
+****************************************************************************//**
+* Summary:
+*  Reads from the external memory, including data that is still staged.
+*
+*******************************************************************************/
+cy_rslt_t write_coalesce_read(uint32_t addr, size_t length, uint8_t *buf)
+{
+    cy_rslt_t result = cy_serial_flash_qspi_read(addr, length, buf);
+
+    if((CY_RSLT_SUCCESS == result) && (COALESCE_NO_PAGE != stage_page) &&
+       (addr < (stage_page + page_size)) && ((addr + length) > stage_page))
+    {
+        for(uint32_t index = 0; index < page_size; index++)
+        {
+            uint32_t target = stage_page + index;
+
+            if((0u != (stage_valid[index / 8u] & (1u << (index % 8u)))) &&
+               (target >= addr) && (target < (addr + length)))
+            {
+                buf[target - addr] = stage_data[index];
+            }
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: write_coalesce_flush
+****************************************************************************//**
+* Summary:
+*  Programs any staged data.
+*
+*******************************************************************************/
+cy_rslt_t write_coalesce_flush(void)
+{
+    return coalesce_flush(false);
+}
+
+/*******************************************************************************
+* Function Name: write_coalesce_poll
+****************************************************************************//**
+* Summary:
+*  Programs the staged data if it was first written WRITE_COALESCE_TIMEOUT_MS
+*  or more ago. Call periodically.
+*
+* Parameters:
+*  now_ms - current time, on the same time base as write_coalesce_write().
+*
+*******************************************************************************/
+cy_rslt_t write_coalesce_poll(uint32_t now_ms)
+{
+    if((COALESCE_NO_PAGE != stage_page) && ((now_ms - stage_time_ms) >= WRITE_COALESCE_TIMEOUT_MS))
+    {
+        return coalesce_flush(false);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: write_coalesce_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the write and program counters since write_coalesce_init().
+*
+*******************************************************************************/
+void write_coalesce_get_stats(write_coalesce_stats_t *stats)
+{
+    *stats = coalesce_stats;
+}
+
+/*******************************************************************************
+* Function Name: write_coalesce_demo
+****************************************************************************//**
+* Summary:
+*  Logs 128 records of 16 bytes, first with one cy_serial_flash_qspi_write()
+*  per record, then through the coalescing buffer, and prints the number of
+*  program operations and the time of each. Must be called in MMIO mode.
+*
+* Parameters:
+*  ext_addr - start of a sector of at least 4 KB that may be erased.
+*
+*******************************************************************************/
+cy_rslt_t write_coalesce_demo(uint32_t ext_addr)
+{
+    static uint8_t expected[COALESCE_DEMO_SIZE];
+    static uint8_t actual[COALESCE_DEMO_SIZE];
+    write_coalesce_stats_t stats;
+    uint32_t direct_cycles;
+    uint32_t coalesced_cycles;
+    uint32_t start;
+    size_t sector_size = cy_serial_flash_qspi_get_erase_size(ext_addr);
+
+    if((0u != (ext_addr % sector_size)) || (sector_size < (2u * COALESCE_DEMO_SIZE)))
+    {
+        return WRITE_COALESCE_RSLT_ERR_BAD_PARAM;
+    }
+
+    for(uint32_t index = 0; index < COALESCE_DEMO_SIZE; index++)
+    {
+        expected[index] = (uint8_t)((index * 13u) ^ (index >> 4u));
+    }
+
+    cy_rslt_t result = write_coalesce_init();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_erase(ext_addr, sector_size);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    cycle_counter_init();
+
+    /* One program operation per record */
+    start = cycle_counter_get();
+    for(uint32_t record = 0; (record < COALESCE_DEMO_RECORDS) && (CY_RSLT_SUCCESS == result); record++)
+    {
+        uint32_t offset = record * COALESCE_DEMO_RECORD_SIZE;
+        result = cy_serial_flash_qspi_write(ext_addr + offset, COALESCE_DEMO_RECORD_SIZE, &expected[offset]);
+    }
+    direct_cycles = cycle_counter_get() - start;
+
+    /* Records coalesced into pages */
+    start = cycle_counter_get();
+    for(uint32_t record = 0; (record < COALESCE_DEMO_RECORDS) && (CY_RSLT_SUCCESS == result); record++)
+    {
+        uint32_t offset = record * COALESCE_DEMO_RECORD_SIZE;
+        result = write_coalesce_write(ext_addr + COALESCE_DEMO_SIZE + offset, COALESCE_DEMO_RECORD_SIZE,
+                                      &expected[offset], 0u);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = write_coalesce_flush();
+    }
+    coalesced_cycles = cycle_counter_get() - start;
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_read(ext_addr + COALESCE_DEMO_SIZE, COALESCE_DEMO_SIZE, actual);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if(0 != memcmp(expected, actual, COALESCE_DEMO_SIZE))
+    {
+        return WRITE_COALESCE_RSLT_ERR_VERIFY;
+    }
+
+    write_coalesce_get_stats(&stats);
+
+    printf("%u writes of %u bytes (page size %"PRIu32" bytes):\n", (unsigned int)COALESCE_DEMO_RECORDS,
+           (unsigned int)COALESCE_DEMO_RECORD_SIZE, page_size);
+    printf("  direct:    %u program operations, %"PRIu32" us\n", (unsigned int)COALESCE_DEMO_RECORDS,
+           cycle_counter_to_us(direct_cycles));
+    printf("  coalesced: %"PRIu32" program operations, %"PRIu32" us\n", stats.programs,
+           cycle_counter_to_us(coalesced_cycles));
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,103 @@
+/******************************************************************************
+* File Name:   write_coalesce.h
+*
+* Description: This file contains the declarations of the page-aligned write
+*              coalescing buffer placed in front of
+*              cy_serial_flash_qspi_write().
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef WRITE_COALESCE_H
+#define WRITE_COALESCE_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the write coalescing demo before entering XIP mode */
+#ifndef WRITE_COALESCE_DEMO_ENABLE
+#define WRITE_COALESCE_DEMO_ENABLE      (0u)
+#endif
+
+/* Largest program page size supported by the staging buffer */
+#define WRITE_COALESCE_MAX_PAGE_SIZE    (512u)
+
+/* Staged data older than this is flushed by write_coalesce_poll() */
+#ifndef WRITE_COALESCE_TIMEOUT_MS
+#define WRITE_COALESCE_TIMEOUT_MS       (100u)
+#endif
+
+#define WRITE_COALESCE_RSLT_ERR_PAGE_SIZE   APP_RSLT_ERR(APP_RSLT_RANGE_WRITE_COALESCE, 1u)
+#define WRITE_COALESCE_RSLT_ERR_BAD_PARAM   APP_RSLT_ERR(APP_RSLT_RANGE_WRITE_COALESCE, 2u)
+#define WRITE_COALESCE_RSLT_ERR_VERIFY      APP_RSLT_ERR(APP_RSLT_RANGE_WRITE_COALESCE, 3u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t writes;        /* Calls to write_coalesce_write() */
+    uint32_t programs;      /* Program operations issued to the memory */
+    uint32_t flushes_full;  /* Flushes because a page was completed */
+    uint32_t flushes_other; /* Flushes because of a different page, timeout or explicit flush */
+} write_coalesce_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t write_coalesce_init(void);
+cy_rslt_t write_coalesce_write(uint32_t addr, size_t length, const uint8_t *buf, uint32_t now_ms);
+cy_rslt_t write_coalesce_read(uint32_t addr, size_t length, uint8_t *buf);
+cy_rslt_t write_coalesce_flush(void);
+cy_rslt_t write_coalesce_poll(uint32_t now_ms);
+void write_coalesce_get_stats(write_coalesce_stats_t *stats);
+cy_rslt_t write_coalesce_demo(uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* WRITE_COALESCE_H */
+
+/* [] END OF FILE */
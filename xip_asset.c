@@ -0,0 +1,234 @@
+/******************************************************************************
+* File Name:   xip_asset.c
+*
+* Description: This file contains the zero-copy asset API and a demo that
+*              reads a font glyph and a sine lookup table in place from the
+*              external memory.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "xip_asset.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define GLYPH_ROWS                  (8u)
+#define SINE_QUARTER_STEPS          (64u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* 8x8 bitmap of the letter 'A', one byte per row, MSB on the left */
+static const uint8_t glyph_a[GLYPH_ROWS] XIP_ASSET =
+{
+    0x18, 0x3C, 0x66, 0x66, 0x7E, 0x66, 0x66, 0x00
+};
+
+/* First quarter of a sine wave in Q15, including the 90 degree point */
+static const int16_t sine_quarter[SINE_QUARTER_STEPS + 1u] XIP_ASSET =
+{
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+      6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+     18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+     27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+     32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767
+};
+
+/*******************************************************************************
+* Function Name: xip_asset_get
+****************************************************************************//**
+* Summary:
+*  Returns a read-only view of an asset in the cy_xip section. The view points
+*  directly into the memory-mapped external memory, so no SRAM copy is made.
+*  The view is valid only while the SMIF stays in XIP mode.
+*
+* Parameters:
+*  ptr - start of the asset.
+*  size - size of the asset in bytes.
+*  asset - receives the view.
+*
+*******************************************************************************/
+cy_rslt_t xip_asset_get(const void *ptr, size_t size, xip_asset_t *asset)
+{
+    if((NULL == ptr) || (NULL == asset))
+    {
+        return XIP_ASSET_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(!xip_asset_contains(ptr, size))
+    {
+        return XIP_ASSET_RSLT_ERR_BOUNDS;
+    }
+
+    if(CY_SMIF_MEMORY != Cy_SMIF_GetMode(SMIF0))
+    {
+        return XIP_ASSET_RSLT_ERR_NOT_MAPPED;
+    }
+
+    asset->data = (const uint8_t *)ptr;
+    asset->size = (uint32_t)size;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: xip_asset_slice
+****************************************************************************//**
+* Summary:
+*  Returns a pointer to part of an asset, for example one glyph of a font or
+*  one block of an audio clip, after checking it against the asset bounds.
+*
+* Parameters:
+*  asset - view returned by xip_asset_get().
+*  offset - offset of the part in the asset.
+*  length - length of the part.
+*  data - receives the pointer to the part.
+*
+*******************************************************************************/
+cy_rslt_t xip_asset_slice(const xip_asset_t *asset, uint32_t offset, uint32_t length, const uint8_t **data)
+{
+    if((NULL == asset) || (NULL == data))
+    {
+        return XIP_ASSET_RSLT_ERR_BAD_PARAM;
+    }
+
+    if((offset > asset->size) || (length > (asset->size - offset)))
+    {
+        return XIP_ASSET_RSLT_ERR_BOUNDS;
+    }
+
+    *data = &asset->data[offset];
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: demo_sine
+****************************************************************************//**
+* Summary:
+*  Looks up sin(2 * pi * phase / 256) in Q15 from the quarter-wave table.
+*
+*******************************************************************************/
+static int32_t demo_sine(const int16_t *table, uint32_t phase)
+{
+    uint32_t index = phase % SINE_QUARTER_STEPS;
+    uint32_t quadrant = (phase / SINE_QUARTER_STEPS) % 4u;
+    int32_t value = (0u == (quadrant % 2u)) ? table[index] : table[SINE_QUARTER_STEPS - index];
+
+    return (quadrant < 2u) ? value : -value;
+}
+
+/*******************************************************************************
+* Function Name: xip_asset_demo
+****************************************************************************//**
+* Summary:
+*  Renders a font glyph and evaluates a sine table directly from the external
+*  memory, then shows that a buffer outside the cy_xip section is rejected.
+*  Must be called in XIP mode.
+*
+*******************************************************************************/
+cy_rslt_t xip_asset_demo(void)
+{
+    xip_asset_t glyph;
+    xip_asset_t sine;
+    uint8_t sram_buffer[GLYPH_ROWS] = { 0u };
+    const uint8_t *row;
+
+    cy_rslt_t result = xip_asset_get(glyph_a, sizeof(glyph_a), &glyph);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = xip_asset_get(sine_quarter, sizeof(sine_quarter), &sine);
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    printf("cy_xip section: 0x%08"PRIx32" - 0x%08"PRIx32"\n", (uint32_t)__cy_xip_start, (uint32_t)__cy_xip_end);
+    printf("Glyph at 0x%08"PRIx32" (%"PRIu32" bytes):\n", (uint32_t)glyph.data, glyph.size);
+
+    for(uint32_t index = 0; (index < GLYPH_ROWS) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        result = xip_asset_slice(&glyph, index, 1u, &row);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            printf("  ");
+
+            for(uint32_t bit = 0; bit < 8u; bit++)
+            {
+                printf("%c", (0u != (*row & (0x80u >> bit))) ? '#' : '.');
+            }
+
+            printf("\n");
+        }
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        const int16_t *table = (const int16_t *)sine.data;
+
+        printf("Sine table at 0x%08"PRIx32" (%"PRIu32" bytes):\n", (uint32_t)sine.data, sine.size);
+
+        for(uint32_t phase = 0; phase < 256u; phase += 32u)
+        {
+            printf("  sin(%3"PRIu32"/256 turn) = %6"PRId32"\n", phase, demo_sine(table, phase));
+        }
+
+        printf("%"PRIu32" bytes read in place, no SRAM copy\n", glyph.size + sine.size);
+
+        /* A buffer in SRAM is not an asset */
+        if(XIP_ASSET_RSLT_ERR_BOUNDS != xip_asset_get(sram_buffer, sizeof(sram_buffer), &glyph))
+        {
+            result = XIP_ASSET_RSLT_ERR_BOUNDS;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
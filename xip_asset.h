@@ -0,0 +1,121 @@
+/******************************************************************************
+* File Name:   xip_asset.h
+*
+* Description: This file contains the declarations of the zero-copy asset
+*              API. Read-mostly data placed in the cy_xip section is accessed
+*              through const pointers into the memory-mapped external memory
+*              instead of being copied to SRAM.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef XIP_ASSET_H
+#define XIP_ASSET_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the zero-copy asset demo in XIP mode */
+#ifndef XIP_ASSET_DEMO_ENABLE
+#define XIP_ASSET_DEMO_ENABLE           (0u)
+#endif
+
+/* Places constant data (fonts, lookup tables, audio clips) in the cy_xip
+ * section of the linker file. The data itself must be the object declared,
+ * for example an array; a pointer placed here still points to a literal in
+ * internal flash.
+ */
+#define XIP_ASSET                       CY_SECTION(".cy_xip") __attribute__((used))
+
+#define XIP_ASSET_RSLT_ERR_BAD_PARAM    APP_RSLT_ERR(APP_RSLT_RANGE_XIP_ASSET, 1u)
+#define XIP_ASSET_RSLT_ERR_BOUNDS       APP_RSLT_ERR(APP_RSLT_RANGE_XIP_ASSET, 2u)
+#define XIP_ASSET_RSLT_ERR_NOT_MAPPED   APP_RSLT_ERR(APP_RSLT_RANGE_XIP_ASSET, 3u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Read-only view of an asset in the memory-mapped external memory */
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size;
+} xip_asset_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Defined by the linker file */
+extern uint8_t __cy_xip_start[];
+extern uint8_t __cy_xip_end[];
+
+/*******************************************************************************
+* Function Name: xip_asset_contains
+****************************************************************************//**
+* Summary:
+*  Checks whether the range [ptr, ptr + size) lies entirely in the cy_xip
+*  section.
+*
+*******************************************************************************/
+static inline bool xip_asset_contains(const void *ptr, size_t size)
+{
+    uint32_t start = (uint32_t)ptr;
+
+    return (start >= (uint32_t)__cy_xip_start) && (start <= (uint32_t)__cy_xip_end) &&
+           (size <= ((uint32_t)__cy_xip_end - start));
+}
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t xip_asset_get(const void *ptr, size_t size, xip_asset_t *asset);
+cy_rslt_t xip_asset_slice(const xip_asset_t *asset, uint32_t offset, uint32_t length, const uint8_t **data);
+cy_rslt_t xip_asset_demo(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XIP_ASSET_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,428 @@
+/******************************************************************************
+* File Name:   xip_benchmark.c
+*
+* Description: This file contains the XIP execution benchmark. The same set
+*              of kernels is built three times, for external memory (XIP),
+*              internal flash and SRAM, and each copy is timed with the DWT
+*              cycle counter.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "xip_benchmark.h"
+#include "qspi_bus.h"
+#include "smif_cache.h"
+#include "cycle_counter.h"
+#include "app_result.h"
+#include "ramfunc.h"
+#include <inttypes.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define XIP_BENCHMARK_COPY_WORDS        (256u)    /* 1 KB copied by the memcpy kernel */
+#define XIP_BENCHMARK_TEXT_SIZE         (512u)    /* Input of the CRC and state machine kernels */
+#define XIP_BENCHMARK_FIR_TAPS          (16u)
+#define XIP_BENCHMARK_FIR_SAMPLES       (256u)
+#define XIP_BENCHMARK_STREAM_SIZE       (32768u)  /* Read sequentially from the start of the XIP region */
+
+#define XIP_BENCHMARK_RSLT_ERR_NOT_XIP      APP_RSLT_ERR(APP_RSLT_RANGE_XIP_BENCHMARK, 1u)
+#define XIP_BENCHMARK_RSLT_ERR_MISMATCH     APP_RSLT_ERR(APP_RSLT_RANGE_XIP_BENCHMARK, 2u)
+
+/* Attributes shared by every kernel copy */
+#define XIP_BENCHMARK_KERNEL            __attribute__((noinline, used, optimize("no-tree-loop-distribute-patterns")))
+
+#define XIP_BENCHMARK_CAT_(a, b)        a##b
+#define XIP_BENCHMARK_CAT(a, b)         XIP_BENCHMARK_CAT_(a, b)
+#define XIP_BENCHMARK_NAME(name)        XIP_BENCHMARK_CAT(name, XIP_BENCHMARK_SUFFIX)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Working buffers of the kernels. They live in SRAM for every placement, so
+ * that only the instruction fetches differ between the measured copies.
+ */
+typedef struct
+{
+    uint32_t copy_src[XIP_BENCHMARK_COPY_WORDS];
+    uint32_t copy_dst[XIP_BENCHMARK_COPY_WORDS];
+    uint8_t  text[XIP_BENCHMARK_TEXT_SIZE];
+    int16_t  fir_taps[XIP_BENCHMARK_FIR_TAPS];
+    int16_t  fir_input[XIP_BENCHMARK_FIR_SAMPLES];
+    int16_t  fir_output[XIP_BENCHMARK_FIR_SAMPLES];
+} xip_benchmark_buffers_t;
+
+typedef uint32_t (*xip_benchmark_fn_t)(xip_benchmark_buffers_t *buffers);
+
+/*******************************************************************************
+* Kernels
+********************************************************************************/
+/* External memory */
+#define XIP_BENCHMARK_PLACEMENT         CY_SECTION(".cy_xip_code")
+#define XIP_BENCHMARK_SUFFIX            _xip
+#include "xip_benchmark_kernels.h"
+#undef XIP_BENCHMARK_PLACEMENT
+#undef XIP_BENCHMARK_SUFFIX
+
+/* Internal flash */
+#define XIP_BENCHMARK_PLACEMENT
+#define XIP_BENCHMARK_SUFFIX            _flash
+#include "xip_benchmark_kernels.h"
+#undef XIP_BENCHMARK_PLACEMENT
+#undef XIP_BENCHMARK_SUFFIX
+
+/* SRAM, copied from internal flash at startup */
+#define XIP_BENCHMARK_PLACEMENT         APP_RAMFUNC
+#define XIP_BENCHMARK_SUFFIX            _sram
+#include "xip_benchmark_kernels.h"
+#undef XIP_BENCHMARK_PLACEMENT
+#undef XIP_BENCHMARK_SUFFIX
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static xip_benchmark_buffers_t bench_buffers;
+
+static const xip_benchmark_fn_t bench_kernels[XIP_BENCHMARK_KERNEL_COUNT][XIP_BENCHMARK_PLACEMENT_COUNT] =
+{
+    [XIP_BENCHMARK_MEMCPY]        = { kernel_memcpy_xip, kernel_memcpy_flash, kernel_memcpy_sram },
+    [XIP_BENCHMARK_CRC32]         = { kernel_crc32_xip, kernel_crc32_flash, kernel_crc32_sram },
+    [XIP_BENCHMARK_FIR]           = { kernel_fir_xip, kernel_fir_flash, kernel_fir_sram },
+    [XIP_BENCHMARK_STATE_MACHINE] = { kernel_state_machine_xip, kernel_state_machine_flash,
+                                      kernel_state_machine_sram },
+};
+
+static const char *const bench_kernel_names[XIP_BENCHMARK_KERNEL_COUNT] =
+{
+    [XIP_BENCHMARK_MEMCPY]        = "memcpy (1 KB)",
+    [XIP_BENCHMARK_CRC32]         = "CRC32 (512 B)",
+    [XIP_BENCHMARK_FIR]           = "FIR (16 taps)",
+    [XIP_BENCHMARK_STATE_MACHINE] = "State machine",
+};
+
+/*******************************************************************************
+* Function Name: bench_prepare_buffers
+****************************************************************************//**
+* Summary:
+*  Fills the kernel inputs with deterministic pseudo-random data.
+*
+*******************************************************************************/
+static void bench_prepare_buffers(void)
+{
+    static const char alphabet[] = "abcXYZ_0123456789 \",;(){}=+";
+    uint32_t seed = 0x12345678u;
+
+    for(uint32_t index = 0; index < XIP_BENCHMARK_COPY_WORDS; index++)
+    {
+        seed = (seed * 1664525u) + 1013904223u;
+        bench_buffers.copy_src[index] = seed;
+    }
+
+    for(uint32_t index = 0; index < XIP_BENCHMARK_TEXT_SIZE; index++)
+    {
+        seed = (seed * 1664525u) + 1013904223u;
+        bench_buffers.text[index] = (uint8_t)alphabet[(seed >> 24u) % (sizeof(alphabet) - 1u)];
+    }
+
+    for(uint32_t index = 0; index < XIP_BENCHMARK_FIR_TAPS; index++)
+    {
+        /* Triangular low-pass window, sums to roughly 1.0 in Q15 */
+        uint32_t weight = (index < (XIP_BENCHMARK_FIR_TAPS / 2u)) ? (index + 1u) : (XIP_BENCHMARK_FIR_TAPS - index);
+        bench_buffers.fir_taps[index] = (int16_t)(weight * 455u);
+    }
+
+    for(uint32_t index = 0; index < XIP_BENCHMARK_FIR_SAMPLES; index++)
+    {
+        seed = (seed * 1664525u) + 1013904223u;
+        bench_buffers.fir_input[index] = (int16_t)(seed >> 16u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_measure
+****************************************************************************//**
+* Summary:
+*  Times every kernel from every placement. The SMIF caches are invalidated
+*  before the first (cold) call of each kernel copy, then the kernel is run
+*  XIP_BENCHMARK_ITERATIONS more times to obtain the warm average. Interrupts
+*  are disabled while a kernel is timed. The SMIF must be in XIP mode.
+*
+* Parameters:
+*  results - array receiving the timings, indexed by xip_benchmark_kernel_t.
+*
+* Return:
+*  CY_RSLT_SUCCESS, or an error if XIP is not enabled or if the copies of a
+*  kernel do not produce the same result.
+*
+*******************************************************************************/
+cy_rslt_t xip_benchmark_measure(xip_benchmark_result_t results[XIP_BENCHMARK_KERNEL_COUNT])
+{
+    if(CY_SMIF_MEMORY != Cy_SMIF_GetMode(SMIF0))
+    {
+        return XIP_BENCHMARK_RSLT_ERR_NOT_XIP;
+    }
+
+    bench_prepare_buffers();
+    cycle_counter_init();
+
+    for(uint32_t kernel = 0; kernel < XIP_BENCHMARK_KERNEL_COUNT; kernel++)
+    {
+        uint32_t reference = 0u;
+
+        for(uint32_t placement = 0; placement < XIP_BENCHMARK_PLACEMENT_COUNT; placement++)
+        {
+            xip_benchmark_fn_t fn = bench_kernels[kernel][placement];
+            uint32_t checksum;
+            uint32_t start;
+            uint32_t cold;
+            uint32_t total;
+
+            uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+            (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+
+            start = cycle_counter_get();
+            checksum = fn(&bench_buffers);
+            cold = cycle_counter_get() - start;
+
+            start = cycle_counter_get();
+            for(uint32_t iteration = 0; iteration < XIP_BENCHMARK_ITERATIONS; iteration++)
+            {
+                (void)fn(&bench_buffers);
+            }
+            total = cycle_counter_get() - start;
+
+            Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+            results[kernel].cold[placement] = cold;
+            results[kernel].warm[placement] = total / XIP_BENCHMARK_ITERATIONS;
+
+            if(0u == placement)
+            {
+                reference = checksum;
+            }
+            else if(reference != checksum)
+            {
+                return XIP_BENCHMARK_RSLT_ERR_MISMATCH;
+            }
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: bench_stream_read
+****************************************************************************//**
+* Summary:
+*  Reads words sequentially and returns their sum. Runs from SRAM, so that
+*  only data fetches go to the external memory.
+*
+*******************************************************************************/
+APP_RAMFUNC static uint32_t bench_stream_read(const volatile uint32_t *src, uint32_t words)
+{
+    uint32_t sum = 0u;
+
+    for(uint32_t index = 0; index < words; index++)
+    {
+        sum += src[index];
+    }
+
+    return sum;
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_measure_read
+****************************************************************************//**
+* Summary:
+*  Measures the sequential read bandwidth of the memory-mapped region with a
+*  cold cache, which bounds the rate at which code can be fetched from the
+*  external memory. The SMIF must be in XIP mode.
+*
+* Parameters:
+*  bytes_per_second - receives the measured bandwidth.
+*
+*******************************************************************************/
+cy_rslt_t xip_benchmark_measure_read(uint32_t *bytes_per_second)
+{
+    if(CY_SMIF_MEMORY != Cy_SMIF_GetMode(SMIF0))
+    {
+        return XIP_BENCHMARK_RSLT_ERR_NOT_XIP;
+    }
+
+    cycle_counter_init();
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+
+    uint32_t start = cycle_counter_get();
+    (void)bench_stream_read((const volatile uint32_t *)CY_XIP_BASE, XIP_BENCHMARK_STREAM_SIZE / sizeof(uint32_t));
+    uint32_t cycles = cycle_counter_get() - start;
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    *bytes_per_second = (uint32_t)(((uint64_t)XIP_BENCHMARK_STREAM_SIZE * SystemCoreClock) / cycles);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_print
+****************************************************************************//**
+* Summary:
+*  Prints the benchmark results as a table of CM4 cycles per iteration, with
+*  the slowdown of warm XIP execution relative to SRAM.
+*
+* Parameters:
+*  results - timings filled in by xip_benchmark_measure().
+*
+*******************************************************************************/
+void xip_benchmark_print(const xip_benchmark_result_t results[XIP_BENCHMARK_KERNEL_COUNT])
+{
+    printf("\nCycles per iteration (CM4 @ %"PRIu32" Hz, %u iterations):\n",
+           SystemCoreClock, (unsigned int)XIP_BENCHMARK_ITERATIONS);
+    printf("%-16s %10s %10s %10s %10s %10s\n", "Kernel", "XIP cold", "XIP warm", "Flash", "SRAM", "XIP/SRAM");
+    printf("--------------------------------------------------------------------------\n");
+
+    for(uint32_t kernel = 0; kernel < XIP_BENCHMARK_KERNEL_COUNT; kernel++)
+    {
+        const xip_benchmark_result_t *result = &results[kernel];
+        uint32_t sram = (0u != result->warm[XIP_BENCHMARK_SRAM]) ? result->warm[XIP_BENCHMARK_SRAM] : 1u;
+        uint32_t ratio = (result->warm[XIP_BENCHMARK_XIP] * 100u) / sram;
+
+        printf("%-16s %10"PRIu32" %10"PRIu32" %10"PRIu32" %10"PRIu32" %7"PRIu32".%02"PRIu32"\n",
+               bench_kernel_names[kernel],
+               result->cold[XIP_BENCHMARK_XIP],
+               result->warm[XIP_BENCHMARK_XIP],
+               result->warm[XIP_BENCHMARK_FLASH],
+               result->warm[XIP_BENCHMARK_SRAM],
+               ratio / 100u, ratio % 100u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_cache_workload
+****************************************************************************//**
+* Summary:
+*  Runs one kernel copy for smif_cache_profile().
+*
+*******************************************************************************/
+static void bench_cache_workload(void *arg)
+{
+    (void)(*(const xip_benchmark_fn_t *)arg)(&bench_buffers);
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_cache_report
+****************************************************************************//**
+* Summary:
+*  Profiles the external memory copy of each kernel with smif_cache_profile(),
+*  taking the SRAM copy as the all-hit time, and prints the estimated cache
+*  hit rates of the instruction fetches. The SMIF must be in XIP mode.
+*
+* Parameters:
+*  results - timings filled in by xip_benchmark_measure().
+*
+*******************************************************************************/
+cy_rslt_t xip_benchmark_cache_report(const xip_benchmark_result_t results[XIP_BENCHMARK_KERNEL_COUNT])
+{
+    smif_cache_profile_t profile;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    printf("\nSMIF cache, instruction fetches of the XIP kernels (cycles, estimated hit rate):\n");
+    smif_cache_print_config();
+    printf("%-18s %10s %10s %5s %10s %5s\n", "Kernel", "Uncached", "Cold", "Hit", "Warm", "Hit");
+    printf("---------------------------------------------------------------\n");
+
+    for(uint32_t kernel = 0; (kernel < XIP_BENCHMARK_KERNEL_COUNT) && (CY_RSLT_SUCCESS == result); kernel++)
+    {
+        result = smif_cache_profile(bench_cache_workload, (void *)&bench_kernels[kernel][XIP_BENCHMARK_XIP],
+                                    results[kernel].warm[XIP_BENCHMARK_SRAM], &profile);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            smif_cache_print(bench_kernel_names[kernel], &profile);
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: xip_benchmark_run
+****************************************************************************//**
+* Summary:
+*  Measures all kernels, their cache hit rates and the sequential read
+*  bandwidth, and prints the results over the debug UART.
+*
+* Return:
+*  CY_RSLT_SUCCESS, or the first error of the measurements.
+*
+*******************************************************************************/
+cy_rslt_t xip_benchmark_run(void)
+{
+    xip_benchmark_result_t results[XIP_BENCHMARK_KERNEL_COUNT];
+    cy_rslt_t result = xip_benchmark_measure(results);
+
+    uint32_t bandwidth;
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        xip_benchmark_print(results);
+        result = xip_benchmark_cache_report(results);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = xip_benchmark_measure_read(&bandwidth);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        /* Hundredths of MB/s (1 MB = 10^6 bytes) */
+        bandwidth /= 10000u;
+
+        printf("\nSequential XIP read, cold cache: %"PRIu32".%02"PRIu32" MB/s\n", bandwidth / 100u, bandwidth % 100u);
+        qspi_bus_print();
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
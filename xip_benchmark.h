@@ -0,0 +1,113 @@
+/******************************************************************************
+* File Name:   xip_benchmark.h
+*
+* Description: This file contains the declarations of the XIP execution
+*              benchmark, which compares code running from external (XIP),
+*              internal flash and SRAM.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef XIP_BENCHMARK_H
+#define XIP_BENCHMARK_H
+
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 (for example, through DEFINES in the Makefile) to run the benchmark
+ * after the XIP demonstration.
+ */
+#ifndef XIP_BENCHMARK_ENABLE
+#define XIP_BENCHMARK_ENABLE        (0u)
+#endif
+
+/* Number of timed iterations of each kernel */
+#ifndef XIP_BENCHMARK_ITERATIONS
+#define XIP_BENCHMARK_ITERATIONS    (100u)
+#endif
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Where a copy of the benchmark kernels is executed from */
+typedef enum
+{
+    XIP_BENCHMARK_XIP,      /* External memory, .cy_xip_code */
+    XIP_BENCHMARK_FLASH,    /* Internal flash, .text */
+    XIP_BENCHMARK_SRAM,     /* SRAM, .cy_ramfunc */
+    XIP_BENCHMARK_PLACEMENT_COUNT
+} xip_benchmark_placement_t;
+
+/* Benchmark kernels */
+typedef enum
+{
+    XIP_BENCHMARK_MEMCPY,
+    XIP_BENCHMARK_CRC32,
+    XIP_BENCHMARK_FIR,
+    XIP_BENCHMARK_STATE_MACHINE,
+    XIP_BENCHMARK_KERNEL_COUNT
+} xip_benchmark_kernel_t;
+
+/* Timing of one kernel for all placements, in CM4 cycles per iteration */
+typedef struct
+{
+    uint32_t cold[XIP_BENCHMARK_PLACEMENT_COUNT];   /* First call after cache invalidation */
+    uint32_t warm[XIP_BENCHMARK_PLACEMENT_COUNT];   /* Average over the timed iterations */
+} xip_benchmark_result_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t xip_benchmark_measure(xip_benchmark_result_t results[XIP_BENCHMARK_KERNEL_COUNT]);
+cy_rslt_t xip_benchmark_measure_read(uint32_t *bytes_per_second);
+cy_rslt_t xip_benchmark_cache_report(const xip_benchmark_result_t results[XIP_BENCHMARK_KERNEL_COUNT]);
+void xip_benchmark_print(const xip_benchmark_result_t results[XIP_BENCHMARK_KERNEL_COUNT]);
+cy_rslt_t xip_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XIP_BENCHMARK_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,203 @@
+/******************************************************************************
+* File Name:   xip_benchmark_kernels.h
+*
+* Description: This file contains the kernels timed by the XIP benchmark. It
+*              is included once per code placement by xip_benchmark.c and
+*              must not be included anywhere else.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/* No include guard: this file is expanded once for every placement. Before
+ * each inclusion xip_benchmark.c defines XIP_BENCHMARK_PLACEMENT (the section
+ * attribute) and XIP_BENCHMARK_SUFFIX (appended to every kernel name).
+ *
+ * The kernels must not call any other function, so that all instructions of a
+ * timed kernel are fetched from the placement under test. Loop distribution
+ * is disabled because it would replace the copy loop with a call to memcpy().
+ */
+
+/*******************************************************************************
+* Function Name: kernel_memcpy
+****************************************************************************//**
+* Summary:
+*  Word-by-word copy of the source buffer into the destination buffer.
+*
+*******************************************************************************/
+XIP_BENCHMARK_PLACEMENT XIP_BENCHMARK_KERNEL
+uint32_t XIP_BENCHMARK_NAME(kernel_memcpy)(xip_benchmark_buffers_t *buffers)
+{
+    const uint32_t *src = buffers->copy_src;
+    uint32_t *dst = buffers->copy_dst;
+
+    for(uint32_t index = 0; index < XIP_BENCHMARK_COPY_WORDS; index++)
+    {
+        dst[index] = src[index];
+    }
+
+    return dst[XIP_BENCHMARK_COPY_WORDS - 1u] ^ dst[0];
+}
+
+/*******************************************************************************
+* Function Name: kernel_crc32
+****************************************************************************//**
+* Summary:
+*  Bitwise (table-less) CRC-32 (IEEE 802.3) of the text buffer.
+*
+*******************************************************************************/
+XIP_BENCHMARK_PLACEMENT XIP_BENCHMARK_KERNEL
+uint32_t XIP_BENCHMARK_NAME(kernel_crc32)(xip_benchmark_buffers_t *buffers)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for(uint32_t index = 0; index < XIP_BENCHMARK_TEXT_SIZE; index++)
+    {
+        crc ^= buffers->text[index];
+
+        for(uint32_t bit = 0; bit < 8u; bit++)
+        {
+            crc = (crc >> 1u) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+
+    return ~crc;
+}
+
+/*******************************************************************************
+* Function Name: kernel_fir
+****************************************************************************//**
+* Summary:
+*  Q15 FIR filter over the sample buffer.
+*
+*******************************************************************************/
+XIP_BENCHMARK_PLACEMENT XIP_BENCHMARK_KERNEL
+uint32_t XIP_BENCHMARK_NAME(kernel_fir)(xip_benchmark_buffers_t *buffers)
+{
+    uint32_t checksum = 0u;
+
+    for(uint32_t n = XIP_BENCHMARK_FIR_TAPS - 1u; n < XIP_BENCHMARK_FIR_SAMPLES; n++)
+    {
+        int32_t acc = 0;
+
+        for(uint32_t k = 0; k < XIP_BENCHMARK_FIR_TAPS; k++)
+        {
+            acc += (int32_t)buffers->fir_taps[k] * (int32_t)buffers->fir_input[n - k];
+        }
+
+        buffers->fir_output[n] = (int16_t)(acc >> 15);
+        checksum += (uint16_t)buffers->fir_output[n];
+    }
+
+    return checksum;
+}
+
+/*******************************************************************************
+* Function Name: kernel_state_machine
+****************************************************************************//**
+* Summary:
+*  Branch-heavy tokenizer that classifies the text buffer into numbers, words,
+*  quoted strings and punctuation.
+*
+*******************************************************************************/
+XIP_BENCHMARK_PLACEMENT XIP_BENCHMARK_KERNEL
+uint32_t XIP_BENCHMARK_NAME(kernel_state_machine)(xip_benchmark_buffers_t *buffers)
+{
+    enum { STATE_IDLE, STATE_NUMBER, STATE_WORD, STATE_STRING } state = STATE_IDLE;
+    uint32_t numbers = 0u;
+    uint32_t words = 0u;
+    uint32_t strings = 0u;
+    uint32_t symbols = 0u;
+
+    for(uint32_t index = 0; index < XIP_BENCHMARK_TEXT_SIZE; index++)
+    {
+        uint8_t c = buffers->text[index];
+        bool is_digit = (c >= '0') && (c <= '9');
+        bool is_alpha = ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_');
+
+        switch(state)
+        {
+            case STATE_NUMBER:
+                if(is_digit)
+                {
+                    break;
+                }
+                state = STATE_IDLE;
+                /* Fall through - reclassify the terminating character */
+            case STATE_IDLE:
+                if(is_digit)
+                {
+                    numbers++;
+                    state = STATE_NUMBER;
+                }
+                else if(is_alpha)
+                {
+                    words++;
+                    state = STATE_WORD;
+                }
+                else if(c == '"')
+                {
+                    strings++;
+                    state = STATE_STRING;
+                }
+                else if(c > ' ')
+                {
+                    symbols++;
+                }
+                break;
+
+            case STATE_WORD:
+                if(!is_alpha && !is_digit)
+                {
+                    state = STATE_IDLE;
+                    symbols += (c > ' ') ? 1u : 0u;
+                }
+                break;
+
+            case STATE_STRING:
+            default:
+                if(c == '"')
+                {
+                    state = STATE_IDLE;
+                }
+                break;
+        }
+    }
+
+    return (numbers << 24u) ^ (words << 16u) ^ (strings << 8u) ^ symbols;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,351 @@
+/******************************************************************************
+* File Name:   xip_crypto.c
+*
+* Description: This file contains the setup of the SMIF on-the-fly AES-128
+*              decryption of XIP reads, a check that the image in the
+*              external memory was encrypted with the same key, and a
+*              benchmark of the XIP read latency with and without decryption.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+#include "ramfunc.h"
+#include "xip_asset.h"
+#include "xip_crypto.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Plaintext of the marker; scripts/xip_encrypt.py looks for it too */
+#define CRYPTO_MARKER_TEXT              "XIP_CRYPTO_CHECK"
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint32_t total_cycles;
+    uint32_t seq_cycles;            /* Sequential read of XIP_CRYPTO_BENCH_SEQ_SIZE bytes */
+    uint32_t checksum;              /* Keeps the reads from being optimized out */
+} crypto_bench_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Encrypted along with the rest of the XIP image. Aligned to an AES block, so
+ * that the post-build script can recognize both its plaintext and ciphertext.
+ */
+XIP_ASSET CY_ALIGN(XIP_CRYPTO_BLOCK_SIZE) static const uint8_t crypto_marker[XIP_CRYPTO_BLOCK_SIZE] =
+    CRYPTO_MARKER_TEXT;
+
+static const cy_stc_smif_mem_config_t *crypto_mem_config = NULL;
+static cy_stc_smif_context_t crypto_context;
+
+/*******************************************************************************
+* Function Name: crypto_set_enable
+****************************************************************************//**
+* Summary:
+*  Turns the decryption of XIP reads on or off and invalidates the SMIF
+*  cache, which may hold lines read with the other setting. While it is off,
+*  no code may be fetched from the external memory.
+*
+*******************************************************************************/
+APP_RAMFUNC static void crypto_set_enable(bool enable)
+{
+    while(Cy_SMIF_BusyCheck(SMIF0))
+    {
+    }
+
+    if(enable)
+    {
+        (void)Cy_SMIF_SetCryptoEnable(SMIF0, crypto_mem_config->slaveSelect);
+    }
+    else
+    {
+        (void)Cy_SMIF_SetCryptoDisable(SMIF0, crypto_mem_config->slaveSelect);
+    }
+
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+}
+
+/*******************************************************************************
+* Function Name: crypto_measure
+****************************************************************************//**
+* Summary:
+*  Times single-word reads that each miss the SMIF cache, then a sequential
+*  read through the cache with prefetching. Runs from SRAM with interrupts
+*  masked: with decryption turned off, code in the external memory cannot
+*  execute.
+*
+* Parameters:
+*  decrypt - false to turn decryption off for the measurement.
+*  bench - receives the results.
+*
+*******************************************************************************/
+APP_RAMFUNC static void crypto_measure(bool decrypt, crypto_bench_t *bench)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t base = crypto_mem_config->baseAddress;
+
+    if(!decrypt)
+    {
+        crypto_set_enable(false);
+    }
+
+    bench->min_cycles = UINT32_MAX;
+    bench->max_cycles = 0u;
+    bench->total_cycles = 0u;
+    bench->checksum = 0u;
+
+    for(uint32_t index = 0; index < XIP_CRYPTO_BENCH_MISSES; index++)
+    {
+        const volatile uint32_t *addr = (const volatile uint32_t *)(base + (index * XIP_CRYPTO_BENCH_STRIDE));
+
+        (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+
+        uint32_t start = cycle_counter_get();
+        bench->checksum += *addr;
+        uint32_t cycles = cycle_counter_get() - start;
+
+        bench->total_cycles += cycles;
+        bench->min_cycles = (cycles < bench->min_cycles) ? cycles : bench->min_cycles;
+        bench->max_cycles = (cycles > bench->max_cycles) ? cycles : bench->max_cycles;
+    }
+
+    const volatile uint32_t *words = (const volatile uint32_t *)base;
+
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+
+    uint32_t start = cycle_counter_get();
+
+    for(uint32_t index = 0; index < (XIP_CRYPTO_BENCH_SEQ_SIZE / sizeof(uint32_t)); index++)
+    {
+        bench->checksum += words[index];
+    }
+
+    bench->seq_cycles = cycle_counter_get() - start;
+
+    if(!decrypt)
+    {
+        crypto_set_enable(true);
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: crypto_report
+****************************************************************************//**
+* Summary:
+*  Prints the results of one benchmark pass.
+*
+*******************************************************************************/
+static void crypto_report(const char *name, const crypto_bench_t *bench)
+{
+    uint32_t seq_us = cycle_counter_to_us(bench->seq_cycles);
+
+    printf("  %-10s miss min %5"PRIu32", avg %5"PRIu32", max %5"PRIu32" cycles; %"PRIu32" KB sequential in %"
+           PRIu32" us (%"PRIu32" KB/s)\n", name, bench->min_cycles, bench->total_cycles / XIP_CRYPTO_BENCH_MISSES,
+           bench->max_cycles, (uint32_t)(XIP_CRYPTO_BENCH_SEQ_SIZE / 1024u), seq_us,
+           (0u != seq_us) ? (uint32_t)(((uint64_t)XIP_CRYPTO_BENCH_SEQ_SIZE * 1000000u) / (1024u * seq_us)) : 0u);
+}
+
+/*******************************************************************************
+* Function Name: xip_crypto_init
+****************************************************************************//**
+* Summary:
+*  Loads the key into the SMIF and turns on the decryption of XIP reads from
+*  the memory. Must be called after the QSPI block is initialized and before
+*  any code or data is fetched from the external memory. MMIO transfers are
+*  not affected: data programmed at runtime and read through XIP must be
+*  encrypted with xip_crypto_encrypt() first. Does nothing unless
+*  XIP_CRYPTO_ENABLE is 1.
+*
+* Parameters:
+*  mem_config - memory to decrypt.
+*
+*******************************************************************************/
+cy_rslt_t xip_crypto_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+#if (XIP_CRYPTO_ENABLE)
+    uint32_t key[XIP_CRYPTO_BLOCK_SIZE / sizeof(uint32_t)] =
+    {
+        XIP_CRYPTO_KEY0, XIP_CRYPTO_KEY1, XIP_CRYPTO_KEY2, XIP_CRYPTO_KEY3
+    };
+
+    if(NULL == mem_config)
+    {
+        return XIP_CRYPTO_RSLT_ERR_BAD_PARAM;
+    }
+
+    Cy_SMIF_SetCryptoKey(SMIF0, key);
+
+    /* Do not leave a copy of the key on the stack */
+    memset(key, 0, sizeof(key));
+
+    if(CY_SMIF_SUCCESS != Cy_SMIF_SetCryptoEnable(SMIF0, mem_config->slaveSelect))
+    {
+        return XIP_CRYPTO_RSLT_ERR_SMIF;
+    }
+
+    crypto_context.timeout = 1000u;
+    crypto_mem_config = mem_config;
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+#else
+    (void)mem_config;
+#endif
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: xip_crypto_check
+****************************************************************************//**
+* Summary:
+*  Reads a marker of the XIP image through the memory-mapped region and
+*  checks that it decrypts. It fails if the post-build step did not run, or
+*  if it used another key than the firmware. Must be called in XIP mode.
+*
+*******************************************************************************/
+cy_rslt_t xip_crypto_check(void)
+{
+    if(NULL == crypto_mem_config)
+    {
+        return XIP_CRYPTO_RSLT_ERR_NOT_INIT;
+    }
+
+    if(CY_SMIF_MEMORY != Cy_SMIF_GetMode(SMIF0))
+    {
+        return XIP_CRYPTO_RSLT_ERR_NOT_XIP;
+    }
+
+    /* Read through a volatile pointer, the compiler knows the initializer */
+    const volatile uint8_t *marker = crypto_marker;
+    const char *text = CRYPTO_MARKER_TEXT;
+
+    for(uint32_t index = 0; index < sizeof(crypto_marker); index++)
+    {
+        if(marker[index] != (uint8_t)text[index])
+        {
+            return XIP_CRYPTO_RSLT_ERR_KEY;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: xip_crypto_encrypt
+****************************************************************************//**
+* Summary:
+*  Encrypts data in place with the SMIF AES block for the given memory
+*  address, so that once programmed it reads back as plaintext through XIP.
+*  Must be called in MMIO mode.
+*
+* Parameters:
+*  addr - address in the memory the data will be programmed to.
+*  data - data, encrypted in place.
+*  length - number of bytes.
+*  addr and length must be multiples of XIP_CRYPTO_BLOCK_SIZE.
+*
+*******************************************************************************/
+cy_rslt_t xip_crypto_encrypt(uint32_t addr, uint8_t *data, uint32_t length)
+{
+    if(NULL == crypto_mem_config)
+    {
+        return XIP_CRYPTO_RSLT_ERR_NOT_INIT;
+    }
+
+    if((NULL == data) || (0u != (addr % XIP_CRYPTO_BLOCK_SIZE)) || (0u != (length % XIP_CRYPTO_BLOCK_SIZE)))
+    {
+        return XIP_CRYPTO_RSLT_ERR_BAD_PARAM;
+    }
+
+    /* The hardware derives the key stream from the XIP address */
+    return (CY_SMIF_SUCCESS == Cy_SMIF_Encrypt(SMIF0, crypto_mem_config->baseAddress + addr, data, length,
+                                               &crypto_context)) ? CY_RSLT_SUCCESS : XIP_CRYPTO_RSLT_ERR_SMIF;
+}
+
+/*******************************************************************************
+* Function Name: xip_crypto_benchmark
+****************************************************************************//**
+* Summary:
+*  Measures the cost of decryption: the latency of XIP reads that miss the
+*  SMIF cache and the time of a sequential read, with decryption on and off
+*  (the latter reads the ciphertext, at plaintext speed). Must be called in
+*  XIP mode, after xip_crypto_check().
+*
+*******************************************************************************/
+cy_rslt_t xip_crypto_benchmark(void)
+{
+    crypto_bench_t plain;
+    crypto_bench_t encrypted;
+
+    cy_rslt_t result = xip_crypto_check();
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    crypto_measure(false, &plain);
+    crypto_measure(true, &encrypted);
+
+    uint32_t plain_avg = plain.total_cycles / XIP_CRYPTO_BENCH_MISSES;
+    uint32_t encrypted_avg = encrypted.total_cycles / XIP_CRYPTO_BENCH_MISSES;
+    uint32_t overhead = (encrypted_avg > plain_avg) ? (encrypted_avg - plain_avg) : 0u;
+
+    printf("\nXIP reads with and without on-the-fly decryption:\n");
+    crypto_report("plaintext", &plain);
+    crypto_report("encrypted", &encrypted);
+    printf("  Decryption adds %"PRIu32" cycles (%"PRIu32"%%) per cache miss, %"PRIu32"%% to the sequential read\n",
+           overhead, (0u != plain_avg) ? ((overhead * 100u) / plain_avg) : 0u,
+           ((encrypted.seq_cycles > plain.seq_cycles) && (0u != plain.seq_cycles)) ?
+           (((encrypted.seq_cycles - plain.seq_cycles) * 100u) / plain.seq_cycles) : 0u);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
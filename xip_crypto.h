@@ -0,0 +1,109 @@
+/******************************************************************************
+* File Name:   xip_crypto.h
+*
+* Description: This file contains the macros, data types and function
+*              declarations of the SMIF on-the-fly decryption of the external
+*              memory.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef XIP_CRYPTO_H
+#define XIP_CRYPTO_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 (XIP_CRYPTO=1 in the Makefile) to decrypt XIP reads with the SMIF
+ * AES-128 block. The image must then be encrypted by scripts/xip_encrypt.py,
+ * which the Makefile runs as a post-build step.
+ */
+#ifndef XIP_CRYPTO_ENABLE
+#define XIP_CRYPTO_ENABLE               (0u)
+#endif
+
+/* AES-128 key, as the four words written to the SMIF CRYPTO_KEY registers.
+ * The default is the FIPS-197 example key; the Makefile passes XIP_CRYPTO_KEY.
+ * The key is kept in internal flash: this protects the content of the external
+ * memory, not a device that can be read out through its debug port.
+ */
+#ifndef XIP_CRYPTO_KEY0
+#define XIP_CRYPTO_KEY0                 (0x16157E2Bu)
+#define XIP_CRYPTO_KEY1                 (0xA6D2AE28u)
+#define XIP_CRYPTO_KEY2                 (0x8815F7ABu)
+#define XIP_CRYPTO_KEY3                 (0x3C4FCF09u)
+#endif
+
+/* Size of an AES block; encrypted ranges are aligned to it */
+#define XIP_CRYPTO_BLOCK_SIZE           (16u)
+
+/* Benchmark: single-word reads that miss the SMIF cache, and one sequential
+ * read of XIP_CRYPTO_BENCH_SEQ_SIZE bytes, starting at the XIP region.
+ */
+#define XIP_CRYPTO_BENCH_MISSES         (256u)
+#define XIP_CRYPTO_BENCH_STRIDE         (256u)
+#define XIP_CRYPTO_BENCH_SEQ_SIZE       (16u * 1024u)
+
+#define XIP_CRYPTO_RSLT_ERR_BAD_PARAM   APP_RSLT_ERR(APP_RSLT_RANGE_XIP_CRYPTO, 1u)
+#define XIP_CRYPTO_RSLT_ERR_NOT_INIT    APP_RSLT_ERR(APP_RSLT_RANGE_XIP_CRYPTO, 2u)
+#define XIP_CRYPTO_RSLT_ERR_SMIF        APP_RSLT_ERR(APP_RSLT_RANGE_XIP_CRYPTO, 3u)
+#define XIP_CRYPTO_RSLT_ERR_NOT_XIP     APP_RSLT_ERR(APP_RSLT_RANGE_XIP_CRYPTO, 4u)
+#define XIP_CRYPTO_RSLT_ERR_KEY         APP_RSLT_ERR(APP_RSLT_RANGE_XIP_CRYPTO, 5u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t xip_crypto_init(const cy_stc_smif_mem_config_t *mem_config);
+cy_rslt_t xip_crypto_check(void);
+cy_rslt_t xip_crypto_encrypt(uint32_t addr, uint8_t *data, uint32_t length);
+cy_rslt_t xip_crypto_benchmark(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XIP_CRYPTO_H */
+
+/* [] END OF FILE */
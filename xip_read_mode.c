@@ -0,0 +1,397 @@
+/******************************************************************************
+* File Name:   xip_read_mode.c
+*
+* Description: This file contains the XIP read mode configuration. For
+*              continuous read, the memory is put in the mode with one MMIO
+*              read carrying the continuous mode byte, and the XIP read
+*              sequence of the SMIF device is reprogrammed without the
+*              command phase. Leaving XIP sends a mode bit reset and restores
+*              the sequence, so MMIO commands work again.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "xip_read_mode.h"
+#include "smif_mmio.h"
+#include "ramfunc.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define XIP_READ_MODE_DEMO_MISSES       (64u)
+#define XIP_READ_MODE_DEMO_STRIDE       (4096u)     /* Far apart, so every read misses */
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint32_t total_cycles;
+    uint32_t checksum;
+} demo_miss_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const cy_stc_smif_mem_config_t *read_mem_config = NULL;
+static SMIF_DEVICE_Type volatile *read_device = NULL;
+static bool read_continuous = false;
+
+/* XIP read sequence as configured by the serial-flash library */
+static uint32_t saved_cmd_ctl;
+static uint32_t saved_mode_ctl;
+static bool sequence_changed = false;
+
+/*******************************************************************************
+* Function Name: read_apply_sequence
+****************************************************************************//**
+* Summary:
+*  Saves the XIP read sequence of the device and reprograms it for the
+*  selected options. If the sequence is still changed, because leaving XIP
+*  mode failed, the saved one is kept and reprogrammed from.
+*
+*******************************************************************************/
+static void read_apply_sequence(void)
+{
+    if(!sequence_changed)
+    {
+        saved_cmd_ctl = read_device->RD_CMD_CTL;
+        saved_mode_ctl = read_device->RD_MODE_CTL;
+    }
+
+    read_device->RD_CMD_CTL = saved_cmd_ctl;
+    read_device->RD_MODE_CTL = saved_mode_ctl;
+
+    if(read_continuous)
+    {
+        read_device->RD_CMD_CTL = saved_cmd_ctl & ~SMIF_DEVICE_RD_CMD_CTL_PRESENT_Msk;
+        read_device->RD_MODE_CTL = (saved_mode_ctl & ~SMIF_DEVICE_RD_MODE_CTL_CODE_Msk) |
+                                   SMIF_DEVICE_RD_MODE_CTL_PRESENT_Msk |
+                                   _VAL2FLD(SMIF_DEVICE_RD_MODE_CTL_CODE, XIP_READ_MODE_CONTINUOUS_CODE);
+    }
+
+#if (XIP_READ_MODE_DDR_ENABLE)
+    read_device->RD_ADDR_CTL |= SMIF_DEVICE_RD_ADDR_CTL_DDR_MODE_Msk;
+    read_device->RD_MODE_CTL |= SMIF_DEVICE_RD_MODE_CTL_DDR_MODE_Msk;
+    read_device->RD_DATA_CTL |= SMIF_DEVICE_RD_DATA_CTL_DDR_MODE_Msk;
+#endif
+
+    sequence_changed = true;
+}
+
+/*******************************************************************************
+* Function Name: read_restore_sequence
+****************************************************************************//**
+* Summary:
+*  Restores the XIP read sequence saved by read_apply_sequence().
+*
+*******************************************************************************/
+static void read_restore_sequence(void)
+{
+    read_device->RD_CMD_CTL = saved_cmd_ctl;
+    read_device->RD_MODE_CTL = saved_mode_ctl;
+
+#if (XIP_READ_MODE_DDR_ENABLE)
+    read_device->RD_ADDR_CTL &= ~SMIF_DEVICE_RD_ADDR_CTL_DDR_MODE_Msk;
+    read_device->RD_DATA_CTL &= ~SMIF_DEVICE_RD_DATA_CTL_DDR_MODE_Msk;
+#endif
+
+    sequence_changed = false;
+}
+
+/*******************************************************************************
+* Function Name: xip_read_mode_init
+****************************************************************************//**
+* Summary:
+*  Initializes the read mode configuration for the memory. Call after
+*  cy_serial_flash_qspi_init(), in MMIO mode.
+*
+* Parameters:
+*  mem_config - memory configuration passed to cy_serial_flash_qspi_init().
+*
+*******************************************************************************/
+cy_rslt_t xip_read_mode_init(const cy_stc_smif_mem_config_t *mem_config)
+{
+    uint32_t index = 0u;
+
+    cy_rslt_t result = smif_mmio_init(mem_config);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    /* The SMIF device registers are indexed by slave select line */
+    while((index < 3u) && (0u == ((uint32_t)mem_config->slaveSelect & (1u << index))))
+    {
+        index++;
+    }
+
+    read_mem_config = mem_config;
+    read_device = &SMIF_DEVICE_IDX(SMIF0, index);
+    read_continuous = false;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: xip_read_mode_set_continuous
+****************************************************************************//**
+* Summary:
+*  Selects whether XIP reads use continuous read mode. The setting takes
+*  effect at the next xip_read_mode_enter_xip(); call in MMIO mode. Requires a
+*  read command with a mode byte in the memslot configuration.
+*
+* Parameters:
+*  enable - true to send XIP reads without the command byte.
+*
+*******************************************************************************/
+cy_rslt_t xip_read_mode_set_continuous(bool enable)
+{
+    if(NULL == read_mem_config)
+    {
+        return XIP_READ_MODE_RSLT_ERR_NOT_INIT;
+    }
+
+    if(CY_SMIF_NORMAL != Cy_SMIF_GetMode(SMIF0))
+    {
+        return XIP_READ_MODE_RSLT_ERR_MODE;
+    }
+
+    if(enable && (CY_SMIF_NO_COMMAND_OR_MODE == read_mem_config->deviceCfg->readCmd->mode))
+    {
+        return XIP_READ_MODE_RSLT_ERR_UNSUPPORTED;
+    }
+
+    read_continuous = enable;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: xip_read_mode_enter_xip
+****************************************************************************//**
+* Summary:
+*  Switches from MMIO to XIP mode. With continuous read selected, the memory
+*  is first put in continuous read mode and the read sequence of the SMIF
+*  device loses its command phase. With XIP_READ_MODE_DDR_ENABLE, the read
+*  sequence is switched to DDR. Without xip_read_mode_init(), this only
+*  enables XIP.
+*
+*******************************************************************************/
+cy_rslt_t xip_read_mode_enter_xip(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if((NULL != read_mem_config) && read_continuous)
+    {
+        uint8_t discard[4];
+
+        /* Any further command would be taken as an address from here on */
+        result = smif_mmio_read_with_mode(0u, XIP_READ_MODE_CONTINUOUS_CODE, discard, sizeof(discard));
+    }
+
+    if((CY_RSLT_SUCCESS == result) && (NULL != read_mem_config) && (read_continuous || XIP_READ_MODE_DDR_ENABLE))
+    {
+        read_apply_sequence();
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_enable_xip(true);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: xip_read_mode_exit_xip
+****************************************************************************//**
+* Summary:
+*  Switches from XIP to MMIO mode. If the memory is in continuous read mode,
+*  it is taken out of it and the read sequence is restored, so that MMIO
+*  commands work again.
+*
+*******************************************************************************/
+cy_rslt_t xip_read_mode_exit_xip(void)
+{
+    cy_rslt_t result = cy_serial_flash_qspi_enable_xip(false);
+
+    if((CY_RSLT_SUCCESS == result) && sequence_changed)
+    {
+        if(read_continuous)
+        {
+            result = smif_mmio_mode_bit_reset();
+        }
+
+        read_restore_sequence();
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: demo_measure_misses
+****************************************************************************//**
+* Summary:
+*  Times single-word reads that each miss the SMIF cache. Runs from SRAM with
+*  interrupts masked, so that only the timed reads go to the external memory.
+*
+*******************************************************************************/
+APP_RAMFUNC static void demo_measure_misses(demo_miss_t *misses)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    misses->min_cycles = UINT32_MAX;
+    misses->max_cycles = 0u;
+    misses->total_cycles = 0u;
+    misses->checksum = 0u;
+
+    for(uint32_t index = 0; index < XIP_READ_MODE_DEMO_MISSES; index++)
+    {
+        const volatile uint32_t *addr = (const volatile uint32_t *)(CY_XIP_BASE +
+                                                                    (index * XIP_READ_MODE_DEMO_STRIDE));
+
+        (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+
+        uint32_t start = cycle_counter_get();
+        misses->checksum += *addr;
+        uint32_t cycles = cycle_counter_get() - start;
+
+        misses->total_cycles += cycles;
+        misses->min_cycles = (cycles < misses->min_cycles) ? cycles : misses->min_cycles;
+        misses->max_cycles = (cycles > misses->max_cycles) ? cycles : misses->max_cycles;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: demo_report
+****************************************************************************//**
+* Summary:
+*  Prints the miss latency of one demo pass.
+*
+*******************************************************************************/
+static void demo_report(const char *name, const demo_miss_t *misses)
+{
+    printf("  %-12s min %5"PRIu32", avg %5"PRIu32", max %5"PRIu32" cycles\n", name, misses->min_cycles,
+           misses->total_cycles / XIP_READ_MODE_DEMO_MISSES, misses->max_cycles);
+}
+
+/*******************************************************************************
+* Function Name: demo_switch
+****************************************************************************//**
+* Summary:
+*  Leaves XIP, selects the read mode and enters XIP again.
+*
+*******************************************************************************/
+static cy_rslt_t demo_switch(bool continuous)
+{
+    cy_rslt_t result = xip_read_mode_exit_xip();
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = xip_read_mode_set_continuous(continuous);
+    }
+
+    /* Return to XIP whatever happened, the caller runs code from there */
+    cy_rslt_t xip_result = xip_read_mode_enter_xip();
+
+    return (CY_RSLT_SUCCESS != result) ? result : xip_result;
+}
+
+/*******************************************************************************
+* Function Name: xip_read_mode_demo
+****************************************************************************//**
+* Summary:
+*  Measures the latency of XIP cache misses with the standard read sequence
+*  and in continuous read mode, checks that both read the same data, and
+*  returns to the mode selected by XIP_READ_MODE_CONTINUOUS_ENABLE. Must be
+*  called in XIP mode, after xip_read_mode_init().
+*
+*******************************************************************************/
+cy_rslt_t xip_read_mode_demo(void)
+{
+    demo_miss_t standard;
+    demo_miss_t continuous;
+
+    cycle_counter_init();
+
+    cy_rslt_t result = demo_switch(false);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        demo_measure_misses(&standard);
+        result = demo_switch(true);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        demo_measure_misses(&continuous);
+    }
+
+    cy_rslt_t restore_result = demo_switch(XIP_READ_MODE_CONTINUOUS_ENABLE);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = restore_result;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("Latency of %u XIP cache misses:\n", (unsigned int)XIP_READ_MODE_DEMO_MISSES);
+        demo_report("standard:", &standard);
+        demo_report("continuous:", &continuous);
+
+        if(standard.checksum != continuous.checksum)
+        {
+            result = XIP_READ_MODE_RSLT_ERR_MISMATCH;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,108 @@
+/******************************************************************************
+* File Name:   xip_read_mode.h
+*
+* Description: This file contains the declarations of the XIP read mode
+*              configuration, which puts the memory in continuous read mode
+*              so that XIP cache line fills are sent without the read command
+*              byte.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef XIP_READ_MODE_H
+#define XIP_READ_MODE_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the continuous read demo in XIP mode */
+#ifndef XIP_READ_MODE_DEMO_ENABLE
+#define XIP_READ_MODE_DEMO_ENABLE           (0u)
+#endif
+
+/* Set to 1 to enter XIP mode in continuous read mode at startup */
+#ifndef XIP_READ_MODE_CONTINUOUS_ENABLE
+#define XIP_READ_MODE_CONTINUOUS_ENABLE     (0u)
+#endif
+
+/* Mode byte that keeps the memory in continuous read mode. S25FL-S and
+ * S25FL-L parts stay in the mode for any Axh value.
+ */
+#ifndef XIP_READ_MODE_CONTINUOUS_CODE
+#define XIP_READ_MODE_CONTINUOUS_CODE       (0xA0u)
+#endif
+
+/* Set to 1 to use DDR (DTR) XIP reads. The read command of the memslot must
+ * then be a DTR command. Only SMIF IP versions with DDR support have the
+ * needed register fields; the SMIF of PSoC 6 is SDR only.
+ */
+#ifndef XIP_READ_MODE_DDR_ENABLE
+#define XIP_READ_MODE_DDR_ENABLE            (0u)
+#endif
+
+#if (XIP_READ_MODE_DDR_ENABLE) && !defined(SMIF_DEVICE_RD_DATA_CTL_DDR_MODE_Msk)
+#error "XIP_READ_MODE_DDR_ENABLE: this SMIF does not support DDR transfers"
+#endif
+
+#define XIP_READ_MODE_RSLT_ERR_NOT_INIT     APP_RSLT_ERR(APP_RSLT_RANGE_XIP_READ_MODE, 1u)
+#define XIP_READ_MODE_RSLT_ERR_UNSUPPORTED  APP_RSLT_ERR(APP_RSLT_RANGE_XIP_READ_MODE, 2u)
+#define XIP_READ_MODE_RSLT_ERR_MODE         APP_RSLT_ERR(APP_RSLT_RANGE_XIP_READ_MODE, 3u)
+#define XIP_READ_MODE_RSLT_ERR_MISMATCH     APP_RSLT_ERR(APP_RSLT_RANGE_XIP_READ_MODE, 4u)
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t xip_read_mode_init(const cy_stc_smif_mem_config_t *mem_config);
+cy_rslt_t xip_read_mode_set_continuous(bool enable);
+cy_rslt_t xip_read_mode_enter_xip(void);
+cy_rslt_t xip_read_mode_exit_xip(void);
+cy_rslt_t xip_read_mode_demo(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XIP_READ_MODE_H */
+
+/* [] END OF FILE */
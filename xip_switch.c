@@ -0,0 +1,323 @@
+/******************************************************************************
+* File Name:   xip_switch.c
+*
+* Description: This file contains the runtime XIP/MMIO mode switch. The
+*              switch itself runs from SRAM, and a lock keeps other users of
+*              the external memory out while XIP is suspended.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cy_serial_flash_qspi.h"
+#include "xip_switch.h"
+#include "xip_read_mode.h"
+#include "ramfunc.h"
+#include "cycle_counter.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+#if defined(CY_SERIAL_FLASH_QSPI_THREAD_SAFE)
+#include "cyabs_rtos.h"
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define XIP_SWITCH_DEMO_UPDATES         (8u)
+#define XIP_SWITCH_DEMO_MAGIC           (0x43464731u)   /* "CFG1" */
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+typedef struct
+{
+    uint32_t magic;
+    uint32_t sequence;
+} demo_config_t;
+
+typedef struct
+{
+    uint32_t addr;
+    demo_config_t config;
+} demo_update_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+#if defined(CY_SERIAL_FLASH_QSPI_THREAD_SAFE)
+static cy_mutex_t switch_mutex;
+#else
+static volatile bool switch_locked = false;
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+CY_SECTION(".cy_xip_code") __attribute__((used)) uint32_t demo_read_sequence(const volatile demo_config_t *config);
+
+/*******************************************************************************
+* Function Name: xip_switch_init
+****************************************************************************//**
+* Summary:
+*  Creates the lock. Call once before any other function of this file.
+*
+*******************************************************************************/
+cy_rslt_t xip_switch_init(void)
+{
+#if defined(CY_SERIAL_FLASH_QSPI_THREAD_SAFE)
+    return cy_rtos_init_mutex(&switch_mutex);
+#else
+    switch_locked = false;
+
+    return CY_RSLT_SUCCESS;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: xip_switch_lock
+****************************************************************************//**
+* Summary:
+*  Takes the lock that guards XIP mode. Tasks that run code or read data from
+*  the external memory while XIP_SWITCH_MASK_INTERRUPTS is 0 must hold it, so
+*  that they never fetch from the external memory while XIP is suspended.
+*  Without an RTOS, the lock does not wait and fails if it is already held.
+*
+*******************************************************************************/
+cy_rslt_t xip_switch_lock(void)
+{
+#if defined(CY_SERIAL_FLASH_QSPI_THREAD_SAFE)
+    return (CY_RSLT_SUCCESS == cy_rtos_get_mutex(&switch_mutex, XIP_SWITCH_LOCK_TIMEOUT_MS)) ?
+           CY_RSLT_SUCCESS : XIP_SWITCH_RSLT_ERR_LOCKED;
+#else
+    cy_rslt_t result = XIP_SWITCH_RSLT_ERR_LOCKED;
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    if(!switch_locked)
+    {
+        switch_locked = true;
+        result = CY_RSLT_SUCCESS;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return result;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: xip_switch_unlock
+****************************************************************************//**
+* Summary:
+*  Releases the lock taken by xip_switch_lock().
+*
+*******************************************************************************/
+void xip_switch_unlock(void)
+{
+#if defined(CY_SERIAL_FLASH_QSPI_THREAD_SAFE)
+    (void)cy_rtos_set_mutex(&switch_mutex);
+#else
+    switch_locked = false;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: xip_switch_run
+****************************************************************************//**
+* Summary:
+*  Suspends XIP, runs an operation in MMIO mode (for example
+*  cy_serial_flash_qspi_write() or cy_serial_flash_qspi_erase()), invalidates
+*  the SMIF cache and resumes XIP. The lock is held for the whole sequence and
+*  the function executes from SRAM, so it can be called from code in internal
+*  flash while other code runs from the external memory. XIP is resumed even
+*  if the operation fails. XIP is left and entered through
+*  xip_read_mode_exit_xip() and xip_read_mode_enter_xip(), which keeps a
+*  continuous read configuration.
+*
+* Parameters:
+*  op - operation to run in MMIO mode.
+*  arg - argument passed to the operation.
+*  timing - receives the duration of each phase in CPU cycles, may be NULL.
+*
+* Return:
+*  Result of the operation, or of the mode switch if that fails.
+*
+*******************************************************************************/
+APP_RAMFUNC cy_rslt_t xip_switch_run(xip_switch_op_t op, void *arg, xip_switch_timing_t *timing)
+{
+    xip_switch_timing_t local_timing;
+    cy_rslt_t op_result;
+
+    if(NULL == op)
+    {
+        return XIP_SWITCH_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(CY_SMIF_MEMORY != Cy_SMIF_GetMode(SMIF0))
+    {
+        return XIP_SWITCH_RSLT_ERR_NOT_XIP;
+    }
+
+    cy_rslt_t result = xip_switch_lock();
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+#if (XIP_SWITCH_MASK_INTERRUPTS)
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+#endif
+
+    uint32_t start = cycle_counter_get();
+    result = xip_read_mode_exit_xip();
+    uint32_t suspended = cycle_counter_get();
+
+    op_result = (CY_RSLT_SUCCESS == result) ? op(arg) : result;
+    uint32_t done = cycle_counter_get();
+
+    /* The operation may have changed data that is still cached */
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+    result = xip_read_mode_enter_xip();
+    uint32_t resumed = cycle_counter_get();
+
+#if (XIP_SWITCH_MASK_INTERRUPTS)
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+#endif
+
+    xip_switch_unlock();
+
+    local_timing.suspend_cycles = suspended - start;
+    local_timing.op_cycles = done - suspended;
+    local_timing.resume_cycles = resumed - done;
+
+    if(NULL != timing)
+    {
+        *timing = local_timing;
+    }
+
+    return (CY_RSLT_SUCCESS != op_result) ? op_result : result;
+}
+
+/*******************************************************************************
+* Function Name: demo_read_sequence
+****************************************************************************//**
+* Summary:
+*  Returns the sequence number of a configuration record. Runs from the
+*  external memory and reads the record through its XIP address.
+*
+*******************************************************************************/
+uint32_t demo_read_sequence(const volatile demo_config_t *config)
+{
+    return (XIP_SWITCH_DEMO_MAGIC == config->magic) ? config->sequence : UINT32_MAX;
+}
+
+/*******************************************************************************
+* Function Name: demo_update_config
+****************************************************************************//**
+* Summary:
+*  Operation run in MMIO mode: replaces the configuration record.
+*
+*******************************************************************************/
+static cy_rslt_t demo_update_config(void *arg)
+{
+    demo_update_t *update = (demo_update_t *)arg;
+    cy_rslt_t result = cy_serial_flash_qspi_erase(update->addr, cy_serial_flash_qspi_get_erase_size(update->addr));
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_write(update->addr, sizeof(update->config), (uint8_t *)&update->config);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: xip_switch_demo
+****************************************************************************//**
+* Summary:
+*  Rewrites a configuration record several times while code keeps running
+*  from the external memory, and checks after each update that the code reads
+*  the new record. Prints the switch latencies. Must be called in XIP mode.
+*
+* Parameters:
+*  mem_config - memory configuration, for the XIP base address.
+*  ext_addr - external memory address of a sector that may be erased.
+*
+*******************************************************************************/
+cy_rslt_t xip_switch_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr)
+{
+    demo_update_t update = { .addr = ext_addr, .config = { .magic = XIP_SWITCH_DEMO_MAGIC } };
+    const volatile demo_config_t *mapped = (const volatile demo_config_t *)(mem_config->baseAddress + ext_addr);
+    xip_switch_timing_t timing = { 0u };
+    uint32_t suspend_max = 0u;
+    uint32_t resume_max = 0u;
+    uint32_t op_max = 0u;
+
+    cycle_counter_init();
+    cy_rslt_t result = xip_switch_init();
+
+    for(uint32_t sequence = 1u; (sequence <= XIP_SWITCH_DEMO_UPDATES) && (CY_RSLT_SUCCESS == result); sequence++)
+    {
+        update.config.sequence = sequence;
+        result = xip_switch_run(demo_update_config, &update, &timing);
+
+        if((CY_RSLT_SUCCESS == result) && (sequence != demo_read_sequence(mapped)))
+        {
+            result = XIP_SWITCH_RSLT_ERR_VERIFY;
+        }
+
+        suspend_max = (timing.suspend_cycles > suspend_max) ? timing.suspend_cycles : suspend_max;
+        resume_max = (timing.resume_cycles > resume_max) ? timing.resume_cycles : resume_max;
+        op_max = (timing.op_cycles > op_max) ? timing.op_cycles : op_max;
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        printf("%u configuration updates read back by code in external memory\n",
+               (unsigned int)XIP_SWITCH_DEMO_UPDATES);
+        printf("  XIP -> MMIO:  max %6"PRIu32" cycles (%"PRIu32" us)\n", suspend_max,
+               cycle_counter_to_us(suspend_max));
+        printf("  MMIO -> XIP:  max %6"PRIu32" cycles (%"PRIu32" us)\n", resume_max,
+               cycle_counter_to_us(resume_max));
+        printf("  erase+write:  max %"PRIu32" us\n", cycle_counter_to_us(op_max));
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
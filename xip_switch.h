@@ -0,0 +1,116 @@
+/******************************************************************************
+* File Name:   xip_switch.h
+*
+* Description: This file contains the declarations of the XIP/MMIO mode
+*              switch, which suspends XIP, runs a program or erase operation
+*              in MMIO mode, and resumes XIP at runtime.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef XIP_SWITCH_H
+#define XIP_SWITCH_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the runtime mode switch demo in XIP mode */
+#ifndef XIP_SWITCH_DEMO_ENABLE
+#define XIP_SWITCH_DEMO_ENABLE          (0u)
+#endif
+
+/* Set to 1 to mask interrupts while XIP is suspended, so that no interrupt
+ * handler or task switch can fetch from the external memory. Set to 0 to keep
+ * interrupts running during long erases; all code that runs from the external
+ * memory must then hold the lock (xip_switch_lock()). Thread-safe builds of the
+ * serial-flash library take an RTOS mutex inside every call, so interrupts are
+ * not masked by default when CY_SERIAL_FLASH_QSPI_THREAD_SAFE is defined.
+ */
+#ifndef XIP_SWITCH_MASK_INTERRUPTS
+#if defined(CY_SERIAL_FLASH_QSPI_THREAD_SAFE)
+#define XIP_SWITCH_MASK_INTERRUPTS      (0u)
+#else
+#define XIP_SWITCH_MASK_INTERRUPTS      (1u)
+#endif
+#endif
+
+/* Time to wait for the lock when built with CY_SERIAL_FLASH_QSPI_THREAD_SAFE */
+#define XIP_SWITCH_LOCK_TIMEOUT_MS      (1000u)
+
+#define XIP_SWITCH_RSLT_ERR_BAD_PARAM   APP_RSLT_ERR(APP_RSLT_RANGE_XIP_SWITCH, 1u)
+#define XIP_SWITCH_RSLT_ERR_LOCKED      APP_RSLT_ERR(APP_RSLT_RANGE_XIP_SWITCH, 2u)
+#define XIP_SWITCH_RSLT_ERR_NOT_XIP     APP_RSLT_ERR(APP_RSLT_RANGE_XIP_SWITCH, 3u)
+#define XIP_SWITCH_RSLT_ERR_VERIFY      APP_RSLT_ERR(APP_RSLT_RANGE_XIP_SWITCH, 4u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Operation run in MMIO mode. It must not be placed in .cy_xip_code and must
+ * not access data in the external memory through its XIP addresses.
+ */
+typedef cy_rslt_t (*xip_switch_op_t)(void *arg);
+
+typedef struct
+{
+    uint32_t suspend_cycles;    /* XIP to MMIO switch */
+    uint32_t op_cycles;         /* Operation in MMIO mode */
+    uint32_t resume_cycles;     /* MMIO to XIP switch, including cache invalidation */
+} xip_switch_timing_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t xip_switch_init(void);
+cy_rslt_t xip_switch_lock(void);
+void xip_switch_unlock(void);
+cy_rslt_t xip_switch_run(xip_switch_op_t op, void *arg, xip_switch_timing_t *timing);
+cy_rslt_t xip_switch_demo(const cy_stc_smif_mem_config_t *mem_config, uint32_t ext_addr);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XIP_SWITCH_H */
+
+/* [] END OF FILE */
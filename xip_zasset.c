@@ -0,0 +1,599 @@
+/******************************************************************************
+* File Name:   xip_zasset.c
+*
+* Description: This file implements the compressed asset reader. Blocks
+*              generated by scripts/xip_compress.py are decoded from the
+*              cy_xip section on demand into a small SRAM cache with least-
+*              recently-used replacement, so fewer bytes cross the QSPI bus
+*              than with raw reads.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+#include "xip_zasset.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#if (XIP_ZASSET_DEMO_ENABLE)
+#include "xip_zasset_demo_data.h"
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define ZASSET_MIN_MATCH                (4u)
+
+/* Random reads of the demo */
+#define ZASSET_DEMO_READS               (512u)
+#define ZASSET_DEMO_READ_SIZE           (32u)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Decoded blocks, keyed by the address of their compressed data */
+CY_ALIGN(4) static uint8_t zasset_cache[XIP_ZASSET_CACHE_BLOCKS][XIP_ZASSET_MAX_BLOCK_SIZE];
+static const uint8_t *zasset_cache_key[XIP_ZASSET_CACHE_BLOCKS];
+static uint32_t zasset_cache_length[XIP_ZASSET_CACHE_BLOCKS];
+static uint32_t zasset_cache_used[XIP_ZASSET_CACHE_BLOCKS];
+static uint32_t zasset_clock = 0u;
+
+static xip_zasset_stats_t zasset_stats;
+
+/*******************************************************************************
+* Function Name: zasset_read_length
+****************************************************************************//**
+* Summary:
+*  Adds the optional extension bytes of an LZ4 literal or match length.
+*
+* Return:
+*  false if the input ends inside the length.
+*
+*******************************************************************************/
+static bool zasset_read_length(const uint8_t **src, const uint8_t *src_end, uint32_t *length)
+{
+    uint8_t byte;
+
+    do
+    {
+        if(*src >= src_end)
+        {
+            return false;
+        }
+
+        byte = **src;
+        (*src)++;
+        *length += byte;
+    } while(255u == byte);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: zasset_decode
+****************************************************************************//**
+* Summary:
+*  Decodes one LZ4 block. Every length and offset is checked, so corrupt data
+*  can't write outside dst or read outside src.
+*
+* Parameters:
+*  src - compressed block.
+*  src_length - size of the compressed block.
+*  dst - output buffer.
+*  dst_length - expected decoded size.
+*
+* Return:
+*  true if the block decodes to exactly dst_length bytes.
+*
+*******************************************************************************/
+static bool zasset_decode(const uint8_t *src, uint32_t src_length, uint8_t *dst, uint32_t dst_length)
+{
+    const uint8_t *src_end = &src[src_length];
+    uint8_t *out = dst;
+    uint8_t *out_end = &dst[dst_length];
+
+    while(src < src_end)
+    {
+        uint32_t token = *src++;
+        uint32_t literals = token >> 4;
+
+        if((15u == literals) && !zasset_read_length(&src, src_end, &literals))
+        {
+            return false;
+        }
+
+        if((literals > (uint32_t)(src_end - src)) || (literals > (uint32_t)(out_end - out)))
+        {
+            return false;
+        }
+
+        memcpy(out, src, literals);
+        out += literals;
+        src += literals;
+
+        /* The last sequence has no match */
+        if(src == src_end)
+        {
+            break;
+        }
+
+        if((src_end - src) < 2)
+        {
+            return false;
+        }
+
+        uint32_t offset = (uint32_t)src[0] | ((uint32_t)src[1] << 8);
+        uint32_t match = token & 0x0Fu;
+        src += 2;
+
+        if((15u == match) && !zasset_read_length(&src, src_end, &match))
+        {
+            return false;
+        }
+
+        match += ZASSET_MIN_MATCH;
+
+        if((0u == offset) || (offset > (uint32_t)(out - dst)) || (match > (uint32_t)(out_end - out)))
+        {
+            return false;
+        }
+
+        /* Byte by byte: the match may overlap the bytes it produces */
+        const uint8_t *from = out - offset;
+        while(0u != match)
+        {
+            *out++ = *from++;
+            match--;
+        }
+    }
+
+    return (out == out_end);
+}
+
+/*******************************************************************************
+* Function Name: zasset_check
+****************************************************************************//**
+* Summary:
+*  Checks an asset descriptor against the cy_xip section and the cache, and
+*  that the external memory is mapped. The last block must hold between 1 and
+*  block_size bytes.
+*
+*******************************************************************************/
+static cy_rslt_t zasset_check(const xip_zasset_t *asset)
+{
+    if((NULL == asset) || (0u == asset->block_size) || (asset->block_size > XIP_ZASSET_MAX_BLOCK_SIZE) ||
+       (0u == asset->block_count) || (asset->size > ((uint32_t)asset->block_size * asset->block_count)) ||
+       (asset->size <= ((uint32_t)asset->block_size * (asset->block_count - 1u))))
+    {
+        return XIP_ZASSET_RSLT_ERR_BAD_PARAM;
+    }
+
+    if(!xip_asset_contains(asset->offsets, (asset->block_count + 1u) * sizeof(uint32_t)))
+    {
+        return XIP_ZASSET_RSLT_ERR_BOUNDS;
+    }
+
+    if(CY_SMIF_MEMORY != Cy_SMIF_GetMode(SMIF0))
+    {
+        return XIP_ZASSET_RSLT_ERR_NOT_MAPPED;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: zasset_lookup
+****************************************************************************//**
+* Summary:
+*  Returns the cache slot holding the block with the given compressed data,
+*  or the slot to replace: an empty one, else the least recently used.
+*
+*******************************************************************************/
+static uint32_t zasset_lookup(const uint8_t *key, bool *found)
+{
+    uint32_t victim = 0u;
+
+    for(uint32_t slot = 0; slot < XIP_ZASSET_CACHE_BLOCKS; slot++)
+    {
+        if(key == zasset_cache_key[slot])
+        {
+            *found = true;
+            return slot;
+        }
+
+        if((NULL != zasset_cache_key[victim]) &&
+           ((NULL == zasset_cache_key[slot]) || (zasset_cache_used[slot] < zasset_cache_used[victim])))
+        {
+            victim = slot;
+        }
+    }
+
+    *found = false;
+    return victim;
+}
+
+/*******************************************************************************
+* Function Name: xip_zasset_get_block
+****************************************************************************//**
+* Summary:
+*  Returns the decoded contents of one block of an asset. A compressed block
+*  is decoded into the SRAM cache unless it is already there; a block stored
+*  raw is returned in place from the external memory. The pointer is valid
+*  until XIP_ZASSET_CACHE_BLOCKS other blocks have been requested, and only
+*  while the SMIF stays in XIP mode. Must be called in XIP mode.
+*
+* Parameters:
+*  asset - asset generated by scripts/xip_compress.py.
+*  index - index of the block.
+*  data - receives the pointer to the decoded block.
+*  length - receives the size of the block.
+*
+* Return:
+*  XIP_ZASSET_RSLT_ERR_CORRUPT if the block does not decode to its size.
+*
+*******************************************************************************/
+cy_rslt_t xip_zasset_get_block(const xip_zasset_t *asset, uint32_t index, const uint8_t **data, uint32_t *length)
+{
+    if((NULL == data) || (NULL == length))
+    {
+        return XIP_ZASSET_RSLT_ERR_BAD_PARAM;
+    }
+
+    cy_rslt_t result = zasset_check(asset);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if(index >= asset->block_count)
+    {
+        return XIP_ZASSET_RSLT_ERR_BOUNDS;
+    }
+
+    uint32_t start = asset->offsets[index] & ~XIP_ZASSET_RAW_FLAG;
+    uint32_t end = asset->offsets[index + 1u] & ~XIP_ZASSET_RAW_FLAG;
+    uint32_t size = asset->block_size;
+
+    if(index == (asset->block_count - 1u))
+    {
+        size = asset->size - (index * asset->block_size);
+    }
+
+    if((end < start) || !xip_asset_contains(&asset->blocks[start], end - start))
+    {
+        return XIP_ZASSET_RSLT_ERR_CORRUPT;
+    }
+
+    const uint8_t *key = &asset->blocks[start];
+
+    if(0u != (asset->offsets[index] & XIP_ZASSET_RAW_FLAG))
+    {
+        if((end - start) != size)
+        {
+            return XIP_ZASSET_RSLT_ERR_CORRUPT;
+        }
+
+        *data = key;
+        *length = size;
+        return CY_RSLT_SUCCESS;
+    }
+
+    bool found;
+    uint32_t slot = zasset_lookup(key, &found);
+
+    if(found)
+    {
+        zasset_stats.hits++;
+    }
+    else
+    {
+        uint32_t cycles = cycle_counter_get();
+
+        /* The slot stays empty if the block turns out to be corrupt */
+        zasset_cache_key[slot] = NULL;
+        if(!zasset_decode(key, end - start, zasset_cache[slot], size))
+        {
+            return XIP_ZASSET_RSLT_ERR_CORRUPT;
+        }
+
+        zasset_cache_key[slot] = key;
+        zasset_cache_length[slot] = size;
+
+        zasset_stats.decode_cycles += cycle_counter_get() - cycles;
+        zasset_stats.misses++;
+        zasset_stats.flash_bytes += end - start;
+        zasset_stats.decoded_bytes += size;
+    }
+
+    zasset_cache_used[slot] = ++zasset_clock;
+    *data = zasset_cache[slot];
+    *length = zasset_cache_length[slot];
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: xip_zasset_read
+****************************************************************************//**
+* Summary:
+*  Copies part of the decoded contents of an asset, which may span several
+*  blocks, into a buffer. Must be called in XIP mode.
+*
+* Parameters:
+*  asset - asset generated by scripts/xip_compress.py.
+*  offset - offset in the decoded asset.
+*  buf - destination buffer.
+*  length - number of bytes to copy.
+*
+*******************************************************************************/
+cy_rslt_t xip_zasset_read(const xip_zasset_t *asset, uint32_t offset, uint8_t *buf, uint32_t length)
+{
+    if((NULL == buf) && (0u != length))
+    {
+        return XIP_ZASSET_RSLT_ERR_BAD_PARAM;
+    }
+
+    /* Validates block_size before it is divided by below */
+    cy_rslt_t result = zasset_check(asset);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if((offset > asset->size) || (length > (asset->size - offset)))
+    {
+        return XIP_ZASSET_RSLT_ERR_BOUNDS;
+    }
+
+    while((0u != length) && (CY_RSLT_SUCCESS == result))
+    {
+        const uint8_t *data;
+        uint32_t block_length;
+        uint32_t in_block = offset % asset->block_size;
+
+        result = xip_zasset_get_block(asset, offset / asset->block_size, &data, &block_length);
+
+        if(CY_RSLT_SUCCESS == result)
+        {
+            uint32_t chunk = block_length - in_block;
+
+            if(chunk > length)
+            {
+                chunk = length;
+            }
+
+            memcpy(buf, &data[in_block], chunk);
+            buf += chunk;
+            offset += chunk;
+            length -= chunk;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: xip_zasset_cache_flush
+****************************************************************************//**
+* Summary:
+*  Empties the SRAM cache. Needed if the external memory is reprogrammed
+*  while decoded blocks are cached.
+*
+*******************************************************************************/
+void xip_zasset_cache_flush(void)
+{
+    memset(zasset_cache_key, 0, sizeof(zasset_cache_key));
+}
+
+/*******************************************************************************
+* Function Name: xip_zasset_get_stats
+****************************************************************************//**
+* Summary:
+*  Returns the cache and decoder counters since the last reset.
+*
+*******************************************************************************/
+void xip_zasset_get_stats(xip_zasset_stats_t *stats)
+{
+    *stats = zasset_stats;
+}
+
+/*******************************************************************************
+* Function Name: xip_zasset_reset_stats
+****************************************************************************//**
+* Summary:
+*  Clears the cache and decoder counters.
+*
+*******************************************************************************/
+void xip_zasset_reset_stats(void)
+{
+    memset(&zasset_stats, 0, sizeof(zasset_stats));
+}
+
+#if (XIP_ZASSET_DEMO_ENABLE)
+/*******************************************************************************
+* Function Name: zasset_demo_hash
+****************************************************************************//**
+* Summary:
+*  Updates a 32-bit FNV-1a hash, so that the raw and decoded reads of the
+*  demo can be compared without keeping the data.
+*
+*******************************************************************************/
+static uint32_t zasset_demo_hash(uint32_t hash, const uint8_t *buf, uint32_t length)
+{
+    for(uint32_t index = 0; index < length; index++)
+    {
+        hash = (hash ^ buf[index]) * 16777619u;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+* Function Name: zasset_demo_print
+****************************************************************************//**
+* Summary:
+*  Prints the time of a raw and a compressed read pattern and the bytes that
+*  each of them read from the external memory.
+*
+*******************************************************************************/
+static void zasset_demo_print(const char *name, uint32_t raw_cycles, uint32_t raw_bytes,
+                              uint32_t zasset_cycles)
+{
+    xip_zasset_stats_t stats;
+
+    xip_zasset_get_stats(&stats);
+    printf("%s:\n", name);
+    printf("  raw        %8"PRIu32" us, %6"PRIu32" bytes read\n", cycle_counter_to_us(raw_cycles), raw_bytes);
+    printf("  compressed %8"PRIu32" us, %6"PRIu32" bytes read, %"PRIu32" us decoding, %"PRIu32" hits, "
+           "%"PRIu32" misses\n", cycle_counter_to_us(zasset_cycles), stats.flash_bytes,
+           cycle_counter_to_us(stats.decode_cycles), stats.hits, stats.misses);
+}
+#endif
+
+/*******************************************************************************
+* Function Name: xip_zasset_demo
+****************************************************************************//**
+* Summary:
+*  Reads the demo asset (the LICENSE file) sequentially and at random offsets,
+*  from its raw copy and through the decoder, with the SMIF cache invalidated
+*  first, and checks that both reads return the same data. Must be called in
+*  XIP mode.
+*
+*******************************************************************************/
+cy_rslt_t xip_zasset_demo(void)
+{
+#if (XIP_ZASSET_DEMO_ENABLE)
+    static uint8_t buf[XIP_ZASSET_MAX_BLOCK_SIZE];
+    const xip_zasset_t *asset = &zasset_demo_text;
+    uint32_t compressed = asset->offsets[asset->block_count] & ~XIP_ZASSET_RAW_FLAG;
+    uint32_t raw_hash = 2166136261u;
+    uint32_t zasset_hash = 2166136261u;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    printf("Asset: %"PRIu32" bytes in %u blocks of %u bytes, %"PRIu32" bytes compressed (%"PRIu32"%%)\n",
+           asset->size, asset->block_count, asset->block_size, compressed, (100u * compressed) / asset->size);
+    printf("SRAM cache: %u blocks\n", (unsigned int)XIP_ZASSET_CACHE_BLOCKS);
+
+    cycle_counter_init();
+
+    /* Whole asset, in order */
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+    uint32_t start = cycle_counter_get();
+    for(uint32_t offset = 0; offset < asset->size; offset += sizeof(buf))
+    {
+        uint32_t chunk = ((asset->size - offset) < sizeof(buf)) ? (asset->size - offset) : sizeof(buf);
+        memcpy(buf, &zasset_demo_text_raw[offset], chunk);
+        raw_hash = zasset_demo_hash(raw_hash, buf, chunk);
+    }
+    uint32_t raw_cycles = cycle_counter_get() - start;
+
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+    xip_zasset_cache_flush();
+    xip_zasset_reset_stats();
+    start = cycle_counter_get();
+    for(uint32_t index = 0; (index < asset->block_count) && (CY_RSLT_SUCCESS == result); index++)
+    {
+        const uint8_t *data;
+        uint32_t length;
+
+        result = xip_zasset_get_block(asset, index, &data, &length);
+        if(CY_RSLT_SUCCESS == result)
+        {
+            zasset_hash = zasset_demo_hash(zasset_hash, data, length);
+        }
+    }
+    uint32_t zasset_cycles = cycle_counter_get() - start;
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    zasset_demo_print("Sequential read", raw_cycles, asset->size, zasset_cycles);
+
+    if(raw_hash != zasset_hash)
+    {
+        return XIP_ZASSET_RSLT_ERR_CORRUPT;
+    }
+
+    /* Short reads at random offsets: the cache turns repeated blocks into hits */
+    uint32_t seed = 1u;
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+    start = cycle_counter_get();
+    for(uint32_t read = 0; read < ZASSET_DEMO_READS; read++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        uint32_t offset = (seed >> 8) % (asset->size - ZASSET_DEMO_READ_SIZE);
+        memcpy(buf, &zasset_demo_text_raw[offset], ZASSET_DEMO_READ_SIZE);
+        raw_hash = zasset_demo_hash(raw_hash, buf, ZASSET_DEMO_READ_SIZE);
+    }
+    raw_cycles = cycle_counter_get() - start;
+
+    seed = 1u;
+    (void)Cy_SMIF_CacheInvalidate(SMIF0, CY_SMIF_CACHE_BOTH);
+    xip_zasset_cache_flush();
+    xip_zasset_reset_stats();
+    start = cycle_counter_get();
+    for(uint32_t read = 0; (read < ZASSET_DEMO_READS) && (CY_RSLT_SUCCESS == result); read++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        uint32_t offset = (seed >> 8) % (asset->size - ZASSET_DEMO_READ_SIZE);
+        result = xip_zasset_read(asset, offset, buf, ZASSET_DEMO_READ_SIZE);
+        zasset_hash = zasset_demo_hash(zasset_hash, buf, ZASSET_DEMO_READ_SIZE);
+    }
+    zasset_cycles = cycle_counter_get() - start;
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    zasset_demo_print("Random 32-byte reads", raw_cycles, ZASSET_DEMO_READS * ZASSET_DEMO_READ_SIZE,
+                      zasset_cycles);
+
+    return (raw_hash == zasset_hash) ? CY_RSLT_SUCCESS : XIP_ZASSET_RSLT_ERR_CORRUPT;
+#else
+    return CY_RSLT_SUCCESS;
+#endif
+}
+
+/* [] END OF FILE */
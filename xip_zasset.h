@@ -0,0 +1,123 @@
+/******************************************************************************
+* File Name:   xip_zasset.h
+*
+* Description: This file contains the declarations of the compressed asset
+*              reader, which decodes LZ4 blocks from the cy_xip section on
+*              demand into a small SRAM cache.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+#ifndef XIP_ZASSET_H
+#define XIP_ZASSET_H
+
+#include "cy_pdl.h"
+#include "app_result.h"
+#include "xip_asset.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+/* Set to 1 to run the compressed asset demo in XIP mode */
+#ifndef XIP_ZASSET_DEMO_ENABLE
+#define XIP_ZASSET_DEMO_ENABLE          (0u)
+#endif
+
+/* Decoded blocks kept in SRAM, replaced least recently used first */
+#ifndef XIP_ZASSET_CACHE_BLOCKS
+#define XIP_ZASSET_CACHE_BLOCKS         (4u)
+#endif
+
+/* Largest block size accepted, the --block-size of scripts/xip_compress.py */
+#ifndef XIP_ZASSET_MAX_BLOCK_SIZE
+#define XIP_ZASSET_MAX_BLOCK_SIZE       (1024u)
+#endif
+
+/* Set in an entry of the block table: the block is stored uncompressed */
+#define XIP_ZASSET_RAW_FLAG             (0x80000000u)
+
+#define XIP_ZASSET_RSLT_ERR_BAD_PARAM   APP_RSLT_ERR(APP_RSLT_RANGE_XIP_ZASSET, 1u)
+#define XIP_ZASSET_RSLT_ERR_BOUNDS      APP_RSLT_ERR(APP_RSLT_RANGE_XIP_ZASSET, 2u)
+#define XIP_ZASSET_RSLT_ERR_NOT_MAPPED  APP_RSLT_ERR(APP_RSLT_RANGE_XIP_ZASSET, 3u)
+#define XIP_ZASSET_RSLT_ERR_CORRUPT     APP_RSLT_ERR(APP_RSLT_RANGE_XIP_ZASSET, 4u)
+
+/*******************************************************************************
+* Data types
+********************************************************************************/
+/* Compressed asset, generated by scripts/xip_compress.py. The descriptor is
+ * in internal flash; the blocks and the block table are in cy_xip.
+ */
+typedef struct
+{
+    const uint8_t *blocks;      /* Compressed blocks, one after the other */
+    const uint32_t *offsets;    /* block_count + 1 offsets into blocks, with XIP_ZASSET_RAW_FLAG */
+    uint32_t size;              /* Uncompressed size */
+    uint16_t block_size;        /* Uncompressed bytes per block, except the last */
+    uint16_t block_count;
+} xip_zasset_t;
+
+typedef struct
+{
+    uint32_t hits;              /* Blocks found in the SRAM cache */
+    uint32_t misses;            /* Blocks decoded */
+    uint32_t flash_bytes;       /* Compressed bytes read from the external memory */
+    uint32_t decoded_bytes;     /* Bytes produced by the decoder */
+    uint32_t decode_cycles;     /* CPU cycles spent decoding */
+} xip_zasset_stats_t;
+
+/*******************************************************************************
+* Function declarations
+*******************************************************************************/
+cy_rslt_t xip_zasset_get_block(const xip_zasset_t *asset, uint32_t index, const uint8_t **data, uint32_t *length);
+cy_rslt_t xip_zasset_read(const xip_zasset_t *asset, uint32_t offset, uint8_t *buf, uint32_t length);
+void xip_zasset_cache_flush(void);
+void xip_zasset_get_stats(xip_zasset_stats_t *stats);
+void xip_zasset_reset_stats(void);
+cy_rslt_t xip_zasset_demo(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* XIP_ZASSET_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,1400 @@
+/* Generated by scripts/xip_compress.py - do not edit. */
+
+#include "xip_zasset_demo_data.h"
+
+#if (XIP_ZASSET_DEMO_ENABLE)
+
+/* LICENSE: 12551 bytes in 13 blocks, 9318 bytes compressed */
+static const uint8_t zasset_demo_text_blocks[9318] XIP_ASSET =
+{
+    0xFF, 0x3B, 0x43, 0x59, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x28, 0x41, 0x4E, 0x20, 0x49, 0x4E,
+    0x46, 0x49, 0x4E, 0x45, 0x4F, 0x4E, 0x20, 0x43, 0x4F, 0x4D, 0x50, 0x41, 0x4E, 0x59, 0x29, 0x20,
+    0x45, 0x4E, 0x44, 0x20, 0x55, 0x53, 0x45, 0x52, 0x20, 0x4C, 0x49, 0x43, 0x45, 0x4E, 0x53, 0x45,
+    0x20, 0x41, 0x47, 0x52, 0x45, 0x45, 0x4D, 0x45, 0x4E, 0x54, 0x0A, 0x0A, 0x50, 0x4C, 0x45, 0x41,
+    0x53, 0x45, 0x20, 0x52, 0x45, 0x41, 0x44, 0x20, 0x54, 0x48, 0x49, 0x53, 0x2D, 0x00, 0x08, 0xF1,
+    0x25, 0x20, 0x28, 0x22, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x20,
+    0x43, 0x41, 0x52, 0x45, 0x46, 0x55, 0x4C, 0x4C, 0x59, 0x20, 0x42, 0x45, 0x46, 0x4F, 0x52, 0x45,
+    0x0A, 0x44, 0x4F, 0x57, 0x4E, 0x4C, 0x4F, 0x41, 0x44, 0x49, 0x4E, 0x47, 0x2C, 0x20, 0x49, 0x4E,
+    0x53, 0x54, 0x41, 0x4C, 0x4C, 0x0C, 0x00, 0x41, 0x43, 0x4F, 0x50, 0x59, 0x09, 0x00, 0x82, 0x4F,
+    0x52, 0x20, 0x55, 0x53, 0x49, 0x4E, 0x47, 0x6A, 0x00, 0xF3, 0x00, 0x53, 0x4F, 0x46, 0x54, 0x57,
+    0x41, 0x52, 0x45, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x41, 0x43, 0xAF, 0x00, 0x80, 0x49, 0x4E, 0x47,
+    0x0A, 0x44, 0x4F, 0x43, 0x55, 0x72, 0x00, 0xBF, 0x41, 0x54, 0x49, 0x4F, 0x4E, 0x2E, 0x20, 0x20,
+    0x42, 0x59, 0x20, 0x5D, 0x00, 0x0D, 0x08, 0x5C, 0x00, 0x15, 0x45, 0x5B, 0x00, 0x61, 0x2C, 0x0A,
+    0x59, 0x4F, 0x55, 0x20, 0x64, 0x00, 0x00, 0xC6, 0x00, 0x01, 0x1F, 0x00, 0xA0, 0x4F, 0x20, 0x42,
+    0x45, 0x20, 0x42, 0x4F, 0x55, 0x4E, 0x44, 0x58, 0x00, 0x01, 0x8A, 0x00, 0x05, 0xE3, 0x00, 0x60,
+    0x2E, 0x20, 0x20, 0x49, 0x46, 0x20, 0x34, 0x00, 0x62, 0x44, 0x4F, 0x20, 0x4E, 0x4F, 0x54, 0x1A,
+    0x00, 0x00, 0x34, 0x00, 0x61, 0x41, 0x4C, 0x4C, 0x0A, 0x4F, 0x46, 0x5D, 0x00, 0x61, 0x54, 0x45,
+    0x52, 0x4D, 0x53, 0x20, 0x0D, 0x00, 0x08, 0x3C, 0x00, 0xF1, 0x02, 0x2C, 0x20, 0x50, 0x52, 0x4F,
+    0x4D, 0x50, 0x54, 0x4C, 0x59, 0x20, 0x52, 0x45, 0x54, 0x55, 0x52, 0x4E, 0xD8, 0x00, 0x03, 0x48,
+    0x00, 0x39, 0x55, 0x53, 0x45, 0x99, 0x00, 0x23, 0x2E, 0x0A, 0x68, 0x00, 0xD3, 0x48, 0x41, 0x56,
+    0x45, 0x20, 0x50, 0x55, 0x52, 0x43, 0x48, 0x41, 0x53, 0x45, 0x83, 0x01, 0x04, 0x7A, 0x01, 0x2A,
+    0x54, 0x4F, 0xCD, 0x00, 0x00, 0x31, 0x00, 0x70, 0x52, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x1C,
+    0x00, 0x03, 0x66, 0x00, 0x45, 0x54, 0x48, 0x45, 0x0A, 0x4B, 0x01, 0xF2, 0x06, 0x45, 0x58, 0x50,
+    0x49, 0x52, 0x45, 0x53, 0x20, 0x33, 0x30, 0x20, 0x44, 0x41, 0x59, 0x53, 0x20, 0x41, 0x46, 0x54,
+    0x45, 0x52, 0x38, 0x00, 0x04, 0x65, 0x00, 0x02, 0x6F, 0x01, 0xB4, 0x50, 0x50, 0x4C, 0x49, 0x45,
+    0x53, 0x20, 0x4F, 0x4E, 0x4C, 0x59, 0x68, 0x00, 0x94, 0x4F, 0x52, 0x49, 0x47, 0x49, 0x4E, 0x41,
+    0x4C, 0x0A, 0x2A, 0x00, 0xF3, 0x21, 0x52, 0x2E, 0x0A, 0x0A, 0x31, 0x2E, 0x20, 0x44, 0x65, 0x66,
+    0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22,
+    0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x15, 0x00, 0xF0, 0x0B, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x6E, 0x79, 0x69, 0x6E, 0x67, 0x20,
+    0x64, 0x6F, 0x63, 0x75, 0x3A, 0x02, 0x10, 0x61, 0x49, 0x00, 0x11, 0x2C, 0x47, 0x00, 0x80, 0x20,
+    0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x1F, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x00, 0x75, 0x70,
+    0x67, 0x72, 0x61, 0x64, 0x65, 0x73, 0x2C, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x09, 0x00, 0xF0,
+    0x0B, 0x62, 0x75, 0x67, 0x20, 0x66, 0x69, 0x78, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x8F, 0x00, 0x93, 0x20, 0x70,
+    0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x4F, 0x00, 0xF7, 0x01, 0x74, 0x6F, 0x20, 0x79, 0x6F,
+    0x75, 0x20, 0x62, 0x79, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0xB0, 0x00, 0x85, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0xB3, 0x00, 0x05, 0xAE, 0x00, 0xF4, 0x07, 0x69, 0x6E, 0x20,
+    0x68, 0x75, 0x6D, 0x61, 0x6E, 0x2D, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x3A, 0x00, 0x69, 0x42, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x3A, 0x00, 0x39, 0x74,
+    0x68, 0x65, 0x3E, 0x00, 0x12, 0x62, 0x23, 0x00, 0x32, 0x63, 0x6F, 0x64, 0x3B, 0x00, 0xF2, 0x00,
+    0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x19,
+    0x00, 0x23, 0x6F, 0x72, 0xA4, 0x00, 0x90, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74,
+    0x6B, 0x00, 0x04, 0x66, 0x00, 0x70, 0x44, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x20, 0x01, 0x6D,
+    0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x73, 0xA6, 0x00, 0xF0, 0x01, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x64, 0xEC, 0x00, 0xA0, 0x62, 0x65, 0x20,
+    0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x91, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x0A,
+    0x20, 0x01, 0x00, 0xF3, 0x34, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x63, 0x6F,
+    0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61,
+    0x6D, 0x6D, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x46,
+    0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x2C, 0x4A, 0x00, 0xF3, 0x32, 0x44, 0x72, 0x69, 0x76,
+    0x65, 0x72, 0x73, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x48, 0x6F, 0x73, 0x74, 0x20, 0x41, 0x70, 0x70,
+    0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x20, 0x45, 0x78, 0x61, 0x6D,
+    0x70, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x44, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x73, 0x20, 0x61, 0x72, 0x65, 0x48, 0x00, 0xF0,
+    0x01, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x27, 0x73, 0x20, 0x50, 0x53, 0x6F, 0x43, 0x20,
+    0x43, 0x83, 0x00, 0x71, 0x6F, 0x72, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x6F, 0x00, 0x07, 0x21, 0x00,
+    0xB1, 0x41, 0x49, 0x52, 0x4F, 0x43, 0x20, 0x53, 0x44, 0x4B, 0x73, 0x2C, 0xB7, 0x00, 0x05, 0x1A,
+    0x00, 0x03, 0x4B, 0x00, 0x50, 0x4D, 0x6F, 0x64, 0x75, 0x73, 0x60, 0x00, 0x35, 0x62, 0x6F, 0x78,
+    0x41, 0x00, 0x21, 0x2E, 0x0A, 0x1E, 0x00, 0x14, 0x22, 0xC0, 0x00, 0x75, 0x22, 0x20, 0x6D, 0x65,
+    0x61, 0x6E, 0x73, 0x20, 0x00, 0xC0, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x78, 0x65, 0x63,
+    0x75, 0x74, 0xAE, 0x00, 0x34, 0x6E, 0x20, 0x61, 0x59, 0x00, 0x51, 0x20, 0x68, 0x61, 0x72, 0x64,
+    0x24, 0x00, 0x74, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x4C, 0x00, 0x02, 0xFC, 0x00, 0x0F,
+    0x4A, 0x00, 0x04, 0x30, 0x6E, 0x61, 0x62, 0xF7, 0x00, 0x30, 0x74, 0x68, 0x65, 0x58, 0x01, 0x00,
+    0xFF, 0x00, 0x0F, 0x51, 0x00, 0x07, 0x03, 0xB9, 0x00, 0x01, 0x75, 0x00, 0xC0, 0x70, 0x61, 0x72,
+    0x74, 0x69, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x68, 0x50, 0x01, 0x60, 0x6F, 0x70, 0x65, 0x72,
+    0x61, 0x74, 0x84, 0x01, 0xF4, 0x19, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x75, 0x63,
+    0x68, 0x20, 0x61, 0x73, 0x20, 0x47, 0x4E, 0x55, 0x2F, 0x4C, 0x69, 0x6E, 0x75, 0x78, 0x2C, 0x20,
+    0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x2C, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x9B, 0x01,
+    0x72, 0x41, 0x6E, 0x64, 0x72, 0x6F, 0x69, 0x64, 0x25, 0x01, 0x34, 0x69, 0x4F, 0x53, 0xB7, 0x00,
+    0x0C, 0xA7, 0x01, 0x0F, 0x0B, 0x01, 0x11, 0xC0, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x00, 0x06, 0x4B, 0x02, 0x0F, 0xD4, 0x00, 0x05, 0x70, 0x20, 0x69,
+    0x6E, 0x20, 0x6F, 0x72, 0x64, 0x2F, 0x00, 0x14, 0x6F, 0x4B, 0x02, 0x91, 0x2C, 0x20, 0x63, 0x6F,
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2F, 0x02, 0x60, 0x63, 0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x85, 0x00,
+    0x04, 0x05, 0x02, 0x4F, 0x77, 0x69, 0x74, 0x68, 0x78, 0x01, 0x10, 0x75, 0x69, 0x6E, 0x66, 0x20,
+    0x46, 0x69, 0x6C, 0xC4, 0x01, 0x16, 0x61, 0x2A, 0x00, 0xC1, 0x73, 0x65, 0x74, 0x75, 0x70, 0x20,
+    0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0xDD, 0x00, 0x80, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x28,
+    0x2E, 0x34, 0x00, 0x00, 0x0B, 0x00, 0x13, 0x29, 0xDE, 0x02, 0x43, 0x64, 0x20, 0x62, 0x79, 0x76,
+    0x00, 0x00, 0xA3, 0x01, 0x15, 0x53, 0xFC, 0x00, 0xF0, 0x00, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F,
+    0x77, 0x20, 0x61, 0x20, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x15, 0x01, 0x04, 0x60, 0x01, 0x0E, 0x8C,
+    0x01, 0xA7, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x4C, 0x00, 0x11, 0x64,
+    0x17, 0x02, 0x01, 0x2E, 0x03, 0x0F, 0xCC, 0x00, 0x0A, 0xF0, 0x05, 0x32, 0x2E, 0x20, 0x4C, 0x69,
+    0x63, 0x65, 0x6E, 0x73, 0x65, 0x2E, 0x20, 0x20, 0x53, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x52,
+    0x00, 0x00, 0x44, 0x00, 0x51, 0x74, 0x65, 0x72, 0x6D, 0x73, 0xB9, 0x01, 0x51, 0x63, 0x6F, 0x6E,
+    0x64, 0x69, 0x4E, 0x03, 0x00, 0x44, 0x02, 0xA0, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72,
+    0x65, 0x65, 0x46, 0x03, 0x05, 0x16, 0x03, 0x50, 0x0A, 0x53, 0x65, 0x6D, 0x69, 0x2A, 0x00, 0x20,
+    0x75, 0x63, 0x36, 0x03, 0x50, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0xAA, 0x00, 0xA0, 0x6F, 0x6E, 0x20,
+    0x28, 0x22, 0x43, 0x79, 0x70, 0x72, 0x65, 0xF0, 0x26, 0x73, 0x73, 0x22, 0x29, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x72, 0x73, 0x20,
+    0x67, 0x72, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x61, 0x0A, 0x6E,
+    0x6F, 0x6E, 0x2D, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x0F, 0x00,
+    0xF1, 0x1C, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C,
+    0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+    0x69, 0x72, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x06, 0x00, 0xA0,
+    0x73, 0x3A, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x2E, 0x57, 0x00, 0x30, 0x75, 0x73, 0x65,
+    0x27, 0x00, 0xF0, 0x1E, 0x20, 0x44, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74,
+    0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x6F, 0x6C, 0x65, 0x6C,
+    0x79, 0x0C, 0x00, 0x01, 0x35, 0x00, 0x71, 0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x4F, 0x00,
+    0xF0, 0x19, 0x20, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x2C, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65,
+    0x72, 0x73, 0x2C, 0x20, 0x48, 0x6F, 0x73, 0x74, 0x20, 0x41, 0xD9, 0x00, 0x82, 0x63, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x2C, 0xF0, 0x00, 0x80, 0x6E, 0x66, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73,
+    0x57, 0x00, 0x04, 0x4B, 0x00, 0xC0, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61,
+    0x72, 0x64, 0x47, 0x00, 0xA0, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x3B, 0x34,
+    0x00, 0x02, 0xC1, 0x00, 0x90, 0x62, 0x2E, 0x20, 0x28, 0x69, 0x29, 0x20, 0x69, 0x66, 0x1D, 0x00,
+    0x40, 0x76, 0x69, 0x64, 0x65, 0x4C, 0x00, 0x94, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20,
+    0x43, 0xB4, 0x00, 0x10, 0x2C, 0xE6, 0x00, 0x00, 0x03, 0x01, 0x82, 0x2C, 0x20, 0x6D, 0x6F, 0x64,
+    0x69, 0x66, 0x79, 0x76, 0x00, 0x61, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0xFC, 0x00, 0x04, 0x74,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0xB7, 0x00, 0x09, 0x47, 0x00, 0x00, 0x41, 0x00, 0x00, 0xD8, 0x00,
+    0x16, 0x65, 0x1F, 0x00, 0x00, 0x02, 0x01, 0x50, 0x65, 0x78, 0x65, 0x63, 0x75, 0xC9, 0x00, 0x54,
+    0x20, 0x6F, 0x6E, 0x20, 0x61, 0xB3, 0x00, 0x08, 0x4E, 0x00, 0x0C, 0xBE, 0x00, 0x01, 0x7B, 0x00,
+    0x03, 0x21, 0x00, 0x40, 0x28, 0x69, 0x69, 0x29, 0x5A, 0x00, 0x88, 0x64, 0x69, 0x73, 0x74, 0x72,
+    0x69, 0x62, 0x75, 0x5E, 0x00, 0x97, 0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x7B,
+    0x01, 0x51, 0x6F, 0x6E, 0x6C, 0x79, 0x2C, 0x06, 0x00, 0x58, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x67,
+    0x00, 0xE6, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x74, 0x6F,
+    0x8B, 0x00, 0x0D, 0x80, 0x00, 0x07, 0x3D, 0x01, 0x1F, 0x63, 0x3D, 0x01, 0x40, 0x02, 0xEA, 0x01,
+    0x0F, 0x3B, 0x01, 0x04, 0xB4, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+    0x13, 0x02, 0x00, 0x1E, 0x00, 0x21, 0x65, 0x6E, 0xB8, 0x02, 0x00, 0x4E, 0x02, 0x16, 0x75, 0x4A,
+    0x02, 0x03, 0x4E, 0x02, 0x0F, 0xCA, 0x00, 0x07, 0x02, 0x73, 0x01, 0xC0, 0x70, 0x61, 0x72, 0x74,
+    0x69, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x68, 0x5D, 0x02, 0x41, 0x6F, 0x70, 0x65, 0x72, 0x7F,
+    0x02, 0x08, 0x48, 0x00, 0x6F, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x7B, 0x01, 0x0C, 0x01, 0x03,
+    0x03, 0x01, 0x96, 0x00, 0x1F, 0x2C, 0x7E, 0x01, 0x29, 0x80, 0x20, 0x61, 0x20, 0x64, 0x65, 0x76,
+    0x69, 0x63, 0x51, 0x00, 0xB1, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x73,
+    0x5F, 0x00, 0x0F, 0xCB, 0x00, 0x05, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20,
+    0x01, 0x00, 0xF0, 0x1D, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x72, 0x69,
+    0x76, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x3B, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x0A,
+    0x30, 0x00, 0xF0, 0x00, 0x64, 0x2E, 0x20, 0x28, 0x69, 0x29, 0x20, 0x69, 0x66, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x27, 0x00, 0xF0, 0x05, 0x69, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C, 0x3C, 0x00, 0xD0, 0x63, 0x6F,
+    0x70, 0x79, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x2C, 0x42, 0x00, 0x80, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x70, 0x00, 0x01, 0x4D, 0x00, 0x03, 0x01, 0x00, 0xFA, 0x00,
+    0x48, 0x6F, 0x73, 0x74, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x4F,
+    0x00, 0x00, 0x49, 0x00, 0xF1, 0x02, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20,
+    0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x33, 0x00, 0x08, 0x43, 0x00, 0x07, 0x3E, 0x00, 0x10,
+    0x73, 0x33, 0x00, 0xF0, 0x02, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x2C, 0x20, 0x63, 0x6F,
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2C, 0x3A, 0x00, 0x60, 0x63, 0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x27,
+    0x00, 0xF8, 0x01, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x4B, 0x00, 0x80, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x44, 0x00,
+    0x41, 0x64, 0x75, 0x63, 0x74, 0xBB, 0x00, 0x03, 0x21, 0x00, 0x40, 0x28, 0x69, 0x69, 0x29, 0x5F,
+    0x00, 0x92, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x8A, 0x00, 0x09, 0x7F, 0x00,
+    0x10, 0x2C, 0x11, 0x01, 0x84, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x63, 0x11, 0x01, 0x61,
+    0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x2C, 0x06, 0x00, 0x08, 0x6C, 0x00, 0xF0, 0x0A, 0x77, 0x68, 0x65,
+    0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x61,
+    0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x24, 0x01, 0xB6, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C,
+    0x75, 0x64, 0x65, 0x73, 0xAA, 0x00, 0x0D, 0x9F, 0x00, 0x08, 0x4F, 0x00, 0x05, 0xCD, 0x01, 0x0D,
+    0x52, 0x01, 0x0B, 0xD7, 0x01, 0x0F, 0x1F, 0x01, 0x01, 0x08, 0x49, 0x00, 0x0C, 0x2A, 0x01, 0x07,
+    0x01, 0x02, 0x20, 0x65, 0x2E, 0x41, 0x00, 0x68, 0x66, 0x72, 0x65, 0x65, 0x6C, 0x79, 0x08, 0x01,
+    0xF7, 0x02, 0x61, 0x6E, 0x79, 0x20, 0x69, 0x6E, 0x66, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x2E, 0x0A,
+    0x0A, 0x41, 0x6E, 0x1E, 0x00, 0x00, 0x82, 0x00, 0x72, 0x6F, 0x66, 0x20, 0x53, 0x6F, 0x66, 0x74,
+    0xBB, 0x00, 0xF0, 0x24, 0x65, 0x72, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x75, 0x6E, 0x64,
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6D, 0x61, 0x64, 0x65, 0x0A, 0x70,
+    0x75, 0x72, 0x73, 0x75, 0x61, 0x6E, 0x74, 0x76, 0x00, 0xF5, 0x11, 0x79, 0x6F, 0x75, 0x72, 0x20,
+    0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x65,
+    0x72, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x61, 0x42, 0x00, 0x40, 0x75, 0x73,
+    0x65, 0x64, 0x78, 0x01, 0x02, 0x32, 0x00, 0xF0, 0x01, 0x70, 0x72, 0x6F, 0x70, 0x72, 0x69, 0x65,
+    0x74, 0x61, 0x72, 0x79, 0x0A, 0x28, 0x63, 0x6C, 0x6F, 0x1D, 0x00, 0x11, 0x73, 0x63, 0x02, 0x35,
+    0x29, 0x20, 0x73, 0x94, 0x00, 0x02, 0x4F, 0x01, 0x7F, 0x73, 0x2C, 0x20, 0x73, 0x75, 0x63, 0x68,
+    0x5D, 0x00, 0x09, 0x24, 0x74, 0x6F, 0x98, 0x01, 0xF2, 0x00, 0x2C, 0x0A, 0x61, 0x74, 0x20, 0x61,
+    0x20, 0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x75, 0x6D, 0x2C, 0x13, 0x03, 0x11, 0x73, 0x84, 0x02, 0x82,
+    0x6C, 0x69, 0x6D, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x82, 0x00, 0x02, 0x45, 0x00, 0xE1, 0x6F, 0x72,
+    0x73, 0x27, 0x20, 0x6C, 0x69, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x12, 0x03, 0x61, 0x70,
+    0x72, 0x6F, 0x68, 0x69, 0x62, 0x2A, 0x00, 0xF0, 0x02, 0x0A, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x20, 0x65, 0x6E, 0x67, 0x69, 0x6E, 0x65, 0x65, 0x72, 0x3E, 0x00, 0x21, 0x6F, 0x66, 0xD0,
+    0x01, 0x04, 0x3A, 0x01, 0x01, 0xB1, 0x01, 0x40, 0x73, 0x69, 0x73, 0x74, 0x88, 0x00, 0x01, 0xC3,
+    0x02, 0x01, 0xAD, 0x00, 0x07, 0x78, 0x00, 0x21, 0x69, 0x6E, 0x4E, 0x01, 0x15, 0x0A, 0x4E, 0x01,
+    0x90, 0x2E, 0x0A, 0x0A, 0x33, 0x2E, 0x20, 0x46, 0x72, 0x65, 0xA3, 0x01, 0xD0, 0x64, 0x20, 0x4F,
+    0x70, 0x65, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0xF5, 0x0C, 0x20, 0x53, 0x6F, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x20, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x1B, 0x00, 0xF5, 0x1E, 0x20, 0x6D, 0x61, 0x79, 0x20,
+    0x62, 0x65, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x64, 0x0A, 0x75, 0x6E, 0x64, 0x65,
+    0x72, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x2F, 0x6F, 0x72, 0x20, 0x6F, 0x70,
+    0x65, 0x6E, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x27, 0x00, 0x91, 0x73, 0x20, 0x73, 0x75, 0x63,
+    0x68, 0x20, 0x61, 0x73, 0x4C, 0x00, 0xF2, 0x05, 0x47, 0x4E, 0x55, 0x20, 0x47, 0x65, 0x6E, 0x65,
+    0x72, 0x61, 0x6C, 0x20, 0x50, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x20, 0x4C, 0x28, 0x00, 0x10, 0x0A,
+    0x3F, 0x00, 0x46, 0x74, 0x68, 0x65, 0x72, 0x39, 0x00, 0xF1, 0x07, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x74, 0x68, 0x69, 0x72, 0x64, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x28, 0x22,
+    0x54, 0x10, 0x00, 0x55, 0x50, 0x61, 0x72, 0x74, 0x79, 0x9A, 0x00, 0x57, 0x22, 0x29, 0x2E, 0x20,
+    0x20, 0x19, 0x00, 0x15, 0x0A, 0xB3, 0x00, 0x10, 0x69, 0x7F, 0x00, 0x81, 0x62, 0x6A, 0x65, 0x63,
+    0x74, 0x20, 0x74, 0x6F, 0x82, 0x00, 0x95, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x62, 0x6C,
+    0xA2, 0x00, 0xA0, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0xC7, 0x00, 0x40,
+    0x20, 0x6E, 0x6F, 0x74, 0x75, 0x00, 0x34, 0x73, 0x0A, 0x41, 0x17, 0x00, 0xA0, 0x2E, 0x20, 0x20,
+    0x49, 0x66, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x53, 0x00, 0x80, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x6C,
+    0x65, 0x64, 0x51, 0x00, 0x71, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x59, 0x00, 0x03, 0xF7,
+    0x00, 0x42, 0x63, 0x6F, 0x64, 0x65, 0xBA, 0x00, 0xF8, 0x00, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x20, 0x66, 0x6F, 0x72, 0x0A, 0x61, 0x6E, 0x79, 0xA1, 0x00, 0x06, 0x54, 0x01, 0xD9, 0x69,
+    0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x01, 0x41, 0x2C,
+    0x20, 0x65, 0x69, 0x10, 0x01, 0x0B, 0x5D, 0x00, 0x60, 0x0A, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x89,
+    0x01, 0x0F, 0x3C, 0x00, 0x07, 0x31, 0x20, 0x6F, 0x72, 0xB0, 0x00, 0x00, 0xB2, 0x01, 0x6D, 0x6F,
+    0x62, 0x74, 0x61, 0x69, 0x6E, 0xA3, 0x00, 0xB2, 0x61, 0x74, 0x20, 0x6E, 0x6F, 0x0A, 0x63, 0x68,
+    0x61, 0x72, 0x67, 0xB0, 0x00, 0xF3, 0x23, 0x0A, 0x3C, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F,
+    0x2F, 0x77, 0x77, 0x77, 0x2E, 0x69, 0x6E, 0x66, 0x69, 0x6E, 0x65, 0x6F, 0x6E, 0x2E, 0x63, 0x6F,
+    0x6D, 0x2F, 0x63, 0x6D, 0x73, 0x2F, 0x65, 0x6E, 0x2F, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6E, 0x2D,
+    0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x2F, 0x73, 0x6D, 0x00, 0x10, 0x2F, 0x02, 0x02, 0x50,
+    0x2D, 0x61, 0x6E, 0x64, 0x2D, 0xFF, 0x01, 0x12, 0x2D, 0x65, 0x00, 0x14, 0x2D, 0x1E, 0x00, 0xAF,
+    0x2D, 0x66, 0x6F, 0x73, 0x73, 0x2F, 0x3E, 0x2E, 0x0A, 0x54, 0x7D, 0x01, 0x03, 0x61, 0x74, 0x65,
+    0x72, 0x6D, 0x73, 0x20, 0xD4, 0x00, 0x60, 0x61, 0x63, 0x63, 0x6F, 0x6D, 0x70, 0x2B, 0x01, 0x49,
+    0x65, 0x61, 0x63, 0x68, 0xAE, 0x00, 0x60, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x9E, 0x02, 0x91,
+    0x54, 0x6F, 0x0A, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0xD2, 0x00, 0x0A, 0x46, 0x00, 0x07, 0x5F,
+    0x00, 0x3F, 0x74, 0x6F, 0x20, 0x74, 0x01, 0x06, 0xA4, 0x66, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69,
+    0x63, 0x68, 0x0A, 0xA3, 0x01, 0x21, 0x69, 0x73, 0xF7, 0x01, 0x62, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0xDB, 0x01, 0x71, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x47, 0x01, 0x01, 0x60, 0x01,
+    0x07, 0x8F, 0x00, 0xB1, 0x2C, 0x20, 0x70, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x65, 0xFC,
+    0x01, 0x05, 0x70, 0x02, 0xB0, 0x27, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x61,
+    0x43, 0x03, 0xD0, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x6F, 0x6E,
+    0x4A, 0x00, 0x20, 0x72, 0x20, 0xE2, 0x00, 0xF1, 0x18, 0x75, 0x74, 0x65, 0x72, 0x2E, 0x0A, 0x0A,
+    0x34, 0x2E, 0x20, 0x50, 0x72, 0x6F, 0x70, 0x72, 0x69, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x52,
+    0x69, 0x67, 0x68, 0x74, 0x73, 0x3B, 0x20, 0x4F, 0x77, 0x6E, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70,
+    0xD4, 0x02, 0x08, 0x10, 0x02, 0x02, 0xF0, 0x01, 0xF0, 0x0B, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x0A, 0x70,
+    0x72, 0x6F, 0x70, 0x65, 0xE5, 0x00, 0x11, 0x72, 0x46, 0x00, 0x00, 0x95, 0x00, 0x50, 0x72, 0x65,
+    0x69, 0x6E, 0x2C, 0xDA, 0x00, 0x00, 0xD5, 0x02, 0x01, 0x60, 0x01, 0x36, 0x72, 0x65, 0x6D, 0x0A,
+    0x02, 0x11, 0x6C, 0xB5, 0x03, 0x80, 0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0xF4, 0x1B,
+    0x76, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x6F, 0x66, 0x0A, 0x43,
+    0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x75,
+    0x70, 0x70, 0x6C, 0x69, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x20, 0x1B, 0x00, 0xF0, 0x2E, 0x72, 0x65,
+    0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6F,
+    0x64, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x61, 0x6E, 0x79, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+    0x6C, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x29, 0x00, 0xF4, 0x02, 0x72,
+    0x65, 0x6F, 0x66, 0x2E, 0x20, 0x20, 0x53, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F,
+    0x5B, 0x00, 0x1E, 0x27, 0x54, 0x00, 0xF8, 0x0F, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x6C, 0x79, 0x69,
+    0x6E, 0x67, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x28, 0x69, 0x6E, 0x63,
+    0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x63, 0x29, 0x2C, 0x20, 0x79, 0x6F, 0x75, 0x9E,
+    0x00, 0x0A, 0x49, 0x00, 0x00, 0x89, 0x00, 0xE0, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x2A, 0x00, 0x40, 0x6D, 0x61, 0x6B, 0x65, 0x7D, 0x00, 0x0B,
+    0xBB, 0x00, 0xF1, 0x00, 0x2E, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65,
+    0x20, 0x6E, 0x6F, 0xA0, 0x00, 0x50, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0xD5, 0x00, 0x15, 0x79, 0x06,
+    0x01, 0xE0, 0x63, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6F, 0x72, 0x0A, 0x6F,
+    0xD6, 0x00, 0x00, 0x2D, 0x00, 0x9F, 0x69, 0x63, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x11,
+    0x01, 0x01, 0x0E, 0x88, 0x00, 0x07, 0x0E, 0x01, 0x05, 0x74, 0x00, 0x8D, 0x0A, 0x74, 0x6F, 0x20,
+    0x6B, 0x65, 0x65, 0x70, 0x42, 0x00, 0xF0, 0x0C, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x64, 0x65, 0x6E,
+    0x74, 0x69, 0x61, 0x6C, 0x2E, 0x20, 0x20, 0x41, 0x6E, 0x79, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6F,
+    0x64, 0x75, 0x63, 0x4D, 0x00, 0x19, 0x2C, 0x5B, 0x00, 0x82, 0x2C, 0x0A, 0x74, 0x72, 0x61, 0x6E,
+    0x73, 0x6C, 0x0D, 0x00, 0x03, 0x87, 0x01, 0x03, 0x0D, 0x00, 0x21, 0x6F, 0x72, 0x39, 0x00, 0x51,
+    0x65, 0x73, 0x65, 0x6E, 0x74, 0x13, 0x00, 0x0F, 0xC1, 0x01, 0x01, 0xF1, 0x0A, 0x65, 0x78, 0x63,
+    0x65, 0x70, 0x74, 0x20, 0x61, 0x73, 0x0A, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64,
+    0x20, 0x69, 0x6E, 0x20, 0x53, 0x65, 0x6D, 0x00, 0xF0, 0x02, 0x20, 0x32, 0x20, 0x28, 0x22, 0x4C,
+    0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x22, 0x29, 0x20, 0x69, 0x73, 0x45, 0x02, 0x40, 0x68, 0x69,
+    0x62, 0x69, 0x27, 0x00, 0x71, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x53, 0x00, 0x22, 0x65,
+    0x78, 0x2F, 0x01, 0x20, 0x77, 0x72, 0x43, 0x00, 0x12, 0x6E, 0x4D, 0x00, 0x11, 0x73, 0x0A, 0x02,
+    0x24, 0x6F, 0x66, 0x4D, 0x01, 0x44, 0x2E, 0x20, 0x20, 0x45, 0x6F, 0x00, 0x11, 0x20, 0x4C, 0x01,
+    0x35, 0x77, 0x69, 0x73, 0x3C, 0x00, 0x20, 0x6C, 0x79, 0x5D, 0x00, 0x32, 0x76, 0x69, 0x64, 0x82,
+    0x00, 0x60, 0x74, 0x68, 0x69, 0x73, 0x0A, 0x41, 0x2A, 0x01, 0x42, 0x6D, 0x65, 0x6E, 0x74, 0xF5,
+    0x01, 0x30, 0x6D, 0x61, 0x79, 0x7E, 0x01, 0x92, 0x3A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69,
+    0x29, 0x0B, 0x01, 0x81, 0x79, 0x2C, 0x20, 0x61, 0x64, 0x61, 0x70, 0x74, 0xF2, 0x00, 0xF2, 0x11,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x75, 0x70,
+    0x9B, 0x02, 0x14, 0x20, 0x65, 0x02, 0x10, 0x3B, 0x4B, 0x00, 0x41, 0x28, 0x69, 0x69, 0x29, 0xE9,
+    0x01, 0x0D, 0x1B, 0x00, 0x20, 0x28, 0x69, 0x1B, 0x00, 0x04, 0x24, 0x01, 0x74, 0x6E, 0x64, 0x20,
+    0x6F, 0x6E, 0x6C, 0x79, 0x4D, 0x02, 0x60, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x74, 0xBF, 0x00, 0x50,
+    0x6C, 0x69, 0x63, 0x69, 0x74, 0xC0, 0x00, 0x05, 0x43, 0x01, 0x40, 0x62, 0x79, 0x20, 0x61, 0x53,
+    0x03, 0x51, 0x63, 0x61, 0x62, 0x6C, 0x65, 0xAF, 0x00, 0x00, 0x01, 0x00, 0xB1, 0x6C, 0x61, 0x77,
+    0x20, 0x64, 0x65, 0x73, 0x70, 0x69, 0x74, 0x65, 0xE0, 0x00, 0x52, 0x20, 0x6C, 0x69, 0x6D, 0x69,
+    0x9C, 0x01, 0x43, 0x2C, 0x20, 0x64, 0x65, 0x45, 0x03, 0x24, 0x2C, 0x20, 0xD4, 0x01, 0x50, 0x65,
+    0x2C, 0x20, 0x72, 0x65, 0x52, 0x03, 0xB5, 0x65, 0x20, 0x65, 0x6E, 0x67, 0x69, 0x6E, 0x65, 0x65,
+    0x72, 0x2C, 0x4D, 0x00, 0xB0, 0x64, 0x69, 0x73, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x65,
+    0xF9, 0x00, 0x06, 0x50, 0x01, 0x50, 0x72, 0x65, 0x64, 0x75, 0x63, 0x61, 0x00, 0x03, 0xCC, 0x00,
+    0x50, 0x61, 0x72, 0x65, 0x20, 0x74, 0xF3, 0x09, 0x6F, 0x20, 0x68, 0x75, 0x6D, 0x61, 0x6E, 0x2D,
+    0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x3B, 0x0A, 0x20,
+    0x01, 0x00, 0x20, 0x6F, 0x72, 0x0B, 0x00, 0xF0, 0x24, 0x28, 0x69, 0x76, 0x29, 0x20, 0x75, 0x73,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6F,
+    0x72, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x48, 0x00, 0x01, 0x2F,
+    0x00, 0xF0, 0x0D, 0x50, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x2E, 0x0A, 0x59, 0x6F, 0x75, 0x20,
+    0x68, 0x65, 0x72, 0x65, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x76, 0x65, 0x6E, 0x61, 0x6E, 0x74, 0x2A,
+    0x00, 0xF1, 0x06, 0x74, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x59, 0x00, 0x52, 0x63, 0x6C, 0x61, 0x69, 0x6D,
+    0x23, 0x00, 0x08, 0x78, 0x00, 0x10, 0x2C, 0x95, 0x00, 0xF0, 0x01, 0x64, 0x65, 0x72, 0x69, 0x76,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x22, 0x00, 0xF0, 0x00, 0x72,
+    0x65, 0x6F, 0x66, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0xA0, 0x00,
+    0x00, 0x85, 0x00, 0xF1, 0x02, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2C, 0x20, 0x69, 0x6E,
+    0x66, 0x72, 0x69, 0x6E, 0x67, 0x65, 0x5D, 0x00, 0xF0, 0x12, 0x69, 0x6E, 0x74, 0x65, 0x6C, 0x6C,
+    0x65, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x0A, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20,
+    0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x64, 0x3F, 0x00, 0x82, 0x63, 0x6F,
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x50, 0x00, 0xF4, 0x05, 0x79, 0x6F, 0x75, 0x0A, 0x0A, 0x35,
+    0x2E, 0x20, 0x4E, 0x6F, 0x20, 0x53, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0x20, 0x5E, 0x00,
+    0xC1, 0x20, 0x6D, 0x61, 0x79, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x69, 0x73, 0xC8, 0x00, 0xF2,
+    0x11, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x2C, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x64, 0x65, 0x20, 0x74, 0x65, 0x63, 0x68, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x20,
+    0x73, 0x41, 0x00, 0x14, 0x0A, 0x26, 0x01, 0x04, 0xDD, 0x00, 0xE1, 0x2E, 0x0A, 0x0A, 0x36, 0x2E,
+    0x20, 0x54, 0x65, 0x72, 0x6D, 0x20, 0x61, 0x6E, 0x64, 0x09, 0x00, 0xF1, 0x08, 0x69, 0x6E, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65,
+    0x65, 0x6D, 0x65, 0x6E, 0x6A, 0x00, 0x51, 0x65, 0x66, 0x66, 0x65, 0x63, 0x06, 0x01, 0x73, 0x75,
+    0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x30, 0x00, 0x30, 0x65, 0x64, 0x2C, 0x40, 0x00, 0x31, 0x0A,
+    0x65, 0x69, 0x91, 0x01, 0x20, 0x70, 0x61, 0xDD, 0x00, 0x36, 0x6D, 0x61, 0x79, 0x21, 0x00, 0x2A,
+    0x20, 0x74, 0x4D, 0x00, 0x12, 0x61, 0x74, 0x01, 0x90, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0xFF, 0x00, 0x00, 0x08, 0x00, 0x70, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x61, 0x75, 0xC1,
+    0x01, 0x0B, 0x7F, 0x00, 0x00, 0xA0, 0x00, 0xC2, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x6C, 0x69, 0x63,
+    0x65, 0x6E, 0x73, 0x65, 0x3D, 0x01, 0x51, 0x73, 0x20, 0x75, 0x6E, 0x64, 0x04, 0x02, 0x09, 0x2D,
+    0x00, 0x01, 0xE0, 0x01, 0x05, 0x7D, 0x00, 0xC5, 0x0A, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61,
+    0x74, 0x65, 0x6C, 0x79, 0x66, 0x00, 0xB5, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x65, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x56, 0x01, 0x21, 0x69, 0x66, 0x1E, 0x02, 0x20, 0x66, 0x61, 0xDC, 0x00, 0x63, 0x6F,
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x32, 0x00, 0x00, 0xAE, 0x00, 0x00, 0xB8, 0x01, 0x9B, 0x76, 0x69,
+    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x72, 0x00, 0x75, 0x2E, 0x20, 0x20, 0x55, 0x70, 0x6F,
+    0x6E, 0x74, 0x00, 0x41, 0x69, 0x6F, 0x6E, 0x2C, 0x4C, 0x00, 0xF5, 0x0C, 0x6D, 0x75, 0x73, 0x74,
+    0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x63, 0x6F, 0x70,
+    0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x0A, 0xDA, 0x02, 0x22, 0x69, 0x6E, 0xDA, 0x00, 0x62, 0x70,
+    0x6F, 0x73, 0x73, 0x65, 0x73, 0x61, 0x00, 0x05, 0x0E, 0x02, 0x01, 0x89, 0x01, 0x00, 0x28, 0x03,
+    0x70, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x5E, 0x01, 0xF0, 0x03, 0x61, 0x67, 0x72, 0x61,
+    0x70, 0x68, 0x73, 0x20, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x0A, 0x73, 0x75, 0x72, 0x76, 0x94, 0x01,
+    0x01, 0x51, 0x01, 0x06, 0x80, 0x00, 0x0E, 0xA5, 0x00, 0x60, 0x3A, 0x20, 0x22, 0x46, 0x72, 0x65,
+    0x29, 0x00, 0xC7, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0xEB,
+    0x02, 0xF1, 0x01, 0x22, 0x0A, 0x22, 0x50, 0x72, 0x6F, 0x70, 0x72, 0x69, 0x65, 0x74, 0x61, 0x72,
+    0x79, 0x20, 0x52, 0x62, 0x01, 0xF0, 0x01, 0x3B, 0x20, 0x4F, 0x77, 0x6E, 0x65, 0x72, 0x73, 0x68,
+    0x69, 0x70, 0x2C, 0x22, 0x20, 0x22, 0x43, 0x15, 0x01, 0x70, 0x69, 0x61, 0x6E, 0x63, 0x65, 0x20,
+    0x57, 0x19, 0x01, 0x30, 0x4C, 0x61, 0x77, 0x17, 0x00, 0x31, 0x44, 0x69, 0x73, 0x41, 0x03, 0x20,
+    0x65, 0x72, 0x46, 0x00, 0x55, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x86, 0x00, 0xB0, 0x4C, 0x69, 0x61,
+    0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x2C, 0x22, 0xF0, 0x31, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x22,
+    0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x2E, 0x22, 0x0A, 0x0A, 0x37, 0x2E, 0x20, 0x43, 0x6F,
+    0x6D, 0x70, 0x6C, 0x69, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x4C, 0x61,
+    0x77, 0x2E, 0x20, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x20, 0x61,
+    0x67, 0x72, 0x65, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x2B, 0x00, 0x30, 0x79, 0x20, 0x77,
+    0x27, 0x00, 0xF1, 0x0B, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x6C, 0x61, 0x77, 0x73, 0x2C, 0x0A, 0x72, 0x75, 0x6C, 0x65, 0x73, 0x65, 0x00,
+    0xF0, 0x06, 0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x0F, 0x00, 0x02, 0x3E, 0x00, 0xF0, 0x0C, 0x69, 0x74,
+    0x73, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x75, 0x6E, 0x64,
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x6E, 0x00, 0x60, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x0A, 0x8F, 0x00, 0xF1, 0x0C, 0x6F, 0x75, 0x74, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x67, 0x6F, 0x69, 0x6E, 0x67,
+    0x2C, 0x0F, 0x00, 0xF0, 0x08, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61,
+    0x79, 0x20, 0x62, 0x65, 0x20, 0x73, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0xAE, 0x00, 0x60, 0x65,
+    0x78, 0x70, 0x6F, 0x72, 0x74, 0x7B, 0x00, 0x50, 0x74, 0x72, 0x6F, 0x6C, 0x0A, 0xA2, 0x00, 0x0D,
+    0x9B, 0x00, 0x21, 0x6F, 0x66, 0x46, 0x00, 0xB3, 0x55, 0x6E, 0x69, 0x74, 0x65, 0x64, 0x20, 0x53,
+    0x74, 0x61, 0x74, 0xC0, 0x00, 0xF2, 0x06, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x75,
+    0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x2E, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x0B, 0x01, 0x43, 0x20,
+    0x74, 0x6F, 0x0A, 0x0A, 0x01, 0x68, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x13, 0x01, 0x41, 0x73,
+    0x75, 0x63, 0x68, 0x0D, 0x01, 0x0D, 0x6B, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x09, 0x61, 0x63, 0x6B,
+    0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x79, 0x6F,
+    0x75, 0x0A, 0x68, 0x61, 0x76, 0x0E, 0x00, 0xF0, 0x01, 0x65, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F,
+    0x6E, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0xC3, 0x00, 0xD2, 0x6F, 0x62, 0x74, 0x61,
+    0x69, 0x6E, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x84, 0x01, 0x02, 0xD6, 0x00, 0x54, 0x2C,
+    0x20, 0x72, 0x65, 0x2D, 0x0B, 0x00, 0x51, 0x6F, 0x72, 0x20, 0x69, 0x6D, 0xEC, 0x00, 0x44, 0x74,
+    0x68, 0x65, 0x0A, 0x12, 0x01, 0xF1, 0x60, 0x2E, 0x0A, 0x0A, 0x38, 0x2E, 0x20, 0x44, 0x69, 0x73,
+    0x63, 0x6C, 0x61, 0x69, 0x6D, 0x65, 0x72, 0x2E, 0x20, 0x20, 0x54, 0x4F, 0x20, 0x54, 0x48, 0x45,
+    0x20, 0x4D, 0x41, 0x58, 0x49, 0x4D, 0x55, 0x4D, 0x20, 0x45, 0x58, 0x54, 0x45, 0x4E, 0x54, 0x20,
+    0x50, 0x45, 0x52, 0x4D, 0x49, 0x54, 0x54, 0x45, 0x44, 0x20, 0x42, 0x59, 0x20, 0x41, 0x50, 0x50,
+    0x4C, 0x49, 0x43, 0x41, 0x42, 0x4C, 0x45, 0x20, 0x4C, 0x41, 0x57, 0x2C, 0x20, 0x43, 0x59, 0x50,
+    0x52, 0x45, 0x53, 0x53, 0x0A, 0x4D, 0x41, 0x4B, 0x45, 0x53, 0x20, 0x4E, 0x4F, 0x20, 0x57, 0x41,
+    0x52, 0x52, 0x41, 0x4E, 0x54, 0x59, 0x20, 0x4F, 0x46, 0x20, 0x41, 0x4E, 0x59, 0x20, 0x4B, 0x49,
+    0x4E, 0x44, 0x2C, 0x20, 0x45, 0x58, 0x27, 0x00, 0xF3, 0x09, 0x20, 0x4F, 0x52, 0x20, 0x49, 0x4D,
+    0x50, 0x4C, 0x49, 0x45, 0x44, 0x2C, 0x20, 0x57, 0x49, 0x54, 0x48, 0x20, 0x52, 0x45, 0x47, 0x41,
+    0x52, 0x44, 0x7A, 0x00, 0xF0, 0x13, 0x0A, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x2C,
+    0x20, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x49, 0x4E, 0x47, 0x2C, 0x20, 0x42, 0x55, 0x54, 0x20,
+    0x4E, 0x4F, 0x54, 0x20, 0x4C, 0x49, 0x4D, 0x49, 0x86, 0x00, 0x20, 0x54, 0x4F, 0x1F, 0x00, 0x70,
+    0x46, 0x52, 0x49, 0x4E, 0x47, 0x45, 0x4D, 0xA1, 0x00, 0x31, 0x41, 0x4E, 0x44, 0xB8, 0x00, 0x03,
+    0x5A, 0x00, 0x13, 0x0A, 0x83, 0x00, 0x30, 0x49, 0x45, 0x53, 0x85, 0x00, 0xF1, 0x00, 0x4D, 0x45,
+    0x52, 0x43, 0x48, 0x41, 0x4E, 0x54, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x59, 0x2E, 0x00, 0x40,
+    0x46, 0x49, 0x54, 0x4E, 0x8F, 0x00, 0xF0, 0x19, 0x46, 0x4F, 0x52, 0x20, 0x41, 0x20, 0x50, 0x41,
+    0x52, 0x54, 0x49, 0x43, 0x55, 0x4C, 0x41, 0x52, 0x20, 0x50, 0x55, 0x52, 0x50, 0x4F, 0x53, 0x45,
+    0x2E, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x0A, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76,
+    0x5B, 0x01, 0x00, 0x81, 0x01, 0x31, 0x69, 0x67, 0x68, 0x3B, 0x02, 0xA2, 0x6D, 0x61, 0x6B, 0x65,
+    0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x75, 0x01, 0x09, 0x6A, 0x02, 0x00, 0xEC, 0x01, 0x00, 0x97,
+    0x02, 0x66, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x65, 0x4B, 0x00, 0x40, 0x64, 0x6F, 0x65, 0x73, 0x15,
+    0x00, 0xF3, 0x00, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6C,
+    0x69, 0x61, 0xCE, 0x01, 0x40, 0x61, 0x72, 0x69, 0x73, 0xC4, 0x02, 0x00, 0x3A, 0x00, 0x03, 0x76,
+    0x02, 0x03, 0x3F, 0x03, 0x01, 0x16, 0x03, 0x95, 0x6F, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6F,
+    0x66, 0xC0, 0x01, 0x00, 0x13, 0x00, 0x00, 0x43, 0x00, 0x70, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+    0x74, 0x0F, 0x00, 0xF0, 0x02, 0x63, 0x69, 0x72, 0x63, 0x75, 0x69, 0x74, 0x20, 0x64, 0x65, 0x73,
+    0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x5B, 0x03, 0x08, 0x9C, 0x00, 0x71, 0x2E, 0x20, 0x20, 0x49,
+    0x74, 0x20, 0x69, 0xCE, 0x00, 0x00, 0xDB, 0x00, 0x07, 0x4F, 0x02, 0x50, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0xF0, 0x1C, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72,
+    0x6F, 0x70, 0x65, 0x72, 0x6C, 0x79, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6E, 0x2C, 0x11, 0x00,
+    0xE1, 0x67, 0x72, 0x61, 0x6D, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x74, 0x65, 0x73, 0x74, 0x33,
+    0x00, 0xD0, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x1B,
+    0x00, 0x70, 0x20, 0x73, 0x61, 0x66, 0x65, 0x74, 0x79, 0x53, 0x00, 0xB0, 0x61, 0x6E, 0x79, 0x20,
+    0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x23, 0x00, 0x5D, 0x20, 0x6D, 0x61, 0x64, 0x65, 0x6B,
+    0x00, 0x00, 0x4E, 0x00, 0x00, 0x29, 0x00, 0x90, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x69, 0x6E,
+    0x67, 0x69, 0x00, 0xF6, 0x16, 0x64, 0x75, 0x63, 0x74, 0x2E, 0x20, 0x20, 0x43, 0x79, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x75, 0x74,
+    0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x74, 0x73, 0x44, 0x00, 0x24, 0x6F, 0x72, 0x35,
+    0x00, 0x50, 0x73, 0x0A, 0x66, 0x6F, 0x72, 0xD4, 0x00, 0x31, 0x20, 0x69, 0x6E, 0x80, 0x00, 0x04,
+    0x18, 0x00, 0x40, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x00, 0x44, 0x20, 0x6D, 0x61, 0x6C, 0xB4, 0x00,
+    0x00, 0x38, 0x00, 0x50, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x43, 0x00, 0x0B, 0x97, 0x00, 0x34, 0x6F,
+    0x72, 0x0A, 0x7E, 0x00, 0x03, 0x43, 0x00, 0x30, 0x20, 0x6D, 0x61, 0xA6, 0x00, 0xF0, 0x05, 0x61,
+    0x73, 0x6F, 0x6E, 0x61, 0x62, 0x6C, 0x79, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63,
+    0x74, 0x65, 0x64, 0x30, 0x01, 0x02, 0xC0, 0x00, 0x00, 0x77, 0x00, 0x00, 0x2F, 0x01, 0x73, 0x69,
+    0x66, 0x69, 0x63, 0x61, 0x6E, 0x74, 0x46, 0x01, 0xF0, 0x02, 0x74, 0x79, 0x0A, 0x64, 0x61, 0x6D,
+    0x61, 0x67, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x6A, 0x75, 0x72, 0x79, 0x7A, 0x00, 0xF2, 0x04, 0x64,
+    0x65, 0x61, 0x74, 0x68, 0x20, 0x28, 0x22, 0x48, 0x69, 0x67, 0x68, 0x20, 0x52, 0x69, 0x73, 0x6B,
+    0x20, 0x50, 0x69, 0x00, 0xF0, 0x03, 0x22, 0x29, 0x2E, 0x20, 0x20, 0x49, 0x66, 0x20, 0x79, 0x6F,
+    0x75, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x26, 0x01, 0x1F, 0x79, 0x9C, 0x00, 0x0A, 0x00,
+    0xEE, 0x00, 0x1D, 0x20, 0x4A, 0x00, 0x11, 0x2C, 0x44, 0x00, 0xC0, 0x61, 0x73, 0x73, 0x75, 0x6D,
+    0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x72, 0x1D, 0x00, 0x71, 0x6F, 0x66, 0x20, 0x73, 0x75, 0x63,
+    0x68, 0x26, 0x01, 0x01, 0x7E, 0x01, 0x31, 0x67, 0x72, 0x65, 0xF3, 0x01, 0x95, 0x69, 0x6E, 0x64,
+    0x65, 0x6D, 0x6E, 0x69, 0x66, 0x79, 0x79, 0x01, 0x00, 0xD0, 0x01, 0x00, 0x6A, 0x01, 0x20, 0x73,
+    0x75, 0xC7, 0x01, 0xB1, 0x65, 0x72, 0x73, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x4E,
+    0x00, 0x50, 0x6C, 0x69, 0x61, 0x62, 0x69, 0xF8, 0x01, 0xB1, 0x2E, 0x20, 0x20, 0x4E, 0x6F, 0x0A,
+    0x63, 0x6F, 0x6D, 0x70, 0x75, 0xC2, 0x01, 0xA0, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x63,
+    0x61, 0x6E, 0x26, 0x01, 0xF0, 0x06, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x6C, 0x79,
+    0x20, 0x73, 0x65, 0x63, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x20, 0x54, 0x8E, 0x01, 0x50, 0x66, 0x6F,
+    0x72, 0x65, 0x2C, 0x60, 0x02, 0x42, 0x70, 0x69, 0x74, 0x65, 0x1C, 0x00, 0xF0, 0x06, 0x69, 0x74,
+    0x79, 0x0A, 0x6D, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x62, 0x01, 0x25, 0x69, 0x6E, 0x95, 0x00, 0x44, 0x68, 0x61, 0x72, 0x64, 0xF7,
+    0x01, 0x14, 0x73, 0x14, 0x01, 0x04, 0xE8, 0x01, 0x19, 0x2C, 0x35, 0x02, 0x11, 0x0A, 0x35, 0x02,
+    0x03, 0x00, 0x01, 0x26, 0x6E, 0x79, 0xB2, 0x00, 0x50, 0x20, 0x61, 0x72, 0x69, 0x73, 0xAB, 0x00,
+    0x34, 0x6F, 0x75, 0x74, 0xAB, 0x02, 0x04, 0x81, 0x00, 0x82, 0x20, 0x62, 0x72, 0x65, 0x61, 0x63,
+    0x68, 0x2C, 0x26, 0x01, 0x55, 0x61, 0x73, 0x0A, 0x75, 0x6E, 0x78, 0x02, 0x50, 0x64, 0x20, 0x61,
+    0x63, 0x63, 0x5E, 0x00, 0x20, 0x74, 0x6F, 0x7F, 0x00, 0x00, 0x43, 0x01, 0x00, 0x3E, 0x00, 0x05,
+    0x75, 0x00, 0x04, 0xBC, 0x02, 0xA2, 0x0A, 0x0A, 0x39, 0x2E, 0x20, 0x4C, 0x69, 0x6D, 0x69, 0x74,
+    0xFB, 0x02, 0x47, 0x6F, 0x66, 0x20, 0x4C, 0x2E, 0x01, 0xF0, 0x2C, 0x54, 0x4F, 0x20, 0x54, 0x48,
+    0x45, 0x20, 0x4D, 0x41, 0x58, 0x49, 0x4D, 0x55, 0x4D, 0x20, 0x45, 0x58, 0x54, 0x45, 0x4E, 0x54,
+    0x20, 0x50, 0x45, 0x52, 0x4D, 0x49, 0x54, 0x54, 0x45, 0x44, 0x20, 0x42, 0x59, 0x20, 0x41, 0x50,
+    0x50, 0x4C, 0x49, 0x43, 0x41, 0x42, 0x4C, 0x45, 0x0A, 0x4C, 0x41, 0x57, 0x2C, 0x20, 0x49, 0x4E,
+    0x20, 0x4E, 0x4F, 0x20, 0x45, 0x56, 0x29, 0x00, 0xF0, 0x07, 0x57, 0x49, 0x4C, 0x4C, 0x20, 0x43,
+    0x59, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x4F, 0x52, 0x20, 0x49, 0x54, 0x53, 0x20, 0x53, 0x55,
+    0x31, 0x00, 0xB1, 0x45, 0x52, 0x53, 0x2C, 0x20, 0x52, 0x45, 0x53, 0x45, 0x4C, 0x4C, 0x0B, 0x00,
+    0xF0, 0x10, 0x4F, 0x52, 0x20, 0x44, 0x49, 0x53, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x4F, 0x52,
+    0x53, 0x20, 0x42, 0x45, 0x0A, 0x4C, 0x49, 0x41, 0x42, 0x4C, 0x45, 0x20, 0x46, 0x4F, 0x52, 0x20,
+    0x41, 0xF1, 0x11, 0x4E, 0x59, 0x20, 0x4C, 0x4F, 0x53, 0x54, 0x20, 0x52, 0x45, 0x56, 0x45, 0x4E,
+    0x55, 0x45, 0x2C, 0x20, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x54, 0x2C, 0x20, 0x4F, 0x52, 0x20, 0x44,
+    0x41, 0x54, 0x41, 0x09, 0x00, 0xF3, 0x12, 0x46, 0x4F, 0x52, 0x20, 0x53, 0x50, 0x45, 0x43, 0x49,
+    0x41, 0x4C, 0x2C, 0x20, 0x49, 0x4E, 0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x2C, 0x0A, 0x43, 0x4F,
+    0x4E, 0x53, 0x45, 0x51, 0x55, 0x45, 0x4E, 0x54, 0x19, 0x00, 0x60, 0x43, 0x49, 0x44, 0x45, 0x4E,
+    0x54, 0x0C, 0x00, 0xF0, 0x29, 0x4F, 0x52, 0x20, 0x50, 0x55, 0x4E, 0x49, 0x54, 0x49, 0x56, 0x45,
+    0x20, 0x44, 0x41, 0x4D, 0x41, 0x47, 0x45, 0x53, 0x20, 0x48, 0x4F, 0x57, 0x45, 0x56, 0x45, 0x52,
+    0x20, 0x43, 0x41, 0x55, 0x53, 0x45, 0x44, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x52, 0x45, 0x47, 0x41,
+    0x52, 0x44, 0x4C, 0x45, 0x53, 0x53, 0x0A, 0x4F, 0x46, 0x20, 0x54, 0x48, 0x45, 0x04, 0x00, 0xF0,
+    0x0E, 0x4F, 0x52, 0x59, 0x20, 0x4F, 0x46, 0x20, 0x4C, 0x49, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54,
+    0x59, 0x2C, 0x20, 0x41, 0x52, 0x49, 0x53, 0x49, 0x4E, 0x47, 0x20, 0x4F, 0x55, 0x54, 0x1A, 0x00,
+    0xD1, 0x4F, 0x52, 0x20, 0x52, 0x45, 0x4C, 0x41, 0x54, 0x45, 0x44, 0x20, 0x54, 0x4F, 0x36, 0x00,
+    0x32, 0x55, 0x53, 0x45, 0x19, 0x00, 0x33, 0x0A, 0x49, 0x4E, 0x36, 0x00, 0x00, 0x1B, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x1F, 0x00, 0x90, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0xE5,
+    0x00, 0xB0, 0x20, 0x49, 0x46, 0x20, 0x43, 0x59, 0x50, 0x52, 0x45, 0x53, 0x53, 0x4A, 0x00, 0xF1,
+    0x06, 0x49, 0x54, 0x53, 0x20, 0x53, 0x55, 0x50, 0x50, 0x4C, 0x49, 0x45, 0x52, 0x53, 0x2C, 0x20,
+    0x52, 0x45, 0x53, 0x45, 0x4C, 0x4C, 0x0B, 0x00, 0xF0, 0x0F, 0x4F, 0x52, 0x0A, 0x44, 0x49, 0x53,
+    0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x4F, 0x52, 0x53, 0x20, 0x48, 0x41, 0x56, 0x45, 0x20, 0x42,
+    0x45, 0x45, 0x4E, 0x20, 0x41, 0x44, 0x56, 0x49, 0xC3, 0x00, 0x03, 0xB4, 0x00, 0x53, 0x50, 0x4F,
+    0x53, 0x53, 0x49, 0x76, 0x00, 0x74, 0x4F, 0x46, 0x20, 0x53, 0x55, 0x43, 0x48, 0xF5, 0x00, 0x90,
+    0x2E, 0x20, 0x20, 0x49, 0x4E, 0x20, 0x4E, 0x4F, 0x0A, 0x7A, 0x00, 0x74, 0x54, 0x20, 0x53, 0x48,
+    0x41, 0x4C, 0x4C, 0x7E, 0x00, 0x1D, 0x27, 0x7F, 0x00, 0x17, 0x27, 0x80, 0x00, 0x12, 0x27, 0x83,
+    0x01, 0x07, 0x81, 0x00, 0x85, 0x27, 0x20, 0x54, 0x4F, 0x54, 0x41, 0x4C, 0x0A, 0x19, 0x01, 0x00,
+    0xE3, 0x00, 0xC0, 0x59, 0x4F, 0x55, 0x2C, 0x20, 0x57, 0x48, 0x45, 0x54, 0x48, 0x45, 0x52, 0x6B,
+    0x00, 0xF0, 0x07, 0x43, 0x4F, 0x4E, 0x54, 0x52, 0x41, 0x43, 0x54, 0x2C, 0x20, 0x54, 0x4F, 0x52,
+    0x54, 0x20, 0x28, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x3D, 0x01, 0xB1, 0x4E, 0x45, 0x47, 0x4C,
+    0x49, 0x47, 0x45, 0x4E, 0x43, 0x45, 0x29, 0xDC, 0x00, 0x10, 0x4F, 0x33, 0x00, 0xA0, 0x57, 0x49,
+    0x53, 0x45, 0x2C, 0x20, 0x45, 0x58, 0x43, 0x45, 0x4D, 0x01, 0xA0, 0x48, 0x45, 0x20, 0x47, 0x52,
+    0x45, 0x41, 0x54, 0x45, 0x52, 0xC8, 0x00, 0x60, 0x55, 0x53, 0x24, 0x35, 0x30, 0x30, 0x86, 0x00,
+    0x01, 0xE5, 0x00, 0xC0, 0x52, 0x49, 0x43, 0x45, 0x20, 0x50, 0x41, 0x49, 0x44, 0x20, 0x42, 0x59,
+    0x77, 0x00, 0x01, 0x16, 0x02, 0x44, 0x54, 0x48, 0x45, 0x0A, 0x5E, 0x01, 0x21, 0x2E, 0x20, 0x29,
+    0x00, 0x60, 0x46, 0x4F, 0x52, 0x45, 0x47, 0x4F, 0x72, 0x00, 0xB3, 0x4C, 0x49, 0x4D, 0x49, 0x54,
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0xFA, 0x00, 0x55, 0x41, 0x50, 0x50, 0x4C, 0x59, 0x86, 0x01,
+    0x00, 0x2E, 0x00, 0x80, 0x41, 0x42, 0x4F, 0x56, 0x45, 0x2D, 0x53, 0x54, 0xCE, 0x01, 0xF0, 0x00,
+    0x0A, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4E, 0x54, 0x59, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x53, 0x84,
+    0x00, 0x00, 0x1F, 0x01, 0x32, 0x45, 0x53, 0x53, 0x63, 0x02, 0x70, 0x20, 0x50, 0x55, 0x52, 0x50,
+    0x4F, 0x53, 0x69, 0x00, 0x21, 0x42, 0x45, 0x46, 0x02, 0x61, 0x20, 0x53, 0x4F, 0x4D, 0x45, 0x20,
+    0x3E, 0x00, 0x01, 0xCD, 0x01, 0x81, 0x4A, 0x55, 0x52, 0x49, 0x53, 0x44, 0x49, 0x43, 0x74, 0x00,
+    0xD7, 0x0A, 0x44, 0x4F, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x41, 0x4C, 0x4C, 0x4F, 0x57, 0x8D, 0x00,
+    0x00, 0x29, 0x00, 0x61, 0x45, 0x58, 0x43, 0x4C, 0x55, 0x53, 0x0D, 0x00, 0x10, 0x46, 0x34, 0x01,
+    0x06, 0xC8, 0x02, 0x01, 0x95, 0x01, 0x05, 0xCA, 0x02, 0x04, 0xC8, 0x01, 0x20, 0x2C, 0x0A, 0xBF,
+    0x00, 0x00, 0xD6, 0x02, 0x22, 0x4F, 0x52, 0xD1, 0x00, 0x03, 0xFC, 0x01, 0x01, 0xC0, 0x00, 0x08,
+    0x5D, 0x00, 0x32, 0x4D, 0x41, 0x59, 0x76, 0x00, 0x01, 0xEB, 0x00, 0x02, 0xA2, 0x01, 0xF0, 0x09,
+    0x2E, 0x0A, 0x0A, 0x31, 0x30, 0x2E, 0x20, 0x52, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x65,
+    0x64, 0x20, 0x52, 0x69, 0x67, 0x68, 0x74, 0x73, 0x32, 0x01, 0xF0, 0x0A, 0x68, 0x65, 0x20, 0x53,
+    0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x65,
+    0x72, 0x63, 0x69, 0x61, 0x6C, 0x0B, 0x00, 0x74, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x73, 0x20,
+    0x00, 0xC0, 0x61, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x0A, 0x74, 0x65, 0x72, 0x6D, 0x2D, 0x00,
+    0xF0, 0x1A, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x34,
+    0x38, 0x20, 0x43, 0x2E, 0x46, 0x2E, 0x52, 0x2E, 0x20, 0x32, 0x35, 0x32, 0x2E, 0x32, 0x32, 0x37,
+    0x2D, 0x37, 0x30, 0x31, 0x34, 0x28, 0x61, 0x29, 0x28, 0x31, 0x29, 0x87, 0x02, 0x3A, 0x66, 0x20,
+    0x74, 0x6C, 0x00, 0x50, 0x20, 0x62, 0x65, 0x69, 0x6E, 0xF0, 0x22, 0x67, 0x0A, 0x61, 0x63, 0x71,
+    0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x62,
+    0x65, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x2E, 0x53,
+    0x2E, 0x20, 0x47, 0x6F, 0x76, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x24, 0x00, 0x4D, 0x62,
+    0x79, 0x20, 0x61, 0x18, 0x00, 0xE0, 0x70, 0x72, 0x69, 0x6D, 0x65, 0x0A, 0x63, 0x6F, 0x6E, 0x74,
+    0x72, 0x61, 0x63, 0x74, 0x4A, 0x00, 0x57, 0x72, 0x20, 0x73, 0x75, 0x62, 0x11, 0x00, 0xE0, 0x28,
+    0x61, 0x74, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x74, 0x69, 0x65, 0x72, 0x29, 0x2C, 0x5D, 0x00, 0x11,
+    0x6E, 0x62, 0x00, 0x06, 0x45, 0x00, 0xF0, 0x26, 0x27, 0x73, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74,
+    0x73, 0x20, 0x69, 0x6E, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x73, 0x68,
+    0x61, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x6F, 0x73,
+    0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x74, 0x68, 0x20, 0x69, 0x45, 0x00, 0x80,
+    0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x45, 0x00, 0xF0, 0x14, 0x2E, 0x0A, 0x0A, 0x31,
+    0x31, 0x2E, 0x20, 0x50, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x49, 0x6E, 0x66, 0x6F,
+    0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x61, 0x2B,
+    0x00, 0x76, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x1D, 0x00, 0xB0, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x1D, 0x00, 0x50, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x14,
+    0x00, 0x92, 0x72, 0x0A, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x26, 0x00, 0xF1, 0x0F, 0x6F,
+    0x6E, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x49, 0x6F, 0x54, 0x20, 0x43, 0x6F,
+    0x6D, 0x6D, 0x75, 0x6E, 0x69, 0x74, 0x79, 0x20, 0x46, 0x6F, 0x72, 0x75, 0x6D, 0x43, 0x01, 0x45,
+    0x74, 0x68, 0x65, 0x72, 0x25, 0x00, 0xF0, 0x05, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x73,
+    0x2C, 0x0A, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x15, 0x01, 0x2A, 0x61,
+    0x63, 0x7E, 0x00, 0x05, 0x39, 0x00, 0x14, 0x70, 0xB9, 0x00, 0x07, 0x1E, 0x00, 0x50, 0x2C, 0x20,
+    0x6D, 0x61, 0x79, 0x03, 0x01, 0xF2, 0x01, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64,
+    0x0A, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x73, 0xB8, 0x01, 0x04, 0x6C, 0x00, 0x70, 0x63, 0x6F, 0x6E,
+    0x73, 0x69, 0x73, 0x74, 0x8F, 0x01, 0x20, 0x77, 0x69, 0x1C, 0x01, 0xF4, 0x2F, 0x74, 0x73, 0x20,
+    0x44, 0x61, 0x74, 0x61, 0x20, 0x50, 0x72, 0x69, 0x76, 0x61, 0x63, 0x79, 0x20, 0x50, 0x6F, 0x6C,
+    0x69, 0x63, 0x79, 0x0A, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77,
+    0x2E, 0x69, 0x6E, 0x66, 0x69, 0x6E, 0x65, 0x6F, 0x6E, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x63, 0x6D,
+    0x73, 0x2F, 0x65, 0x6E, 0x2F, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x2D, 0x1A, 0x00, 0x22, 0x2F, 0x70,
+    0x3F, 0x00, 0x21, 0x2D, 0x70, 0x3F, 0x00, 0xB0, 0x2F, 0x29, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x75,
+    0x70, 0x64, 0x61, 0x89, 0x00, 0x70, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x76, 0x69, 0x8B, 0x00, 0xC1,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x6F, 0x08, 0x00, 0x20, 0x2C,
+    0x20, 0xA7, 0x00, 0x03, 0xBC, 0x00, 0x03, 0x5C, 0x01, 0x10, 0x64, 0x1D, 0x00, 0x00, 0x9A, 0x00,
+    0xF0, 0x05, 0x74, 0x68, 0x69, 0x72, 0x64, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x20, 0x73, 0x61,
+    0x6C, 0x65, 0x73, 0x0A, 0x72, 0x65, 0xC8, 0x00, 0xC0, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x73, 0x2C, 0x20, 0x64, 0x78, 0x01, 0x71, 0x69, 0x62, 0x75, 0x74, 0x6F, 0x72, 0x73, 0x4B,
+    0x00, 0x02, 0x23, 0x01, 0x71, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0xF1, 0x00, 0x40, 0x64,
+    0x75, 0x63, 0x74, 0x54, 0x01, 0x01, 0x42, 0x00, 0x61, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x1C,
+    0x00, 0x36, 0x0A, 0x66, 0x6F, 0x85, 0x01, 0x00, 0x0C, 0x00, 0x01, 0x21, 0x00, 0x40, 0x2D, 0x72,
+    0x65, 0x6C, 0xB6, 0x00, 0x07, 0x4D, 0x00, 0x50, 0x62, 0x75, 0x73, 0x69, 0x6E, 0x25, 0x00, 0x80,
+    0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x73, 0x41, 0x02, 0xE9, 0x32, 0x2E, 0x20, 0x47, 0x65,
+    0x6E, 0x65, 0x72, 0x61, 0x6C, 0x2E, 0x20, 0x20, 0x54, 0x60, 0x02, 0x30, 0x20, 0x77, 0x69, 0x8F,
+    0x02, 0x22, 0x69, 0x6E, 0x45, 0x00, 0x42, 0x69, 0x6E, 0x75, 0x72, 0xF0, 0x00, 0xA0, 0x68, 0x65,
+    0x20, 0x62, 0x65, 0x6E, 0x65, 0x66, 0x69, 0x74, 0x3C, 0x03, 0x51, 0x65, 0x61, 0x63, 0x68, 0x0A,
+    0xDD, 0x00, 0xA4, 0x27, 0x73, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0xC6, 0x00, 0x87,
+    0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x73, 0x2C, 0x13, 0x01, 0x00, 0x8D, 0x02, 0x00, 0x81, 0x02,
+    0x00, 0x2C, 0x01, 0x33, 0x6E, 0x6F, 0x74, 0x23, 0x00, 0x00, 0x16, 0x02, 0x9A, 0x74, 0x72, 0x61,
+    0x6E, 0x73, 0x66, 0x65, 0x72, 0x0A, 0xE7, 0x02, 0x10, 0x2C, 0xFA, 0x02, 0x50, 0x77, 0x68, 0x6F,
+    0x6C, 0x65, 0x25, 0x00, 0x21, 0x69, 0x6E, 0x49, 0x01, 0x11, 0x2C, 0xF8, 0x01, 0x34, 0x6F, 0x75,
+    0x74, 0xFA, 0x00, 0x91, 0x27, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x1C, 0x02, 0x00,
+    0x1E, 0x03, 0x02, 0xCF, 0x00, 0x80, 0x0A, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0xF0, 0x36,
+    0x6E, 0x74, 0x20, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x67, 0x6F, 0x76, 0x65,
+    0x72, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x72, 0x75, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x61,
+    0x6E, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x77,
+    0x73, 0x20, 0x6F, 0x66, 0x0A, 0x0C, 0x00, 0xF2, 0x0C, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x43, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x2C, 0x20, 0x55, 0x6E,
+    0x69, 0x74, 0x65, 0x64, 0x1C, 0x00, 0x00, 0x2A, 0x00, 0xF0, 0x12, 0x20, 0x41, 0x6D, 0x65, 0x72,
+    0x69, 0x63, 0x61, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x69, 0x66, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F,
+    0x72, 0x6D, 0x65, 0x64, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x6C, 0x79, 0x0A, 0x5B, 0x00, 0x21, 0x69,
+    0x6E, 0x5D, 0x00, 0x11, 0x73, 0x51, 0x00, 0x00, 0x88, 0x00, 0x00, 0x15, 0x00, 0xF1, 0x05, 0x6F,
+    0x75, 0x74, 0x20, 0x67, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74,
+    0x20, 0x74, 0x6F, 0x27, 0x00, 0x82, 0x70, 0x72, 0x69, 0x6E, 0x63, 0x69, 0x70, 0x6C, 0x60, 0x00,
+    0x80, 0x63, 0x6F, 0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x96, 0x00, 0x70, 0x6C, 0x61, 0x77, 0x2E,
+    0x20, 0x20, 0x54, 0x24, 0x00, 0x61, 0x61, 0x72, 0x74, 0x69, 0x65, 0x73, 0xD1, 0x00, 0x21, 0x65,
+    0x6E, 0x3B, 0x00, 0x81, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x61, 0x00, 0xF0, 0x07,
+    0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x6A, 0x75, 0x72, 0x69, 0x73, 0x64,
+    0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x50, 0x00, 0x00, 0x1E, 0x00, 0x9B, 0x76, 0x65, 0x6E, 0x75,
+    0x65, 0x0A, 0x69, 0x6E, 0x2C, 0x97, 0x00, 0xE1, 0x66, 0x65, 0x64, 0x65, 0x72, 0x61, 0x6C, 0x20,
+    0x63, 0x6F, 0x75, 0x72, 0x74, 0x73, 0xA6, 0x00, 0xF7, 0x07, 0x69, 0x6E, 0x20, 0x53, 0x61, 0x6E,
+    0x74, 0x61, 0x20, 0x43, 0x6C, 0x61, 0x72, 0x61, 0x20, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x79, 0x2C,
+    0x13, 0x01, 0xF0, 0x03, 0x3B, 0x0A, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x68,
+    0x6F, 0x77, 0x65, 0x76, 0x65, 0x72, 0x56, 0x00, 0x50, 0x61, 0x74, 0x20, 0x6E, 0x6F, 0x3E, 0x00,
+    0x10, 0x67, 0x6A, 0x01, 0xB0, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D,
+    0xAD, 0x00, 0xF0, 0x09, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x43,
+    0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x27, 0x20, 0x72, 0x69, 0x67, 0x68, 0xC7, 0x00, 0x30, 0x0A,
+    0x62, 0x72, 0x35, 0x00, 0x30, 0x6C, 0x65, 0x67, 0xCA, 0x00, 0x02, 0xB6, 0x00, 0x00, 0xAC, 0x01,
+    0x22, 0x6E, 0x79, 0xB6, 0x00, 0x00, 0x0D, 0x00, 0x51, 0x6F, 0x72, 0x64, 0x65, 0x72, 0xF3, 0x00,
+    0x30, 0x72, 0x6F, 0x74, 0x39, 0x01, 0xF0, 0x0C, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x66, 0x6F, 0x72,
+    0x63, 0x65, 0x20, 0x69, 0x74, 0x73, 0x0A, 0x69, 0x6E, 0x74, 0x65, 0x6C, 0x6C, 0x65, 0x63, 0x74,
+    0x75, 0x61, 0x6C, 0x24, 0x00, 0x52, 0x70, 0x65, 0x72, 0x74, 0x79, 0x62, 0x00, 0xD1, 0x73, 0x2E,
+    0x20, 0x20, 0x4E, 0x6F, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0xDD, 0x01, 0x61, 0x65, 0x69,
+    0x74, 0x68, 0x65, 0x72, 0x51, 0x01, 0x10, 0x79, 0x54, 0x00, 0xC4, 0x65, 0x78, 0x65, 0x72, 0x63,
+    0x69, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x0A, 0x55, 0x00, 0x00, 0x7E, 0x00, 0x20, 0x6F, 0x66, 0x5C,
+    0x00, 0x03, 0x46, 0x00, 0x31, 0x20, 0x75, 0x6E, 0x83, 0x00, 0x0F, 0xD8, 0x00, 0x00, 0x30, 0x61,
+    0x63, 0x74, 0x0B, 0x02, 0x80, 0x61, 0x20, 0x77, 0x61, 0x69, 0x76, 0x65, 0x72, 0x38, 0x00, 0x55,
+    0x73, 0x75, 0x63, 0x68, 0x0A, 0x7F, 0x00, 0x10, 0x49, 0x84, 0x01, 0x54, 0x79, 0x20, 0x70, 0x6F,
+    0x72, 0x93, 0x01, 0x0B, 0x47, 0x00, 0x80, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x8E,
+    0x00, 0x70, 0x62, 0x65, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x8D, 0x00, 0x23, 0x75, 0x6E, 0x8F, 0x00,
+    0x42, 0x61, 0x62, 0x6C, 0x65, 0xBA, 0x01, 0x60, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x30, 0x01,
+    0x01, 0x84, 0x01, 0x41, 0x73, 0x69, 0x6F, 0x6E, 0x34, 0x02, 0x0B, 0x51, 0x00, 0x02, 0x0F, 0x03,
+    0x02, 0x2D, 0x00, 0x00, 0x40, 0x01, 0x54, 0x66, 0x75, 0x6C, 0x6C, 0x0A, 0xDA, 0x00, 0x13, 0x64,
+    0x7E, 0x02, 0x01, 0x59, 0x02, 0x0C, 0x88, 0x00, 0x00, 0x65, 0x00, 0x63, 0x63, 0x6F, 0x6D, 0x70,
+    0x6C, 0x65, 0x22, 0x02, 0x06, 0x58, 0x02, 0x14, 0x61, 0x28, 0x00, 0x72, 0x0A, 0x62, 0x65, 0x74,
+    0x77, 0x65, 0x65, 0xE3, 0x02, 0x04, 0x98, 0x02, 0x01, 0x51, 0x03, 0x47, 0x72, 0x65, 0x73, 0x70,
+    0xD8, 0x02, 0x40, 0x73, 0x75, 0x62, 0x6A, 0x0F, 0x00, 0xF0, 0x02, 0x6D, 0x61, 0x74, 0x74, 0x65,
+    0x72, 0x20, 0x68, 0x65, 0x72, 0x65, 0x6F, 0x66, 0x2C, 0x20, 0x73, 0x75, 0xBA, 0x02, 0x20, 0x65,
+    0x64, 0xC7, 0x00, 0xA2, 0x61, 0x6E, 0x64, 0x0A, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x0E, 0x00,
+    0x02, 0xB6, 0x03, 0x00, 0xBE, 0x00, 0x56, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x75, 0x00, 0x20, 0x73,
+    0x2C, 0x98, 0x00, 0x60, 0x6D, 0x75, 0x6E, 0x69, 0x63, 0x61, 0x47, 0x01, 0xB0, 0x73, 0x2C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x75, 0x6E, 0x64, 0x65, 0xF0, 0x19, 0x72, 0x73, 0x74, 0x61, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x73, 0x0A, 0x28, 0x62, 0x6F, 0x74, 0x68, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74,
+    0x65, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x72, 0x61, 0x6C, 0x29, 0x20, 0x72, 0x65, 0x67,
+    0x61, 0x72, 0x23, 0x00, 0xF0, 0x39, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x73, 0x75, 0x62, 0x6A,
+    0x65, 0x63, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x72, 0x2E, 0x20, 0x20, 0x41, 0x6E, 0x79,
+    0x20, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x0A, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x65, 0x6D, 0x65,
+    0x64, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x68, 0x5E, 0x00,
+    0xF1, 0x01, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76,
+    0x65, 0x64, 0x70, 0x00, 0x40, 0x6D, 0x75, 0x73, 0x74, 0x34, 0x00, 0x48, 0x73, 0x65, 0x6E, 0x74,
+    0x4C, 0x00, 0xF0, 0x53, 0x53, 0x65, 0x6D, 0x69, 0x63, 0x6F, 0x6E, 0x64, 0x75, 0x63, 0x74, 0x6F,
+    0x72, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x41,
+    0x54, 0x54, 0x4E, 0x3A, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x4C, 0x65, 0x67, 0x61, 0x6C,
+    0x20, 0x4F, 0x66, 0x66, 0x69, 0x63, 0x65, 0x72, 0x2C, 0x20, 0x31, 0x39, 0x38, 0x20, 0x43, 0x68,
+    0x61, 0x6D, 0x70, 0x69, 0x6F, 0x6E, 0x20, 0x43, 0x6F, 0x75, 0x72, 0x74, 0x2C, 0x20, 0x53, 0x61,
+    0x6E, 0x0A, 0x4A, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x43, 0x41, 0x20, 0x39, 0x35, 0x31, 0x33, 0x34,
+    0x20, 0x55, 0x53, 0x41, 0x2E, 0x0A,
+};
+
+static const uint32_t zasset_demo_text_offsets[14] XIP_ASSET =
+{
+    0x00000000u, 0x000002F7u, 0x00000597u, 0x000007EEu, 0x00000ABAu, 0x00000D8Eu,
+    0x00001066u, 0x00001388u, 0x000016E1u, 0x000019F1u, 0x00001D29u, 0x0000204Eu,
+    0x00002368u, 0x00002466u,
+};
+
+const xip_zasset_t zasset_demo_text =
+{
+    .blocks = zasset_demo_text_blocks,
+    .offsets = zasset_demo_text_offsets,
+    .size = 12551u,
+    .block_size = 1024u,
+    .block_count = 13u
+};
+
+const uint8_t zasset_demo_text_raw[12551] XIP_ASSET =
+{
+    0x43, 0x59, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x28, 0x41, 0x4E, 0x20, 0x49, 0x4E, 0x46, 0x49,
+    0x4E, 0x45, 0x4F, 0x4E, 0x20, 0x43, 0x4F, 0x4D, 0x50, 0x41, 0x4E, 0x59, 0x29, 0x20, 0x45, 0x4E,
+    0x44, 0x20, 0x55, 0x53, 0x45, 0x52, 0x20, 0x4C, 0x49, 0x43, 0x45, 0x4E, 0x53, 0x45, 0x20, 0x41,
+    0x47, 0x52, 0x45, 0x45, 0x4D, 0x45, 0x4E, 0x54, 0x0A, 0x0A, 0x50, 0x4C, 0x45, 0x41, 0x53, 0x45,
+    0x20, 0x52, 0x45, 0x41, 0x44, 0x20, 0x54, 0x48, 0x49, 0x53, 0x20, 0x45, 0x4E, 0x44, 0x20, 0x55,
+    0x53, 0x45, 0x52, 0x20, 0x4C, 0x49, 0x43, 0x45, 0x4E, 0x53, 0x45, 0x20, 0x41, 0x47, 0x52, 0x45,
+    0x45, 0x4D, 0x45, 0x4E, 0x54, 0x20, 0x28, 0x22, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x22, 0x29, 0x20, 0x43, 0x41, 0x52, 0x45, 0x46, 0x55, 0x4C, 0x4C, 0x59, 0x20, 0x42, 0x45,
+    0x46, 0x4F, 0x52, 0x45, 0x0A, 0x44, 0x4F, 0x57, 0x4E, 0x4C, 0x4F, 0x41, 0x44, 0x49, 0x4E, 0x47,
+    0x2C, 0x20, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x49, 0x4E, 0x47, 0x2C, 0x20, 0x43, 0x4F,
+    0x50, 0x59, 0x49, 0x4E, 0x47, 0x2C, 0x20, 0x4F, 0x52, 0x20, 0x55, 0x53, 0x49, 0x4E, 0x47, 0x20,
+    0x54, 0x48, 0x49, 0x53, 0x20, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x41, 0x4E,
+    0x44, 0x20, 0x41, 0x43, 0x43, 0x4F, 0x4D, 0x50, 0x41, 0x4E, 0x59, 0x49, 0x4E, 0x47, 0x0A, 0x44,
+    0x4F, 0x43, 0x55, 0x4D, 0x45, 0x4E, 0x54, 0x41, 0x54, 0x49, 0x4F, 0x4E, 0x2E, 0x20, 0x20, 0x42,
+    0x59, 0x20, 0x44, 0x4F, 0x57, 0x4E, 0x4C, 0x4F, 0x41, 0x44, 0x49, 0x4E, 0x47, 0x2C, 0x20, 0x49,
+    0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x49, 0x4E, 0x47, 0x2C, 0x20, 0x43, 0x4F, 0x50, 0x59, 0x49,
+    0x4E, 0x47, 0x20, 0x4F, 0x52, 0x20, 0x55, 0x53, 0x49, 0x4E, 0x47, 0x20, 0x54, 0x48, 0x45, 0x20,
+    0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x2C, 0x0A, 0x59, 0x4F, 0x55, 0x20, 0x41, 0x52,
+    0x45, 0x20, 0x41, 0x47, 0x52, 0x45, 0x45, 0x49, 0x4E, 0x47, 0x20, 0x54, 0x4F, 0x20, 0x42, 0x45,
+    0x20, 0x42, 0x4F, 0x55, 0x4E, 0x44, 0x20, 0x42, 0x59, 0x20, 0x54, 0x48, 0x49, 0x53, 0x20, 0x41,
+    0x47, 0x52, 0x45, 0x45, 0x4D, 0x45, 0x4E, 0x54, 0x2E, 0x20, 0x20, 0x49, 0x46, 0x20, 0x59, 0x4F,
+    0x55, 0x20, 0x44, 0x4F, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x41, 0x47, 0x52, 0x45, 0x45, 0x20, 0x54,
+    0x4F, 0x20, 0x41, 0x4C, 0x4C, 0x0A, 0x4F, 0x46, 0x20, 0x54, 0x48, 0x45, 0x20, 0x54, 0x45, 0x52,
+    0x4D, 0x53, 0x20, 0x4F, 0x46, 0x20, 0x54, 0x48, 0x49, 0x53, 0x20, 0x41, 0x47, 0x52, 0x45, 0x45,
+    0x4D, 0x45, 0x4E, 0x54, 0x2C, 0x20, 0x50, 0x52, 0x4F, 0x4D, 0x50, 0x54, 0x4C, 0x59, 0x20, 0x52,
+    0x45, 0x54, 0x55, 0x52, 0x4E, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x44, 0x4F, 0x20, 0x4E, 0x4F, 0x54,
+    0x20, 0x55, 0x53, 0x45, 0x20, 0x54, 0x48, 0x45, 0x20, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52,
+    0x45, 0x2E, 0x0A, 0x49, 0x46, 0x20, 0x59, 0x4F, 0x55, 0x20, 0x48, 0x41, 0x56, 0x45, 0x20, 0x50,
+    0x55, 0x52, 0x43, 0x48, 0x41, 0x53, 0x45, 0x44, 0x20, 0x54, 0x48, 0x49, 0x53, 0x20, 0x4C, 0x49,
+    0x43, 0x45, 0x4E, 0x53, 0x45, 0x20, 0x54, 0x4F, 0x20, 0x54, 0x48, 0x45, 0x20, 0x53, 0x4F, 0x46,
+    0x54, 0x57, 0x41, 0x52, 0x45, 0x2C, 0x20, 0x59, 0x4F, 0x55, 0x52, 0x20, 0x52, 0x49, 0x47, 0x48,
+    0x54, 0x20, 0x54, 0x4F, 0x20, 0x52, 0x45, 0x54, 0x55, 0x52, 0x4E, 0x20, 0x54, 0x48, 0x45, 0x0A,
+    0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x45, 0x58, 0x50, 0x49, 0x52, 0x45, 0x53,
+    0x20, 0x33, 0x30, 0x20, 0x44, 0x41, 0x59, 0x53, 0x20, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x59,
+    0x4F, 0x55, 0x52, 0x20, 0x50, 0x55, 0x52, 0x43, 0x48, 0x41, 0x53, 0x45, 0x20, 0x41, 0x4E, 0x44,
+    0x20, 0x41, 0x50, 0x50, 0x4C, 0x49, 0x45, 0x53, 0x20, 0x4F, 0x4E, 0x4C, 0x59, 0x20, 0x54, 0x4F,
+    0x20, 0x54, 0x48, 0x45, 0x20, 0x4F, 0x52, 0x49, 0x47, 0x49, 0x4E, 0x41, 0x4C, 0x0A, 0x50, 0x55,
+    0x52, 0x43, 0x48, 0x41, 0x53, 0x45, 0x52, 0x2E, 0x0A, 0x0A, 0x31, 0x2E, 0x20, 0x44, 0x65, 0x66,
+    0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22,
+    0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x6E, 0x79, 0x69,
+    0x6E, 0x67, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x73, 0x2C, 0x20,
+    0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x62, 0x75, 0x67, 0x20, 0x66, 0x69, 0x78,
+    0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x76,
+    0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x62, 0x79,
+    0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22,
+    0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x22, 0x20, 0x6D, 0x65, 0x61,
+    0x6E, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x68,
+    0x75, 0x6D, 0x61, 0x6E, 0x2D, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x42, 0x69, 0x6E, 0x61, 0x72, 0x79,
+    0x20, 0x43, 0x6F, 0x64, 0x65, 0x22, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E,
+    0x61, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x75,
+    0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78,
+    0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22,
+    0x44, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x54, 0x6F, 0x6F, 0x6C,
+    0x73, 0x22, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72,
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x64,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C,
+    0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65,
+    0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x6D, 0x69, 0x6E, 0x67, 0x20, 0x63,
+    0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65,
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x2C,
+    0x20, 0x6F, 0x72, 0x20, 0x48, 0x6F, 0x73, 0x74, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x20, 0x45, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x44, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x54, 0x6F, 0x6F, 0x6C, 0x73, 0x20, 0x61, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x27, 0x73, 0x20, 0x50, 0x53, 0x6F, 0x43, 0x20, 0x43,
+    0x72, 0x65, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2C,
+    0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x27, 0x73, 0x20, 0x41, 0x49, 0x52, 0x4F, 0x43,
+    0x20, 0x53, 0x44, 0x4B, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x27, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x6F, 0x64, 0x75, 0x73,
+    0x54, 0x6F, 0x6F, 0x6C, 0x62, 0x6F, 0x78, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+    0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65,
+    0x22, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x73, 0x20, 0x6F,
+    0x6E, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72, 0x64,
+    0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x2E, 0x0A, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x22, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x22, 0x20, 0x6D, 0x65, 0x61, 0x6E,
+    0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72,
+    0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75,
+    0x6C, 0x61, 0x72, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+    0x6E, 0x67, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61,
+    0x73, 0x20, 0x47, 0x4E, 0x55, 0x2F, 0x4C, 0x69, 0x6E, 0x75, 0x78, 0x2C, 0x20, 0x57, 0x69, 0x6E,
+    0x64, 0x6F, 0x77, 0x73, 0x2C, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x2C, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x41, 0x6E, 0x64, 0x72, 0x6F, 0x69, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x69, 0x4F, 0x53, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x48, 0x6F, 0x73, 0x74, 0x20,
+    0x41, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x6D, 0x65, 0x61,
+    0x6E, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x64,
+    0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E,
+    0x20, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72,
+    0x6F, 0x67, 0x72, 0x61, 0x6D, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2C, 0x20,
+    0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x65, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F,
+    0x64, 0x75, 0x63, 0x74, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6E, 0x66, 0x20,
+    0x46, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x68, 0x61,
+    0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 0x74, 0x75, 0x70, 0x20, 0x69, 0x6E, 0x66,
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x2E,
+    0x69, 0x6E, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x62, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53,
+    0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77,
+    0x20, 0x61, 0x20, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x57, 0x69, 0x6E,
+    0x64, 0x6F, 0x77, 0x73, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73,
+    0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65,
+    0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20,
+    0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74,
+    0x2E, 0x0A, 0x0A, 0x32, 0x2E, 0x20, 0x4C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x2E, 0x20, 0x20,
+    0x53, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+    0x65, 0x72, 0x6D, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x0A, 0x53,
+    0x65, 0x6D, 0x69, 0x63, 0x6F, 0x6E, 0x64, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x43, 0x6F, 0x72,
+    0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x22, 0x43, 0x79, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x22, 0x29, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x75, 0x70,
+    0x70, 0x6C, 0x69, 0x65, 0x72, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20,
+    0x79, 0x6F, 0x75, 0x20, 0x61, 0x0A, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73,
+    0x69, 0x76, 0x65, 0x2C, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65,
+    0x72, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x75, 0x6E,
+    0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x3A, 0x0A, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x61, 0x2E, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44,
+    0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x6F, 0x6C, 0x65, 0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x46,
+    0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x2C, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73,
+    0x2C, 0x20, 0x48, 0x6F, 0x73, 0x74, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x66, 0x20, 0x46, 0x69, 0x6C,
+    0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x79,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70,
+    0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x3B, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x62, 0x2E, 0x20, 0x28, 0x69, 0x29, 0x20, 0x69, 0x66, 0x20, 0x70, 0x72, 0x6F, 0x76,
+    0x69, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43,
+    0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x70,
+    0x79, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x53,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x20, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x61,
+    0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F,
+    0x64, 0x75, 0x63, 0x74, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x28, 0x69, 0x69, 0x29, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75,
+    0x74, 0x65, 0x20, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x62,
+    0x69, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x6F, 0x6E, 0x6C, 0x79, 0x2C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61,
+    0x6C, 0x6C, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F,
+    0x64, 0x75, 0x63, 0x74, 0x3B, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63,
+    0x2E, 0x20, 0x28, 0x69, 0x29, 0x20, 0x69, 0x66, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65,
+    0x64, 0x20, 0x69, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0x65,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x2C, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x44, 0x72, 0x69, 0x76,
+    0x65, 0x72, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61,
+    0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x20, 0x6F,
+    0x6E, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x68,
+    0x6F, 0x73, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x69, 0x69, 0x29, 0x20,
+    0x74, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E,
+    0x61, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6F, 0x6E,
+    0x6C, 0x79, 0x2C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C,
+    0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72,
+    0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x72,
+    0x69, 0x76, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x3B, 0x20, 0x61, 0x6E, 0x64, 0x0A,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x2E, 0x20, 0x28, 0x69, 0x29, 0x20, 0x69, 0x66, 0x20, 0x70,
+    0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63,
+    0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2C, 0x20, 0x74, 0x6F, 0x20,
+    0x63, 0x6F, 0x70, 0x79, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x6F, 0x73, 0x74, 0x20, 0x41, 0x70,
+    0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x48, 0x6F, 0x73, 0x74,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x70, 0x70, 0x6C,
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x67,
+    0x72, 0x61, 0x6D, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2C, 0x20, 0x6F, 0x72,
+    0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20,
+    0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x28, 0x69, 0x69, 0x29, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72,
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x48, 0x6F, 0x73, 0x74, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x61,
+    0x72, 0x79, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6F, 0x6E, 0x6C,
+    0x79, 0x2C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65,
+    0x64, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x73, 0x20, 0x61, 0x20, 0x43, 0x79,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70,
+    0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x6F, 0x73, 0x74, 0x20,
+    0x41, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72,
+    0x61, 0x6D, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2C, 0x20, 0x6F, 0x72, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x75,
+    0x6E, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x3B, 0x20, 0x61, 0x6E, 0x64,
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x2E, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x72, 0x65, 0x65,
+    0x6C, 0x79, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x61, 0x6E,
+    0x79, 0x20, 0x69, 0x6E, 0x66, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x41, 0x6E, 0x79,
+    0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66,
+    0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x74,
+    0x74, 0x65, 0x64, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41,
+    0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x6D, 0x61, 0x64, 0x65, 0x0A, 0x70, 0x75, 0x72, 0x73, 0x75, 0x61, 0x6E, 0x74, 0x20, 0x74,
+    0x6F, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20,
+    0x65, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65,
+    0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x72, 0x69, 0x65,
+    0x74, 0x61, 0x72, 0x79, 0x0A, 0x28, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x64, 0x20, 0x73, 0x6F, 0x75,
+    0x72, 0x63, 0x65, 0x29, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72,
+    0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x2C, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x65, 0x6E, 0x64,
+    0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x61, 0x67,
+    0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75,
+    0x64, 0x65, 0x2C, 0x0A, 0x61, 0x74, 0x20, 0x61, 0x20, 0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x75, 0x6D,
+    0x2C, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6C, 0x69, 0x6D,
+    0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E,
+    0x73, 0x6F, 0x72, 0x73, 0x27, 0x20, 0x6C, 0x69, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x68, 0x69, 0x62, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x0A,
+    0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x65, 0x6E, 0x67, 0x69, 0x6E, 0x65, 0x65, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77,
+    0x61, 0x72, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x73,
+    0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0A, 0x41, 0x67, 0x72,
+    0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x0A, 0x33, 0x2E, 0x20, 0x46, 0x72, 0x65, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x20, 0x20, 0x50, 0x6F, 0x72, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74,
+    0x77, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x6C, 0x69, 0x63, 0x65,
+    0x6E, 0x73, 0x65, 0x64, 0x0A, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20,
+    0x61, 0x6E, 0x64, 0x2F, 0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68,
+    0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4E, 0x55, 0x20, 0x47, 0x65, 0x6E, 0x65,
+    0x72, 0x61, 0x6C, 0x20, 0x50, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x20, 0x4C, 0x69, 0x63, 0x65, 0x6E,
+    0x73, 0x65, 0x0A, 0x6F, 0x72, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6C, 0x69, 0x63, 0x65,
+    0x6E, 0x73, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x20,
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x28, 0x22, 0x54, 0x68, 0x69, 0x72, 0x64, 0x20,
+    0x50, 0x61, 0x72, 0x74, 0x79, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x29,
+    0x2E, 0x20, 0x20, 0x54, 0x68, 0x69, 0x72, 0x64, 0x20, 0x50, 0x61, 0x72, 0x74, 0x79, 0x0A, 0x53,
+    0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x75, 0x62, 0x6A, 0x65,
+    0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x61, 0x67, 0x72,
+    0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74,
+    0x68, 0x69, 0x73, 0x0A, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x20,
+    0x49, 0x66, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x74,
+    0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x0A,
+    0x61, 0x6E, 0x79, 0x20, 0x54, 0x68, 0x69, 0x72, 0x64, 0x20, 0x50, 0x61, 0x72, 0x74, 0x79, 0x20,
+    0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65,
+    0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77,
+    0x61, 0x72, 0x65, 0x2C, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x0A, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
+    0x6F, 0x72, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x6F, 0x62, 0x74, 0x61, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x61, 0x74, 0x20, 0x6E, 0x6F, 0x0A, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x0A, 0x3C, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77,
+    0x2E, 0x69, 0x6E, 0x66, 0x69, 0x6E, 0x65, 0x6F, 0x6E, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x63, 0x6D,
+    0x73, 0x2F, 0x65, 0x6E, 0x2F, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6E, 0x2D, 0x73, 0x75, 0x70, 0x70,
+    0x6F, 0x72, 0x74, 0x2F, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2F, 0x66, 0x72, 0x65,
+    0x65, 0x2D, 0x61, 0x6E, 0x64, 0x2D, 0x6F, 0x70, 0x65, 0x6E, 0x2D, 0x73, 0x6F, 0x75, 0x72, 0x63,
+    0x65, 0x2D, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2D, 0x66, 0x6F, 0x73, 0x73, 0x2F,
+    0x3E, 0x2E, 0x0A, 0x54, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6D, 0x73, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x6E, 0x79, 0x20, 0x65,
+    0x61, 0x63, 0x68, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20,
+    0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x20, 0x54, 0x6F, 0x0A, 0x72, 0x65, 0x76,
+    0x69, 0x65, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20,
+    0x74, 0x65, 0x72, 0x6D, 0x73, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x54, 0x68, 0x69, 0x72, 0x64, 0x20, 0x50, 0x61,
+    0x72, 0x74, 0x79, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0A, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x2C, 0x20,
+    0x70, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x65, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x53,
+    0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x27, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C,
+    0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
+    0x20, 0x6F, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65,
+    0x72, 0x2E, 0x0A, 0x0A, 0x34, 0x2E, 0x20, 0x50, 0x72, 0x6F, 0x70, 0x72, 0x69, 0x65, 0x74, 0x61,
+    0x72, 0x79, 0x20, 0x52, 0x69, 0x67, 0x68, 0x74, 0x73, 0x3B, 0x20, 0x4F, 0x77, 0x6E, 0x65, 0x72,
+    0x73, 0x68, 0x69, 0x70, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77,
+    0x61, 0x72, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x0A,
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x72, 0x65, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x6F, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69,
+    0x76, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x6F, 0x66, 0x0A, 0x43,
+    0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x75,
+    0x70, 0x70, 0x6C, 0x69, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x20, 0x72, 0x65, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x73,
+    0x68, 0x69, 0x70, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63,
+    0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x61, 0x6E, 0x79, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x72, 0x65, 0x6F, 0x66, 0x2E, 0x20, 0x20, 0x53, 0x75, 0x62, 0x6A, 0x65, 0x63,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x27, 0x20, 0x6F, 0x77,
+    0x6E, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75,
+    0x6E, 0x64, 0x65, 0x72, 0x6C, 0x79, 0x69, 0x6E, 0x67, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61,
+    0x72, 0x65, 0x20, 0x28, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x53, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x29, 0x2C, 0x20, 0x79, 0x6F, 0x75, 0x20,
+    0x72, 0x65, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x79, 0x6F, 0x75, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6F, 0x64,
+    0x65, 0x2E, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20,
+    0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68,
+    0x74, 0x20, 0x6F, 0x72, 0x0A, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x63,
+    0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6E, 0x79, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x72, 0x65, 0x6F, 0x66, 0x2E, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x61, 0x67, 0x72, 0x65,
+    0x65, 0x0A, 0x74, 0x6F, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x64,
+    0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x2E, 0x20, 0x20, 0x41, 0x6E, 0x79, 0x20, 0x72, 0x65, 0x70,
+    0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x0A, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x61,
+    0x73, 0x0A, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x53,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x32, 0x20, 0x28, 0x22, 0x4C, 0x69, 0x63, 0x65, 0x6E,
+    0x73, 0x65, 0x22, 0x29, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x68, 0x69, 0x62, 0x69, 0x74,
+    0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x0A, 0x70,
+    0x65, 0x72, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x43, 0x79, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x2E, 0x20, 0x20, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x61, 0x73,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x6C, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x0A, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C,
+    0x20, 0x79, 0x6F, 0x75, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x6E, 0x6F, 0x74, 0x3A, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x28, 0x69, 0x29, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x2C, 0x20, 0x61, 0x64,
+    0x61, 0x70, 0x74, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x64,
+    0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x20,
+    0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x75, 0x70, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53,
+    0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x28, 0x69, 0x69, 0x29,
+    0x20, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61,
+    0x72, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x28, 0x69, 0x69, 0x69, 0x29, 0x20, 0x65, 0x78, 0x63, 0x65,
+    0x70, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x78, 0x70, 0x6C, 0x69, 0x63,
+    0x69, 0x74, 0x6C, 0x79, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x62,
+    0x79, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x61, 0x77, 0x20, 0x64, 0x65, 0x73, 0x70, 0x69, 0x74, 0x65,
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x2C, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2C, 0x20, 0x74, 0x72, 0x61,
+    0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20,
+    0x65, 0x6E, 0x67, 0x69, 0x6E, 0x65, 0x65, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x64, 0x69, 0x73, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74,
+    0x6F, 0x20, 0x68, 0x75, 0x6D, 0x61, 0x6E, 0x2D, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F,
+    0x72, 0x0A, 0x20, 0x20, 0x20, 0x28, 0x69, 0x76, 0x29, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x6E,
+    0x79, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x50, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x2E, 0x0A, 0x59, 0x6F, 0x75, 0x20, 0x68, 0x65,
+    0x72, 0x65, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x76, 0x65, 0x6E, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x63, 0x6C, 0x61, 0x69, 0x6D,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61,
+    0x72, 0x65, 0x2C, 0x20, 0x6F, 0x72, 0x0A, 0x64, 0x65, 0x72, 0x69, 0x76, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x6F, 0x66, 0x20,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2C, 0x20, 0x69, 0x6E, 0x66, 0x72, 0x69,
+    0x6E, 0x67, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6C, 0x6C, 0x65, 0x63,
+    0x74, 0x75, 0x61, 0x6C, 0x0A, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x79, 0x6F, 0x75, 0x0A, 0x0A,
+    0x35, 0x2E, 0x20, 0x4E, 0x6F, 0x20, 0x53, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0x20, 0x20,
+    0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6D, 0x61, 0x79, 0x2C, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x20, 0x74, 0x65, 0x63,
+    0x68, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x0A, 0x66,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E,
+    0x0A, 0x0A, 0x36, 0x2E, 0x20, 0x54, 0x65, 0x72, 0x6D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x54, 0x65,
+    0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73,
+    0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x65, 0x66,
+    0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x65,
+    0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x65, 0x69,
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x74,
+    0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67,
+    0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x74, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x74,
+    0x69, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6F, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68,
+    0x6F, 0x75, 0x74, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65, 0x2E, 0x0A, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x79, 0x6F,
+    0x75, 0x72, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74,
+    0x73, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72,
+    0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x65, 0x72, 0x6D,
+    0x69, 0x6E, 0x61, 0x74, 0x65, 0x0A, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x6C,
+    0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x69, 0x66,
+    0x20, 0x79, 0x6F, 0x75, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x6C, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x79, 0x0A, 0x70, 0x72, 0x6F,
+    0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41,
+    0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x20, 0x55, 0x70, 0x6F, 0x6E, 0x20,
+    0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x0A, 0x53, 0x6F, 0x66, 0x74,
+    0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x70, 0x6F, 0x73,
+    0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72,
+    0x6F, 0x6C, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69,
+    0x6E, 0x67, 0x20, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x73, 0x68,
+    0x61, 0x6C, 0x6C, 0x0A, 0x73, 0x75, 0x72, 0x76, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20,
+    0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x22,
+    0x46, 0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x53, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2C, 0x22, 0x0A,
+    0x22, 0x50, 0x72, 0x6F, 0x70, 0x72, 0x69, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x52, 0x69, 0x67,
+    0x68, 0x74, 0x73, 0x3B, 0x20, 0x4F, 0x77, 0x6E, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x2C, 0x22,
+    0x20, 0x22, 0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x69, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x57, 0x69, 0x74,
+    0x68, 0x20, 0x4C, 0x61, 0x77, 0x2C, 0x22, 0x20, 0x22, 0x44, 0x69, 0x73, 0x63, 0x6C, 0x61, 0x69,
+    0x6D, 0x65, 0x72, 0x2C, 0x22, 0x0A, 0x22, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x4C, 0x69, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x2C, 0x22,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x22, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x2E, 0x22, 0x0A,
+    0x0A, 0x37, 0x2E, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x69, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x57,
+    0x69, 0x74, 0x68, 0x20, 0x4C, 0x61, 0x77, 0x2E, 0x20, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x70,
+    0x61, 0x72, 0x74, 0x79, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x6C, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61,
+    0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x61, 0x77, 0x73, 0x2C, 0x0A,
+    0x72, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6C, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74, 0x73, 0x20, 0x61, 0x63, 0x74,
+    0x69, 0x76, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x57, 0x69,
+    0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x65, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62,
+    0x65, 0x20, 0x73, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x78, 0x70,
+    0x6F, 0x72, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x0A, 0x6C, 0x61, 0x77, 0x73,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6E, 0x69, 0x74, 0x65, 0x64, 0x20, 0x53,
+    0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x2E, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x20,
+    0x61, 0x67, 0x72, 0x65, 0x65, 0x20, 0x74, 0x6F, 0x0A, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x79, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x6C, 0x61, 0x77, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x61, 0x63, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x79, 0x6F, 0x75, 0x0A, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+    0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x74, 0x6F, 0x20,
+    0x6F, 0x62, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x2C, 0x20, 0x72, 0x65, 0x2D, 0x65, 0x78,
+    0x70, 0x6F, 0x72, 0x74, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x0A, 0x0A, 0x38,
+    0x2E, 0x20, 0x44, 0x69, 0x73, 0x63, 0x6C, 0x61, 0x69, 0x6D, 0x65, 0x72, 0x2E, 0x20, 0x20, 0x54,
+    0x4F, 0x20, 0x54, 0x48, 0x45, 0x20, 0x4D, 0x41, 0x58, 0x49, 0x4D, 0x55, 0x4D, 0x20, 0x45, 0x58,
+    0x54, 0x45, 0x4E, 0x54, 0x20, 0x50, 0x45, 0x52, 0x4D, 0x49, 0x54, 0x54, 0x45, 0x44, 0x20, 0x42,
+    0x59, 0x20, 0x41, 0x50, 0x50, 0x4C, 0x49, 0x43, 0x41, 0x42, 0x4C, 0x45, 0x20, 0x4C, 0x41, 0x57,
+    0x2C, 0x20, 0x43, 0x59, 0x50, 0x52, 0x45, 0x53, 0x53, 0x0A, 0x4D, 0x41, 0x4B, 0x45, 0x53, 0x20,
+    0x4E, 0x4F, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4E, 0x54, 0x59, 0x20, 0x4F, 0x46, 0x20, 0x41,
+    0x4E, 0x59, 0x20, 0x4B, 0x49, 0x4E, 0x44, 0x2C, 0x20, 0x45, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53,
+    0x20, 0x4F, 0x52, 0x20, 0x49, 0x4D, 0x50, 0x4C, 0x49, 0x45, 0x44, 0x2C, 0x20, 0x57, 0x49, 0x54,
+    0x48, 0x20, 0x52, 0x45, 0x47, 0x41, 0x52, 0x44, 0x20, 0x54, 0x4F, 0x20, 0x54, 0x48, 0x45, 0x0A,
+    0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x2C, 0x20, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44,
+    0x49, 0x4E, 0x47, 0x2C, 0x20, 0x42, 0x55, 0x54, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x4C, 0x49, 0x4D,
+    0x49, 0x54, 0x45, 0x44, 0x20, 0x54, 0x4F, 0x2C, 0x20, 0x49, 0x4E, 0x46, 0x52, 0x49, 0x4E, 0x47,
+    0x45, 0x4D, 0x45, 0x4E, 0x54, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x54, 0x48, 0x45, 0x20, 0x49, 0x4D,
+    0x50, 0x4C, 0x49, 0x45, 0x44, 0x0A, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4E, 0x54, 0x49, 0x45, 0x53,
+    0x20, 0x4F, 0x46, 0x20, 0x4D, 0x45, 0x52, 0x43, 0x48, 0x41, 0x4E, 0x54, 0x41, 0x42, 0x49, 0x4C,
+    0x49, 0x54, 0x59, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x46, 0x49, 0x54, 0x4E, 0x45, 0x53, 0x53, 0x20,
+    0x46, 0x4F, 0x52, 0x20, 0x41, 0x20, 0x50, 0x41, 0x52, 0x54, 0x49, 0x43, 0x55, 0x4C, 0x41, 0x52,
+    0x20, 0x50, 0x55, 0x52, 0x50, 0x4F, 0x53, 0x45, 0x2E, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x0A, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x69, 0x67, 0x68, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x68, 0x61,
+    0x6E, 0x67, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74,
+    0x77, 0x61, 0x72, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x6E, 0x6F, 0x74,
+    0x69, 0x63, 0x65, 0x2E, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x0A, 0x64, 0x6F, 0x65,
+    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x61, 0x6E, 0x79,
+    0x20, 0x6C, 0x69, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x61, 0x72, 0x69, 0x73, 0x69,
+    0x6E, 0x67, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70,
+    0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x75, 0x73, 0x65,
+    0x20, 0x6F, 0x66, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x72, 0x20,
+    0x61, 0x6E, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x63,
+    0x69, 0x72, 0x63, 0x75, 0x69, 0x74, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+    0x2E, 0x20, 0x20, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x72, 0x65, 0x73,
+    0x70, 0x6F, 0x6E, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53,
+    0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65,
+    0x72, 0x6C, 0x79, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x67,
+    0x72, 0x61, 0x6D, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x74, 0x65, 0x73, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x73, 0x61, 0x66, 0x65, 0x74, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E,
+    0x79, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61,
+    0x64, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61,
+    0x72, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x61, 0x6E, 0x79, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x2E, 0x20, 0x20, 0x43,
+    0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x74, 0x73, 0x20, 0x53, 0x6F,
+    0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+    0x74, 0x73, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E,
+    0x79, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x61, 0x20, 0x6D, 0x61, 0x6C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F,
+    0x72, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x72, 0x0A, 0x43, 0x79, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x20, 0x6D, 0x61, 0x79,
+    0x20, 0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x61, 0x62, 0x6C, 0x79, 0x20, 0x62, 0x65, 0x20, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6E, 0x74,
+    0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x0A, 0x64, 0x61, 0x6D, 0x61, 0x67, 0x65,
+    0x2C, 0x20, 0x69, 0x6E, 0x6A, 0x75, 0x72, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x61, 0x74,
+    0x68, 0x20, 0x28, 0x22, 0x48, 0x69, 0x67, 0x68, 0x20, 0x52, 0x69, 0x73, 0x6B, 0x20, 0x50, 0x72,
+    0x6F, 0x64, 0x75, 0x63, 0x74, 0x22, 0x29, 0x2E, 0x20, 0x20, 0x49, 0x66, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x53, 0x6F, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x72, 0x0A, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x48, 0x69,
+    0x67, 0x68, 0x20, 0x52, 0x69, 0x73, 0x6B, 0x20, 0x50, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x2C,
+    0x20, 0x79, 0x6F, 0x75, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x72, 0x69, 0x73, 0x6B, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x75, 0x73, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x0A, 0x61, 0x67, 0x72, 0x65, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x6D, 0x6E, 0x69, 0x66, 0x79, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x72,
+    0x73, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6C, 0x69,
+    0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x2E, 0x20, 0x20, 0x4E, 0x6F, 0x0A, 0x63, 0x6F, 0x6D,
+    0x70, 0x75, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x6C, 0x79, 0x20,
+    0x73, 0x65, 0x63, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x65, 0x72, 0x65, 0x66, 0x6F,
+    0x72, 0x65, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x70, 0x69, 0x74, 0x65, 0x20, 0x73, 0x65, 0x63, 0x75,
+    0x72, 0x69, 0x74, 0x79, 0x0A, 0x6D, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6D,
+    0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x43, 0x79, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+    0x74, 0x73, 0x2C, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x64, 0x6F, 0x65, 0x73,
+    0x0A, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20,
+    0x6C, 0x69, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x61, 0x72, 0x69, 0x73, 0x69, 0x6E,
+    0x67, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x73, 0x65, 0x63,
+    0x75, 0x72, 0x69, 0x74, 0x79, 0x20, 0x62, 0x72, 0x65, 0x61, 0x63, 0x68, 0x2C, 0x20, 0x73, 0x75,
+    0x63, 0x68, 0x20, 0x61, 0x73, 0x0A, 0x75, 0x6E, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A,
+    0x65, 0x64, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6F, 0x72, 0x20,
+    0x75, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x2E, 0x0A, 0x0A, 0x39, 0x2E, 0x20, 0x4C, 0x69,
+    0x6D, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x4C, 0x69, 0x61, 0x62,
+    0x69, 0x6C, 0x69, 0x74, 0x79, 0x2E, 0x20, 0x20, 0x54, 0x4F, 0x20, 0x54, 0x48, 0x45, 0x20, 0x4D,
+    0x41, 0x58, 0x49, 0x4D, 0x55, 0x4D, 0x20, 0x45, 0x58, 0x54, 0x45, 0x4E, 0x54, 0x20, 0x50, 0x45,
+    0x52, 0x4D, 0x49, 0x54, 0x54, 0x45, 0x44, 0x20, 0x42, 0x59, 0x20, 0x41, 0x50, 0x50, 0x4C, 0x49,
+    0x43, 0x41, 0x42, 0x4C, 0x45, 0x0A, 0x4C, 0x41, 0x57, 0x2C, 0x20, 0x49, 0x4E, 0x20, 0x4E, 0x4F,
+    0x20, 0x45, 0x56, 0x45, 0x4E, 0x54, 0x20, 0x57, 0x49, 0x4C, 0x4C, 0x20, 0x43, 0x59, 0x50, 0x52,
+    0x45, 0x53, 0x53, 0x20, 0x4F, 0x52, 0x20, 0x49, 0x54, 0x53, 0x20, 0x53, 0x55, 0x50, 0x50, 0x4C,
+    0x49, 0x45, 0x52, 0x53, 0x2C, 0x20, 0x52, 0x45, 0x53, 0x45, 0x4C, 0x4C, 0x45, 0x52, 0x53, 0x2C,
+    0x20, 0x4F, 0x52, 0x20, 0x44, 0x49, 0x53, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x4F, 0x52, 0x53,
+    0x20, 0x42, 0x45, 0x0A, 0x4C, 0x49, 0x41, 0x42, 0x4C, 0x45, 0x20, 0x46, 0x4F, 0x52, 0x20, 0x41,
+    0x4E, 0x59, 0x20, 0x4C, 0x4F, 0x53, 0x54, 0x20, 0x52, 0x45, 0x56, 0x45, 0x4E, 0x55, 0x45, 0x2C,
+    0x20, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x54, 0x2C, 0x20, 0x4F, 0x52, 0x20, 0x44, 0x41, 0x54, 0x41,
+    0x2C, 0x20, 0x4F, 0x52, 0x20, 0x46, 0x4F, 0x52, 0x20, 0x53, 0x50, 0x45, 0x43, 0x49, 0x41, 0x4C,
+    0x2C, 0x20, 0x49, 0x4E, 0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x2C, 0x0A, 0x43, 0x4F, 0x4E, 0x53,
+    0x45, 0x51, 0x55, 0x45, 0x4E, 0x54, 0x49, 0x41, 0x4C, 0x2C, 0x20, 0x49, 0x4E, 0x43, 0x49, 0x44,
+    0x45, 0x4E, 0x54, 0x41, 0x4C, 0x2C, 0x20, 0x4F, 0x52, 0x20, 0x50, 0x55, 0x4E, 0x49, 0x54, 0x49,
+    0x56, 0x45, 0x20, 0x44, 0x41, 0x4D, 0x41, 0x47, 0x45, 0x53, 0x20, 0x48, 0x4F, 0x57, 0x45, 0x56,
+    0x45, 0x52, 0x20, 0x43, 0x41, 0x55, 0x53, 0x45, 0x44, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x52, 0x45,
+    0x47, 0x41, 0x52, 0x44, 0x4C, 0x45, 0x53, 0x53, 0x0A, 0x4F, 0x46, 0x20, 0x54, 0x48, 0x45, 0x20,
+    0x54, 0x48, 0x45, 0x4F, 0x52, 0x59, 0x20, 0x4F, 0x46, 0x20, 0x4C, 0x49, 0x41, 0x42, 0x49, 0x4C,
+    0x49, 0x54, 0x59, 0x2C, 0x20, 0x41, 0x52, 0x49, 0x53, 0x49, 0x4E, 0x47, 0x20, 0x4F, 0x55, 0x54,
+    0x20, 0x4F, 0x46, 0x20, 0x4F, 0x52, 0x20, 0x52, 0x45, 0x4C, 0x41, 0x54, 0x45, 0x44, 0x20, 0x54,
+    0x4F, 0x20, 0x54, 0x48, 0x45, 0x20, 0x55, 0x53, 0x45, 0x20, 0x4F, 0x46, 0x20, 0x4F, 0x52, 0x0A,
+    0x49, 0x4E, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x59, 0x20, 0x54, 0x4F, 0x20, 0x55, 0x53, 0x45,
+    0x20, 0x54, 0x48, 0x45, 0x20, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x45, 0x56,
+    0x45, 0x4E, 0x20, 0x49, 0x46, 0x20, 0x43, 0x59, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x4F, 0x52,
+    0x20, 0x49, 0x54, 0x53, 0x20, 0x53, 0x55, 0x50, 0x50, 0x4C, 0x49, 0x45, 0x52, 0x53, 0x2C, 0x20,
+    0x52, 0x45, 0x53, 0x45, 0x4C, 0x4C, 0x45, 0x52, 0x53, 0x2C, 0x20, 0x4F, 0x52, 0x0A, 0x44, 0x49,
+    0x53, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x4F, 0x52, 0x53, 0x20, 0x48, 0x41, 0x56, 0x45, 0x20,
+    0x42, 0x45, 0x45, 0x4E, 0x20, 0x41, 0x44, 0x56, 0x49, 0x53, 0x45, 0x44, 0x20, 0x4F, 0x46, 0x20,
+    0x54, 0x48, 0x45, 0x20, 0x50, 0x4F, 0x53, 0x53, 0x49, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x59, 0x20,
+    0x4F, 0x46, 0x20, 0x53, 0x55, 0x43, 0x48, 0x20, 0x44, 0x41, 0x4D, 0x41, 0x47, 0x45, 0x53, 0x2E,
+    0x20, 0x20, 0x49, 0x4E, 0x20, 0x4E, 0x4F, 0x0A, 0x45, 0x56, 0x45, 0x4E, 0x54, 0x20, 0x53, 0x48,
+    0x41, 0x4C, 0x4C, 0x20, 0x43, 0x59, 0x50, 0x52, 0x45, 0x53, 0x53, 0x27, 0x20, 0x4F, 0x52, 0x20,
+    0x49, 0x54, 0x53, 0x20, 0x53, 0x55, 0x50, 0x50, 0x4C, 0x49, 0x45, 0x52, 0x53, 0x27, 0x2C, 0x20,
+    0x52, 0x45, 0x53, 0x45, 0x4C, 0x4C, 0x45, 0x52, 0x53, 0x27, 0x2C, 0x20, 0x4F, 0x52, 0x20, 0x44,
+    0x49, 0x53, 0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x4F, 0x52, 0x53, 0x27, 0x20, 0x54, 0x4F, 0x54,
+    0x41, 0x4C, 0x0A, 0x4C, 0x49, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x59, 0x20, 0x54, 0x4F, 0x20,
+    0x59, 0x4F, 0x55, 0x2C, 0x20, 0x57, 0x48, 0x45, 0x54, 0x48, 0x45, 0x52, 0x20, 0x49, 0x4E, 0x20,
+    0x43, 0x4F, 0x4E, 0x54, 0x52, 0x41, 0x43, 0x54, 0x2C, 0x20, 0x54, 0x4F, 0x52, 0x54, 0x20, 0x28,
+    0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x49, 0x4E, 0x47, 0x20, 0x4E, 0x45, 0x47, 0x4C, 0x49, 0x47,
+    0x45, 0x4E, 0x43, 0x45, 0x29, 0x2C, 0x20, 0x4F, 0x52, 0x0A, 0x4F, 0x54, 0x48, 0x45, 0x52, 0x57,
+    0x49, 0x53, 0x45, 0x2C, 0x20, 0x45, 0x58, 0x43, 0x45, 0x45, 0x44, 0x20, 0x54, 0x48, 0x45, 0x20,
+    0x47, 0x52, 0x45, 0x41, 0x54, 0x45, 0x52, 0x20, 0x4F, 0x46, 0x20, 0x55, 0x53, 0x24, 0x35, 0x30,
+    0x30, 0x20, 0x4F, 0x52, 0x20, 0x54, 0x48, 0x45, 0x20, 0x50, 0x52, 0x49, 0x43, 0x45, 0x20, 0x50,
+    0x41, 0x49, 0x44, 0x20, 0x42, 0x59, 0x20, 0x59, 0x4F, 0x55, 0x20, 0x46, 0x4F, 0x52, 0x20, 0x54,
+    0x48, 0x45, 0x0A, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x2E, 0x20, 0x20, 0x54, 0x48,
+    0x45, 0x20, 0x46, 0x4F, 0x52, 0x45, 0x47, 0x4F, 0x49, 0x4E, 0x47, 0x20, 0x4C, 0x49, 0x4D, 0x49,
+    0x54, 0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x20, 0x53, 0x48, 0x41, 0x4C, 0x4C, 0x20, 0x41, 0x50,
+    0x50, 0x4C, 0x59, 0x20, 0x45, 0x56, 0x45, 0x4E, 0x20, 0x49, 0x46, 0x20, 0x54, 0x48, 0x45, 0x20,
+    0x41, 0x42, 0x4F, 0x56, 0x45, 0x2D, 0x53, 0x54, 0x41, 0x54, 0x45, 0x44, 0x0A, 0x57, 0x41, 0x52,
+    0x52, 0x41, 0x4E, 0x54, 0x59, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x53, 0x20, 0x4F, 0x46, 0x20, 0x49,
+    0x54, 0x53, 0x20, 0x45, 0x53, 0x53, 0x45, 0x4E, 0x54, 0x49, 0x41, 0x4C, 0x20, 0x50, 0x55, 0x52,
+    0x50, 0x4F, 0x53, 0x45, 0x2E, 0x20, 0x20, 0x42, 0x45, 0x43, 0x41, 0x55, 0x53, 0x45, 0x20, 0x53,
+    0x4F, 0x4D, 0x45, 0x20, 0x53, 0x54, 0x41, 0x54, 0x45, 0x53, 0x20, 0x4F, 0x52, 0x20, 0x4A, 0x55,
+    0x52, 0x49, 0x53, 0x44, 0x49, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x0A, 0x44, 0x4F, 0x20, 0x4E,
+    0x4F, 0x54, 0x20, 0x41, 0x4C, 0x4C, 0x4F, 0x57, 0x20, 0x4C, 0x49, 0x4D, 0x49, 0x54, 0x41, 0x54,
+    0x49, 0x4F, 0x4E, 0x20, 0x4F, 0x52, 0x20, 0x45, 0x58, 0x43, 0x4C, 0x55, 0x53, 0x49, 0x4F, 0x4E,
+    0x20, 0x4F, 0x46, 0x20, 0x43, 0x4F, 0x4E, 0x53, 0x45, 0x51, 0x55, 0x45, 0x4E, 0x54, 0x49, 0x41,
+    0x4C, 0x20, 0x4F, 0x52, 0x20, 0x49, 0x4E, 0x43, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x41, 0x4C, 0x20,
+    0x44, 0x41, 0x4D, 0x41, 0x47, 0x45, 0x53, 0x2C, 0x0A, 0x41, 0x4C, 0x4C, 0x20, 0x4F, 0x52, 0x20,
+    0x50, 0x4F, 0x52, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x20, 0x4F, 0x46, 0x20, 0x54, 0x48, 0x45, 0x20,
+    0x41, 0x42, 0x4F, 0x56, 0x45, 0x20, 0x4C, 0x49, 0x4D, 0x49, 0x54, 0x41, 0x54, 0x49, 0x4F, 0x4E,
+    0x20, 0x4D, 0x41, 0x59, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x41, 0x50, 0x50, 0x4C, 0x59, 0x20, 0x54,
+    0x4F, 0x20, 0x59, 0x4F, 0x55, 0x2E, 0x0A, 0x0A, 0x31, 0x30, 0x2E, 0x20, 0x52, 0x65, 0x73, 0x74,
+    0x72, 0x69, 0x63, 0x74, 0x65, 0x64, 0x20, 0x52, 0x69, 0x67, 0x68, 0x74, 0x73, 0x2E, 0x20, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x72, 0x63, 0x69, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x75,
+    0x74, 0x65, 0x72, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x0A, 0x74, 0x65, 0x72, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x73,
+    0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x34, 0x38, 0x20, 0x43, 0x2E, 0x46,
+    0x2E, 0x52, 0x2E, 0x20, 0x32, 0x35, 0x32, 0x2E, 0x32, 0x32, 0x37, 0x2D, 0x37, 0x30, 0x31, 0x34,
+    0x28, 0x61, 0x29, 0x28, 0x31, 0x29, 0x2E, 0x20, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x62, 0x65, 0x69, 0x6E,
+    0x67, 0x0A, 0x61, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x72,
+    0x20, 0x6F, 0x6E, 0x20, 0x62, 0x65, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x55, 0x2E, 0x53, 0x2E, 0x20, 0x47, 0x6F, 0x76, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x55, 0x2E, 0x53, 0x2E, 0x20, 0x47,
+    0x6F, 0x76, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x69, 0x6D, 0x65, 0x0A,
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x75,
+    0x62, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x28, 0x61, 0x74, 0x20,
+    0x61, 0x6E, 0x79, 0x20, 0x74, 0x69, 0x65, 0x72, 0x29, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x47, 0x6F, 0x76, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x27, 0x73,
+    0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x77,
+    0x61, 0x72, 0x65, 0x20, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x6E, 0x6C,
+    0x79, 0x20, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x74,
+    0x68, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x0A, 0x31, 0x31, 0x2E, 0x20, 0x50, 0x65, 0x72, 0x73, 0x6F, 0x6E,
+    0x61, 0x6C, 0x20, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20,
+    0x20, 0x59, 0x6F, 0x75, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x20,
+    0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20,
+    0x79, 0x6F, 0x75, 0x72, 0x0A, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x49, 0x6F, 0x54,
+    0x20, 0x43, 0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x69, 0x74, 0x79, 0x20, 0x46, 0x6F, 0x72, 0x75, 0x6D,
+    0x20, 0x6F, 0x72, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x20, 0x77, 0x65, 0x62, 0x73, 0x69, 0x74, 0x65, 0x73, 0x2C, 0x0A, 0x69, 0x6E, 0x63, 0x6C,
+    0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x63, 0x74, 0x20, 0x69, 0x6E,
+    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x66, 0x6F,
+    0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20,
+    0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x0A, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x73,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6F,
+    0x6E, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74,
+    0x73, 0x20, 0x44, 0x61, 0x74, 0x61, 0x20, 0x50, 0x72, 0x69, 0x76, 0x61, 0x63, 0x79, 0x20, 0x50,
+    0x6F, 0x6C, 0x69, 0x63, 0x79, 0x0A, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x77,
+    0x77, 0x77, 0x2E, 0x69, 0x6E, 0x66, 0x69, 0x6E, 0x65, 0x6F, 0x6E, 0x2E, 0x63, 0x6F, 0x6D, 0x2F,
+    0x63, 0x6D, 0x73, 0x2F, 0x65, 0x6E, 0x2F, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x2D, 0x69, 0x6E, 0x66,
+    0x69, 0x6E, 0x65, 0x6F, 0x6E, 0x2F, 0x70, 0x72, 0x69, 0x76, 0x61, 0x63, 0x79, 0x2D, 0x70, 0x6F,
+    0x6C, 0x69, 0x63, 0x79, 0x2F, 0x29, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74,
+    0x65, 0x64, 0x0A, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x76, 0x69, 0x73, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x76,
+    0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x73, 0x20, 0x74, 0x68, 0x69, 0x72,
+    0x64, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x20, 0x73, 0x61, 0x6C, 0x65, 0x73, 0x0A, 0x72, 0x65,
+    0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x76, 0x65, 0x73, 0x2C, 0x20, 0x64,
+    0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x6F, 0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x63,
+    0x6F, 0x6E, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x61, 0x6C, 0x65, 0x73, 0x20,
+    0x61, 0x63, 0x74, 0x69, 0x76, 0x69, 0x74, 0x69, 0x65, 0x73, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x43,
+    0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x61, 0x6C, 0x65, 0x73,
+    0x2D, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x62, 0x75, 0x73, 0x69, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x70, 0x75, 0x72, 0x70,
+    0x6F, 0x73, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x31, 0x32, 0x2E, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x6C, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x69, 0x6E, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x65, 0x6E, 0x65, 0x66, 0x69, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x0A, 0x70,
+    0x61, 0x72, 0x74, 0x79, 0x27, 0x73, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72,
+    0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x73, 0x2C, 0x20, 0x70,
+    0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x6D, 0x61, 0x79, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x20,
+    0x6F, 0x72, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x0A, 0x74, 0x68, 0x69, 0x73,
+    0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x77,
+    0x68, 0x6F, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x2C,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x27, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x65, 0x6E,
+    0x74, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x0A, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x67, 0x6F, 0x76, 0x65,
+    0x72, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x72, 0x75, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x61,
+    0x6E, 0x63, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x77,
+    0x73, 0x20, 0x6F, 0x66, 0x0A, 0x74, 0x68, 0x65, 0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x43, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x2C, 0x20, 0x55, 0x6E,
+    0x69, 0x74, 0x65, 0x64, 0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x41,
+    0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x69, 0x66, 0x20, 0x70, 0x65,
+    0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x6C, 0x79, 0x0A, 0x77,
+    0x69, 0x74, 0x68, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x67, 0x69, 0x76, 0x69,
+    0x6E, 0x67, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x72, 0x69, 0x6E, 0x63, 0x69, 0x70, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x63,
+    0x6F, 0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x20, 0x6F, 0x66, 0x0A, 0x6C, 0x61, 0x77, 0x2E, 0x20,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x63, 0x6F, 0x6E,
+    0x73, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x6A,
+    0x75, 0x72, 0x69, 0x73, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x76, 0x65, 0x6E, 0x75, 0x65, 0x0A, 0x69, 0x6E, 0x2C, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x65, 0x64, 0x65, 0x72,
+    0x61, 0x6C, 0x20, 0x63, 0x6F, 0x75, 0x72, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6E,
+    0x20, 0x53, 0x61, 0x6E, 0x74, 0x61, 0x20, 0x43, 0x6C, 0x61, 0x72, 0x61, 0x20, 0x43, 0x6F, 0x75,
+    0x6E, 0x74, 0x79, 0x2C, 0x20, 0x43, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x3B,
+    0x0A, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x68, 0x6F, 0x77, 0x65, 0x76, 0x65,
+    0x72, 0x2C, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x43, 0x79, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x27, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x74, 0x6F, 0x0A, 0x62,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x65, 0x67, 0x61, 0x6C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x76, 0x65, 0x6E, 0x75, 0x65, 0x20, 0x69,
+    0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x65,
+    0x63, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x69, 0x74,
+    0x73, 0x0A, 0x69, 0x6E, 0x74, 0x65, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x20, 0x70,
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x2E, 0x20,
+    0x20, 0x4E, 0x6F, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x65,
+    0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x74, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x65,
+    0x78, 0x65, 0x72, 0x63, 0x69, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x0A, 0x65, 0x6E, 0x66, 0x6F, 0x72,
+    0x63, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x73, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+    0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x61,
+    0x63, 0x74, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x77, 0x61, 0x69, 0x76, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x73, 0x75, 0x63, 0x68, 0x0A, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x2E, 0x20, 0x20,
+    0x49, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20,
+    0x76, 0x6F, 0x69, 0x64, 0x20, 0x6F, 0x72, 0x0A, 0x75, 0x6E, 0x65, 0x6E, 0x66, 0x6F, 0x72, 0x63,
+    0x65, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69,
+    0x6E, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x69,
+    0x6E, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x0A, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x2E, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x41,
+    0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x63,
+    0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x0A, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x74, 0x69, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 0x63,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74,
+    0x20, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x72, 0x20, 0x68, 0x65, 0x72, 0x65, 0x6F, 0x66, 0x2C, 0x20,
+    0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x0A,
+    0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x61, 0x67, 0x72, 0x65,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x69, 0x63,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x6E, 0x64, 0x65,
+    0x72, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x28, 0x62, 0x6F, 0x74, 0x68,
+    0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x72, 0x61,
+    0x6C, 0x29, 0x20, 0x72, 0x65, 0x67, 0x61, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x75, 0x63,
+    0x68, 0x20, 0x73, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x72,
+    0x2E, 0x20, 0x20, 0x41, 0x6E, 0x79, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x65, 0x20, 0x74, 0x6F,
+    0x20, 0x43, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x0A, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+    0x20, 0x64, 0x65, 0x65, 0x6D, 0x65, 0x64, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x75, 0x73,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x43, 0x79, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x0A, 0x53, 0x65, 0x6D, 0x69, 0x63, 0x6F, 0x6E, 0x64, 0x75, 0x63, 0x74,
+    0x6F, 0x72, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20,
+    0x41, 0x54, 0x54, 0x4E, 0x3A, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x4C, 0x65, 0x67, 0x61,
+    0x6C, 0x20, 0x4F, 0x66, 0x66, 0x69, 0x63, 0x65, 0x72, 0x2C, 0x20, 0x31, 0x39, 0x38, 0x20, 0x43,
+    0x68, 0x61, 0x6D, 0x70, 0x69, 0x6F, 0x6E, 0x20, 0x43, 0x6F, 0x75, 0x72, 0x74, 0x2C, 0x20, 0x53,
+    0x61, 0x6E, 0x0A, 0x4A, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x43, 0x41, 0x20, 0x39, 0x35, 0x31, 0x33,
+    0x34, 0x20, 0x55, 0x53, 0x41, 0x2E, 0x0A,
+};
+
+#endif /* XIP_ZASSET_DEMO_ENABLE */
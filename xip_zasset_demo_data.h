@@ -0,0 +1,15 @@
+/* Generated by scripts/xip_compress.py - do not edit. */
+
+#ifndef XIP_ZASSET_DEMO_DATA_H
+#define XIP_ZASSET_DEMO_DATA_H
+
+#include "xip_zasset.h"
+
+#if (XIP_ZASSET_DEMO_ENABLE)
+
+extern const xip_zasset_t zasset_demo_text;
+extern const uint8_t zasset_demo_text_raw[12551];
+
+#endif /* XIP_ZASSET_DEMO_ENABLE */
+
+#endif /* XIP_ZASSET_DEMO_DATA_H */